@@ -35,7 +35,9 @@
 #
 ##########################################################################
 
+import os
 import sys
+import json
 import pathlib
 import traceback
 
@@ -111,6 +113,14 @@ class execute( Gaffer.Application ) :
 					},
 				),
 
+				IECore.BoolParameter(
+					name = "worker",
+					description = "Runs as a persistent worker process, executing batches "
+						"received on stdin until stdin is closed. This is used internally "
+						"by the LocalDispatcher, and is not intended for direct use.",
+					defaultValue = False,
+				),
+
 			]
 
 		)
@@ -123,19 +133,99 @@ class execute( Gaffer.Application ) :
 
 	def _run( self, args ) :
 
+		if args["worker"].value :
+			return self.__runWorker( args )
+
+		scriptNode = self.__loadScript( args["script"].value, args["ignoreScriptLoadErrors"].value )
+		if scriptNode is None :
+			return 1
+
+		return self.__execute(
+			scriptNode, list( args["nodes"] ),
+			self.parameters()["frames"].getFrameListValue().asList(),
+			list( args["context"] )
+		)
+
+	## Runs as a persistent worker for the LocalDispatcher. Batches are
+	# received as JSON requests on `stdin`, one per line, and the result of
+	# each is written to `stdout` following any messages output while executing
+	# it. The script and all caches are kept alive between requests, so that
+	# subsequent batches don't pay the cost of starting up again.
+	def __runWorker( self, args ) :
+
+		resultPrefix = os.environ.get( "GAFFER_EXECUTE_WORKER_RESULT_PREFIX", "gaffer execute : result" )
+
+		scriptFileName = args["script"].value
+		ignoreScriptLoadErrors = args["ignoreScriptLoadErrors"].value
+		scriptNode = self.__loadScript( scriptFileName, ignoreScriptLoadErrors )
+
+		for line in sys.stdin :
+
+			if not line.strip() :
+				continue
+
+			try :
+				request = json.loads( line )
+			except ValueError :
+				IECore.msg( IECore.Msg.Level.Error, "gaffer execute", "Invalid worker request \"%s\"" % line.strip() )
+				return 1
+
+			if request["script"] != scriptFileName or request["ignoreScriptLoadErrors"] != ignoreScriptLoadErrors :
+				if scriptNode is not None :
+					self.root()["scripts"].removeChild( scriptNode )
+				# A different script means a different job, and files read by
+				# the previous one may have been rewritten since. So we must not
+				# reuse anything cached from them.
+				self.__clearCaches()
+				scriptFileName = request["script"]
+				ignoreScriptLoadErrors = request["ignoreScriptLoadErrors"]
+				scriptNode = self.__loadScript( scriptFileName, ignoreScriptLoadErrors )
+
+			if scriptNode is not None :
+				result = self.__execute(
+					scriptNode, request["nodes"],
+					IECore.FrameList.parse( request["frames"] ).asList(),
+					request["context"]
+				)
+			else :
+				result = 1
+
+			# Flush everything output by the batch before reporting the result,
+			# so the dispatcher can attribute all messages to the right batch.
+			sys.stderr.flush()
+			sys.stdout.write( "{} {}\n".format( resultPrefix, result ) )
+			sys.stdout.flush()
+
+		return 0
+
+	def __clearCaches( self ) :
+
+		Gaffer.ValuePlug.clearCache()
+		Gaffer.ValuePlug.clearHashCache()
+		# Only relevant if a previous script has loaded GafferImage.
+		if "GafferImage" in sys.modules :
+			sys.modules["GafferImage"].OpenImageIOReader.clearFileCache()
+
+	def __loadScript( self, fileName, ignoreScriptLoadErrors ) :
+
 		scriptNode = Gaffer.ScriptNode()
-		scriptNode["fileName"].setValue( pathlib.Path( args["script"].value ).absolute() )
+		scriptNode["fileName"].setValue( pathlib.Path( fileName ).absolute() )
 		try :
-			scriptNode.load( continueOnError = args["ignoreScriptLoadErrors"].value )
+			scriptNode.load( continueOnError = ignoreScriptLoadErrors )
 		except Exception as exception :
 			IECore.msg( IECore.Msg.Level.Error, "gaffer execute : loading \"%s\"" % scriptNode["fileName"].getValue(), str( exception ) )
-			return 1
+			return None
 
 		self.root()["scripts"].addChild( scriptNode )
+		self.__errorConnections = {}
+
+		return scriptNode
+
+	def __execute( self, scriptNode, nodeNames, frames, contextArgs ) :
 
 		nodes = []
-		if len( args["nodes"] ) :
-			for nodeName in args["nodes"] :
+		if len( nodeNames ) :
+			for nodeName in nodeNames :
 				node = scriptNode.descendant( nodeName )
 				if node is None :
 					IECore.msg( IECore.Msg.Level.Error, "gaffer execute", "Node \"%s\" does not exist" % nodeName )
@@ -152,16 +242,15 @@ class execute( Gaffer.Application ) :
 				IECore.msg( IECore.Msg.Level.Error, "gaffer execute", "Script has no executable nodes" )
 				return 1
 
-		if len(args["context"]) % 2 :
+		if len( contextArgs ) % 2 :
 			IECore.msg( IECore.Msg.Level.Error, "gaffer execute", "Context parameter must have matching entry/value pairs" )
 			return 1
 
 		context = Gaffer.Context( scriptNode.context() )
-		for i in range( 0, len(args["context"]), 2 ) :
-			entry = args["context"][i].lstrip( "-" )
-			context[entry] = eval( args["context"][i+1] )
+		for i in range( 0, len( contextArgs ), 2 ) :
+			entry = contextArgs[i].lstrip( "-" )
+			context[entry] = eval( contextArgs[i+1] )
 
-		frames = self.parameters()["frames"].getFrameListValue().asList()
 		if not frames :
 			frames = [ scriptNode.context().getFrame() ]
 
@@ -171,18 +260,20 @@ class execute( Gaffer.Application ) :
 
 		with context :
 			for node in nodes :
-				node.errorSignal().connect( Gaffer.WeakMethod( self.__error ) )
+				nodeName = node.relativeName( scriptNode )
+				if nodeName not in self.__errorConnections :
+					self.__errorConnections[nodeName] = node.errorSignal().connect( Gaffer.WeakMethod( self.__error ), scoped = True )
 				try :
 					node["task"].executeSequence( frames )
 				except Exception as exception :
 					IECore.msg(
 						IECore.Msg.Level.Debug,
-						"gaffer execute : executing %s" % node.relativeName( scriptNode ),
+						"gaffer execute : executing %s" % nodeName,
 						traceback.format_exc().strip(),
 					)
 					IECore.msg(
 						IECore.Msg.Level.Error,
-						"gaffer execute : executing %s" % node.relativeName( scriptNode ),
+						"gaffer execute : executing %s" % nodeName,
 						"See previous message for details",
 					)
 					return 1
@@ -81,6 +81,13 @@ class stats( Gaffer.Application ) :
 			```
 			gaffer stats fileName.gfr -image NameOfNode -performanceMonitor
 			```
+
+			To record a timeline of all processes, for viewing in Perfetto
+			or `chrome://tracing` :
+
+			```
+			gaffer stats fileName.gfr -scene NameOfNode -traceFile trace.json
+			```
 			"""
 		)
 
@@ -204,6 +211,14 @@ class stats( Gaffer.Application ) :
 					defaultValue = 50,
 				),
 
+				IECore.IntParameter(
+					name = "maxSlowProcesses",
+					description = "The number of the slowest processes captured by the "
+						"performance monitor to list, along with the values of "
+						"their context variables.",
+					defaultValue = 10,
+				),
+
 				IECore.BoolParameter(
 					name = "contextMonitor",
 					description = "Turns on a Context monitor to provide additional "
@@ -228,6 +243,17 @@ class stats( Gaffer.Application ) :
 					extensions = "gfr",
 				),
 
+				IECore.FileNameParameter(
+					name = "traceFile",
+					description = "Records the start and finish of every process, "
+						"and writes them to the specified file in the Chrome Trace "
+						"Event format. This may be viewed using `https://ui.perfetto.dev` "
+						"or `chrome://tracing`.",
+					defaultValue = "",
+					allowEmptyString = True,
+					extensions = "json",
+				),
+
 				IECore.BoolParameter(
 					name = "vtune",
 					description = "Enables VTune instrumentation. When enabled, the VTune "
@@ -267,6 +293,15 @@ class stats( Gaffer.Application ) :
 					defaultValue = 0,
 				),
 
+				IECore.BoolParameter(
+					name = "frameInvariantHashCache",
+					description = "Shares hashes which don't depend on the frame between all "
+						"the frames being evaluated, and reports how many hashes were shared. "
+						"This is also enabled if the `GAFFER_FRAMEINVARIANT_HASHCACHE` environment "
+						"variable is set to `1`.",
+					defaultValue = False,
+				),
+
 			]
 
 		)
@@ -283,6 +318,8 @@ class stats( Gaffer.Application ) :
 			Gaffer.ValuePlug.setCacheMemoryLimit( 1024 * 1024 * args["cacheMemoryLimit"].value )
 		if args["hashCacheSizeLimit"].value :
 			Gaffer.ValuePlug.setHashCacheSizeLimit( args["hashCacheSizeLimit"].value )
+		if args["frameInvariantHashCache"].value :
+			Gaffer.ValuePlug.setFrameInvariantHashCacheEnabled( True )
 
 		self.__timers = collections.OrderedDict()
 		self.__memory = collections.OrderedDict()
@@ -292,7 +329,8 @@ class stats( Gaffer.Application ) :
 		script = Gaffer.ScriptNode()
 		script["fileName"].setValue( os.path.abspath( args["script"].value ) )
 
-		with _Timer() as loadingTimer :
+		self.__loadStatistics = Gaffer.Serialisation.LoadStatistics()
+		with _Timer() as loadingTimer, self.__loadStatistics :
 			script.load( continueOnError = True )
 		self.__timers["Loading"] = loadingTimer
 
@@ -309,7 +347,7 @@ class stats( Gaffer.Application ) :
 				)
 
 		if args["performanceMonitor"].value :
-			self.__performanceMonitor = Gaffer.PerformanceMonitor()
+			self.__performanceMonitor = Gaffer.PerformanceMonitor( maxSlowProcesses = args["maxSlowProcesses"].value )
 		else :
 			self.__performanceMonitor = None
 
@@ -324,6 +362,11 @@ class stats( Gaffer.Application ) :
 		else :
 			self.__contextMonitor = None
 
+		if args["traceFile"].value :
+			self.__traceMonitor = Gaffer.TraceMonitor()
+		else :
+			self.__traceMonitor = None
+
 		if args["vtune"].value :
 			try:
 				self.__vtuneMonitor = Gaffer.VTuneMonitor()
@@ -386,6 +429,9 @@ class stats( Gaffer.Application ) :
 
 		self.__output.close()
 
+		if self.__traceMonitor is not None :
+			self.__traceMonitor.writeChromeTrace( args["traceFile"].value )
+
 		if args["annotatedScript"].value :
 
 			if self.__performanceMonitor is not None :
@@ -507,7 +553,7 @@ class stats( Gaffer.Application ) :
 		memory = _Memory.maxRSS()
 		# We don't expect serialisation to trigger any processes that the monitors would see,
 		# but we definitely want to know if they do.
-		with self.__performanceMonitor or contextlib.nullcontext(), self.__contextMonitor or contextlib.nullcontext(), self.__vtuneMonitor or contextlib.nullcontext() :
+		with self.__performanceMonitor or contextlib.nullcontext(), self.__contextMonitor or contextlib.nullcontext(), self.__vtuneMonitor or contextlib.nullcontext(), self.__traceMonitor or contextlib.nullcontext() :
 			with _Timer() as timer :
 				script.serialise()
 
@@ -563,7 +609,7 @@ class stats( Gaffer.Application ) :
 			computeScene()
 
 		memory = _Memory.maxRSS()
-		with self.__performanceMonitor or contextlib.nullcontext(), self.__contextMonitor or contextlib.nullcontext(), self.__vtuneMonitor or contextlib.nullcontext() :
+		with self.__performanceMonitor or contextlib.nullcontext(), self.__contextMonitor or contextlib.nullcontext(), self.__vtuneMonitor or contextlib.nullcontext(), self.__traceMonitor or contextlib.nullcontext() :
 			with contextSanitiser :
 				with _Timer() as sceneTimer :
 					computeScene()
@@ -605,7 +651,7 @@ class stats( Gaffer.Application ) :
 			computeImage()
 
 		memory = _Memory.maxRSS()
-		with self.__performanceMonitor or contextlib.nullcontext(), self.__contextMonitor or contextlib.nullcontext(), self.__vtuneMonitor or contextlib.nullcontext() :
+		with self.__performanceMonitor or contextlib.nullcontext(), self.__contextMonitor or contextlib.nullcontext(), self.__vtuneMonitor or contextlib.nullcontext(), self.__traceMonitor or contextlib.nullcontext() :
 			with contextSanitiser :
 				with _Timer() as imageTimer :
 					computeImage()
@@ -641,7 +687,7 @@ class stats( Gaffer.Application ) :
 
 		memory = _Memory.maxRSS()
 		with _Timer() as taskTimer :
-			with self.__performanceMonitor or contextlib.nullcontext(), self.__contextMonitor or contextlib.nullcontext(), self.__vtuneMonitor or contextlib.nullcontext() :
+			with self.__performanceMonitor or contextlib.nullcontext(), self.__contextMonitor or contextlib.nullcontext(), self.__vtuneMonitor or contextlib.nullcontext(), self.__traceMonitor or contextlib.nullcontext() :
 				with self.__context( script, args ) as context :
 					for frame in self.__frames( script, args ) :
 						context.setFrame( frame )
@@ -692,6 +738,35 @@ class stats( Gaffer.Application ) :
 			self.__output.write( "Performance :\n\n" )
 			self.__writeItems( self.__timers.items() )
 
+			if Gaffer.ValuePlug.getFrameInvariantHashCacheEnabled() :
+				statistics = Gaffer.ValuePlug.frameInvariantHashCacheStatistics()
+				lookups = statistics.hits + statistics.misses
+				self.__output.write( "\nFrame invariant hashes :\n\n" )
+				self.__writeItems( [
+					( "Shared between frames", "{} ({:.1f}%)".format( statistics.hits, 100.0 * statistics.hits / lookups if lookups else 0.0 ) ),
+					( "Not shared", statistics.misses ),
+					( "Cached", statistics.entries ),
+				] )
+
+			# Only available for binary (`.gfrb`) scripts.
+			loadStatistics = self.__loadStatistics.entries()
+			if loadStatistics :
+				self.__output.write( "\nLoading breakdown :\n\n" )
+				self.__writeItems( [
+					(
+						typeName,
+						"{:.3f}s (native, {} operations), {:.3f}s (Python, {} fragments)".format(
+							entry["nativeTime"], entry["nativeOperations"],
+							entry["pythonTime"], entry["pythonFragments"]
+						)
+					)
+					for typeName, entry in sorted(
+						loadStatistics.items(),
+						key = lambda x : x[1]["nativeTime"] + x[1]["pythonTime"],
+						reverse = True
+					)
+				] )
+
 			if self.__performanceMonitor is not None :
 				self.__output.write(
 					"\n" + Gaffer.MonitorAlgo.formatStatistics(
@@ -700,6 +775,17 @@ class stats( Gaffer.Application ) :
 					)
 				)
 
+				distributions = Gaffer.MonitorAlgo.formatDistributions(
+					self.__performanceMonitor,
+					maxLines = args["maxLinesPerMetric"].value
+				)
+				if distributions :
+					self.__output.write( "\n" + distributions )
+
+				slowestProcesses = Gaffer.MonitorAlgo.formatSlowestProcesses( self.__performanceMonitor )
+				if slowestProcesses :
+					self.__output.write( "\n" + slowestProcesses )
+
 	def __writeContext( self, script, args ) :
 
 			if self.__contextMonitor is None :
@@ -39,10 +39,13 @@
 #include "Gaffer/ComputeNode.h"
 #include "Gaffer/NumericPlug.h"
 
+#include "boost/core/span.hpp"
 #include "boost/intrusive/avl_set.hpp"
 #include "boost/intrusive/avl_set_hook.hpp"
 #include "boost/intrusive/options.hpp"
 
+#include <mutex>
+
 namespace Gaffer
 {
 
@@ -462,6 +465,52 @@ class GAFFER_API Animation : public ComputeNode
 
 				/// Evaluate the curve at the specified time.
 				float evaluate( float time ) const;
+				/// Evaluates the curve at each of the specified times, storing the results
+				/// in `values`, which must be the same size as `times`. This is more efficient
+				/// than calling `evaluate()` for each time in turn, particularly when the
+				/// times are sorted.
+				void evaluate( boost::span<const float> times, boost::span<float> values ) const;
+
+				/// Approximation of a curve by values sampled uniformly in time, which
+				/// can be evaluated in constant time regardless of the number of keys.
+				/// Intended for dense curves which are evaluated many times, where a small
+				/// loss of precision is acceptable.
+				class GAFFER_API Baked : public IECore::RefCounted
+				{
+
+					public :
+
+						IE_CORE_DECLAREMEMBERPTR( Baked )
+
+						float startTime() const;
+						float endTime() const;
+						const std::vector<float> &samples() const;
+
+						/// Returns the value at the specified time, interpolated linearly
+						/// between the neighbouring samples. Times outside the baked range
+						/// are clamped to it.
+						float evaluate( float time ) const;
+						void evaluate( boost::span<const float> times, boost::span<float> values ) const;
+
+					private :
+
+						friend class CurvePlug;
+
+						Baked( const CurvePlug *curve, float startTime, float endTime, size_t numSamples );
+
+						float m_startTime;
+						float m_endTime;
+						double m_samplesPerUnit;
+						std::vector<float> m_samples;
+
+				};
+
+				IE_CORE_DECLAREPTR( Baked );
+
+				/// Returns a baked approximation of the curve between `startTime` and `endTime`,
+				/// using `numSamples` samples. The most recently baked curve is cached, and reused
+				/// by subsequent calls with the same arguments until the curve is next edited.
+				ConstBakedPtr baked( float startTime, float endTime, size_t numSamples ) const;
 
 				/// Output plug for evaluating the curve
 				/// over time - use this as the input to
@@ -484,6 +533,9 @@ class GAFFER_API Animation : public ComputeNode
 
 				KeyPtr insertKeyInternal( float, const float* );
 				double evaluateInternal( double, bool ) const;
+				// Must be called after every edit that affects the
+				// evaluated values of the curve.
+				void curveChanged();
 
 				struct TimeKey
 				{
@@ -497,6 +549,10 @@ class GAFFER_API Animation : public ComputeNode
 				using Keys = boost::intrusive::avl_set<Key, KeyHook, KeyOfValue>;
 				using InactiveKeys = boost::intrusive::avl_multiset< Key, KeyHook, KeyOfValue>;
 
+				// As above, but with `hiIt` being the first key with a time
+				// not less than `time`.
+				double evaluateInternal( double time, Keys::const_iterator hiIt, bool extrapolate ) const;
+
 				static ConstExtrapolatorPtr CurvePlug::* const m_extrapolators[ 2 ];
 
 				Keys m_keys;
@@ -510,6 +566,9 @@ class GAFFER_API Animation : public ComputeNode
 				CurvePlugDirectionSignal m_extrapolationChangedSignal;
 				ConstExtrapolatorPtr m_extrapolatorIn;
 				ConstExtrapolatorPtr m_extrapolatorOut;
+
+				mutable std::mutex m_bakedMutex;
+				mutable ConstBakedPtr m_baked;
 		};
 
 		/// convert enums to strings
@@ -37,6 +37,7 @@
 #pragma once
 
 #include "Gaffer/Export.h"
+#include "Gaffer/ParallelAlgo.h"
 
 #include "IECore/Canceller.h"
 
@@ -77,9 +78,11 @@ class GAFFER_API BackgroundTask : public boost::noncopyable
 		/// The `function` is passed an `IECore::Canceller` object which must
 		/// be checked periodically via `IECore::Canceller::check()`.
 		///
+		/// The task is queued in the `priority` class - see `ParallelAlgo::Priority`.
+		///
 		/// > Note : Gaffer's responsiveness to asynchronous edits is entirely
 		/// > dependent on prompt responses to cancellation requests.
-		BackgroundTask( const Plug *subject, const Function &function );
+		BackgroundTask( const Plug *subject, const Function &function, ParallelAlgo::Priority priority = ParallelAlgo::Priority::Normal );
 		/// Calls `cancelAndWait()`. This allows the lifetime of the
 		/// BackgroundTask to be used to protect access to resources
 		//  required by the background function.
@@ -48,6 +48,8 @@
 
 #include "boost/container/flat_map.hpp"
 
+#include <atomic>
+
 namespace Gaffer
 {
 
@@ -294,6 +296,13 @@ class GAFFER_API Context : public IECore::RefCounted
 
 		Context( const Context &other, CopyMode mode );
 
+		// Equivalent to `new Context( other, CopyMode::NonOwning )`, but reusing
+		// a Context previously returned to `recycleNonOwningCopy()` on this thread
+		// where possible. This avoids allocating a Context and its storage for each
+		// EditableScope.
+		static Ptr nonOwningCopy( const Context &other );
+		static void recycleNonOwningCopy( Ptr &&context );
+
 		// Type used for the value of a variable. Can refer to any type `T` for
 		// which `IECore::TypedData<T>` is available and `registerType()` has
 		// been called. Values are stored as `const void *` pointing to `T`,
@@ -357,6 +366,9 @@ class GAFFER_API Context : public IECore::RefCounted
 
 		};
 
+		// Updates `m_hash` to account for a variable changing from `oldVariableHash`
+		// to `newVariableHash`, if the hash is currently valid.
+		void updateHash( const IECore::MurmurHash &oldVariableHash, const IECore::MurmurHash &newVariableHash );
 		// Sets a variable and emits `changedSignal()` as appropriate. Does not
 		// manage ownership in any way. If ownership is required, call
 		// `internalSetWithOwner()` instead.
@@ -368,6 +380,18 @@ class GAFFER_API Context : public IECore::RefCounted
 		// Returns nullptr if variable doesn't exist.
 		const Value *internalGetIfExists( const IECore::InternedString &name ) const;
 
+		// Variable access tracking. While `g_accessTracking` is on, `variableAccessed()`
+		// is called for every variable read, with a null `name` for operations which
+		// depend on all variables, such as `hash()`. Used by ValuePlug to identify hashes
+		// which don't depend on the frame.
+		static std::atomic_bool g_accessTracking;
+		static void variableAccessed( const IECore::InternedString *name );
+		// Equivalents to `internalGetIfExists()` and `hash()`, which are not
+		// considered to be accesses. For use by ValuePlug only.
+		const Value *internalFind( const IECore::InternedString &name ) const;
+		IECore::MurmurHash hashInternal() const;
+		friend class ValuePlug;
+
 		using Map = boost::container::flat_map<IECore::InternedString, Value>;
 
 		Map m_map;
@@ -178,29 +178,44 @@ void Context::set( const IECore::InternedString &name, const T &value )
 
 }
 
+inline void Context::updateHash( const IECore::MurmurHash &oldVariableHash, const IECore::MurmurHash &newVariableHash )
+{
+	// Our hash is the sum of the variable hashes, so we can replace
+	// a single variable in constant time, without visiting the others.
+	if( m_hashValid )
+	{
+		m_hash = IECore::MurmurHash(
+			m_hash.h1() - oldVariableHash.h1() + newVariableHash.h1(),
+			m_hash.h2() - oldVariableHash.h2() + newVariableHash.h2()
+		);
+	}
+}
+
 inline void Context::internalSet( const IECore::InternedString &name, const Value &value )
 {
+	// Note : a newly inserted Value has a default hash of zero, so
+	// makes no contribution to the hash update.
+	Value &v = m_map[name];
 	if( !m_changedSignal )
 	{
 		// Fast path, typically in an EditableScope, where we
 		// expect the value to have changed and don't want the
 		// expense of checking.
-		m_map[name] = value;
-		m_hashValid = false;
+		updateHash( v.hash(), value.hash() );
+		v = value;
 	}
 	else
 	{
 		// Always assign to the value, because the caller might have updated
 		// `m_allocMap` already (removing the previous value).
-		Value &v = m_map[name];
 		const bool changed = v != value;
+		updateHash( v.hash(), value.hash() );
 		v = value;
 		if( changed )
 		{
 			// But avoid emitting `changedSignal` if the value hasn't
 			// actually changed. We want to avoid expensive re-evaluations
 			// that might otherwise be triggered in the UI.
-			m_hashValid = false;
 			(*m_changedSignal)( this, name );
 		}
 	}
@@ -234,6 +249,15 @@ inline const Context::Value &Context::internalGet( const IECore::InternedString
 }
 
 inline const Context::Value *Context::internalGetIfExists( const IECore::InternedString &name ) const
+{
+	if( g_accessTracking.load( std::memory_order_relaxed ) )
+	{
+		variableAccessed( &name );
+	}
+	return internalFind( name );
+}
+
+inline const Context::Value *Context::internalFind( const IECore::InternedString &name ) const
 {
 	Map::const_iterator it = m_map.find( name );
 	return it != m_map.end() ? &it->second : nullptr;
@@ -65,7 +65,9 @@ class GAFFER_API DependencyNode : public Node
 		/// will be affected by the specified input. It is an error to pass a compound plug
 		/// for input or to place one in outputs as computations are always performed on the
 		/// leaf level plugs only. Implementations of this method should call the base class
-		/// implementation first.
+		/// implementation first. Results are cached during dirty propagation until the
+		/// plugs of any node or their connections are next edited, so they must depend
+		/// only on that structure, and not on plug values.
 		/// \todo Make this protected, and add an accessor on the Plug class instead.
 		/// The general principle in effect elsewhere in Gaffer is that plugs provide
 		/// the public interface to the work done by nodes.
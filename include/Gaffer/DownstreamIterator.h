@@ -93,6 +93,18 @@ class DownstreamIterator : public boost::iterator_facade<DownstreamIterator, con
 			return m_stack.size() == 1 && m_stack[0].it == m_stack[0].end;
 		}
 
+		/// Appends the plugs immediately downstream of `plug` to `plugs`, in
+		/// the order they are visited by iteration. Returns false if the result
+		/// may be incomplete, because `DependencyNode::affects()` could not be
+		/// called or threw an exception.
+		static bool appendDownstreamPlugs( const Plug *plug, DependencyNode::AffectedPlugsContainer &plugs )
+		{
+			plugs.insert( plugs.end(), plug->outputs().begin(), plug->outputs().end() );
+			const bool complete = appendDependentPlugs( plug, plugs );
+			appendAncestorOutputs( plug, plugs );
+			return complete;
+		}
+
 	private :
 
 		friend class boost::iterator_core_access;
@@ -103,10 +115,8 @@ class DownstreamIterator : public boost::iterator_facade<DownstreamIterator, con
 			public :
 
 				Level( const Plug *plug )
-					:	plugs( plug->outputs().begin(), plug->outputs().end() )
 				{
-					addDependentPlugs( plug );
-					addAncestorOutputs( plug );
+					appendDownstreamPlugs( plug, plugs );
 					it = plugs.begin();
 					end = plugs.end();
 				}
@@ -133,108 +143,115 @@ class DownstreamIterator : public boost::iterator_facade<DownstreamIterator, con
 				DependencyNode::AffectedPlugsContainer::const_iterator it;
 				DependencyNode::AffectedPlugsContainer::const_iterator end;
 
-			private :
+		};
 
-				void addDependentPlugs( const Plug *plug )
-				{
-					if( !plug->children().empty() )
-					{
-						// We only call affects() for leaf level plugs. This
-						// is because ComputeNode hash/compute also only occurs
-						// for leaf plugs, and it would be too big a burden on
-						// node implementers to implement affects() to reflect
-						// child behaviour in parents.
-						return;
-					}
+		static bool appendDependentPlugs( const Plug *plug, DependencyNode::AffectedPlugsContainer &plugs )
+		{
+			if( !plug->children().empty() )
+			{
+				// We only call affects() for leaf level plugs. This
+				// is because ComputeNode hash/compute also only occurs
+				// for leaf plugs, and it would be too big a burden on
+				// node implementers to implement affects() to reflect
+				// child behaviour in parents.
+				return true;
+			}
 
-					const DependencyNode *node = IECore::runTimeCast<const DependencyNode>( plug->node() );
-					if( !node || !node->refCount() )
-					{
-						// No node, or node constructing or destructing.
-						// We can't call `DependencyNode::affects()`.
-						return;
-					}
+			const DependencyNode *node = IECore::runTimeCast<const DependencyNode>( plug->node() );
+			if( !node )
+			{
+				return true;
+			}
+			else if( !node->refCount() )
+			{
+				// Node constructing or destructing.
+				// We can't call `DependencyNode::affects()`.
+				return false;
+			}
 
-					const size_t firstDependentIndex = plugs.size();
+			const size_t firstDependentIndex = plugs.size();
+			bool complete = true;
 
-					// We don't want client code iterating the graph to
-					// be responsible for dealing with buggy Node::affects()
-					// implementations, so we catch and report any exceptions
-					// which occur.
-					try
-					{
-						node->affects( plug, plugs );
-					}
-					catch( const std::exception &e )
-					{
-						IECore::msg(
-							IECore::Msg::Error,
-							node->fullName() + "::affects()",
-							e.what()
-						);
-					}
-					catch( ... )
-					{
-						IECore::msg(
-							IECore::Msg::Error,
-							node->fullName() + "::affects()",
-							"Unknown exception"
-						);
-					}
+			// We don't want client code iterating the graph to
+			// be responsible for dealing with buggy Node::affects()
+			// implementations, so we catch and report any exceptions
+			// which occur.
+			try
+			{
+				node->affects( plug, plugs );
+			}
+			catch( const std::exception &e )
+			{
+				IECore::msg(
+					IECore::Msg::Error,
+					node->fullName() + "::affects()",
+					e.what()
+				);
+				complete = false;
+			}
+			catch( ... )
+			{
+				IECore::msg(
+					IECore::Msg::Error,
+					node->fullName() + "::affects()",
+					"Unknown exception"
+				);
+				complete = false;
+			}
 
-					// Likewise we don't want client code to be exposed to
-					// dependencies which are disallowed.
-					plugs.erase(
-						std::remove_if(
-							plugs.begin() + firstDependentIndex,
-							plugs.end(),
-							isNonLeaf
-						),
-						plugs.end()
-					);
-				}
+			// Likewise we don't want client code to be exposed to
+			// dependencies which are disallowed.
+			plugs.erase(
+				std::remove_if(
+					plugs.begin() + firstDependentIndex,
+					plugs.end(),
+					isNonLeaf
+				),
+				plugs.end()
+			);
 
-				static bool isNonLeaf( const Plug *plug )
-				{
-					if( plug->children().empty() )
-					{
-						return false;
-					}
-					const Node *node = plug->node();
-					IECore::msg(
-						IECore::Msg::Error,
-						node->fullName() + "::affects()",
-						"Non-leaf plug " + plug->relativeName( node ) + " returned by affects()"
-					);
-					return true;
-				}
+			return complete;
+		}
 
-				void addAncestorOutputs( const Plug *plug )
+		static bool isNonLeaf( const Plug *plug )
+		{
+			if( plug->children().empty() )
+			{
+				return false;
+			}
+			const Node *node = plug->node();
+			IECore::msg(
+				IECore::Msg::Error,
+				node->fullName() + "::affects()",
+				"Non-leaf plug " + plug->relativeName( node ) + " returned by affects()"
+			);
+			return true;
+		}
+
+		static void appendAncestorOutputs( const Plug *plug, DependencyNode::AffectedPlugsContainer &plugs )
+		{
+			// It is valid to connect a compound plug into
+			// a non-compound Plug, but when this is done, the
+			// "leaf level" where the plugs have no children
+			// is deeper on the source side than it is on the
+			// destination side. Since we only propagate dependencies
+			// along the leaf levels, we must account for the
+			// mismatch by finding ancestors which output to leaf
+			// level plugs, and including those destination
+			// plugs in our traversal.
+			plug = plug->parent<Plug>();
+			while( plug )
+			{
+				for( Plug::OutputContainer::const_iterator pIt = plug->outputs().begin(), eIt = plug->outputs().end(); pIt!=eIt; ++pIt )
 				{
-					// It is valid to connect a compound plug into
-					// a non-compound Plug, but when this is done, the
-					// "leaf level" where the plugs have no children
-					// is deeper on the source side than it is on the
-					// destination side. Since we only propagate dependencies
-					// along the leaf levels, we must account for the
-					// mismatch by finding ancestors which output to leaf
-					// level plugs, and including those destination
-					// plugs in our traversal.
-					plug = plug->parent<Plug>();
-					while( plug )
+					if( (*pIt)->children().empty() )
 					{
-						for( Plug::OutputContainer::const_iterator pIt = plug->outputs().begin(), eIt = plug->outputs().end(); pIt!=eIt; ++pIt )
-						{
-							if( (*pIt)->children().empty() )
-							{
-								plugs.push_back( *pIt );
-							}
-						}
-						plug = plug->parent<Plug>();
+						plugs.push_back( *pIt );
 					}
 				}
-
-		};
+				plug = plug->parent<Plug>();
+			}
+		}
 
 		using Levels = std::vector<Level>;
 		Levels m_stack;
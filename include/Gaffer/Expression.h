@@ -221,7 +221,22 @@ class GAFFER_API Expression : public ComputeNode
 
 		void plugSet( const Plug *plug );
 
+		// Python expressions which use only a simple subset of the
+		// language are translated to a native engine, so that they
+		// can be executed without acquiring the GIL. Returns null
+		// if translation isn't possible.
+		static EnginePtr translate(
+			Expression *node, const std::string &expression, const std::string &language,
+			const std::vector<ValuePlug *> &inPlugs, const std::vector<ValuePlug *> &outPlugs,
+			const std::vector<IECore::InternedString> &contextNames
+		);
+
+		std::vector<const ValuePlug *> executeInputs() const;
+
 		EnginePtr m_engine;
+		// Used in preference to `m_engine` when not null, falling
+		// back to `m_engine` for operations it doesn't support.
+		EnginePtr m_nativeEngine;
 		std::vector<IECore::InternedString> m_contextNames;
 
 		ExpressionChangedSignal m_expressionChangedSignal;
@@ -301,6 +301,7 @@ class GAFFER_API GraphComponent : public IECore::RunTimeTyped, public Signals::T
 		void addChildInternal( GraphComponentPtr child, size_t index );
 		void removeChildInternal( GraphComponentPtr child, bool emitParentChanged );
 		size_t index() const;
+		const GraphComponent *getChildInternal( const IECore::InternedString &name ) const;
 
 		struct MemberSignals;
 		MemberSignals *signals();
@@ -309,6 +310,11 @@ class GAFFER_API GraphComponent : public IECore::RunTimeTyped, public Signals::T
 		IECore::InternedString m_name;
 		GraphComponent *m_parent;
 		ChildContainer m_children;
+		// Index from name to child, only built once `m_children` exceeds
+		// a threshold size, so that lookups by name aren't linear in the
+		// number of children.
+		struct ChildIndex;
+		std::unique_ptr<ChildIndex> m_childIndex;
 
 };
 
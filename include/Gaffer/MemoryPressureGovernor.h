@@ -0,0 +1,213 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2025, Cinesite VFX Ltd. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//      * Redistributions of source code must retain the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer.
+//
+//      * Redistributions in binary form must reproduce the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer in the documentation and/or other materials provided with
+//        the distribution.
+//
+//      * Neither the name of John Haddon nor the names of
+//        any other contributors to this software may be used to endorse or
+//        promote products derived from this software without specific prior
+//        written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Gaffer/Export.h"
+
+#include "IECore/RefCounted.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <filesystem>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Gaffer
+{
+
+IE_CORE_FORWARDDECLARE( MemoryPressureGovernor )
+
+/// Adjusts the limits of Gaffer's caches in response to the memory
+/// pressure on the system. This is useful on shared machines where the
+/// memory available to a process varies as other processes come and go,
+/// so that any fixed limit either wastes memory or risks the process
+/// being killed when memory runs out.
+///
+/// The limit of each registered cache is scaled between its configured
+/// value and a minimum fraction of it, shrinking as soon as memory usage
+/// exceeds the target and growing back gradually once it falls. Any
+/// changes made to the limits while the governor is active are taken
+/// to be new configured values, and the configured values are restored
+/// when the governor is destroyed.
+class GAFFER_API MemoryPressureGovernor : public IECore::RefCounted
+{
+
+	public :
+
+		IE_CORE_DECLAREMEMBERPTR( MemoryPressureGovernor )
+
+		struct Status
+		{
+			/// Bytes used.
+			size_t used = 0;
+			/// Bytes available in total.
+			size_t limit = 0;
+		};
+
+		/// Source of memory measurements.
+		class GAFFER_API Source : public IECore::RefCounted
+		{
+
+			public :
+
+				IE_CORE_DECLAREMEMBERPTR( Source )
+
+				/// Returns false if the status could not be measured.
+				virtual bool read( Status &status ) const = 0;
+				/// Used to describe the source in messages.
+				virtual std::string description() const = 0;
+
+		};
+
+		IE_CORE_DECLAREPTR( Source )
+
+		/// Reads `memory.current` and `memory.high` (or `memory.max`)
+		/// from a cgroup v2 directory.
+		static SourcePtr cgroupSource( const std::filesystem::path &directory = "/sys/fs/cgroup" );
+		/// Reads `MemTotal` and `MemAvailable` from a file in the
+		/// format of `/proc/meminfo`.
+		static SourcePtr memInfoSource( const std::filesystem::path &file = "/proc/meminfo" );
+		/// Returns the `cgroupSource()` if the cgroup has a memory limit,
+		/// and the `memInfoSource()` otherwise.
+		static SourcePtr defaultSource();
+
+		/// The governor updates the cache limits every `interval`, using
+		/// a background thread, aiming to keep memory usage below
+		/// `targetUsage * Status::limit`. An interval of 0 disables the
+		/// background thread, so that limits are only adjusted by explicit
+		/// calls to `update()`.
+		explicit MemoryPressureGovernor(
+			const SourcePtr &source = defaultSource(),
+			float targetUsage = 0.9f,
+			float minimumScale = 0.1f,
+			std::chrono::milliseconds interval = std::chrono::milliseconds( 1000 )
+		);
+		~MemoryPressureGovernor() override;
+
+		const Source *source() const;
+		float targetUsage() const;
+		float minimumScale() const;
+		std::chrono::milliseconds interval() const;
+
+		/// Measures the memory usage and adjusts the cache limits
+		/// accordingly, returning the scale applied to them.
+		float update();
+		/// Returns the scale most recently applied to the cache limits.
+		float scale() const;
+
+		/// Sets a governor to remain active for the lifetime of the
+		/// application, replacing any previous one. Passing null
+		/// deactivates the current governor.
+		static void setInstance( const MemoryPressureGovernorPtr &governor );
+		static MemoryPressureGovernorPtr getInstance();
+
+		/// Cache registry
+		/// ==============
+		///
+		/// Caches are registered by the modules that own them, and are
+		/// picked up by any active governor on its next update. Limits
+		/// may be in any unit, but `memoryUsage` must return bytes, and
+		/// should only be provided if `getLimit()` is also in bytes.
+		/// The ValuePlug compute and hash caches are registered
+		/// automatically.
+		struct Cache
+		{
+			std::function<size_t ()> getLimit;
+			std::function<void ( size_t )> setLimit;
+			std::function<size_t ()> memoryUsage;
+		};
+
+		static void registerCache( const std::string &name, const Cache &cache );
+		static std::vector<std::string> registeredCaches();
+
+		/// Convenience class to allow static registrations of caches.
+		/// e.g. `static CacheRegistration g_registration( "Name", cache )`.
+		struct CacheRegistration
+		{
+			CacheRegistration( const std::string &name, const Cache &cache )
+			{
+				registerCache( name, cache );
+			}
+		};
+
+	protected :
+
+		/// Stops the background thread, waiting for any update in progress
+		/// to complete. This is called by the destructor, but may be called
+		/// earlier by derived classes that need to control the circumstances
+		/// of the wait.
+		void stopUpdates();
+
+	private :
+
+		struct GovernedCache
+		{
+			std::string name;
+			Cache cache;
+			// Limit configured by the user, the limit we last
+			// requested in its place, and the limit the cache
+			// reported after our request. The latter may differ
+			// due to rounding by the cache.
+			size_t configuredLimit;
+			size_t requestedLimit;
+			size_t appliedLimit;
+		};
+
+		void applyScale( float scale );
+
+		const SourcePtr m_source;
+		const float m_targetUsage;
+		const float m_minimumScale;
+		const std::chrono::milliseconds m_interval;
+
+		// Protects everything below.
+		mutable std::mutex m_mutex;
+		std::vector<GovernedCache> m_caches;
+		float m_scale;
+		bool m_readFailed;
+
+		std::mutex m_stopMutex;
+		std::condition_variable m_stopCondition;
+		bool m_stop;
+		std::thread m_thread;
+
+};
+
+} // namespace Gaffer
@@ -46,6 +46,7 @@ namespace Gaffer
 class ContextMonitor;
 class Node;
 class PerformanceMonitor;
+class SamplingMonitor;
 
 namespace MonitorAlgo
 {
@@ -68,11 +69,22 @@ enum PerformanceMetric
 
 GAFFER_API std::string formatStatistics( const PerformanceMonitor &monitor, size_t maxLinesPerMetric = 50 );
 GAFFER_API std::string formatStatistics( const PerformanceMonitor &monitor, PerformanceMetric metric, size_t maxLines = 50 );
+/// Formats the 50th, 95th and 99th percentiles and maximum of the hash and
+/// compute durations for the plugs with the slowest 99th percentile.
+GAFFER_API std::string formatDistributions( const PerformanceMonitor &monitor, size_t maxLines = 50 );
+/// Formats the processes returned by `monitor.slowestProcesses()`, including
+/// the values of the variables in their contexts.
+GAFFER_API std::string formatSlowestProcesses( const PerformanceMonitor &monitor );
 
 GAFFER_API void annotate( Node &root, const PerformanceMonitor &monitor, bool persistent = true );
 GAFFER_API void annotate( Node &root, const PerformanceMonitor &monitor, PerformanceMetric metric, bool persistent = true );
 GAFFER_API void annotate( Node &root, const ContextMonitor &monitor, bool persistent = true );
+/// Annotates nodes with the time attributed to them by sampling. Only
+/// exclusive samples are used, so that time is not double counted between
+/// nodes that call one another.
+GAFFER_API void annotate( Node &root, const SamplingMonitor &monitor, bool persistent = true );
 
+/// Removes annotations made using PerformanceMonitor and SamplingMonitor.
 GAFFER_API void removePerformanceAnnotations( Node &root );
 GAFFER_API void removeContextAnnotations( Node &root );
 
@@ -75,6 +75,49 @@ GAFFER_API void popUIThreadCallHandler();
 /// otherwise.
 GAFFER_API bool canCallOnUIThread();
 
+/// Priority classes
+/// ================
+///
+/// Background work is divided into classes, so that work the user is
+/// waiting to see, such as Viewer updates, doesn't have to queue behind
+/// work they are not, such as saving images or updating hierarchies.
+/// By default all classes share the current task arena, and work is run
+/// in the order it was queued. When a class is given a thread budget, it
+/// runs in its own task arena, limited to that number of threads, leaving
+/// the remainder free for the other classes.
+enum class Priority
+{
+	Interactive,
+	Normal,
+	Background
+};
+
+/// Limits the class to `numThreads` threads. Passing 0 removes the limit,
+/// returning the class to the current task arena.
+GAFFER_API void setThreadBudget( Priority priority, size_t numThreads );
+GAFFER_API size_t getThreadBudget( Priority priority );
+
+/// Runs `function` asynchronously on a thread belonging to the class. The
+/// function must not throw.
+using PriorityFunction = std::function<void ()>;
+GAFFER_API void enqueue( Priority priority, const PriorityFunction &function );
+/// Runs `function` on the calling thread, within the task arena for the class,
+/// so that any parallel work it launches is limited to the class budget.
+GAFFER_API void execute( Priority priority, const PriorityFunction &function );
+
+/// Statistics measuring the time between work being queued and
+/// it starting to run. Durations are measured in seconds.
+struct QueueStatistics
+{
+	size_t numTasks = 0;
+	size_t numPending = 0;
+	double totalLatency = 0;
+	double maxLatency = 0;
+};
+
+GAFFER_API QueueStatistics queueStatistics( Priority priority );
+GAFFER_API void resetQueueStatistics();
+
 /// Runs the specified function asynchronously on a background thread,
 /// using a copy of the current Context from the calling thread. This
 /// context contains an `IECore::Canceller` controlled by the returned
@@ -82,7 +125,39 @@ GAFFER_API bool canCallOnUIThread();
 /// explicitly. Implicit cancellation is also performed using the `subject`
 /// argument : see the `BackgroundTask` documentation for details.
 using BackgroundFunction = std::function<void ()>;
-GAFFER_API std::unique_ptr<BackgroundTask> callOnBackgroundThread( const Plug *subject, BackgroundFunction function );
+GAFFER_API std::unique_ptr<BackgroundTask> callOnBackgroundThread( const Plug *subject, BackgroundFunction function, Priority priority = Priority::Normal );
+
+/// NUMA
+/// ====
+///
+/// On machines with several NUMA nodes, memory is faster to access from the
+/// CPUs of the node it was allocated on. When NUMA support is enabled,
+/// `ImageAlgo::parallelProcessTiles()` and `SceneAlgo::parallelProcessLocations()`
+/// distribute their work between per-node task arenas, whose worker threads
+/// are bound to the CPUs of their node. Each tile or location is assigned to
+/// a node deterministically, so it is processed on the same node each time,
+/// and the results it caches are allocated where they will be read from.
+///
+/// NUMA support is disabled by default. It may be enabled using `setNUMANodes()`
+/// or the `GAFFER_NUMA_NODES` environment variable, which accepts the same values.
+
+/// Passing 0 uses the hardware topology, and any other value emulates that
+/// number of nodes by dividing the available CPUs between them, in the manner
+/// of the kernel's `numa=fake` option. Passing 1 disables NUMA support.
+GAFFER_API void setNUMANodes( size_t numNodes );
+/// Returns the number of nodes that work is distributed between, or 1
+/// if NUMA support is disabled.
+GAFFER_API size_t getNUMANodes();
+/// Returns the node whose task arena the current thread is running in,
+/// or -1 if it is not in a NUMA arena.
+GAFFER_API int currentNUMANode();
+/// Calls `f( node, numNodes )` concurrently for every node, each within the
+/// task arena for that node, and waits for all calls to complete. Exceptions
+/// are rethrown once all calls have completed. If NUMA support is disabled,
+/// or this is called from a TBB worker thread or during a compute, then
+/// `f( 0, 1 )` is called on the current thread.
+using NUMAFunction = std::function<void ( size_t node, size_t numNodes )>;
+GAFFER_API void parallelForEachNUMANode( const NUMAFunction &f );
 
 } // namespace ParallelAlgo
 
@@ -36,6 +36,7 @@
 
 #pragma once
 
+#include "Gaffer/Context.h"
 #include "Gaffer/Monitor.h"
 
 #include "IECore/RefCounted.h"
@@ -46,6 +47,7 @@
 #include "tbb/enumerable_thread_specific.h"
 
 #include <stack>
+#include <vector>
 
 namespace Gaffer
 {
@@ -59,11 +61,54 @@ class GAFFER_API PerformanceMonitor : public Monitor
 
 	public :
 
-		PerformanceMonitor();
+		/// If `maxSlowProcesses` is non-zero, the contexts of that
+		/// many of the slowest processes are recorded, and are available
+		/// via `slowestProcesses()`.
+		PerformanceMonitor( size_t maxSlowProcesses = 0 );
 		~PerformanceMonitor() override;
 
 		IE_CORE_DECLAREMEMBERPTR( PerformanceMonitor )
 
+		/// Records the distribution of process durations. Durations
+		/// are counted in logarithmically spaced buckets, giving a
+		/// relative precision of 1/8th of an octave, and using memory
+		/// independent of the number of samples.
+		class GAFFER_API Histogram
+		{
+
+			public :
+
+				Histogram();
+
+				void addSample( boost::chrono::nanoseconds duration );
+
+				/// Returns the number of samples.
+				size_t count() const;
+				/// Returns the exact maximum duration.
+				boost::chrono::nanoseconds max() const;
+				/// Returns an approximation of the specified percentile,
+				/// where `p` is in the range [0, 100].
+				boost::chrono::nanoseconds percentile( float p ) const;
+
+				Histogram & operator += ( const Histogram &rhs );
+
+				bool operator == ( const Histogram &rhs ) const;
+				bool operator != ( const Histogram &rhs ) const;
+
+			private :
+
+				static size_t bucketIndex( boost::chrono::nanoseconds duration );
+				static boost::chrono::nanoseconds bucketMidpoint( size_t index );
+
+				// Counts for the buckets in the range
+				// `[m_firstBucket, m_firstBucket + m_counts.size())`.
+				size_t m_firstBucket;
+				std::vector<size_t> m_counts;
+				size_t m_count;
+				boost::chrono::nanoseconds m_max;
+
+		};
+
 		struct GAFFER_API Statistics
 		{
 
@@ -78,6 +123,11 @@ class GAFFER_API PerformanceMonitor : public Monitor
 			size_t computeCount;
 			boost::chrono::nanoseconds hashDuration;
 			boost::chrono::nanoseconds computeDuration;
+			/// Distributions of the durations of individual processes.
+			/// As with `hashDuration` and `computeDuration`, these
+			/// exclude time spent in upstream processes.
+			Histogram hashHistogram;
+			Histogram computeHistogram;
 
 			Statistics & operator += ( const Statistics &rhs );
 
@@ -92,6 +142,20 @@ class GAFFER_API PerformanceMonitor : public Monitor
 		const Statistics &plugStatistics( const Plug *plug ) const;
 		const Statistics &combinedStatistics() const;
 
+		struct GAFFER_API SlowProcess
+		{
+			ConstPlugPtr plug;
+			IECore::InternedString type;
+			ConstContextPtr context;
+			boost::chrono::nanoseconds duration;
+		};
+
+		using SlowProcesses = std::vector<SlowProcess>;
+
+		size_t maxSlowProcesses() const;
+		/// Returns the slowest processes, sorted in order of decreasing
+		/// duration.
+		const SlowProcesses &slowestProcesses() const;
 
 	protected :
 
@@ -109,10 +173,21 @@ class GAFFER_API PerformanceMonitor : public Monitor
 			// Stack of durations pointing into the statistics map.
 			// The top of the stack is the duration we're billing the
 			// current chunk of time to.
-			using DurationStack = std::stack<boost::chrono::nanoseconds *>;
+			struct StackEntry
+			{
+				boost::chrono::nanoseconds *duration;
+				Histogram *histogram;
+				// Time billed to this process alone.
+				boost::chrono::nanoseconds processDuration;
+			};
+			using DurationStack = std::stack<StackEntry>;
 			DurationStack durationStack;
 			// The last time measurement we made.
 			boost::chrono::high_resolution_clock::time_point then;
+			// Min-heap of the slowest processes seen by this thread,
+			// and the duration a process must exceed to be added.
+			SlowProcesses slowestProcesses;
+			boost::chrono::nanoseconds slowThreshold = boost::chrono::nanoseconds( 0 );
 		};
 
 		tbb::enumerable_thread_specific<ThreadData, tbb::cache_aligned_allocator<ThreadData>, tbb::ets_key_per_instance> m_threadData;
@@ -121,6 +196,8 @@ class GAFFER_API PerformanceMonitor : public Monitor
 		void collate() const;
 		mutable StatisticsMap m_statistics;
 		mutable Statistics m_combinedStatistics;
+		const size_t m_maxSlowProcesses;
+		mutable SlowProcesses m_slowestProcesses;
 
 };
 
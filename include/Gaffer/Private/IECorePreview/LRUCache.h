@@ -40,6 +40,7 @@
 #include "boost/noncopyable.hpp"
 #include "boost/variant.hpp"
 
+#include <chrono>
 #include <optional>
 
 namespace IECorePreview
@@ -61,6 +62,15 @@ class Serial;
 template<typename LRUCache>
 class Parallel;
 
+/// Threadsafe, `get()` blocks if another thread is already
+/// computing the value. Equivalent to Parallel, but with
+/// independent per-bin eviction, for reduced contention when
+/// the cache is accessed by many threads at once. Key type must
+/// have a `hash_value` implementation as described in the boost
+/// documentation.
+template<typename LRUCache>
+class Sharded;
+
 /// Threadsafe, `get()` collaborates on TBB tasks if another
 /// thread is already computing the value. Key type must have
 /// a `hash_value` implementation as described in the boost
@@ -73,6 +83,17 @@ class Parallel;
 template<typename LRUCache>
 class TaskParallel;
 
+/// Threadsafe, `get()` blocks if another thread is already
+/// computing the value. Rather than evicting purely by recency,
+/// this uses a sampled approximation of the GreedyDual-Size
+/// algorithm, preferentially retaining items which took a long
+/// time to compute relative to their cost. Items with equal
+/// compute time per unit cost are evicted in approximately
+/// least-recently-used order. Key type must have a `hash_value`
+/// implementation as described in the boost documentation.
+template<typename LRUCache>
+class GreedyDual;
+
 } // namespace LRUCachePolicy
 
 /// A mapping from keys to values, where values are computed from keys using a user
@@ -129,15 +150,39 @@ class LRUCache : private boost::noncopyable
 		/// Returns true for success and false on failure - failure can occur
 		/// if the cost exceeds the maximum cost for the cache. Note that even
 		/// when true is returned, the item may be removed from the cache by a
-		/// subsequent (or concurrent) operation.
-		bool set( const Key &key, const Value &value, Cost cost );
+		/// subsequent (or concurrent) operation. The optional `computeTime`
+		/// specifies the time in seconds taken to compute the value, and is
+		/// used by policies which weight eviction by the cost of recomputation.
+		/// When values are computed by `get()`, the compute time is measured
+		/// automatically.
+		bool set( const Key &key, const Value &value, Cost cost, float computeTime = 0.0f );
 		/// As above, but only if the item is not cached already. This avoids
 		/// calling a potentially expensive cost function in the case that the
 		/// item is cached already.
 		/// \todo Ideally we wouldn't need the cost calculation to be duplicated
 		/// between CostFunction and GetterFunction.
 		template<typename CostFunction>
-		bool setIfUncached( const Key &key, const Value &value, CostFunction &&costFunction );
+		bool setIfUncached( const Key &key, const Value &value, CostFunction &&costFunction, float computeTime = 0.0f );
+
+		/// Measures the time taken to compute a value, for passing as the
+		/// `computeTime` argument to `set()` and `setIfUncached()`. The clock
+		/// is only read if the policy makes use of the compute time, so
+		/// callers on hot paths needn't pay for timing that has no effect.
+		class ComputeTimer
+		{
+
+			public :
+
+				ComputeTimer();
+				/// Returns the time in seconds since construction, or 0
+				/// if the policy doesn't use it.
+				float elapsed() const;
+
+			private :
+
+				std::chrono::steady_clock::time_point m_startTime;
+
+		};
 
 		/// Returns true if the object is in the cache. Note that the
 		/// return value may be invalidated immediately by operations performed
@@ -198,6 +243,7 @@ class LRUCache : private boost::noncopyable
 
 			State state;
 			Cost cost; // the cost for this item
+			float computeTime; // the time taken to compute the item, in seconds
 
 			Status status() const;
 
@@ -215,7 +261,7 @@ class LRUCache : private boost::noncopyable
 
 		// Updates the cached value and updates the current
 		// total cost.
-		bool setInternal( const Key &key, CacheEntry &cacheEntry, const Value &value, Cost cost );
+		bool setInternal( const Key &key, CacheEntry &cacheEntry, const Value &value, Cost cost, float computeTime );
 
 		// Removes any cached value and updates the current total
 		// cost.
@@ -50,6 +50,7 @@
 #include "tbb/spin_rw_mutex.h"
 
 #include <cassert>
+#include <chrono>
 #include <iostream>
 #include <tuple>
 #include <vector>
@@ -96,6 +97,9 @@ class Serial
 		using CacheEntry = typename LRUCache::CacheEntry;
 		using Key = typename LRUCache::KeyType;
 
+		// Whether eviction takes account of `CacheEntry::computeTime`.
+		static constexpr bool usesComputeTime = false;
+
 		struct Item
 		{
 			Item( const Key &key )
@@ -298,6 +302,8 @@ class Parallel
 
 		using CacheEntry = typename LRUCache::CacheEntry;
 		using Key = typename LRUCache::KeyType;
+
+		static constexpr bool usesComputeTime = false;
 		using AtomicCost = std::atomic<typename LRUCache::Cost>;
 
 		struct Item
@@ -621,6 +627,281 @@ class Parallel
 };
 
 
+// Variant of the Parallel policy intended for machines with many cores.
+// Parallel uses a single CLOCK hand shared by all bins, which must sweep
+// every bin in turn, and every cache hit writes to the `recentlyUsed`
+// flag even when it is already set. Here each bin is a self-contained
+// shard with its own CLOCK hand, bins are padded to avoid false sharing,
+// and hits only write to the item when its flag needs setting.
+template<typename LRUCache>
+class Sharded
+{
+
+	public :
+
+		using CacheEntry = typename LRUCache::CacheEntry;
+		using Key = typename LRUCache::KeyType;
+
+		static constexpr bool usesComputeTime = false;
+		using AtomicCost = std::atomic<typename LRUCache::Cost>;
+
+		// Number of bins per hardware thread.
+		static constexpr size_t binsPerThread = 8;
+
+		struct Item
+		{
+			Item() : recentlyUsed() {}
+			Item( const Key &key ) : key( key ), recentlyUsed() {}
+			Item( const Item &other ) : key( other.key ), cacheEntry( other.cacheEntry ), recentlyUsed() {}
+			Key key;
+			mutable CacheEntry cacheEntry;
+			// Mutex to protect cacheEntry.
+			using Mutex = tbb::spin_rw_mutex;
+			mutable Mutex mutex;
+			// Flag used in second-chance algorithm.
+			mutable std::atomic_bool recentlyUsed;
+		};
+
+		using Map = boost::multi_index::multi_index_container<
+			Item,
+			boost::multi_index::indexed_by<
+				boost::multi_index::hashed_unique<
+					boost::multi_index::member<Item, Key, &Item::key>
+				>
+			>
+		>;
+
+		using MapIterator = typename Map::iterator;
+
+		// Aligned so that threads locking neighbouring bins
+		// do not contend for the same cache line.
+		struct alignas( 64 ) Bin
+		{
+			Bin() : popIterator( map.end() ) {}
+			Bin( const Bin &other ) : map( other.map ), popIterator( map.end() ) {}
+			Bin &operator = ( const Bin &other ) { map = other.map; popIterator = map.end(); return *this; }
+			Map map;
+			using Mutex = tbb::spin_rw_mutex;
+			Mutex mutex;
+			// CLOCK hand for this bin, protected by
+			// a write lock on `mutex`.
+			MapIterator popIterator;
+		};
+
+		using Bins = std::vector<Bin>;
+
+		Sharded()
+			:	m_popBinIndex( 0 )
+		{
+			// Use more bins than threads, to reduce the
+			// likelihood of two threads needing the same one.
+			m_bins.resize( std::thread::hardware_concurrency() * binsPerThread );
+			currentCost = 0;
+		}
+
+		struct Handle : private boost::noncopyable
+		{
+
+			Handle()
+				:	m_item( nullptr ), m_writable( false )
+			{
+			}
+
+			~Handle()
+			{
+			}
+
+			const CacheEntry &readable()
+			{
+				return m_item->cacheEntry;
+			}
+
+			CacheEntry &writable()
+			{
+				assert( m_writable );
+				return m_item->cacheEntry;
+			}
+
+			bool isWritable() const
+			{
+				return m_writable;
+			}
+
+			template<typename F>
+			void execute( F &&f )
+			{
+				f();
+			}
+
+			void release()
+			{
+				if( m_item )
+				{
+					m_itemLock.release();
+					m_item = nullptr;
+				}
+			}
+
+			private :
+
+				// See `Parallel::Handle::acquire()` for a description
+				// of the locking strategy, which is identical.
+				bool acquire( Bin &bin, const Key &key, AcquireMode mode, const IECore::Canceller *canceller )
+				{
+					assert( !m_item );
+
+					typename Bin::Mutex::scoped_lock binLock;
+					while( true )
+					{
+						binLock.acquire( bin.mutex, /* write = */ false );
+						MapIterator it = bin.map.find( key );
+						bool inserted = false;
+						if( it == bin.map.end() )
+						{
+							if( mode != Insert && mode != InsertWritable )
+							{
+								return false;
+							}
+							binLock.upgrade_to_writer();
+							std::tie<MapIterator, bool>( it, inserted ) = bin.map.insert( Item( key ) );
+						}
+
+						m_writable = inserted || mode == FindWritable || mode == InsertWritable;
+
+						if( m_itemLock.try_acquire( it->mutex, /* write = */ m_writable ) )
+						{
+							if( !m_writable && mode == Insert && it->cacheEntry.status() == LRUCache::Uncached )
+							{
+								mode = InsertWritable;
+								m_itemLock.release();
+								binLock.release();
+								continue;
+							}
+							m_item = &*it;
+							return true;
+						}
+						else
+						{
+							binLock.release();
+						}
+						IECore::Canceller::check( canceller );
+					}
+				}
+
+				friend class Sharded;
+
+				const Item *m_item;
+				typename Item::Mutex::scoped_lock m_itemLock;
+				bool m_writable;
+
+		};
+
+		bool acquire( const Key &key, Handle &handle, AcquireMode mode, const IECore::Canceller *canceller )
+		{
+			return handle.acquire( bin( key ), key, mode, canceller );
+		}
+
+		void push( Handle &handle )
+		{
+			// Only write if necessary, so that threads repeatedly
+			// hitting the same item share its cache line rather
+			// than fighting over ownership of it.
+			if( !handle.m_item->recentlyUsed.load( std::memory_order_relaxed ) )
+			{
+				handle.m_item->recentlyUsed.store( true, std::memory_order_release );
+			}
+		}
+
+		bool pop( Key &key, CacheEntry &cacheEntry )
+		{
+			// As for the Parallel policy, it is sufficient for only
+			// one thread to be limiting cost at any given time, and
+			// letting others evict concurrently just empties the cache
+			// faster than necessary. Each call starts at a different
+			// bin, so that eviction is spread evenly across them. We
+			// give up after visiting every bin once without finding
+			// anything to pop.
+			PopMutex::scoped_lock lock;
+			if( !lock.try_acquire( m_popMutex ) )
+			{
+				return false;
+			}
+
+			const size_t startIndex = m_popBinIndex++;
+			for( size_t i = 0; i < m_bins.size(); ++i )
+			{
+				Bin &bin = m_bins[( startIndex + i ) % m_bins.size()];
+				if( popFromBin( bin, key, cacheEntry ) )
+				{
+					return true;
+				}
+			}
+			return false;
+		}
+
+		AtomicCost currentCost;
+
+	private :
+
+		bool popFromBin( Bin &bin, Key &key, CacheEntry &cacheEntry )
+		{
+			typename Bin::Mutex::scoped_lock binLock( bin.mutex );
+
+			// Two full sweeps are sufficient to find an item,
+			// unless other threads are using all of them.
+			const size_t maxSteps = bin.map.size() * 2;
+			typename Item::Mutex::scoped_lock itemLock;
+			for( size_t step = 0; step < maxSteps; ++step, ++bin.popIterator )
+			{
+				if( bin.popIterator == bin.map.end() )
+				{
+					bin.popIterator = bin.map.begin();
+				}
+
+				if( !itemLock.try_acquire( bin.popIterator->mutex ) )
+				{
+					// Some other thread is busy with this item, so
+					// we consider it to be recently used.
+					continue;
+				}
+
+				if( bin.popIterator->recentlyUsed.load( std::memory_order_acquire ) )
+				{
+					// Give it a second chance.
+					bin.popIterator->recentlyUsed.store( false, std::memory_order_release );
+					itemLock.release();
+					continue;
+				}
+
+				key = bin.popIterator->key;
+				cacheEntry = bin.popIterator->cacheEntry;
+				// We must release the lock before erasing the item, but
+				// no other thread can acquire it because we hold the bin
+				// lock.
+				itemLock.release();
+				bin.popIterator = bin.map.erase( bin.popIterator );
+				return true;
+			}
+
+			return false;
+		}
+
+		Bins m_bins;
+
+		Bin &bin( const Key &key )
+		{
+			// Note : `testLRUCacheUncacheableItem()` requires keys to share
+			// a bin, and needs updating if the indexing strategy changes.
+			size_t binIndex = boost::hash<Key>()( key ) % m_bins.size();
+			return m_bins[binIndex];
+		};
+
+		using PopMutex = tbb::spin_mutex;
+		PopMutex m_popMutex;
+		size_t m_popBinIndex;
+
+};
+
 /// Used to determine if `GetterFunction( key )` will spawn tasks.
 /// If it is specialised to return false for certain keys, then
 /// some significant TBB task sharing overhead is avoided.
@@ -644,6 +925,8 @@ class TaskParallel
 
 		using CacheEntry = typename LRUCache::CacheEntry;
 		using Key = typename LRUCache::KeyType;
+
+		static constexpr bool usesComputeTime = false;
 		using AtomicCost = std::atomic<typename LRUCache::Cost>;
 
 		struct Item
@@ -1005,6 +1288,321 @@ class TaskParallel
 
 };
 
+// Uses the same binned map as the Parallel policy, but replaces the
+// second-chance algorithm with a sampled approximation of GreedyDual-Size.
+// Each item is assigned a priority `H = L + computeTime / cost` when it is
+// used, where `L` is an "inflation" value that rises to the priority of
+// each evicted item. Items which are expensive to recompute per unit of
+// cost therefore survive longer, while items which are not used again
+// eventually fall below the inflation value and are evicted. Rather than
+// maintaining a priority queue, which would require serial updates on
+// every access, `pop()` samples a handful of items from a bin and evicts
+// the one with the lowest priority, breaking ties by recency.
+template<typename LRUCache>
+class GreedyDual
+{
+
+	public :
+
+		using CacheEntry = typename LRUCache::CacheEntry;
+		using Key = typename LRUCache::KeyType;
+
+		static constexpr bool usesComputeTime = true;
+		using AtomicCost = std::atomic<typename LRUCache::Cost>;
+
+		struct Item
+		{
+			Item() : priority( 0 ), lastUsed( 0 ) {}
+			Item( const Key &key ) : key( key ), priority( 0 ), lastUsed( 0 ) {}
+			Item( const Item &other ) : key( other.key ), cacheEntry( other.cacheEntry ), priority( 0 ), lastUsed( 0 ) {}
+			Key key;
+			mutable CacheEntry cacheEntry;
+			// Mutex to protect cacheEntry.
+			using Mutex = tbb::spin_rw_mutex;
+			mutable Mutex mutex;
+			// GreedyDual priority, and the value of `m_clock`
+			// when the item was last used. Both are atomic
+			// so they can be updated without taking a write
+			// lock on the item.
+			mutable std::atomic<double> priority;
+			mutable std::atomic<uint64_t> lastUsed;
+		};
+
+		using Map = boost::multi_index::multi_index_container<
+			Item,
+			boost::multi_index::indexed_by<
+				boost::multi_index::hashed_unique<
+					boost::multi_index::member<Item, Key, &Item::key>
+				>
+			>
+		>;
+
+		using MapIterator = typename Map::iterator;
+
+		struct Bin
+		{
+			Bin() : popIterator( map.end() ) {}
+			Bin( const Bin &other ) : map( other.map ), popIterator( map.end() ) {}
+			Bin &operator = ( const Bin &other ) { map = other.map; popIterator = map.end(); return *this; }
+			Map map;
+			using Mutex = tbb::spin_rw_mutex;
+			Mutex mutex;
+			// Position from which `pop()` will start sampling.
+			// Protected by `m_popMutex` rather than `mutex`.
+			MapIterator popIterator;
+		};
+
+		using Bins = std::vector<Bin>;
+
+		GreedyDual()
+			:	m_popBinIndex( 0 ), m_inflation( 0 ), m_clock( 0 )
+		{
+			m_bins.resize( std::thread::hardware_concurrency() );
+			currentCost = 0;
+		}
+
+		struct Handle : private boost::noncopyable
+		{
+
+			Handle()
+				:	m_item( nullptr ), m_writable( false )
+			{
+			}
+
+			~Handle()
+			{
+			}
+
+			const CacheEntry &readable()
+			{
+				return m_item->cacheEntry;
+			}
+
+			CacheEntry &writable()
+			{
+				assert( m_writable );
+				return m_item->cacheEntry;
+			}
+
+			bool isWritable() const
+			{
+				return m_writable;
+			}
+
+			template<typename F>
+			void execute( F &&f )
+			{
+				f();
+			}
+
+			void release()
+			{
+				if( m_item )
+				{
+					m_itemLock.release();
+					m_item = nullptr;
+				}
+			}
+
+			private :
+
+				// See `Parallel::Handle::acquire()` for a description
+				// of the locking strategy, which is identical.
+				bool acquire( Bin &bin, const Key &key, AcquireMode mode, const IECore::Canceller *canceller )
+				{
+					assert( !m_item );
+
+					typename Bin::Mutex::scoped_lock binLock;
+					while( true )
+					{
+						binLock.acquire( bin.mutex, /* write = */ false );
+						MapIterator it = bin.map.find( key );
+						bool inserted = false;
+						if( it == bin.map.end() )
+						{
+							if( mode != Insert && mode != InsertWritable )
+							{
+								return false;
+							}
+							binLock.upgrade_to_writer();
+							std::tie<MapIterator, bool>( it, inserted ) = bin.map.insert( Item( key ) );
+						}
+
+						m_writable = inserted || mode == FindWritable || mode == InsertWritable;
+
+						if( m_itemLock.try_acquire( it->mutex, /* write = */ m_writable ) )
+						{
+							if( !m_writable && mode == Insert && it->cacheEntry.status() == LRUCache::Uncached )
+							{
+								mode = InsertWritable;
+								m_itemLock.release();
+								binLock.release();
+								continue;
+							}
+							m_item = &*it;
+							return true;
+						}
+						else
+						{
+							binLock.release();
+						}
+						IECore::Canceller::check( canceller );
+					}
+				}
+
+				friend class GreedyDual;
+
+				const Item *m_item;
+				typename Item::Mutex::scoped_lock m_itemLock;
+				bool m_writable;
+
+		};
+
+		bool acquire( const Key &key, Handle &handle, AcquireMode mode, const IECore::Canceller *canceller )
+		{
+			return handle.acquire( bin( key ), key, mode, canceller );
+		}
+
+		void push( Handle &handle )
+		{
+			// Reset the priority relative to the current inflation value.
+			// This is the only work needed to record a use of the item, and
+			// requires no locks, because all the values involved are atomic
+			// or are protected by the handle.
+			const CacheEntry &cacheEntry = handle.m_item->cacheEntry;
+			const double weight = cacheEntry.computeTime / (double)std::max<typename LRUCache::Cost>( cacheEntry.cost, 1 );
+			handle.m_item->priority.store( m_inflation.load( std::memory_order_relaxed ) + weight, std::memory_order_relaxed );
+			handle.m_item->lastUsed.store( m_clock.load( std::memory_order_relaxed ), std::memory_order_relaxed );
+		}
+
+		bool pop( Key &key, CacheEntry &cacheEntry )
+		{
+			// As for the Parallel policy, it is sufficient for only one thread
+			// to be limiting cost at any given time.
+			PopMutex::scoped_lock lock;
+			if( !lock.try_acquire( m_popMutex ) )
+			{
+				return false;
+			}
+
+			// Visit each bin in turn, so that eviction is spread evenly
+			// across them all. We give up if we can't pop anything after
+			// visiting every bin once.
+			for( size_t i = 0; i < m_bins.size(); ++i )
+			{
+				m_popBinIndex = ( m_popBinIndex + 1 ) % m_bins.size();
+				Bin &bin = m_bins[m_popBinIndex];
+				typename Bin::Mutex::scoped_lock binLock( bin.mutex );
+				if( bin.map.empty() )
+				{
+					continue;
+				}
+
+				// Sample items starting from `popIterator`, keeping a lock on
+				// the best candidate so far. We only ever use `try_acquire()`,
+				// so holding one item lock while trying another cannot deadlock.
+				// Items we can't lock are in use by another thread, so are not
+				// candidates for eviction anyway.
+				MapIterator candidate = bin.map.end();
+				typename Item::Mutex::scoped_lock itemLocks[2];
+				size_t candidateLockIndex = 0;
+				double candidatePriority = 0;
+				uint64_t candidateLastUsed = 0;
+
+				MapIterator it = bin.popIterator;
+				const size_t numSamples = std::min( g_numSamples, bin.map.size() );
+				for( size_t s = 0; s < numSamples; ++s, ++it )
+				{
+					if( it == bin.map.end() )
+					{
+						it = bin.map.begin();
+					}
+
+					const double priority = it->priority.load( std::memory_order_relaxed );
+					const uint64_t lastUsed = it->lastUsed.load( std::memory_order_relaxed );
+					if(
+						candidate != bin.map.end() &&
+						( priority > candidatePriority || ( priority == candidatePriority && lastUsed >= candidateLastUsed ) )
+					)
+					{
+						continue;
+					}
+
+					if( !itemLocks[1-candidateLockIndex].try_acquire( it->mutex ) )
+					{
+						continue;
+					}
+
+					if( candidate != bin.map.end() )
+					{
+						itemLocks[candidateLockIndex].release();
+					}
+					candidateLockIndex = 1 - candidateLockIndex;
+					candidate = it;
+					candidatePriority = priority;
+					candidateLastUsed = lastUsed;
+				}
+
+				bin.popIterator = it;
+				if( candidate == bin.map.end() )
+				{
+					continue;
+				}
+
+				// Pop the candidate, raising the inflation value so that
+				// items not used since now have lower priority than items
+				// used from here on.
+
+				key = candidate->key;
+				cacheEntry = candidate->cacheEntry;
+
+				double inflation = m_inflation.load( std::memory_order_relaxed );
+				while( candidatePriority > inflation && !m_inflation.compare_exchange_weak( inflation, candidatePriority ) )
+				{
+				}
+				m_clock.fetch_add( 1, std::memory_order_relaxed );
+
+				// We must release the lock before erasing the item, but
+				// no other thread can acquire it because we hold the bin
+				// lock.
+				itemLocks[candidateLockIndex].release();
+				if( bin.popIterator == candidate )
+				{
+					bin.popIterator = bin.map.erase( candidate );
+				}
+				else
+				{
+					bin.map.erase( candidate );
+				}
+				return true;
+			}
+
+			return false;
+		}
+
+		AtomicCost currentCost;
+
+	private :
+
+		static constexpr size_t g_numSamples = 8;
+
+		Bins m_bins;
+
+		Bin &bin( const Key &key )
+		{
+			size_t binIndex = boost::hash<Key>()( key ) % m_bins.size();
+			return m_bins[binIndex];
+		};
+
+		using PopMutex = tbb::spin_mutex;
+		PopMutex m_popMutex;
+		size_t m_popBinIndex;
+
+		std::atomic<double> m_inflation;
+		std::atomic<uint64_t> m_clock;
+
+};
+
 } // namespace LRUCachePolicy
 
 // CacheEntry
@@ -1012,7 +1610,7 @@ class TaskParallel
 
 template<typename Key, typename Value, template <typename> class Policy, typename GetterKey>
 LRUCache<Key, Value, Policy, GetterKey>::CacheEntry::CacheEntry()
-	:	cost( 0 )
+	:	cost( 0 ), computeTime( 0.0f )
 {
 }
 
@@ -1022,6 +1620,31 @@ typename LRUCache<Key, Value, Policy, GetterKey>::Status LRUCache<Key, Value, Po
 	return static_cast<Status>( state.which() );
 }
 
+// ComputeTimer
+// =======================================================================
+
+template<typename Key, typename Value, template <typename> class Policy, typename GetterKey>
+LRUCache<Key, Value, Policy, GetterKey>::ComputeTimer::ComputeTimer()
+{
+	if constexpr( Policy<LRUCache>::usesComputeTime )
+	{
+		m_startTime = std::chrono::steady_clock::now();
+	}
+}
+
+template<typename Key, typename Value, template <typename> class Policy, typename GetterKey>
+float LRUCache<Key, Value, Policy, GetterKey>::ComputeTimer::elapsed() const
+{
+	if constexpr( Policy<LRUCache>::usesComputeTime )
+	{
+		return std::chrono::duration<float>( std::chrono::steady_clock::now() - m_startTime ).count();
+	}
+	else
+	{
+		return 0.0f;
+	}
+}
+
 // LRUCache
 // =======================================================================
 
@@ -1087,6 +1710,7 @@ Value LRUCache<Key, Value, Policy, GetterKey>::get( const GetterKey &key, const
 		assert( handle.isWritable() );
 		Value value = Value();
 		Cost cost = 0;
+		const ComputeTimer timer;
 		try
 		{
 			handle.execute( [this, &value, &key, &cost, canceller] { value = m_getter( key, cost, canceller ); } );
@@ -1107,7 +1731,7 @@ Value LRUCache<Key, Value, Policy, GetterKey>::get( const GetterKey &key, const
 		assert( cacheEntry.status() != Cached ); // this would indicate that another thread somehow
 		assert( cacheEntry.status() != Failed ); // loaded the same thing as us, which is not the intention.
 
-		setInternal( key, handle.writable(), value, cost );
+		setInternal( key, handle.writable(), value, cost, timer.elapsed() );
 		m_policy.push( handle );
 
 		handle.release();
@@ -1154,12 +1778,12 @@ std::optional<Value> LRUCache<Key, Value, Policy, GetterKey>::getIfCached( const
 }
 
 template<typename Key, typename Value, template <typename> class Policy, typename GetterKey>
-bool LRUCache<Key, Value, Policy, GetterKey>::set( const Key &key, const Value &value, Cost cost )
+bool LRUCache<Key, Value, Policy, GetterKey>::set( const Key &key, const Value &value, Cost cost, float computeTime )
 {
 	typename Policy<LRUCache>::Handle handle;
 	m_policy.acquire( key, handle, LRUCachePolicy::InsertWritable, /* canceller = */ nullptr );
 	assert( handle.isWritable() );
-	bool result = setInternal( key, handle.writable(), value, cost );
+	bool result = setInternal( key, handle.writable(), value, cost, computeTime );
 	m_policy.push( handle );
 	handle.release();
 	limitCost( m_maxCost );
@@ -1168,7 +1792,7 @@ bool LRUCache<Key, Value, Policy, GetterKey>::set( const Key &key, const Value &
 
 template<typename Key, typename Value, template <typename> class Policy, typename GetterKey>
 template<typename CostFunction>
-bool LRUCache<Key, Value, Policy, GetterKey>::setIfUncached( const Key &key, const Value &value, CostFunction &&costFunction )
+bool LRUCache<Key, Value, Policy, GetterKey>::setIfUncached( const Key &key, const Value &value, CostFunction &&costFunction, float computeTime )
 {
 	typename Policy<LRUCache>::Handle handle;
 	m_policy.acquire( key, handle, LRUCachePolicy::Insert, /* canceller = */ nullptr );
@@ -1179,7 +1803,7 @@ bool LRUCache<Key, Value, Policy, GetterKey>::setIfUncached( const Key &key, con
 	if( status == Uncached )
 	{
 		assert( handle.isWritable() );
-		result = setInternal( key, handle.writable(), value, costFunction( value ) );
+		result = setInternal( key, handle.writable(), value, costFunction( value ), computeTime );
 		m_policy.push( handle );
 
 		handle.release();
@@ -1189,7 +1813,7 @@ bool LRUCache<Key, Value, Policy, GetterKey>::setIfUncached( const Key &key, con
 }
 
 template<typename Key, typename Value, template <typename> class Policy, typename GetterKey>
-bool LRUCache<Key, Value, Policy, GetterKey>::setInternal( const Key &key, CacheEntry &cacheEntry, const Value &value, Cost cost )
+bool LRUCache<Key, Value, Policy, GetterKey>::setInternal( const Key &key, CacheEntry &cacheEntry, const Value &value, Cost cost, float computeTime )
 {
 	eraseInternal( key, cacheEntry );
 
@@ -1200,6 +1824,7 @@ bool LRUCache<Key, Value, Policy, GetterKey>::setInternal( const Key &key, Cache
 
 	cacheEntry.state = value;
 	cacheEntry.cost = cost;
+	cacheEntry.computeTime = computeTime;
 
 	m_policy.currentCost += cost;
 
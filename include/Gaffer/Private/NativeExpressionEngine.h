@@ -0,0 +1,109 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2025, Cinesite VFX Ltd. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//      * Redistributions of source code must retain the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer.
+//
+//      * Redistributions in binary form must reproduce the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer in the documentation and/or other materials provided with
+//        the distribution.
+//
+//      * Neither the name of John Haddon nor the names of
+//        any other contributors to this software may be used to endorse or
+//        promote products derived from this software without specific prior
+//        written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Gaffer/Expression.h"
+
+#include "IECore/Exception.h"
+
+#include <memory>
+
+namespace Gaffer
+{
+
+namespace Private
+{
+
+/// An Expression::Engine which compiles expressions to bytecode and
+/// evaluates them without Python, so that they may be executed concurrently
+/// from many threads. The language is a subset of Python, supporting
+/// arithmetic, comparisons, conditionals, local variables, context lookups,
+/// string formatting and access to vector and colour components. Plugs
+/// are read and written exactly as they are by the Python engine :
+///
+/// ```
+/// parent["n"]["out"] = "{}_{:04d}".format( context["shot"], int( context.getFrame() ) )
+/// ```
+///
+/// As well as being available directly as the "native" language, the
+/// engine is used by the Expression node to execute Python expressions
+/// which fall within the subset, falling back to Python for any
+/// operation it can't guarantee to reproduce exactly.
+class GAFFER_API NativeExpressionEngine : public Expression::Engine
+{
+
+	public :
+
+		NativeExpressionEngine();
+		~NativeExpressionEngine() override;
+
+		IE_CORE_DECLAREMEMBERPTR( NativeExpressionEngine );
+
+		/// Thrown by `execute()` and `apply()` when an operation can't be
+		/// performed natively. This includes runtime errors, so that when
+		/// translating Python expressions the Python engine can be used to
+		/// report them in the canonical form.
+		struct UnsupportedOperation : public IECore::Exception
+		{
+			UnsupportedOperation( const std::string &what );
+		};
+
+	protected :
+
+		void parse( Expression *node, const std::string &expression, std::vector<ValuePlug *> &inputs, std::vector<ValuePlug *> &outputs, std::vector<IECore::InternedString> &contextVariables ) override;
+		IECore::ConstObjectVectorPtr execute( const Context *context, const std::vector<const ValuePlug *> &proxyInputs ) const override;
+		ValuePlug::CachePolicy executeCachePolicy() const override;
+
+		void apply( ValuePlug *proxyOutput, const ValuePlug *topLevelProxyOutput, const IECore::Object *value ) const override;
+		std::string identifier( const Expression *node, const ValuePlug *plug ) const override;
+		std::string replace( const Expression *node, const std::string &expression, const std::vector<const ValuePlug *> &oldPlugs, const std::vector<const ValuePlug *> &newPlugs ) const override;
+		std::string defaultExpression( const ValuePlug *output ) const override;
+
+	private :
+
+		struct Program;
+		std::unique_ptr<const Program> m_program;
+
+		static EngineDescription<NativeExpressionEngine> g_engineDescription;
+
+};
+
+IE_CORE_DECLAREPTR( NativeExpressionEngine )
+
+} // namespace Private
+
+} // namespace Gaffer
@@ -0,0 +1,162 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2025, Cinesite VFX Ltd. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//      * Redistributions of source code must retain the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer.
+//
+//      * Redistributions in binary form must reproduce the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer in the documentation and/or other materials provided with
+//        the distribution.
+//
+//      * Neither the name of John Haddon nor the names of
+//        any other contributors to this software may be used to endorse or
+//        promote products derived from this software without specific prior
+//        written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+#pragma once
+
+#include "Gaffer/Export.h"
+
+#include "IECore/MurmurHash.h"
+#include "IECore/Object.h"
+
+#include "boost/noncopyable.hpp"
+#include "boost/unordered_map.hpp"
+
+#include "tbb/spin_rw_mutex.h"
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace Gaffer
+{
+
+namespace Private
+{
+
+/// A disk-backed cache of `IECore::Object` values, keyed by `MurmurHash`.
+/// This is used as a second level beneath the in-memory compute cache in
+/// ValuePlug, so that a freshly started process can reuse results computed
+/// by previous processes.
+///
+/// Values are stored in a directory of append-only segment files, which are
+/// memory-mapped for reading. Multiple processes on the same host may share
+/// a directory : appends are serialised by an advisory lock on a lock file,
+/// and records are validated by checksum before being returned. When the
+/// total size of the segments exceeds the size limit, the oldest segments
+/// are deleted. Processes which have deleted segments mapped continue to
+/// read from them until they next refresh their index.
+///
+/// > Caution : Keys must uniquely identify a value _across_ processes, not
+/// > just within a single one. This is not true of ComputeNode hashes in
+/// > general, so nodes must opt in explicitly via
+/// > `ValuePlug::CachePolicy::Persistent`.
+class GAFFER_API PersistentCache : private boost::noncopyable
+{
+
+	public :
+
+		PersistentCache();
+		~PersistentCache();
+
+		/// Sets the directory used to store segment files, creating it
+		/// if necessary. An empty string disables the cache.
+		void setDirectory( const std::string &directory );
+		const std::string &getDirectory() const;
+		bool enabled() const;
+
+		/// Sets the maximum total size of all segment files in the directory.
+		/// This limit is shared by all processes using the same directory, and is
+		/// applied by whichever process next appends to it.
+		void setSizeLimit( size_t bytes );
+		size_t getSizeLimit() const;
+
+		/// Returns the total size of the segments known to this process.
+		size_t usage() const;
+
+		/// Returns the value for `key`, or null if it is not stored.
+		IECore::ConstObjectPtr get( const IECore::MurmurHash &key );
+		/// Appends `value` to the cache. Values which can not be serialised
+		/// are silently ignored. Returns true if the value was stored.
+		bool set( const IECore::MurmurHash &key, const IECore::Object *value );
+
+		/// Deletes all segment files in the directory.
+		void clear();
+
+	private :
+
+		struct Mapping;
+		using MappingPtr = std::shared_ptr<const Mapping>;
+
+		struct Segment
+		{
+			size_t index;
+			MappingPtr mapping;
+			// Offset of the next record to be indexed.
+			size_t indexedSize;
+			// Size of the file when it was last indexed. Segments are
+			// only remapped when this changes.
+			size_t fileSize;
+			// Size including records we have appended ourselves,
+			// which may not have been indexed yet.
+			size_t knownSize;
+		};
+
+		struct Location
+		{
+			size_t segment;
+			// Null for records we have appended ourselves, until
+			// they are first read back.
+			MappingPtr mapping;
+			size_t offset;
+		};
+
+		// Scans the directory for segments and records written by other
+		// processes. Must be called with `m_mutex` held for writing.
+		void refreshInternal();
+		// Indexes any records appended since the segment was last indexed,
+		// provided its size on disk has changed to `fileSize`.
+		void indexSegment( Segment &segment, size_t fileSize );
+		Segment *findSegment( size_t index );
+		void closeInternal();
+
+		IECore::MurmurHash storageKey( const IECore::MurmurHash &key ) const;
+
+		using Mutex = tbb::spin_rw_mutex;
+		mutable Mutex m_mutex;
+
+		std::string m_directory;
+		std::atomic_bool m_enabled;
+		std::atomic_size_t m_sizeLimit;
+		std::vector<Segment> m_segments;
+		boost::unordered_map<IECore::MurmurHash, Location> m_index;
+		std::chrono::steady_clock::time_point m_lastRefresh;
+
+};
+
+} // namespace Private
+
+} // namespace Gaffer
@@ -406,13 +406,14 @@ typename ProcessType::ResultType Process::acquireCollaborativeResult(
 					{
 						ProcessType process( std::forward<ProcessArguments>( args )... );
 						process.m_collaboration = collaboration.get();
+						const typename ProcessType::CacheType::ComputeTimer timer;
 						collaboration->result = process.run();
 						// Publish result to cache before we remove ourself from
 						// `g_pendingCollaborations`, so that other threads will
 						// be able to get the result one way or the other.
 						ProcessType::g_cache.setIfUncached(
 							cacheKey, std::get<typename ProcessType::ResultType>( collaboration->result ),
-							ProcessType::cacheCostFunction
+							ProcessType::cacheCostFunction, timer.elapsed()
 						);
 					}
 					catch( ... )
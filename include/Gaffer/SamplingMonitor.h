@@ -0,0 +1,153 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2025, Cinesite VFX Ltd. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//      * Redistributions of source code must retain the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer.
+//
+//      * Redistributions in binary form must reproduce the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer in the documentation and/or other materials provided with
+//        the distribution.
+//
+//      * Neither the name of John Haddon nor the names of
+//        any other contributors to this software may be used to endorse or
+//        promote products derived from this software without specific prior
+//        written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+#pragma once
+
+#include "Gaffer/Monitor.h"
+
+#include "boost/unordered_map.hpp"
+
+#include "tbb/enumerable_thread_specific.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace Gaffer
+{
+
+IE_CORE_FORWARDDECLARE( Plug )
+
+/// A monitor which periodically samples the process stack of each
+/// thread, attributing the samples to the plugs being processed. This
+/// is less precise than the PerformanceMonitor, but has much lower
+/// overhead for graphs performing very many small processes, because
+/// no timing is performed per process.
+class GAFFER_API SamplingMonitor : public Monitor
+{
+
+	public :
+
+		explicit SamplingMonitor( std::chrono::microseconds interval = std::chrono::microseconds( 1000 ) );
+		~SamplingMonitor() override;
+
+		IE_CORE_DECLAREMEMBERPTR( SamplingMonitor )
+
+		struct GAFFER_API Statistics
+		{
+
+			Statistics( size_t inclusiveSamples = 0, size_t exclusiveSamples = 0 );
+
+			/// Number of samples in which the plug appeared
+			/// anywhere in the process stack.
+			size_t inclusiveSamples;
+			/// Number of samples in which the plug was at
+			/// the top of the process stack.
+			size_t exclusiveSamples;
+
+			Statistics & operator += ( const Statistics &rhs );
+
+			bool operator == ( const Statistics &rhs ) const;
+			bool operator != ( const Statistics &rhs ) const;
+
+		};
+
+		using StatisticsMap = boost::unordered_map<ConstPlugPtr, Statistics>;
+
+		std::chrono::microseconds interval() const;
+
+		/// Query functions. These may be called at any time, but
+		/// results will only be stable once the monitor is no longer
+		/// active.
+		StatisticsMap allStatistics() const;
+		Statistics plugStatistics( const Plug *plug ) const;
+		/// Total number of samples taken from busy threads.
+		size_t numSamples() const;
+		/// Writes the samples as "folded" stacks, one per line, in the
+		/// format used by `flamegraph.pl`, `speedscope` and similar tools.
+		void writeFlameGraph( const std::string &fileName ) const;
+
+	protected :
+
+		void processStarted( const Process *process ) override;
+		void processFinished( const Process *process ) override;
+
+	private :
+
+		// Each thread publishes its process stack, so that it can be read
+		// by the sampling thread. Updating the stack is the only work done
+		// per process.
+		struct ThreadData
+		{
+			ThreadData();
+			static constexpr size_t maxDepth = 128;
+			std::atomic<size_t> depth;
+			std::array<std::atomic<const Plug *>, maxDepth> stack;
+			// Owning references to every plug published in `stack`, so
+			// the sampling thread never sees a dangling pointer. Only
+			// accessed by the owning thread.
+			std::unordered_map<const Plug *, ConstPlugPtr> plugs;
+		};
+
+		tbb::enumerable_thread_specific<ThreadData, tbb::cache_aligned_allocator<ThreadData>, tbb::ets_key_per_instance> m_threadData;
+
+		void sample();
+
+		const std::chrono::microseconds m_interval;
+
+		// Protects everything below.
+		mutable std::mutex m_mutex;
+		std::condition_variable m_stopCondition;
+		bool m_stop;
+		// Threads that have published a process stack, registered when
+		// they first do so.
+		std::vector<ThreadData *> m_threads;
+		std::unordered_map<const Plug *, Statistics> m_statistics;
+		std::map<std::vector<const Plug *>, size_t> m_stacks;
+		size_t m_numSamples;
+
+		std::thread m_samplingThread;
+
+};
+
+IE_CORE_DECLAREPTR( SamplingMonitor )
+
+} // namespace Gaffer
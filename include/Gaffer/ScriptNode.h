@@ -49,6 +49,8 @@
 
 #include <filesystem>
 #include <functional>
+#include <memory>
+#include <mutex>
 #include <stack>
 
 namespace GafferModule
@@ -198,14 +200,22 @@ class GAFFER_API ScriptNode : public Node
 		/// defaults to the ScriptNode itself. The filter may be specified to limit
 		/// serialised nodes to those contained in the set.
 		std::string serialise( const Node *parent = nullptr, const Set *filter = nullptr ) const;
-		/// Calls serialise() and saves the result into the specified file.
+		/// Calls serialise() and saves the result into the specified file. If the
+		/// file has a `.gfrb` extension, a binary serialisation is saved instead.
+		/// This is significantly quicker to load, but is not human readable.
 		void serialiseToFile( const std::filesystem::path &fileName, const Node *parent = nullptr, const Set *filter = nullptr ) const;
+		/// Returns a count which changes whenever `node` or anything inside
+		/// it is edited. This is used to reuse the serialisations of unchanged
+		/// nodes when the whole script is serialised repeatedly, as it is
+		/// by `save()` and by backups. Returns 0 if `node` is not a child of
+		/// the script.
+		uint64_t editCount( const Node *node ) const;
 		/// Executes a previously generated serialisation. If continueOnError is true, then
 		/// errors are reported via IECore::MessageHandler rather than as exceptions, and
 		/// execution continues at the point after the error. This allows scripts to be loaded as
 		/// best as possible even when certain nodes/plugs/shaders may be missing or
 		/// may have been renamed. A true return value indicates that one or more errors
-		/// were ignored.
+		/// were ignored. Both Python and binary serialisations are supported.
 		bool execute( const std::string &serialisation, Node *parent = nullptr, bool continueOnError = false );
 		/// As above, but loads the serialisation from the specified file.
 		bool executeFile( const std::filesystem::path &fileName, Node *parent = nullptr, bool continueOnError = false );
@@ -341,10 +351,13 @@ class GAFFER_API ScriptNode : public Node
 		// Serialisation and execution
 		// ===========================
 
-		std::string serialiseInternal( const Node *parent, const Set *filter ) const;
+		std::string serialiseInternal( const Node *parent, const Set *filter, bool binary = false ) const;
 		bool executeInternal( const std::string &serialisation, Node *parent, bool continueOnError, const std::string &context = "" );
 
-		using SerialiseFunction = std::function<std::string ( const Node *, const Set * )>;
+		// The final argument is storage for a cache of serialised nodes, or null
+		// if caching is not appropriate. The cache is owned by the ScriptNode,
+		// but its contents are managed entirely by the serialise function.
+		using SerialiseFunction = std::function<std::string ( const Node *, const Set *, bool, IECore::RefCountedPtr * )>;
 		using ExecuteFunction = std::function<bool ( ScriptNode *, const std::string &, Node *, bool, const std::string & )>;
 
 		// Actual implementations reside in libGafferBindings (due to Python
@@ -355,6 +368,9 @@ class GAFFER_API ScriptNode : public Node
 
 		bool m_executing;
 
+		mutable IECore::RefCountedPtr m_serialisationCache;
+		mutable std::mutex m_serialisationCacheMutex;
+
 		// Context and plugs
 		// =================
 
@@ -367,6 +383,12 @@ class GAFFER_API ScriptNode : public Node
 		void plugSet( Plug *plug );
 		void contextChanged( const Context *context, const IECore::InternedString &name );
 
+		// Edit tracking
+		// =============
+
+		class EditTracker;
+		std::unique_ptr<EditTracker> m_editTracker;
+
 		static size_t g_firstPlugIndex;
 
 };
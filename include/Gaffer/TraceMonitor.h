@@ -0,0 +1,149 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2025, Cinesite VFX Ltd. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//      * Redistributions of source code must retain the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer.
+//
+//      * Redistributions in binary form must reproduce the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer in the documentation and/or other materials provided with
+//        the distribution.
+//
+//      * Neither the name of John Haddon nor the names of
+//        any other contributors to this software may be used to endorse or
+//        promote products derived from this software without specific prior
+//        written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+#pragma once
+
+#include "Gaffer/Monitor.h"
+
+#include "IECore/InternedString.h"
+
+#include "tbb/enumerable_thread_specific.h"
+
+#include <chrono>
+#include <deque>
+#include <unordered_map>
+#include <vector>
+
+namespace Gaffer
+{
+
+IE_CORE_FORWARDDECLARE( Plug )
+
+/// A monitor which records the start and finish of every process,
+/// so that the timeline of a computation can be inspected. This
+/// reveals information that aggregate statistics can't, such as
+/// idle threads, serialised computes and chains of collaboration.
+/// Events are recorded into per-thread buffers, so recording is
+/// cheap enough to leave enabled for production jobs.
+class GAFFER_API TraceMonitor : public Monitor
+{
+
+	public :
+
+		/// Only processes with types in `processMask` are recorded. An
+		/// empty mask records all processes. Each thread retains only
+		/// the most recent `maxEventsPerThread` events, so that memory
+		/// usage is bounded however long the monitor is active for.
+		TraceMonitor( const std::vector<IECore::InternedString> &processMask = {}, size_t maxEventsPerThread = 250000 );
+		~TraceMonitor() override;
+
+		IE_CORE_DECLAREMEMBERPTR( TraceMonitor )
+
+		/// Query and export functions. These are not thread-safe, and must
+		/// be called only when the Monitor is not active (as defined by
+		/// `Monitor::Scope`).
+		///
+		/// Returns the number of processes recorded.
+		size_t numEvents() const;
+		/// Returns the number of processes discarded because they exceeded
+		/// `maxEventsPerThread`.
+		size_t numDroppedEvents() const;
+		/// Writes the recorded events in the Chrome Trace Event format,
+		/// which may be viewed using `chrome://tracing` or the Perfetto
+		/// UI at `https://ui.perfetto.dev`.
+		void writeChromeTrace( const std::string &fileName ) const;
+		/// Discards all recorded events.
+		void clear();
+
+	protected :
+
+		void processStarted( const Process *process ) override;
+		void processFinished( const Process *process ) override;
+
+	private :
+
+		using Clock = std::chrono::steady_clock;
+
+		bool recording( const Process *process ) const;
+		// Returns the closest ancestor of `process` that is recorded.
+		const Process *recordedParent( const Process *process ) const;
+
+		// Each event records a complete process, and is added when the
+		// process finishes.
+		struct Event
+		{
+			Clock::time_point startTime;
+			Clock::time_point finishTime;
+			// Raw pointers are kept alive by `ThreadData::plugs`.
+			const Plug *plug;
+			const Plug *parentPlug;
+			// Processes are identified by address. Addresses are reused,
+			// but never by two processes running at the same time, so the
+			// parent can be identified unambiguously at export time.
+			const Process *process;
+			const Process *parent;
+			IECore::InternedString processType;
+		};
+
+		// Events are recorded into a per-thread buffer to avoid contention.
+		// We use a deque so that the buffer can grow without copying existing
+		// events, and so that the oldest events can be discarded cheaply.
+		struct ThreadData
+		{
+			ThreadData();
+			int id;
+			// Processes which have started but not yet finished.
+			std::vector<std::pair<const Process *, Clock::time_point>> running;
+			std::deque<Event> events;
+			size_t droppedEvents;
+			// Owning references to the plugs referred to by `events`, so that
+			// we can export them even if they are removed from the graph.
+			// Kept separately so that recording an event doesn't need to
+			// increment a shared reference count.
+			std::unordered_map<const Plug *, ConstPlugPtr> plugs;
+		};
+
+		const Plug *retainPlug( ThreadData &threadData, const Plug *plug );
+
+		const std::vector<IECore::InternedString> m_processMask;
+		const size_t m_maxEventsPerThread;
+		const Clock::time_point m_startTime;
+		mutable tbb::enumerable_thread_specific<ThreadData> m_threadData;
+
+};
+
+IE_CORE_DECLAREPTR( TraceMonitor )
+
+} // namespace Gaffer
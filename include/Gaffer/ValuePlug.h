@@ -141,7 +141,13 @@ class GAFFER_API ValuePlug : public Plug
 			Default,
 			/// Deprecated synonym for Default. Will be removed in a future
 			/// release.
-			Legacy = Default
+			Legacy = Default,
+			/// As for TaskCollaboration, but results are additionally
+			/// stored in the persistent cache on disk, so that they may be
+			/// reused by other processes. Only suitable for processes whose
+			/// hash uniquely identifies the result across sessions, and
+			/// whose result supports `IECore::Object::save()`.
+			Persistent
 		};
 
 		/// @name Cache management
@@ -160,6 +166,29 @@ class GAFFER_API ValuePlug : public Plug
 		static void clearCache();
 		//@}
 
+		/// @name Persistent cache management
+		/// Results computed with `CachePolicy::Persistent` may also be
+		/// stored in a cache on disk, beneath the in-memory cache. This
+		/// allows them to be reused by subsequent processes, and may be
+		/// shared by concurrent processes on the same host. The persistent
+		/// cache is disabled until a directory is specified.
+		////////////////////////////////////////////////////////////////////
+		//@{
+		/// Sets the directory used to store the persistent cache.
+		/// An empty string disables the cache.
+		static void setPersistentCacheDirectory( const std::string &directory );
+		static const std::string &getPersistentCacheDirectory();
+		/// Sets the maximum size of the persistent cache in bytes. This
+		/// is shared by all processes using the same directory.
+		static void setPersistentCacheSizeLimit( size_t bytes );
+		static size_t getPersistentCacheSizeLimit();
+		/// Returns the size of the persistent cache in bytes.
+		static size_t persistentCacheUsage();
+		/// Removes all entries from the persistent cache, including those
+		/// written by other processes.
+		static void clearPersistentCache();
+		//@}
+
 		/// @name Hash cache management
 		/// In addition to the cache of recently computed values, we also
 		/// keep a per-thread cache of recently computed hashes. These functions
@@ -194,6 +223,31 @@ class GAFFER_API ValuePlug : public Plug
 		static void setHashCacheMode( HashCacheMode hashCacheMode );
 		static HashCacheMode getHashCacheMode();
 
+		/// When enabled, the context variables read by each hash are tracked,
+		/// and hashes which don't depend on the frame are shared between all
+		/// frames. This avoids rehashing static branches of the graph for every
+		/// frame of a sequence. Only used in the Standard HashCacheMode. Defaults
+		/// to off, unless the `GAFFER_FRAMEINVARIANT_HASHCACHE` environment
+		/// variable is set to `1`.
+		static void setFrameInvariantHashCacheEnabled( bool enabled );
+		static bool getFrameInvariantHashCacheEnabled();
+
+		struct FrameInvariantHashCacheStatistics
+		{
+			/// The number of hashes reused from another frame.
+			size_t hits = 0;
+			/// The number of hashes which couldn't be reused from another
+			/// frame, either because they depend on the frame or because they
+			/// hadn't been computed yet.
+			size_t misses = 0;
+			/// The number of frame-invariant hashes currently cached.
+			size_t entries = 0;
+		};
+
+		/// Returns statistics accumulated since the frame-invariant
+		/// hash cache was first enabled.
+		static FrameInvariantHashCacheStatistics frameInvariantHashCacheStatistics();
+
 		//@}
 
 		/// Returns a counter that increments when this plug is been dirtied
@@ -267,6 +321,10 @@ class GAFFER_API ValuePlug : public Plug
 		class ComputeProcess;
 		class SetValueAction;
 
+		friend class Context;
+		// Called by Context when variable access tracking is enabled.
+		static void contextVariableAccessed( const IECore::InternedString *name );
+
 		const IECore::Object *getValueInternal( IECore::ConstObjectPtr &owner, const IECore::MurmurHash *precomputedHash = nullptr ) const;
 		void setValueInternal( IECore::ConstObjectPtr value, bool propagateDirtiness );
 		void childAddedOrRemoved();
@@ -44,5 +44,9 @@ namespace GafferBindings
 {
 
 GAFFERBINDINGS_API std::string metadataSerialisation( const Gaffer::GraphComponent *graphComponent, const std::string &identifier, Serialisation &serialisation );
+/// Returns true if the metadata for `graphComponent` can be serialised by `binaryMetadataSerialisation()`.
+GAFFERBINDINGS_API bool canSerialiseMetadataBinary( const Gaffer::GraphComponent *graphComponent );
+/// Equivalent of `metadataSerialisation()` for use in `Serialiser::binaryPostHierarchy()`.
+GAFFERBINDINGS_API void binaryMetadataSerialisation( const Gaffer::GraphComponent *graphComponent, const std::string &identifier, Serialisation &serialisation );
 
 } // namespace GafferBindings
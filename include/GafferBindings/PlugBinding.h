@@ -165,6 +165,8 @@ class GAFFERBINDINGS_API PlugSerialiser : public Serialisation::Serialiser
 		void moduleDependencies( const Gaffer::GraphComponent *graphComponent, std::set<std::string> &modules, const Serialisation &serialisation ) const override;
 		std::string constructor( const Gaffer::GraphComponent *graphComponent, Serialisation &serialisation ) const override;
 		std::string postHierarchy( const Gaffer::GraphComponent *graphComponent, const std::string &identifier, Serialisation &serialisation ) const override;
+		bool binaryPostHierarchy( const Gaffer::GraphComponent *graphComponent, const std::string &identifier, Serialisation &serialisation ) const override;
+		const std::type_info &binaryPostHierarchyType() const override;
 		bool childNeedsSerialisation( const Gaffer::GraphComponent *child, const Serialisation &serialisation ) const override;
 		bool childNeedsConstruction( const Gaffer::GraphComponent *child, const Serialisation &serialisation ) const override;
 
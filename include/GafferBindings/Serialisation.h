@@ -43,8 +43,17 @@
 #include "Gaffer/Set.h"
 
 #include "IECore/Canceller.h"
+#include "IECore/Data.h"
 #include "IECore/Object.h"
 
+#include <chrono>
+#include <functional>
+#include <map>
+#include <memory>
+#include <set>
+#include <typeinfo>
+#include <unordered_map>
+
 namespace GafferBindings
 {
 
@@ -53,12 +62,85 @@ class GAFFERBINDINGS_API Serialisation : boost::noncopyable
 
 	public :
 
+		enum class Format
+		{
+			/// A Python script which rebuilds the graph when executed.
+			Python,
+			/// A binary format which stores node construction, plug values,
+			/// connections and metadata natively, so that they can be rebuilt
+			/// without executing Python. Serialisers which don't support the
+			/// binary format are serialised as fragments of Python embedded
+			/// within the binary data. See `Serialiser::binaryPostHierarchy()`.
+			Binary
+		};
+
+		/// Stores the Python serialisations of the children of a parent, so that
+		/// they may be reused by subsequent serialisations of the same parent,
+		/// regenerating only the children that have changed in the meantime.
+		class GAFFERBINDINGS_API FragmentCache : public IECore::RefCounted
+		{
+
+			public :
+
+				IE_CORE_DECLAREMEMBERPTR( FragmentCache );
+
+				/// Must return a key which changes whenever the serialisation of `child`
+				/// might have changed, or 0 if `child` should not be cached. Keys must
+				/// not be reused for different children, even if a child is destroyed
+				/// and another allocated at the same address.
+				using KeyFunction = std::function<uint64_t ( const Gaffer::GraphComponent *child )>;
+
+				FragmentCache( const KeyFunction &keyFunction );
+				~FragmentCache() override;
+
+				/// Number of children reused and regenerated by the most recent
+				/// serialisation.
+				size_t hits() const;
+				size_t misses() const;
+
+				void clear();
+
+			private :
+
+				friend class Serialisation;
+
+				struct Fragment
+				{
+					uint64_t key;
+					uint64_t generation;
+					std::string hierarchy;
+					std::string connections;
+					std::string postScript;
+					std::set<std::string> modules;
+				};
+
+				KeyFunction m_keyFunction;
+				std::unordered_map<const Gaffer::GraphComponent *, Fragment> m_fragments;
+				// Identifies the Serialisation which last used the cache, so that
+				// fragments for removed children can be discarded.
+				uint64_t m_generation;
+				std::string m_parentName;
+				bool m_protectParentNamespace;
+				size_t m_hits;
+				size_t m_misses;
+
+		};
+
+		IE_CORE_DECLAREPTR( FragmentCache );
+
 		/// Supports cancellation via the usual mechanism of scoping a Context
-		/// containing an `IECore::Canceller`.
-		Serialisation( const Gaffer::GraphComponent *parent, const std::string &parentName = "parent", const Gaffer::Set *filter = nullptr );
+		/// containing an `IECore::Canceller`. If `fragmentCache` is specified,
+		/// it is used to reuse the serialisations of children which haven't
+		/// changed since the last serialisation made with the same cache. The
+		/// cache is only used for the Python format, and when no `filter` is
+		/// specified.
+		Serialisation( const Gaffer::GraphComponent *parent, const std::string &parentName = "parent", const Gaffer::Set *filter = nullptr, Format format = Format::Python, FragmentCache *fragmentCache = nullptr );
+		~Serialisation();
 
 		/// Returns the parent passed to the constructor.
 		const Gaffer::GraphComponent *parent() const;
+		/// Returns the format passed to the constructor.
+		Format format() const;
 
 		/// Returns the name of a variable used to reference the specified object
 		/// within the serialisation. Returns the empty string if the object is not
@@ -76,9 +158,76 @@ class GAFFERBINDINGS_API Serialisation : boost::noncopyable
 		/// Ensures that `import moduleName` is included in the result.
 		void addModule( const std::string &moduleName );
 
-		/// Returns the result of the serialisation.
+		/// Returns the result of the serialisation. For the Binary format this
+		/// is binary data, which may be passed to `executeBinary()`.
 		std::string result() const;
 
+		/// Binary serialisation
+		/// ====================
+		///
+		/// These methods record the native equivalents of `setValue()`, `setInput()`
+		/// and `Metadata.registerValue()` calls. They may only be called from
+		/// `Serialiser::binaryPostHierarchy()`, and only when `format()` is Binary.
+		/// Components are referred to by the same identifiers as are used in
+		/// the Python format.
+
+		void addValue( const std::string &identifier, const IECore::Data *value );
+		void addInput( const std::string &identifier, const std::string &inputIdentifier );
+		void addMetadata( const std::string &identifier, IECore::InternedString key, const IECore::Data *value, bool persistent = true );
+
+		/// Returns true if `serialisation` was created using the Binary format.
+		static bool isBinary( const std::string &serialisation );
+
+		/// Load times for a binary serialisation, broken down by the type of node
+		/// each operation was performed on.
+		struct LoadStatistics
+		{
+
+			struct Entry
+			{
+				size_t nativeOperations = 0;
+				size_t pythonFragments = 0;
+				std::chrono::nanoseconds nativeTime = std::chrono::nanoseconds( 0 );
+				std::chrono::nanoseconds pythonTime = std::chrono::nanoseconds( 0 );
+			};
+
+			std::map<std::string, Entry> entries;
+
+			/// Accumulates the statistics for all calls to `executeBinary()` made
+			/// on this thread while the Scope is active. This allows statistics to be
+			/// collected from `ScriptNode::load()` and friends.
+			class GAFFERBINDINGS_API Scope : boost::noncopyable
+			{
+
+				public :
+
+					Scope( LoadStatistics *statistics );
+					~Scope();
+
+				private :
+
+					LoadStatistics *m_previous;
+
+			};
+
+			/// Returns the statistics for the innermost active Scope, or
+			/// `nullptr` if there is none.
+			static LoadStatistics *current();
+
+		};
+
+		/// Called to execute the Python fragments embedded in a binary serialisation.
+		/// Should return true if errors were reported rather than thrown, as for
+		/// `ScriptNode::execute()`.
+		using PythonFunction = std::function<bool ( const std::string &python )>;
+
+		/// Rebuilds the graph described by a Binary serialisation. Identifiers are
+		/// resolved relative to `parent`, and are also made available to Python fragments
+		/// via `executionDict`, which must contain any variables the fragments expect.
+		/// Returns true if errors were reported rather than thrown, as for
+		/// `ScriptNode::execute()`. The GIL must be held by the caller.
+		static bool executeBinary( const std::string &serialisation, Gaffer::GraphComponent *parent, const boost::python::object &executionDict, const PythonFunction &executePython, bool continueOnError, const std::string &context = "" );
+
 		/// Convenience function to return the name of the module where object is defined.
 		static std::string modulePath( const IECore::RefCounted *object );
 		/// As above, but returns the empty string for built in python types.
@@ -135,6 +284,20 @@ class GAFFERBINDINGS_API Serialisation : boost::noncopyable
 				/// At this point it is possible to request the identifiers of other objects via the Serialisation and refer to them in the result.
 				/// Typically this would be used for forming connections between plugs. The default implementation returns the empty string.
 				virtual std::string postHierarchy( const Gaffer::GraphComponent *graphComponent, const std::string &identifier, Serialisation &serialisation ) const;
+				/// Used instead of `postHierarchy()` for the Binary format. May be implemented to
+				/// record the work of `postHierarchy()` using `Serialisation::addValue()` and friends,
+				/// returning true if that was possible. If false is returned, the result of `postHierarchy()`
+				/// is embedded in the binary serialisation as Python instead, so implementations should
+				/// return false _before_ adding anything. This is only called if `binaryPostHierarchyType()`
+				/// matches the type of the serialiser. The default implementation returns false.
+				virtual bool binaryPostHierarchy( const Gaffer::GraphComponent *graphComponent, const std::string &identifier, Serialisation &serialisation ) const;
+				/// Returns the type of the serialiser whose `postHierarchy()` is reproduced exactly by
+				/// `binaryPostHierarchy()`. If this doesn't match the actual type of the serialiser,
+				/// the Binary format falls back to using `postHierarchy()`, so that derived classes
+				/// which reimplement `postHierarchy()` are serialised correctly without needing to know
+				/// about `binaryPostHierarchy()`. Derived classes which don't reimplement `postHierarchy()`
+				/// may opt in to the faster binary serialisation by returning their own type.
+				virtual const std::type_info &binaryPostHierarchyType() const;
 				/// May be implemented to return a string to be executed after all the postHierarchy strings. This
 				/// can be used to perform a final setup step. The default implementation returns an empty string.
 				virtual std::string postScript( const Gaffer::GraphComponent *graphComponent, const std::string &identifier, Serialisation &serialisation ) const;
@@ -162,6 +325,7 @@ class GAFFERBINDINGS_API Serialisation : boost::noncopyable
 		const std::string m_parentName;
 		const Gaffer::Set *m_filter;
 		const bool m_protectParentNamespace;
+		const Format m_format;
 
 		std::string m_hierarchyScript;
 		std::string m_connectionScript;
@@ -169,7 +333,16 @@ class GAFFERBINDINGS_API Serialisation : boost::noncopyable
 
 		std::set<std::string> m_modules;
 
+		struct BinaryData;
+		std::unique_ptr<BinaryData> m_binaryData;
+
+		FragmentCache *m_fragmentCache;
+
 		void walk( const Gaffer::GraphComponent *parent, const std::string &parentIdentifier, const Serialiser *parentSerialiser, const IECore::Canceller *canceller );
+		void walkChild( Gaffer::GraphComponent::ChildIterator it, const std::string &parentIdentifier, const Serialiser *parentSerialiser, const IECore::Canceller *canceller );
+		void walkCachedChild( Gaffer::GraphComponent::ChildIterator it, const std::string &parentIdentifier, const Serialiser *parentSerialiser, const IECore::Canceller *canceller );
+		void walkBinary( const Gaffer::GraphComponent *child, const std::string &childIdentifier, const std::string &childConstructor, const std::string &parentIdentifier, const Serialiser *childSerialiser );
+		std::string binaryResult() const;
 
 		using SerialiserMap = std::map<IECore::TypeId, SerialiserPtr>;
 		static SerialiserMap &serialiserMap();
@@ -162,6 +162,31 @@ class SerialiserWrapper : public IECorePython::RefCountedWrapper<WrappedType>
 			return WrappedType::postHierarchy( graphComponent, identifier, serialisation );
 		}
 
+		bool binaryPostHierarchy( const Gaffer::GraphComponent *graphComponent, const std::string &identifier, Serialisation &serialisation ) const override
+		{
+			if( this->isSubclassed() )
+			{
+				IECorePython::ScopedGILLock gilLock;
+				if( this->methodOverride( "postHierarchy" ) )
+				{
+					// The binary implementation of the base class knows
+					// nothing of the Python override, so we must use
+					// the override instead.
+					return false;
+				}
+			}
+			return WrappedType::binaryPostHierarchy( graphComponent, identifier, serialisation );
+		}
+
+		const std::type_info &binaryPostHierarchyType() const override
+		{
+			// Python overrides of `postHierarchy()` are dealt with in
+			// `binaryPostHierarchy()` above, so we only need to check
+			// that the wrapped type supports the binary format.
+			const std::type_info &wrappedType = WrappedType::binaryPostHierarchyType();
+			return wrappedType == typeid( WrappedType ) ? typeid( *this ) : wrappedType;
+		}
+
 		std::string postScript( const Gaffer::GraphComponent *graphComponent, const std::string &identifier, Serialisation &serialisation ) const override
 		{
 			if( this->isSubclassed() )
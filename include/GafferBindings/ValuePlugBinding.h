@@ -58,6 +58,8 @@ class GAFFERBINDINGS_API ValuePlugSerialiser : public PlugSerialiser
 
 		std::string constructor( const Gaffer::GraphComponent *graphComponent, Serialisation &serialisation ) const override;
 		std::string postHierarchy( const Gaffer::GraphComponent *graphComponent, const std::string &identifier, Serialisation &serialisation ) const override;
+		bool binaryPostHierarchy( const Gaffer::GraphComponent *graphComponent, const std::string &identifier, Serialisation &serialisation ) const override;
+		const std::type_info &binaryPostHierarchyType() const override;
 
 		static std::string repr( const Gaffer::ValuePlug *plug, const std::string &extraArguments = "", Serialisation *serialisation = nullptr );
 		/// Returns a serialisation suitable for use in a `setValue()` or `setDefaultValue()` call.
@@ -41,6 +41,7 @@
 
 #include "Gaffer/NumericPlug.h"
 #include "Gaffer/Signals.h"
+#include "Gaffer/TypedPlug.h"
 
 #include "IECore/CompoundData.h"
 #include "IECore/FrameList.h"
@@ -52,6 +53,7 @@
 #include <map>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
@@ -170,6 +172,18 @@ class GAFFERDISPATCH_API Dispatcher : public TaskNode
 		const std::filesystem::path jobDirectory() const;
 		//@}
 
+		//! @name Incremental dispatch
+		/// Dispatchers may skip tasks whose outputs are up to date.
+		/////////////////////////////////////////////////////////////
+		//@{
+		/// When on, the hashes of executed tasks are recorded alongside
+		/// the jobs directory, and subsequent dispatches skip tasks whose
+		/// hash is unchanged and whose output files still exist. See
+		/// `TaskPlug::upToDate()`.
+		Gaffer::BoolPlug *skipUpToDateTasksPlug();
+		const Gaffer::BoolPlug *skipUpToDateTasksPlug() const;
+		//@}
+
 		/// A function which creates a Dispatcher.
 		using Creator = std::function<DispatcherPtr ()>;
 		/// SetupPlugsFn may be registered along with a Dispatcher Creator. It will be called by setupPlugs,
@@ -283,6 +297,9 @@ class GAFFERDISPATCH_API Dispatcher : public TaskNode
 		mutable std::filesystem::path m_jobDirectory;
 
 		void executeAndPruneImmediateBatches( TaskBatch *batch, bool immediate = false ) const;
+		// Removes batches whose tasks are all up to date, returning true if
+		// `batch` or any of its preTasks still require execution.
+		bool pruneUpToDateBatches( TaskBatch *batch, std::unordered_map<const TaskBatch *, bool> &visited, size_t &numSkipped ) const;
 
 		using CreatorMap = std::map<std::string, std::pair<Creator, SetupPlugsFn>>;
 		static CreatorMap &creators();
@@ -44,6 +44,8 @@
 
 #include "IECore/MurmurHash.h"
 
+#include <functional>
+
 namespace Gaffer
 {
 
@@ -161,6 +163,19 @@ class GAFFERDISPATCH_API TaskNode : public Gaffer::DependencyNode
 				/// of this node in the current context. Primarily for use by the Dispatcher
 				/// class.
 				void postTasks( Tasks &tasks ) const;
+				/// Fills `fileNames` with the files written by `execute()`
+				/// in the current context.
+				void outputFileNames( std::vector<std::string> &fileNames ) const;
+				/// Returns a hash representing the contents of the files
+				/// written by `execute()` in the current context.
+				IECore::MurmurHash outputHash() const;
+				/// Returns true if the task has previously been executed with an
+				/// identical output hash and all its output files still exist. Hashes are only
+				/// recorded and queried when the "dispatcher:taskHashesDirectory" context
+				/// variable specifies where to store them, as it does when a Dispatcher
+				/// is skipping up-to-date tasks. Tasks without output files are never
+				/// considered to be up to date.
+				bool upToDate() const;
 
 		};
 
@@ -205,6 +220,19 @@ class GAFFERDISPATCH_API TaskNode : public Gaffer::DependencyNode
 		/// \todo Add `const TaskPlug *plug` argument.
 		virtual void postTasks( const Gaffer::Context *context, Tasks &tasks ) const;
 
+		/// Called by `TaskPlug::outputFileNames()`. The default implementation
+		/// outputs nothing, so that the task is always executed, even by Dispatchers
+		/// which skip up-to-date tasks. Derived nodes should append the names of any
+		/// files they write, so that the tasks may be skipped when the files are up
+		/// to date.
+		/// \todo Add `const TaskPlug *plug` argument.
+		virtual void outputFileNames( const Gaffer::Context *context, std::vector<std::string> &fileNames ) const;
+		/// Called by `TaskPlug::outputHash()`. This must vary whenever the contents
+		/// of the output files would vary, so unlike `hash()`, it must account for
+		/// the data being written as well as the parameters of the task. The default
+		/// implementation returns `hash()`.
+		/// \todo Add `const TaskPlug *plug` argument.
+		virtual IECore::MurmurHash outputHash( const Gaffer::Context *context ) const;
 		/// Called by `TaskPlug::hash()`. Derived nodes should first call the base
 		/// implementation and append to the returned hash. Nodes can indicate that they
 		/// don't cause side effects for the given context by returning a default hash.
@@ -226,6 +254,32 @@ class GAFFERDISPATCH_API TaskNode : public Gaffer::DependencyNode
 		/// \todo Add `const TaskPlug *plug, const Context *context` arguments.
 		virtual bool requiresSequenceExecution() const;
 
+		/// May be implemented to return true if the frames passed to
+		/// `executeSequence()` can be executed concurrently. This requires
+		/// that the work for each frame is thread-safe and independent of
+		/// the other frames, although writes may still be performed in frame
+		/// order using `executeFrames()`. The default implementation returns
+		/// false. If true, the default implementation of `executeSequence()`
+		/// calls `execute()` concurrently for frames with distinct output files.
+		/// \todo Add `const TaskPlug *plug, const Context *context` arguments.
+		virtual bool supportsConcurrentFrames() const;
+
+		/// Returns the number of frames that `executeFrames()` will execute
+		/// concurrently. This is 1 unless `supportsConcurrentFrames()` returns
+		/// true, in which case it is taken from the "taskNode:concurrentFrames"
+		/// context variable if it exists, and from the `dispatcher.concurrentFrames`
+		/// plug otherwise.
+		size_t concurrentFrames() const;
+
+		/// Utility for implementing `executeSequence()`. Calls `functor` for
+		/// each frame with the current context set to that frame, executing up
+		/// to `concurrentFrames()` frames concurrently. `functor` may return
+		/// another function, which will be called serially and in frame order,
+		/// again with the context set to the frame. This allows results to be
+		/// written to formats which require samples to be written in order.
+		using FrameFunctor = std::function<std::function<void ()> ()>;
+		void executeFrames( const std::vector<float> &frames, const FrameFunctor &functor ) const;
+
 	private :
 
 		// Friendship for the bindings.
@@ -166,6 +166,54 @@ class TaskNodeWrapper : public GafferBindings::DependencyNodeWrapper<WrappedType
 			return WrappedType::hash( context );
 		}
 
+		void outputFileNames( const Gaffer::Context *context, std::vector<std::string> &fileNames ) const override
+		{
+			if( this->isSubclassed() )
+			{
+				IECorePython::ScopedGILLock gilLock;
+				try
+				{
+					boost::python::object override = this->methodOverride( "outputFileNames" );
+					if( override )
+					{
+						boost::python::list pythonFileNames = boost::python::extract<boost::python::list>(
+							override( Gaffer::ContextPtr( const_cast<Gaffer::Context *>( context ) ) )
+						);
+						boost::python::container_utils::extend_container( fileNames, pythonFileNames );
+						return;
+					}
+				}
+				catch( const boost::python::error_already_set & )
+				{
+					IECorePython::ExceptionAlgo::translatePythonException();
+				}
+			}
+			WrappedType::outputFileNames( context, fileNames );
+		}
+
+		IECore::MurmurHash outputHash( const Gaffer::Context *context ) const override
+		{
+			if( this->isSubclassed() )
+			{
+				IECorePython::ScopedGILLock gilLock;
+				try
+				{
+					boost::python::object h = this->methodOverride( "outputHash" );
+					if( h )
+					{
+						return boost::python::extract<IECore::MurmurHash>(
+							h( Gaffer::ContextPtr( const_cast<Gaffer::Context *>( context ) ) )
+						);
+					}
+				}
+				catch( const boost::python::error_already_set & )
+				{
+					IECorePython::ExceptionAlgo::translatePythonException();
+				}
+			}
+			return WrappedType::outputHash( context );
+		}
+
 		void execute() const override
 		{
 			if( this->isSubclassed() )
@@ -236,6 +284,27 @@ class TaskNodeWrapper : public GafferBindings::DependencyNodeWrapper<WrappedType
 			return WrappedType::requiresSequenceExecution();
 		}
 
+		bool supportsConcurrentFrames() const override
+		{
+			if( this->isSubclassed() )
+			{
+				IECorePython::ScopedGILLock gilLock;
+				try
+				{
+					boost::python::object override = this->methodOverride( "supportsConcurrentFrames" );
+					if( override )
+					{
+						return override();
+					}
+				}
+				catch( const boost::python::error_already_set & )
+				{
+					IECorePython::ExceptionAlgo::translatePythonException();
+				}
+			}
+			return WrappedType::supportsConcurrentFrames();
+		}
+
 };
 
 } // namespace GafferDispatchBindings
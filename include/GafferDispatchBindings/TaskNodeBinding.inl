@@ -98,6 +98,31 @@ static IECore::MurmurHash hash( T &n, const Gaffer::Context *context )
 	return n.T::hash( context );
 }
 
+template<typename T>
+static boost::python::list outputFileNames( T &n, Gaffer::Context *context )
+{
+	std::vector<std::string> fileNames;
+
+	{
+		IECorePython::ScopedGILRelease gilRelease;
+		n.T::outputFileNames( context, fileNames );
+	}
+
+	boost::python::list result;
+	for( const auto &fileName : fileNames )
+	{
+		result.append( fileName );
+	}
+	return result;
+}
+
+template<typename T>
+static IECore::MurmurHash outputHash( T &n, const Gaffer::Context *context )
+{
+	IECorePython::ScopedGILRelease gilRelease;
+	return n.T::outputHash( context );
+}
+
 template<typename T>
 static void execute( T &n )
 {
@@ -120,6 +145,12 @@ static bool requiresSequenceExecution( T &n )
 	return n.T::requiresSequenceExecution();
 }
 
+template<typename T>
+static bool supportsConcurrentFrames( T &n )
+{
+	return n.T::supportsConcurrentFrames();
+}
+
 };
 
 } // namespace Detail
@@ -132,9 +163,12 @@ TaskNodeClass<T, Ptr>::TaskNodeClass( const char *docString )
 	this->def( "preTasks", &Detail::TaskNodeAccessor::preTasks<T> );
 	this->def( "postTasks", &Detail::TaskNodeAccessor::postTasks<T> );
 	this->def( "hash", &Detail::TaskNodeAccessor::hash<T> );
+	this->def( "outputFileNames", &Detail::TaskNodeAccessor::outputFileNames<T> );
+	this->def( "outputHash", &Detail::TaskNodeAccessor::outputHash<T> );
 	this->def( "execute", &Detail::TaskNodeAccessor::execute<T> );
 	this->def( "executeSequence", &Detail::TaskNodeAccessor::executeSequence<T> );
 	this->def( "requiresSequenceExecution", &Detail::TaskNodeAccessor::requiresSequenceExecution<T> );
+	this->def( "supportsConcurrentFrames", &Detail::TaskNodeAccessor::supportsConcurrentFrames<T> );
 }
 
 } // namespace GafferDispatchBindings
@@ -40,9 +40,11 @@
 #include "GafferImage/ImagePlug.h"
 
 #include "Gaffer/Context.h"
+#include "Gaffer/ParallelAlgo.h"
 
 #include "boost/tuple/tuple.hpp"
 
+#include "tbb/parallel_for.h"
 #include "tbb/pipeline.h"
 #include "tbb/task_scheduler_init.h"
 
@@ -150,6 +152,49 @@ class TileInputFilter
 
 };
 
+// Assigns horizontal bands of tiles to each NUMA node, so that operations
+// reading neighbouring tiles mostly find them on the same node. The
+// assignment doesn't depend on the window being processed, so a tile is
+// assigned to the same node each time it is processed.
+inline size_t numaNode( const Imath::V2i &tileOrigin, size_t numNodes )
+{
+	const int band = ImagePlug::tileIndex( tileOrigin ).y >> 3;
+	const int n = numNodes;
+	return ( ( band % n ) + n ) % n;
+}
+
+template<typename ProcessTileFunctor>
+void parallelProcessTilesNUMA( const Imath::Box2i &window, TileOrder tileOrder, ProcessTileFunctor &processTile )
+{
+	// Shared by all nodes, so that an exception on one node
+	// cancels the work on the others.
+	tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
+	Gaffer::ParallelAlgo::parallelForEachNUMANode(
+		[&] ( size_t node, size_t numNodes ) {
+
+			std::vector<Imath::V2i> tileOrigins;
+			for( TileInputIterator it( window, tileOrder ); !it.done(); ++it )
+			{
+				if( numaNode( *it, numNodes ) == node )
+				{
+					tileOrigins.push_back( *it );
+				}
+			}
+
+			tbb::parallel_for(
+				tbb::blocked_range<size_t>( 0, tileOrigins.size() ),
+				[&] ( const tbb::blocked_range<size_t> &range ) {
+					for( size_t i = range.begin(); i != range.end(); ++i )
+					{
+						processTile( tileOrigins[i] );
+					}
+				},
+				taskGroupContext
+			);
+		}
+	);
+}
+
 } // namespace Detail
 
 } // namespace ImageAlgo
@@ -266,8 +311,22 @@ void parallelProcessTiles( const ImagePlug *imagePlug, TileFunctor &&functor, co
 		return;
 	}
 
-	Detail::TileInputIterator tileIterator( processWindow, tileOrder );
 	const Gaffer::ThreadState &threadState = Gaffer::ThreadState::current();
+	auto processTile = [ imagePlug, &functor, &threadState ] ( const Imath::V2i &tileOrigin ) {
+
+		ImagePlug::ChannelDataScope channelDataScope( threadState );
+		channelDataScope.setTileOrigin( &tileOrigin );
+		functor( imagePlug, tileOrigin );
+
+	};
+
+	if( Gaffer::ParallelAlgo::getNUMANodes() > 1 && Gaffer::ParallelAlgo::currentNUMANode() == -1 )
+	{
+		Detail::parallelProcessTilesNUMA( processWindow, tileOrder, processTile );
+		return;
+	}
+
+	Detail::TileInputIterator tileIterator( processWindow, tileOrder );
 
 	tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
 	parallel_pipeline( tbb::task_scheduler_init::default_num_threads(),
@@ -278,17 +337,8 @@ void parallelProcessTiles( const ImagePlug *imagePlug, TileFunctor &&functor, co
 		) &
 
 		tbb::make_filter<Imath::V2i, void>(
-
 			tbb::filter::parallel,
-
-			[ imagePlug, &functor, &threadState ] ( const Imath::V2i &tileOrigin ) {
-
-				ImagePlug::ChannelDataScope channelDataScope( threadState );
-				channelDataScope.setTileOrigin( &tileOrigin );
-				functor( imagePlug, tileOrigin );
-
-			}
-
+			processTile
 		),
 
 		// Prevents outer tasks silently cancelling our tasks
@@ -114,7 +114,10 @@ class GAFFERIMAGE_API ImageWriter : public GafferDispatch::TaskNode
 	protected :
 
 		IECore::MurmurHash hash( const Gaffer::Context *context ) const override;
+		void outputFileNames( const Gaffer::Context *context, std::vector<std::string> &fileNames ) const override;
+		IECore::MurmurHash outputHash( const Gaffer::Context *context ) const override;
 		void execute() const override;
+		bool supportsConcurrentFrames() const override;
 
 	private :
 
@@ -91,6 +91,9 @@ class GAFFERIMAGE_API OpenImageIOReader : public ImageNode
 
 		static void setOpenFilesLimit( size_t maxOpenFiles );
 		static size_t getOpenFilesLimit();
+		/// Closes all files held open by the reader, so that subsequent
+		/// reads see any changes made to them.
+		static void clearFileCache();
 
 		static size_t supportedExtensions( std::vector<std::string> &extensions );
 
@@ -35,6 +35,7 @@
 //////////////////////////////////////////////////////////////////////////
 
 #include "Gaffer/Context.h"
+#include "Gaffer/ParallelAlgo.h"
 
 #include "tbb/concurrent_queue.h"
 #include "tbb/enumerable_thread_specific.h"
@@ -50,8 +51,15 @@ namespace GafferScene
 namespace Detail
 {
 
+// Assigns locations to NUMA nodes by name, so that a location is assigned
+// to the same node each time it is processed.
+inline size_t numaNode( const IECore::InternedString &name, size_t numNodes )
+{
+	return std::hash<std::string>()( name.string() ) % numNodes;
+}
+
 template<typename ThreadableFunctor>
-void parallelProcessLocationsWalk( const GafferScene::ScenePlug *scene, const Gaffer::ThreadState &threadState, const ScenePlug::ScenePath &path, ThreadableFunctor &f, tbb::task_group_context &taskGroupContext )
+void parallelProcessLocationsWalk( const GafferScene::ScenePlug *scene, const Gaffer::ThreadState &threadState, const ScenePlug::ScenePath &path, ThreadableFunctor &f, tbb::task_group_context &taskGroupContext, bool distributeNUMA = false )
 {
 	ScenePlug::PathScope pathScope( threadState, &path );
 
@@ -81,10 +89,36 @@ void parallelProcessLocationsWalk( const GafferScene::ScenePlug *scene, const Ga
 		}
 	};
 
-	if( childNames.size() > 1 )
+	if( childNames.size() > 1 && distributeNUMA )
+	{
+		// Distribute the children between NUMA nodes. Their descendants
+		// are processed on the same node.
+		Gaffer::ParallelAlgo::parallelForEachNUMANode(
+			[&] ( size_t node, size_t numNodes ) {
+				std::vector<IECore::InternedString> nodeChildNames;
+				for( const auto &childName : childNames )
+				{
+					if( numaNode( childName, numNodes ) == node )
+					{
+						nodeChildNames.push_back( childName );
+					}
+				}
+				tbb::parallel_for( ChildNameRange( nodeChildNames.cbegin(), nodeChildNames.cend() ), loopBody, taskGroupContext );
+			}
+		);
+	}
+	else if( childNames.size() > 1 )
 	{
 		tbb::parallel_for( loopRange, loopBody, taskGroupContext );
 	}
+	else if( distributeNUMA )
+	{
+		// Keep looking for a location with several children.
+		ScenePlug::ScenePath childPath = path;
+		childPath.push_back( childNames.front() );
+		ThreadableFunctor childFunctor( f );
+		parallelProcessLocationsWalk( scene, threadState, childPath, childFunctor, taskGroupContext, true );
+	}
 	else
 	{
 		// Serial execution
@@ -156,7 +190,8 @@ template <class ThreadableFunctor>
 void parallelProcessLocations( const GafferScene::ScenePlug *scene, ThreadableFunctor &f, const ScenePlug::ScenePath &root )
 {
 	tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated ); // Prevents outer tasks silently cancelling our tasks
-	Detail::parallelProcessLocationsWalk( scene, Gaffer::ThreadState::current(), root, f, taskGroupContext );
+	const bool distributeNUMA = Gaffer::ParallelAlgo::getNUMANodes() > 1 && Gaffer::ParallelAlgo::currentNUMANode() == -1;
+	Detail::parallelProcessLocationsWalk( scene, Gaffer::ThreadState::current(), root, f, taskGroupContext, distributeNUMA );
 }
 
 template <class ThreadableFunctor>
@@ -72,6 +72,10 @@ class GAFFERSCENE_API SceneWriter : public GafferDispatch::TaskNode
 
 	protected :
 
+		void outputFileNames( const Gaffer::Context *context, std::vector<std::string> &fileNames ) const override;
+		/// Re-implemented to hash the scene itself, since `hash()` does not.
+		IECore::MurmurHash outputHash( const Gaffer::Context *context ) const override;
+
 		void execute() const override;
 
 		/// Re-implemented to open the file for writing, then iterate through the
@@ -81,8 +85,13 @@ class GAFFERSCENE_API SceneWriter : public GafferDispatch::TaskNode
 		/// Re-implemented to return true, since the entire file must be written at once.
 		bool requiresSequenceExecution() const override;
 
+		/// Re-implemented to return true. Frames are gathered concurrently, and
+		/// written in order.
+		bool supportsConcurrentFrames() const override;
+
 	private :
 
+		void executeConcurrentFrames( const std::vector<float> &frames ) const;
 		void createDirectories( const std::string &fileName ) const;
 
 		static size_t g_firstPlugIndex;
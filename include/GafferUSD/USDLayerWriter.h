@@ -78,6 +78,7 @@ class GAFFERUSD_API USDLayerWriter : public GafferDispatch::TaskNode
 		bool requiresSequenceExecution() const override;
 		void execute() const override;
 		void executeSequence( const std::vector<float> &frames ) const override;
+		bool supportsConcurrentFrames() const override;
 
 	private :
 
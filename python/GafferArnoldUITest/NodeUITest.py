@@ -36,9 +36,12 @@
 
 import unittest
 
+import Gaffer
+import GafferTest
+import GafferUI
+import GafferUITest
 import GafferArnold
 import GafferArnoldUI
-import GafferUITest
 
 class NodeUITest( GafferUITest.TestCase ) :
 
@@ -46,5 +49,25 @@ class NodeUITest( GafferUITest.TestCase ) :
 
 		self.assertNodeUIsHaveExpectedLifetime( GafferArnold )
 
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testArnoldOptionsNodeEditorPerformance( self ) :
+
+		s = Gaffer.ScriptNode()
+		s["options"] = GafferArnold.ArnoldOptions()
+		s["smallNode"] = Gaffer.Node()
+
+		a = Gaffer.StandardSet( [ s["smallNode"] ] )
+		b = Gaffer.StandardSet( [ s["options"] ] )
+
+		sw = GafferUI.ScriptWindow.acquire( s )
+		ne = GafferUI.NodeEditor.acquire( s["smallNode"] )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			for i in range( 2 ) :
+				ne.setNodeSet( b )
+				ne.nodeUI()
+				ne.setNodeSet( a )
+				ne.nodeUI()
+
 if __name__ == "__main__":
 	unittest.main()
@@ -39,6 +39,7 @@ import collections
 import datetime
 import enum
 import functools
+import json
 import os
 import re
 import signal
@@ -47,6 +48,7 @@ import subprocess
 import threading
 import time
 import traceback
+import uuid
 
 import psutil
 
@@ -64,6 +66,9 @@ class LocalDispatcher( GafferDispatch.Dispatcher ) :
 		self["executeInBackground"] = Gaffer.BoolPlug( defaultValue = False )
 		self["ignoreScriptLoadErrors"] = Gaffer.BoolPlug( defaultValue = False )
 		self["environmentCommand"] = Gaffer.StringPlug()
+		self["concurrentBatches"] = Gaffer.IntPlug( defaultValue = 1, minValue = 1 )
+		self["memoryPerBatch"] = Gaffer.FloatPlug( defaultValue = 0, minValue = 0 )
+		self["persistentWorkers"] = Gaffer.BoolPlug( defaultValue = False )
 
 		self.__jobPool = jobPool if jobPool else LocalDispatcher.defaultJobPool()
 
@@ -92,6 +97,9 @@ class LocalDispatcher( GafferDispatch.Dispatcher ) :
 			self.__ignoreScriptLoadErrors = dispatcher["ignoreScriptLoadErrors"].getValue()
 			self.__environmentCommand = dispatcher["environmentCommand"].getValue()
 			self.__executeInBackground = dispatcher["executeInBackground"].getValue()
+			self.__concurrentBatches = dispatcher["concurrentBatches"].getValue()
+			self.__memoryPerBatch = int( dispatcher["memoryPerBatch"].getValue() * 1024 ** 3 )
+			self.__persistentWorkers = dispatcher["persistentWorkers"].getValue()
 
 			if self.__executeInBackground :
 				application = script.ancestor( Gaffer.ApplicationRoot )
@@ -114,7 +122,8 @@ class LocalDispatcher( GafferDispatch.Dispatcher ) :
 
 			self.__statusChangedSignal = Gaffer.Signal1()
 
-			self.__currentProcess = None
+			self.__currentProcesses = []
+			self.__currentProcessesMutex = threading.Lock()
 			self.__status = self.Status.Waiting
 			self.__backgroundTask = None
 
@@ -149,29 +158,24 @@ class LocalDispatcher( GafferDispatch.Dispatcher ) :
 			else :
 				return datetime.datetime.now( datetime.timezone.utc ) - self.__startTime
 
+		# When batches are executed concurrently, returns the ID of the
+		# process that was launched first.
 		def processID( self ) :
 
-			return self.__currentProcess.pid if self.__currentProcess is not None else None
+			with self.__currentProcessesMutex :
+				return self.__currentProcesses[0].pid if self.__currentProcesses else None
 
+		# When batches are executed concurrently, returns the total for all
+		# processes.
 		def memoryUsage( self ) :
 
-			if self.__currentProcess is None :
-				return None
-
-			try :
-				return self.__currentProcess.memory_info().rss
-			except psutil.NoSuchProcess :
-				return None
+			return self.__processesTotal( lambda p : p.memory_info().rss )
 
+		# When batches are executed concurrently, returns the total for all
+		# processes.
 		def cpuUsage( self ) :
 
-			if self.__currentProcess is None :
-				return None
-
-			try :
-				return self.__currentProcess.cpu_percent()
-			except psutil.NoSuchProcess :
-				return None
+			return self.__processesTotal( lambda p : p.cpu_percent() )
 
 		def status( self ) :
 
@@ -217,7 +221,10 @@ class LocalDispatcher( GafferDispatch.Dispatcher ) :
 			with self.__messageHandler :
 				self.__updateStatus( self.Status.Running )
 				try :
-					self.__executeWalk( self.__rootBatch, canceller )
+					if self.__concurrentBatches > 1 :
+						self.__executeConcurrently( canceller )
+					else :
+						self.__executeWalk( self.__rootBatch, canceller )
 				except IECore.Cancelled :
 					self.__updateStatus( self.Status.Killed )
 				except :
@@ -240,14 +247,21 @@ class LocalDispatcher( GafferDispatch.Dispatcher ) :
 				assert( batch is self.__rootBatch )
 				return
 
-			if len( batch.frames() ) == 0 :
-				# This case occurs for nodes like TaskList and
-				# TaskContextProcessors, because they don't do anything in
-				# execute (they have empty hashes). Their batches exist only to
-				# depend on upstream batches, so we don't need to do any work
-				# here.
+			if self.__isNoOp( batch ) :
 				return
 
+			self.__executeAndReportBatch( batch, canceller )
+
+		def __isNoOp( self, batch ) :
+
+			# Batches without frames occur for nodes like TaskList and
+			# TaskContextProcessors, because they don't do anything in execute
+			# (they have empty hashes). Their batches exist only to depend on
+			# upstream batches, so we don't need to do any work for them.
+			return batch.plug() is None or len( batch.frames() ) == 0
+
+		def __executeAndReportBatch( self, batch, canceller ) :
+
 			IECore.Canceller.check( canceller )
 
 			frames = "frame{framesPlural} {frames}".format(
@@ -279,6 +293,143 @@ class LocalDispatcher( GafferDispatch.Dispatcher ) :
 				)
 				raise e
 
+		# Executes batches concurrently, starting each one as soon as its
+		# preTasks have completed and a slot is free. When several batches
+		# are ready, they are started in the order `__executeWalk()` would
+		# have executed them.
+		def __executeConcurrently( self, canceller ) :
+
+			batches = []
+			self.__orderWalk( self.__rootBatch, batches )
+
+			# Count the preTasks each batch is waiting for, and
+			# find the batches waiting for each batch.
+
+			waitingFor = [ 0 ] * len( batches )
+			dependents = [ [] for b in batches ]
+			for index, batch in enumerate( batches ) :
+				for upstreamBatch in batch.preTasks() :
+					if "localDispatcher:executed" in upstreamBatch.blindData() :
+						continue
+					waitingFor[index] += 1
+					dependents[upstreamBatch.blindData()["localDispatcher:index"].value].append( index )
+
+			ready = [ i for i, n in enumerate( waitingFor ) if n == 0 ]
+			running = {}
+			errors = []
+			condition = threading.Condition()
+
+			def batchCompleted( index ) :
+
+				for dependent in dependents[index] :
+					waitingFor[dependent] -= 1
+					if waitingFor[dependent] == 0 :
+						ready.append( dependent )
+				ready.sort()
+
+			def executeBatch( index ) :
+
+				batch = batches[index]
+				error = None
+				with self.__messageHandler :
+					try :
+						self.__executeAndReportBatch( batch, canceller )
+					except Exception as e :
+						error = e
+
+				with condition :
+					del running[index]
+					if error is not None :
+						errors.append( error )
+					else :
+						batchCompleted( index )
+					condition.notify()
+
+			with condition :
+
+				while True :
+
+					if canceller is not None and canceller.cancelled() and not errors :
+						errors.append( IECore.Cancelled() )
+
+					# Completing a no-op may make more batches ready
+					# immediately, so we loop until there are none.
+					completedNoOp = not errors
+					while completedNoOp :
+						completedNoOp = False
+						for index in list( ready ) :
+							batch = batches[index]
+							if self.__isNoOp( batch ) :
+								ready.remove( index )
+								batchCompleted( index )
+								completedNoOp = True
+							elif len( running ) < self.__concurrentBatches and self.__canStart( batch, [ batches[i] for i in running ] ) :
+								ready.remove( index )
+								running[index] = threading.Thread(
+									target = executeBatch, args = [ index ],
+									name = "localDispatcherBatch",
+								)
+								running[index].start()
+
+					if not running and ( errors or not ready ) :
+						break
+
+					# We use a timeout so that we poll for cancellation, and
+					# for memory to become available.
+					condition.wait( 0.1 )
+
+			if errors :
+				raise errors[0]
+
+		def __orderWalk( self, batch, batches ) :
+
+			if "localDispatcher:index" in batch.blindData() :
+				# Visited this batch by another path
+				return
+
+			# Mark as visited before recursing, so that we
+			# don't revisit it.
+			batch.blindData()["localDispatcher:index"] = IECore.IntData( -1 )
+			for upstreamBatch in batch.preTasks() :
+				self.__orderWalk( upstreamBatch, batches )
+
+			if "localDispatcher:executed" in batch.blindData() :
+				# Already executed by a previous dispatch
+				# of the same batch graph.
+				return
+
+			batch.blindData()["localDispatcher:index"] = IECore.IntData( len( batches ) )
+			batches.append( batch )
+
+		# Returns True if `batch` may be started while the `running`
+		# batches are executing.
+		def __canStart( self, batch, running ) :
+
+			if not running :
+				return True
+
+			# Batches which require sequence execution must not run
+			# concurrently with other batches from the same node.
+			if batch.blindData()["localDispatcher:requiresSequenceExecution"].value :
+				nodeName = batch.blindData()["nodeName"].value
+				if any( b.blindData()["nodeName"].value == nodeName for b in running ) :
+					return False
+
+			if not self.__memoryPerBatch :
+				return True
+
+			# Running batches may still grow to use their full budget,
+			# so we must reserve memory for that as well.
+			available = psutil.virtual_memory().available
+			with self.__currentProcessesMutex :
+				for process in self.__currentProcesses :
+					try :
+						available -= max( 0, self.__memoryPerBatch - process.memory_info().rss )
+					except psutil.NoSuchProcess :
+						pass
+
+			return available >= self.__memoryPerBatch
+
 		def __executeBatch( self, batch, canceller ) :
 
 			# Simple case for foreground execution.
@@ -287,50 +438,46 @@ class LocalDispatcher( GafferDispatch.Dispatcher ) :
 				batch.execute()
 				return
 
-			# Background execution. Launch a separate process.
-			# Start by building the command arguments.
+			# Background execution. Start by building the arguments
+			# describing the batch.
 
 			taskContext = batch.context()
+			nodeName = batch.blindData()["nodeName"].value
 			frames = str( IECore.frameListFromList( [ int(x) for x in batch.frames() ] ) )
 
+			contextArgs = []
+			for entry in [ k for k in taskContext.keys() if k != "frame" and not k.startswith( "ui:" ) ] :
+				if entry not in self.__context.keys() or taskContext[entry] != self.__context[entry] :
+					contextArgs.extend( [ "-" + entry, IECore.repr( taskContext[entry] ) ] )
+
+			if self.__persistentWorkers :
+				self.__executeInWorker( nodeName, frames, contextArgs, canceller )
+				return
+
+			# Launch a separate process.
+
 			args = shlex.split( self.__environmentCommand ) + [
 				str( Gaffer.executablePath() ),
 				"execute",
 				"-script", str( self.__scriptFile ),
-				"-nodes", batch.blindData()["nodeName"].value,
+				"-nodes", nodeName,
 				"-frames", frames,
 			]
 
 			if self.__ignoreScriptLoadErrors :
 				args.append( "-ignoreScriptLoadErrors" )
 
-			contextArgs = []
-			for entry in [ k for k in taskContext.keys() if k != "frame" and not k.startswith( "ui:" ) ] :
-				if entry not in self.__context.keys() or taskContext[entry] != self.__context[entry] :
-					contextArgs.extend( [ "-" + entry, IECore.repr( taskContext[entry] ) ] )
-
 			if contextArgs :
 				args.extend( [ "-context" ] + contextArgs )
 
-			# Build environment. We want to enable all Cortex message levels so
-			# we can capture everything and then let the LocalJobs UI filter
-			# it dynamically.
-
-			env = os.environ.copy()
-			env["IECORE_LOG_LEVEL"] = "DEBUG"
-
 			# Launch process.
 
-			IECore.msg( IECore.Msg.Level.Debug, batch.blindData()["nodeName"].value, "Executing `{}`".format( " ".join( args ) ) )
+			IECore.msg( IECore.Msg.Level.Debug, nodeName, "Executing `{}`".format( " ".join( args ) ) )
 
-			platformKW = { "start_new_session" : True } if os.name != "nt" else {}
-			process = subprocess.Popen(
-				args,
-				text = True, stdout = subprocess.PIPE, stderr = subprocess.STDOUT,
-				shell = os.name == "nt" and self.__environmentCommand, env = env,
-				**platformKW,
-			)
-			self.__currentProcess = psutil.Process( process.pid )
+			process = _launchProcess( args, self.__environmentCommand )
+			currentProcess = psutil.Process( process.pid )
+			with self.__currentProcessesMutex :
+				self.__currentProcesses.append( currentProcess )
 
 			# Launch a thread to monitor the output stream and feed it into a
 			# our message handler. We must do this on a thread because reading
@@ -350,7 +497,7 @@ class LocalDispatcher( GafferDispatch.Dispatcher ) :
 
 			outputHandler = threading.Thread(
 				target = handleOutput,
-				args = [ process.stdout, str( batch.blindData()["nodeName"] ), self.__messageHandler ],
+				args = [ process.stdout, nodeName, self.__messageHandler ],
 				name = "localDispatcherOutputHandler",
 			)
 			outputHandler.start()
@@ -363,11 +510,7 @@ class LocalDispatcher( GafferDispatch.Dispatcher ) :
 				while process.poll() is None :
 
 					if canceller is not None and canceller.cancelled() :
-						if os.name == "nt" :
-							for toKill in self.__currentProcess.children( recursive = True ) + [ self.__currentProcess ] :
-								toKill.kill()
-						else :
-							os.killpg( process.pid, signal.SIGTERM )
+						_killProcess( process )
 						raise IECore.Cancelled()
 
 					time.sleep( 0.01 )
@@ -380,9 +523,55 @@ class LocalDispatcher( GafferDispatch.Dispatcher ) :
 
 			finally :
 
-				self.__currentProcess = None
+				with self.__currentProcessesMutex :
+					self.__currentProcesses.remove( currentProcess )
 				outputHandler.join()
 
+		def __executeInWorker( self, nodeName, frames, contextArgs, canceller ) :
+
+			worker = _workerPool.acquire(
+				self.__environmentCommand, self.__scriptFile, self.__ignoreScriptLoadErrors,
+				nodeName, self.__messageHandler
+			)
+
+			IECore.msg(
+				IECore.Msg.Level.Debug, nodeName,
+				"Executing frames {} in worker process {}".format( frames, worker.process().pid )
+			)
+
+			with self.__currentProcessesMutex :
+				self.__currentProcesses.append( worker.process() )
+
+			try :
+				worker.execute(
+					{
+						"script" : str( self.__scriptFile ),
+						"ignoreScriptLoadErrors" : self.__ignoreScriptLoadErrors,
+						"nodes" : [ nodeName ],
+						"frames" : frames,
+						"context" : contextArgs,
+					},
+					nodeName, self.__messageHandler, canceller
+				)
+			finally :
+				with self.__currentProcessesMutex :
+					self.__currentProcesses.remove( worker.process() )
+				_workerPool.release( worker )
+
+		def __processesTotal( self, f ) :
+
+			with self.__currentProcessesMutex :
+				processes = list( self.__currentProcesses )
+
+			result = None
+			for process in processes :
+				try :
+					result = f( process ) + ( result or 0 )
+				except psutil.NoSuchProcess :
+					pass
+
+			return result
+
 		def __initBatchWalk( self, batch ) :
 
 			if "nodeName" in batch.blindData() :
@@ -390,9 +579,14 @@ class LocalDispatcher( GafferDispatch.Dispatcher ) :
 				return
 
 			nodeName = ""
+			requiresSequenceExecution = False
 			if batch.plug() is not None :
 				nodeName = batch.plug().node().relativeName( batch.plug().node().scriptNode() )
+				if self.__concurrentBatches > 1 :
+					with batch.context() :
+						requiresSequenceExecution = batch.plug().requiresSequenceExecution()
 			batch.blindData()["nodeName"] = nodeName
+			batch.blindData()["localDispatcher:requiresSequenceExecution"] = IECore.BoolData( requiresSequenceExecution )
 
 			for upstreamBatch in batch.preTasks() :
 				self.__initBatchWalk( upstreamBatch )
@@ -497,6 +691,14 @@ class LocalDispatcher( GafferDispatch.Dispatcher ) :
 
 		return self.__jobPool
 
+	## Stops all idle worker processes launched for the `persistentWorkers`
+	# mode. Workers are otherwise kept alive until the application exits, so
+	# this may be used to release the memory they hold.
+	@staticmethod
+	def stopWorkers() :
+
+		_workerPool.stop()
+
 	def _doDispatch( self, batch ) :
 
 		job = LocalDispatcher.Job(
@@ -558,6 +760,193 @@ class _MessageHandler( IECore.MessageHandler ) :
 
 		self.__messagesChangedSignal()
 
+def _launchProcess( args, environmentCommand, stdin = None, environment = {} ) :
+
+	# We want to enable all Cortex message levels so we can capture
+	# everything and then let the LocalJobs UI filter it dynamically.
+
+	env = os.environ.copy()
+	env["IECORE_LOG_LEVEL"] = "DEBUG"
+	env.update( environment )
+
+	platformKW = { "start_new_session" : True } if os.name != "nt" else {}
+	return subprocess.Popen(
+		args,
+		text = True, stdin = stdin, stdout = subprocess.PIPE, stderr = subprocess.STDOUT,
+		shell = os.name == "nt" and environmentCommand, env = env,
+		**platformKW,
+	)
+
+def _killProcess( process ) :
+
+	if os.name == "nt" :
+		try :
+			toKill = psutil.Process( process.pid )
+			for p in toKill.children( recursive = True ) + [ toKill ] :
+				p.kill()
+		except psutil.NoSuchProcess :
+			pass
+	else :
+		try :
+			os.killpg( process.pid, signal.SIGTERM )
+		except ProcessLookupError :
+			pass
+
+## A long-lived `gaffer execute -worker` process, which keeps the script
+# loaded and caches warm between batches.
+class _Worker( object ) :
+
+	def __init__( self, environmentCommand, scriptFile, ignoreScriptLoadErrors, messageContext, messageHandler ) :
+
+		self.__environmentCommand = environmentCommand
+
+		# Marks the end of each batch in the output stream. We use a unique
+		# value so it can't be confused with output from the batch itself.
+		self.__resultPrefix = "gaffer execute : result {}".format( uuid.uuid4().hex )
+
+		self.__condition = threading.Condition()
+		self.__result = None
+		self.__outputClosed = False
+		self.__killed = False
+		self.__messageContext = messageContext
+		self.__messageHandler = messageHandler
+
+		self.__args = shlex.split( environmentCommand ) + [
+			str( Gaffer.executablePath() ),
+			"execute", "-worker",
+			"-script", str( scriptFile ),
+		]
+
+		if ignoreScriptLoadErrors :
+			self.__args.append( "-ignoreScriptLoadErrors" )
+
+		IECore.msg( IECore.Msg.Level.Debug, messageContext, "Launching worker `{}`".format( " ".join( self.__args ) ) )
+
+		self.__process = _launchProcess(
+			self.__args, environmentCommand, stdin = subprocess.PIPE,
+			environment = { "GAFFER_EXECUTE_WORKER_RESULT_PREFIX" : self.__resultPrefix }
+		)
+		self.__psutilProcess = psutil.Process( self.__process.pid )
+
+		self.__outputHandler = threading.Thread(
+			target = self.__handleOutput,
+			name = "localDispatcherWorkerOutputHandler",
+			daemon = True,
+		)
+		self.__outputHandler.start()
+
+	def environmentCommand( self ) :
+
+		return self.__environmentCommand
+
+	def process( self ) :
+
+		return self.__psutilProcess
+
+	def alive( self ) :
+
+		with self.__condition :
+			return not ( self.__outputClosed or self.__killed ) and self.__process.poll() is None
+
+	def execute( self, request, messageContext, messageHandler, canceller ) :
+
+		with self.__condition :
+			self.__result = None
+			self.__messageContext = messageContext
+			self.__messageHandler = messageHandler
+
+		try :
+			self.__process.stdin.write( json.dumps( request ) + "\n" )
+			self.__process.stdin.flush()
+		except OSError :
+			# Worker has died. We'll report it below.
+			pass
+
+		with self.__condition :
+			while self.__result is None and not self.__outputClosed :
+				if canceller is not None and canceller.cancelled() :
+					self.__killed = True
+					_killProcess( self.__process )
+					raise IECore.Cancelled()
+				self.__condition.wait( 0.01 )
+			result = self.__result
+
+		if result is None :
+			raise subprocess.CalledProcessError( self.__process.wait(), " ".join( self.__args ) )
+		elif result :
+			raise subprocess.CalledProcessError(
+				result, "{} (worker request `{}`)".format( " ".join( self.__args ), json.dumps( request ) )
+			)
+
+	def stop( self ) :
+
+		try :
+			self.__process.stdin.close()
+			self.__process.wait( timeout = 10 )
+		except ( OSError, subprocess.TimeoutExpired ) :
+			_killProcess( self.__process )
+		self.__outputHandler.join()
+
+	def __handleOutput( self ) :
+
+		stream = self.__process.stdout
+		for line in iter( stream.readline, "" ) :
+			line = line[:-1]
+			if line.startswith( self.__resultPrefix ) :
+				with self.__condition :
+					self.__result = int( line[len(self.__resultPrefix):] )
+					self.__condition.notify_all()
+				continue
+			message, level = _messageLevel( line )
+			with self.__condition :
+				messageContext, messageHandler = self.__messageContext, self.__messageHandler
+			messageHandler.handle( level, messageContext, message )
+
+		stream.close()
+		with self.__condition :
+			self.__outputClosed = True
+			self.__condition.notify_all()
+
+## Maintains idle workers for reuse by subsequent batches. Workers are launched
+# on demand, so the size of the pool grows to match the number of batches
+# executed concurrently.
+class _WorkerPool( object ) :
+
+	def __init__( self ) :
+
+		self.__mutex = threading.Lock()
+		self.__idleWorkers = []
+
+	def acquire( self, environmentCommand, scriptFile, ignoreScriptLoadErrors, messageContext, messageHandler ) :
+
+		with self.__mutex :
+			self.__idleWorkers = [ w for w in self.__idleWorkers if w.alive() ]
+			for i, worker in enumerate( self.__idleWorkers ) :
+				if worker.environmentCommand() == environmentCommand :
+					return self.__idleWorkers.pop( i )
+
+		return _Worker( environmentCommand, scriptFile, ignoreScriptLoadErrors, messageContext, messageHandler )
+
+	def release( self, worker ) :
+
+		if not worker.alive() :
+			return
+
+		with self.__mutex :
+			self.__idleWorkers.append( worker )
+
+	def stop( self ) :
+
+		with self.__mutex :
+			workers = self.__idleWorkers
+			self.__idleWorkers = []
+
+		for worker in workers :
+			worker.stop()
+
+_workerPool = _WorkerPool()
+atexit.register( _workerPool.stop )
+
 __messageLevelRE = re.compile(
 	r"(DEBUG|INFO|WARNING|ERROR) +[:|] ",
 )
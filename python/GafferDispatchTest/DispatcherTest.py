@@ -1282,6 +1282,96 @@ class DispatcherTest( GafferTest.TestCase ) :
 			# we're mostly just testing the internal Batcher machinery in Dispatcher.
 			dispatcher["task"].execute()
 
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 1 )
+	def testWedgeBatcherPerformance( self ) :
+
+		script = Gaffer.ScriptNode()
+		script["taskList1"] = GafferDispatch.TaskList()
+		script["taskList2"] = GafferDispatch.TaskList()
+		script["taskList2"]["preTasks"][0].setInput( script["taskList1"]["task"] )
+
+		script["wedge"] = GafferDispatch.Wedge()
+		script["wedge"]["preTasks"][0].setInput( script["taskList2"]["task"] )
+		script["wedge"]["mode"].setValue( int( GafferDispatch.Wedge.Mode.IntRange ) )
+		script["wedge"]["intMin"].setValue( 1 )
+		script["wedge"]["intMax"].setValue( 50 )
+
+		dispatcher = GafferDispatchTest.DispatcherTest.NullDispatcher()
+		dispatcher["tasks"][0].setInput( script["wedge"]["task"] )
+		dispatcher["framesMode"].setValue( dispatcher.FramesMode.CustomRange )
+		dispatcher["frameRange"].setValue( "1-2000" )
+		dispatcher["jobsDirectory"].setValue( self.temporaryDirectory() )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			# 2000 frames * 50 variants * 2 tasks, plus 2000 Wedge tasks.
+			dispatcher["task"].execute()
+
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 1 )
+	def testLargeBatcherPerformance( self ) :
+
+		script = Gaffer.ScriptNode()
+
+		script["wedge"] = GafferDispatch.Wedge()
+		script["wedge"]["mode"].setValue( int( GafferDispatch.Wedge.Mode.IntRange ) )
+		script["wedge"]["intMin"].setValue( 1 )
+		script["wedge"]["intMax"].setValue( 50 )
+
+		for i in range( 0, 10 ) :
+			script["taskList{}".format( i )] = GafferDispatch.TaskList()
+			if i :
+				script["taskList{}".format( i )]["preTasks"][0].setInput( script["taskList{}".format( i - 1 )]["task"] )
+			script["wedge"]["preTasks"][i].setInput( script["taskList{}".format( i )]["task"] )
+
+		dispatcher = GafferDispatchTest.DispatcherTest.NullDispatcher()
+		dispatcher["tasks"][0].setInput( script["wedge"]["task"] )
+		dispatcher["framesMode"].setValue( dispatcher.FramesMode.CustomRange )
+		dispatcher["frameRange"].setValue( "1-2000" )
+		dispatcher["jobsDirectory"].setValue( self.temporaryDirectory() )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			# 2000 frames * 50 variants * 10 tasks, plus 2000 Wedge tasks.
+			dispatcher["task"].execute()
+
+	def testPreTasksEvaluatedOncePerContext( self ) :
+
+		class CountingTaskNode( GafferDispatch.TaskNode ) :
+
+			def __init__( self, name = "CountingTaskNode" ) :
+
+				GafferDispatch.TaskNode.__init__( self, name )
+				self.preTasksCount = 0
+
+			def preTasks( self, context ) :
+
+				self.preTasksCount += 1
+				return GafferDispatch.TaskNode.preTasks( self, context )
+
+			def hash( self, context ) :
+
+				h = GafferDispatch.TaskNode.hash( self, context )
+				h.append( context.getFrame() )
+				return h
+
+		s = Gaffer.ScriptNode()
+		s["counter"] = CountingTaskNode()
+
+		s["taskList1"] = GafferDispatch.TaskList()
+		s["taskList1"]["preTasks"][0].setInput( s["counter"]["task"] )
+		s["taskList2"] = GafferDispatch.TaskList()
+		s["taskList2"]["preTasks"][0].setInput( s["counter"]["task"] )
+
+		dispatcher = GafferDispatchTest.DispatcherTest.NullDispatcher()
+		dispatcher["tasks"][0].setInput( s["taskList1"]["task"] )
+		dispatcher["tasks"][1].setInput( s["taskList2"]["task"] )
+		dispatcher["framesMode"].setValue( dispatcher.FramesMode.CustomRange )
+		dispatcher["frameRange"].setValue( "1-10" )
+		dispatcher["jobsDirectory"].setValue( self.temporaryDirectory() )
+		dispatcher["task"].execute()
+
+		# The counter is reached via two paths on each frame, but
+		# its preTasks should only be evaluated once per frame.
+		self.assertEqual( s["counter"].preTasksCount, 10 )
+
 	def testDirectCyles( self ) :
 
 		s = Gaffer.ScriptNode()
@@ -2337,5 +2427,136 @@ class DispatcherTest( GafferTest.TestCase ) :
 		pythonCommand = GafferDispatch.PythonCommand()
 		self.assertIs( SetupPlugsTestDispatcher.lastNode, pythonCommand )
 
+	def testSkipUpToDateTasks( self ) :
+
+		s = Gaffer.ScriptNode()
+
+		s["a"] = GafferDispatchTest.TextWriter()
+		s["a"]["fileName"].setValue( self.temporaryDirectory() / "a.####.txt" )
+		s["a"]["text"].setValue( "a" )
+
+		s["b"] = GafferDispatchTest.TextWriter()
+		s["b"]["preTasks"][0].setInput( s["a"]["task"] )
+		s["b"]["fileName"].setValue( self.temporaryDirectory() / "b.####.txt" )
+		s["b"]["text"].setValue( "b" )
+
+		s["dispatcher"] = GafferDispatch.Dispatcher.create( "testDispatcher" )
+		s["dispatcher"]["tasks"][0].setInput( s["b"]["task"] )
+		s["dispatcher"]["framesMode"].setValue( GafferDispatch.Dispatcher.FramesMode.CustomRange )
+		s["dispatcher"]["frameRange"].setValue( "1-4" )
+		s["dispatcher"]["skipUpToDateTasks"].setValue( True )
+
+		def fileName( node, frame ) :
+			return self.temporaryDirectory() / "{}.{:04d}.txt".format( node, frame )
+
+		def markFiles() :
+			for node in "ab" :
+				for frame in range( 1, 5 ) :
+					fileName( node, frame ).write_text( "stale" )
+
+		def executed() :
+			return {
+				"{}{}".format( node, frame )
+				for node in "ab" for frame in range( 1, 5 )
+				if fileName( node, frame ).read_text() != "stale"
+			}
+
+		# First dispatch executes everything.
+
+		s["dispatcher"]["task"].execute()
+		self.assertEqual( executed(), { "a1", "a2", "a3", "a4", "b1", "b2", "b3", "b4" } )
+
+		with Gaffer.Context() as c :
+			c["dispatcher:taskHashesDirectory"] = ( self.temporaryDirectory() / "taskHashes" ).as_posix()
+			c.setFrame( 1 )
+			self.assertTrue( s["a"]["task"].upToDate() )
+			self.assertTrue( s["b"]["task"].upToDate() )
+		self.assertFalse( s["a"]["task"].upToDate() )
+
+		# Second dispatch executes nothing, because everything is
+		# up to date.
+
+		markFiles()
+		s["dispatcher"]["task"].execute()
+		self.assertEqual( executed(), set() )
+
+		# Editing the downstream node only executes that node.
+
+		s["b"]["text"].setValue( "bb" )
+		s["dispatcher"]["task"].execute()
+		self.assertEqual( executed(), { "b1", "b2", "b3", "b4" } )
+
+		# Editing the upstream node executes both, because the
+		# downstream node may depend on the files that are written.
+
+		markFiles()
+		s["a"]["text"].setValue( "aa" )
+		s["dispatcher"]["task"].execute()
+		self.assertEqual( executed(), { "a1", "a2", "a3", "a4", "b1", "b2", "b3", "b4" } )
+
+		# Missing outputs are written again.
+
+		markFiles()
+		fileName( "b", 2 ).unlink()
+		s["dispatcher"]["task"].execute()
+		self.assertEqual( executed(), { "b2" } )
+
+		# Reverting an edit is not mistaken for being up to date.
+
+		markFiles()
+		s["b"]["text"].setValue( "b" )
+		s["dispatcher"]["task"].execute()
+		self.assertEqual( executed(), { "b1", "b2", "b3", "b4" } )
+
+		# Nothing is skipped if the dispatcher isn't asked to.
+
+		markFiles()
+		s["dispatcher"]["skipUpToDateTasks"].setValue( False )
+		s["dispatcher"]["task"].execute()
+		self.assertEqual( executed(), { "a1", "a2", "a3", "a4", "b1", "b2", "b3", "b4" } )
+
+	def testSkipUpToDateTasksRequiringSequenceExecution( self ) :
+
+		s = Gaffer.ScriptNode()
+
+		s["writer"] = GafferDispatchTest.TextWriter( requiresSequenceExecution = True )
+		s["writer"]["fileName"].setValue( self.temporaryDirectory() / "sequence.txt" )
+		s["writer"]["text"].setValue( "${frame} " )
+
+		s["dispatcher"] = GafferDispatch.Dispatcher.create( "testDispatcher" )
+		s["dispatcher"]["tasks"][0].setInput( s["writer"]["task"] )
+		s["dispatcher"]["framesMode"].setValue( GafferDispatch.Dispatcher.FramesMode.CustomRange )
+		s["dispatcher"]["frameRange"].setValue( "1-3" )
+		s["dispatcher"]["skipUpToDateTasks"].setValue( True )
+
+		fileName = self.temporaryDirectory() / "sequence.txt"
+
+		s["dispatcher"]["task"].execute()
+		self.assertEqual( fileName.read_text(), "1 2 3 " )
+
+		fileName.write_text( "stale" )
+		s["dispatcher"]["task"].execute()
+		self.assertEqual( fileName.read_text(), "stale" )
+
+		# Extending the range requires the whole sequence to
+		# be executed again.
+
+		s["dispatcher"]["frameRange"].setValue( "1-4" )
+		s["dispatcher"]["task"].execute()
+		self.assertEqual( fileName.read_text(), "1 2 3 4 " )
+
+	def testTasksWithoutOutputsAreNeverSkipped( self ) :
+
+		s = Gaffer.ScriptNode()
+		s["n"] = GafferDispatchTest.LoggingTaskNode()
+
+		s["dispatcher"] = GafferDispatch.Dispatcher.create( "testDispatcher" )
+		s["dispatcher"]["tasks"][0].setInput( s["n"]["task"] )
+		s["dispatcher"]["skipUpToDateTasks"].setValue( True )
+
+		s["dispatcher"]["task"].execute()
+		s["dispatcher"]["task"].execute()
+		self.assertEqual( len( s["n"].log ), 2 )
+
 if __name__ == "__main__":
 	unittest.main()
@@ -52,6 +52,7 @@ import threading
 import weakref
 
 import imath
+import psutil
 
 import IECore
 
@@ -1292,5 +1293,312 @@ class LocalDispatcherTest( GafferTest.TestCase ) :
 
 		self.assertTrue( fileToCreate.is_file() )
 
+	def __wedgeScript( self, numVariants, duration, sequence = False ) :
+
+		# Each variant records the time it started and finished,
+		# so that we can check which variants ran concurrently.
+
+		script = Gaffer.ScriptNode()
+
+		script["command"] = GafferDispatch.PythonCommand()
+		script["command"]["command"].setValue( inspect.cleandoc(
+			"""
+			import time
+			start = time.time()
+			time.sleep( %f )
+			with open( "%s/{}.txt".format( context["wedge:value"] ), "w" ) as f :
+				f.write( "{} {}".format( start, time.time() ) )
+			""" % ( duration, self.temporaryDirectory().as_posix() )
+		) )
+		if sequence :
+			script["command"]["framesMode"].setValue( GafferDispatch.PythonCommand.FramesMode.Sequence )
+
+		script["wedge"] = GafferDispatch.Wedge()
+		script["wedge"]["preTasks"][0].setInput( script["command"]["task"] )
+		script["wedge"]["mode"].setValue( int( GafferDispatch.Wedge.Mode.IntList ) )
+		script["wedge"]["ints"].setValue( IECore.IntVectorData( range( 0, numVariants ) ) )
+
+		script["dispatcher"] = self.__createLocalDispatcher()
+		script["dispatcher"]["tasks"][0].setInput( script["wedge"]["task"] )
+
+		return script
+
+	def __maxConcurrency( self, numVariants ) :
+
+		intervals = []
+		for i in range( 0, numVariants ) :
+			with open( self.temporaryDirectory() / f"{i}.txt" ) as f :
+				intervals.append( [ float( x ) for x in f.read().split() ] )
+
+		return max(
+			sum( 1 for start, end in intervals if start <= t < end )
+			for t, _ in intervals
+		)
+
+	def testConcurrentBatches( self ) :
+
+		script = self.__wedgeScript( 4, 0.5 )
+		script["dispatcher"]["concurrentBatches"].setValue( 4 )
+		script["dispatcher"]["task"].execute()
+
+		self.assertEqual( script["dispatcher"].jobPool().jobs()[0].status(), GafferDispatch.LocalDispatcher.Job.Status.Complete )
+		self.assertGreater( self.__maxConcurrency( 4 ), 1 )
+
+	def testConcurrentBatchesInBackground( self ) :
+
+		script = self.__wedgeScript( 3, 1 )
+		script["fileName"].setValue( self.temporaryDirectory() / "test.gfr" )
+		script.save()
+
+		script["dispatcher"]["concurrentBatches"].setValue( 3 )
+		script["dispatcher"]["executeInBackground"].setValue( True )
+		script["dispatcher"]["task"].execute()
+		script["dispatcher"].jobPool().waitForAll()
+
+		self.assertEqual( script["dispatcher"].jobPool().jobs()[0].status(), GafferDispatch.LocalDispatcher.Job.Status.Complete )
+		self.assertGreater( self.__maxConcurrency( 3 ), 1 )
+
+	def testConcurrentBatchesHonourSequenceExecution( self ) :
+
+		script = self.__wedgeScript( 3, 0.25, sequence = True )
+		script["dispatcher"]["concurrentBatches"].setValue( 3 )
+		script["dispatcher"]["task"].execute()
+
+		self.assertEqual( script["dispatcher"].jobPool().jobs()[0].status(), GafferDispatch.LocalDispatcher.Job.Status.Complete )
+		self.assertEqual( self.__maxConcurrency( 3 ), 1 )
+
+	def testConcurrentBatchesFailure( self ) :
+
+		script = self.__wedgeScript( 4, 0.1 )
+		script["failure"] = GafferDispatch.PythonCommand()
+		script["failure"]["command"].setValue( "a = nonExistentVariable" )
+		script["wedge"]["preTasks"][1].setInput( script["failure"]["task"] )
+
+		script["dispatcher"]["concurrentBatches"].setValue( 4 )
+		with self.assertRaisesRegex( Exception, "nonExistentVariable" ) :
+			script["dispatcher"]["task"].execute()
+
+		self.assertEqual( script["dispatcher"].jobPool().jobs()[0].status(), GafferDispatch.LocalDispatcher.Job.Status.Failed )
+
+	def testConcurrentBatchesKill( self ) :
+
+		script = self.__wedgeScript( 4, 10 )
+		script["fileName"].setValue( self.temporaryDirectory() / "test.gfr" )
+		script.save()
+
+		script["dispatcher"]["concurrentBatches"].setValue( 2 )
+		script["dispatcher"]["executeInBackground"].setValue( True )
+		script["dispatcher"]["task"].execute()
+
+		job = script["dispatcher"].jobPool().jobs()[0]
+		while job.processID() is None and job.status() in ( job.Status.Waiting, job.Status.Running ) :
+			time.sleep( 0.1 )
+
+		job.kill()
+		script["dispatcher"].jobPool().waitForAll()
+		self.assertEqual( job.status(), GafferDispatch.LocalDispatcher.Job.Status.Killed )
+		self.assertEqual( list( self.temporaryDirectory().glob( "*.txt" ) ), [] )
+
+	def __concurrentBatchesPerformance( self, concurrentBatches ) :
+
+		script = self.__wedgeScript( 16, 0.25 )
+		script["dispatcher"]["concurrentBatches"].setValue( concurrentBatches )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			script["dispatcher"]["task"].execute()
+
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 1 )
+	def testSerialBatchesPerformance( self ) :
+
+		# Baseline for comparison with `testConcurrentBatchesPerformance()`.
+		self.__concurrentBatchesPerformance( 1 )
+
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 1 )
+	def testConcurrentBatchesPerformance( self ) :
+
+		self.__concurrentBatchesPerformance( 8 )
+
+	def __workerScript( self, frameRange ) :
+
+		# Each frame records the ID of the process it was executed in.
+
+		script = Gaffer.ScriptNode()
+		script["fileName"].setValue( self.temporaryDirectory() / "test.gfr" )
+
+		script["command"] = GafferDispatch.PythonCommand()
+		script["command"]["command"].setValue( inspect.cleandoc(
+			"""
+			import os
+			with open( "%s/{}.txt".format( context.getFrame() ), "w" ) as f :
+				f.write( str( os.getpid() ) )
+			print( "Executed frame {}".format( context.getFrame() ) )
+			""" % self.temporaryDirectory().as_posix()
+		) )
+
+		script["dispatcher"] = self.__createLocalDispatcher()
+		script["dispatcher"]["tasks"][0].setInput( script["command"]["task"] )
+		script["dispatcher"]["executeInBackground"].setValue( True )
+		script["dispatcher"]["persistentWorkers"].setValue( True )
+		script["dispatcher"]["framesMode"].setValue( GafferDispatch.Dispatcher.FramesMode.CustomRange )
+		script["dispatcher"]["frameRange"].setValue( frameRange )
+
+		script.save()
+		self.addCleanup( GafferDispatch.LocalDispatcher.stopWorkers )
+
+		return script
+
+	def __workerProcessIDs( self, frames ) :
+
+		result = set()
+		for frame in frames :
+			with open( self.temporaryDirectory() / f"{frame}.0.txt" ) as f :
+				result.add( int( f.read() ) )
+
+		return result
+
+	def testPersistentWorkers( self ) :
+
+		script = self.__workerScript( "1-4" )
+
+		script["dispatcher"]["task"].execute()
+		script["dispatcher"]["frameRange"].setValue( "5-8" )
+		script["dispatcher"]["task"].execute()
+		script["dispatcher"].jobPool().waitForAll()
+
+		for job in script["dispatcher"].jobPool().jobs() :
+			self.assertEqual( job.status(), GafferDispatch.LocalDispatcher.Job.Status.Complete )
+
+		# All batches from both jobs should have been executed by the same worker,
+		# and that worker should not be the process we're running in.
+
+		processIDs = self.__workerProcessIDs( range( 1, 9 ) )
+		self.assertEqual( len( processIDs ), 1 )
+		self.assertNotEqual( processIDs, { os.getpid() } )
+
+		# Messages should be attributed to the job that output them.
+
+		for job, frames in zip( script["dispatcher"].jobPool().jobs(), [ range( 1, 5 ), range( 5, 9 ) ] ) :
+			messages = { m.message for m in job.messages() if m.context == "command" }
+			for frame in frames :
+				self.assertIn( f"Executed frame {frame}.0", messages )
+
+	def testPersistentWorkerRewrittenInput( self ) :
+
+		inputFileName = self.temporaryDirectory() / "input.txt"
+		outputFileName = self.temporaryDirectory() / "output.txt"
+
+		script = self.__workerScript( "1" )
+
+		# The value of `n.user.s` is read from a file by an expression. Its
+		# hash doesn't depend on the contents of the file, so if the worker
+		# kept its caches between jobs, it would see the old contents.
+
+		script["n"] = Gaffer.Node()
+		script["n"]["user"]["s"] = Gaffer.StringPlug( flags = Gaffer.Plug.Flags.Default | Gaffer.Plug.Flags.Dynamic )
+		script["e"] = Gaffer.Expression()
+		script["e"].setExpression( inspect.cleandoc(
+			"""
+			with open( "{}" ) as f :
+				parent["n"]["user"]["s"] = f.read()
+			""".format( inputFileName.as_posix() )
+		) )
+
+		script["command"]["command"].setValue( inspect.cleandoc(
+			"""
+			with open( "{}", "w" ) as f :
+				f.write( self.parent()["n"]["user"]["s"].getValue() )
+			""".format( outputFileName.as_posix() )
+		) )
+		script.save()
+
+		for i, contents in enumerate( [ "a", "b" ] ) :
+
+			with open( inputFileName, "w" ) as f :
+				f.write( contents )
+
+			script["dispatcher"]["task"].execute()
+			script["dispatcher"].jobPool().waitForAll()
+			self.assertEqual( script["dispatcher"].jobPool().jobs()[i].status(), GafferDispatch.LocalDispatcher.Job.Status.Complete )
+
+			with open( outputFileName ) as f :
+				self.assertEqual( f.read(), contents )
+
+	def testPersistentWorkerFailure( self ) :
+
+		script = self.__workerScript( "1" )
+		script["command"]["command"].setValue( "a = nonExistentVariable" )
+		script.save()
+
+		script["dispatcher"]["task"].execute()
+		script["dispatcher"].jobPool().waitForAll()
+
+		job = script["dispatcher"].jobPool().jobs()[0]
+		self.assertEqual( job.status(), GafferDispatch.LocalDispatcher.Job.Status.Failed )
+		self.assertIn( "nonExistentVariable", "\n".join( m.message for m in job.messages() ) )
+
+		# The worker should remain usable after a failure.
+
+		script["command"]["command"].setValue( "pass" )
+		script.save()
+
+		script["dispatcher"]["task"].execute()
+		script["dispatcher"].jobPool().waitForAll()
+		self.assertEqual( script["dispatcher"].jobPool().jobs()[1].status(), GafferDispatch.LocalDispatcher.Job.Status.Complete )
+
+	def testPersistentWorkerKill( self ) :
+
+		script = self.__workerScript( "1" )
+		script["command"]["command"].setValue( "import time; time.sleep( 10 )" )
+		script.save()
+
+		script["dispatcher"]["task"].execute()
+
+		job = script["dispatcher"].jobPool().jobs()[0]
+		while job.processID() is None and job.status() in ( job.Status.Waiting, job.Status.Running ) :
+			time.sleep( 0.1 )
+
+		processID = job.processID()
+		job.kill()
+		script["dispatcher"].jobPool().waitForAll()
+		self.assertEqual( job.status(), GafferDispatch.LocalDispatcher.Job.Status.Killed )
+
+		# A killed worker must not be reused.
+
+		script["command"]["command"].setValue( "pass" )
+		script.save()
+
+		script["dispatcher"]["task"].execute()
+		script["dispatcher"].jobPool().waitForAll()
+
+		job = script["dispatcher"].jobPool().jobs()[1]
+		self.assertEqual( job.status(), GafferDispatch.LocalDispatcher.Job.Status.Complete )
+		self.assertFalse( psutil.pid_exists( processID ) and psutil.Process( processID ).status() != psutil.STATUS_ZOMBIE )
+
+	def __shortTasksPerformance( self, numTasks, persistentWorkers ) :
+
+		script = self.__workerScript( f"1-{numTasks}" )
+		script["command"]["command"].setValue( "pass" )
+		script["dispatcher"]["persistentWorkers"].setValue( persistentWorkers )
+		script.save()
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			script["dispatcher"]["task"].execute()
+			script["dispatcher"].jobPool().waitForAll()
+
+		self.assertEqual( script["dispatcher"].jobPool().jobs()[0].status(), GafferDispatch.LocalDispatcher.Job.Status.Complete )
+
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 1 )
+	def testPersistentWorkersPerformance( self ) :
+
+		self.__shortTasksPerformance( 1000, persistentWorkers = True )
+
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 1 )
+	def testPerProcessPerformance( self ) :
+
+		# Reference for `testPersistentWorkersPerformance()`. Launching a
+		# process per task is so slow that we use only a tenth of the tasks,
+		# so the timing must be multiplied by 10 for comparison.
+		self.__shortTasksPerformance( 100, persistentWorkers = False )
+
 if __name__ == "__main__":
 	unittest.main()
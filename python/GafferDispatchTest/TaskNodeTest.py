@@ -175,6 +175,49 @@ class TaskNodeTest( GafferTest.TestCase ) :
 		n = GafferDispatchTest.LoggingTaskNode()
 		self.assertEqual( n.requiresSequenceExecution(), False )
 
+	def testConcurrentFrames( self ) :
+
+		class ConcurrentTaskNode( GafferDispatchTest.LoggingTaskNode ) :
+
+			def __init__( self, name = "ConcurrentTaskNode" ) :
+
+				GafferDispatchTest.LoggingTaskNode.__init__( self, name )
+				self["fileName"] = Gaffer.StringPlug()
+
+			def supportsConcurrentFrames( self ) :
+
+				return True
+
+			def outputFileNames( self, context ) :
+
+				with context :
+					return [ self["fileName"].getValue() ]
+
+		n = ConcurrentTaskNode()
+		self.assertEqual( n.supportsConcurrentFrames(), True )
+		self.assertEqual( GafferDispatchTest.LoggingTaskNode().supportsConcurrentFrames(), False )
+		self.assertEqual( n["dispatcher"]["concurrentFrames"].getValue(), 1 )
+
+		# Frames with distinct outputs may be executed in any order.
+
+		n["fileName"].setValue( "test.####.txt" )
+		n["dispatcher"]["concurrentFrames"].setValue( 4 )
+		n["task"].executeSequence( range( 1, 21 ) )
+		self.assertEqual(
+			sorted( [ l.context.getFrame() for l in n.log ] ),
+			list( range( 1, 21 ) )
+		)
+
+		# But frames writing to the same file must be executed in order.
+
+		del n.log[:]
+		n["fileName"].setValue( "test.txt" )
+		n["task"].executeSequence( range( 1, 21 ) )
+		self.assertEqual(
+			[ l.context.getFrame() for l in n.log ],
+			list( range( 1, 21 ) )
+		)
+
 	def testPreTasks( self ) :
 
 		c1 = Gaffer.Context()
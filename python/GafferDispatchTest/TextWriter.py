@@ -100,6 +100,13 @@ class TextWriter( GafferDispatch.TaskNode ) :
 
 		return h
 
+	def outputFileNames( self, context ) :
+
+		with context :
+			fileName = self["fileName"].getValue()
+
+		return [ fileName ] if fileName else []
+
 	def requiresSequenceExecution( self ) :
 
 		return self.__requiresSequenceExecution
@@ -147,6 +147,25 @@ Gaffer.Metadata.registerNode(
 
 		),
 
+		"skipUpToDateTasks" : (
+
+			"description",
+			"""
+			Skips tasks which are already up to date, so that resubmitting
+			a job only executes the tasks affected by changes made since
+			the last submission. The hash of each executed task is recorded
+			in the jobs directory, and a task is considered up to date if
+			its hash is unchanged and its output files still exist. Tasks
+			which depend on a task that is executed are always executed
+			themselves.
+
+			> Note : Only tasks which declare their output files can be
+			> skipped. ImageWriters and SceneWriters do so, but tasks such as
+			> SystemCommands and PythonCommands are always executed.
+			""",
+
+		),
+
 	}
 
 )
@@ -253,7 +272,23 @@ Gaffer.Metadata.registerNode(
 			considered to be immediate too, regardless of their settings.
 			"""
 
-		)
+		),
+
+		"dispatcher.concurrentFrames" : (
+
+			"description",
+			"""
+			The maximum number of frames to execute concurrently within
+			a single batch. This only affects nodes which support concurrent
+			execution, such as the ImageWriter, SceneWriter and USDLayerWriter,
+			and is only useful when several frames are executed together,
+			either because of the `batchSize` setting or because the node
+			requires sequence execution. Executing frames concurrently makes
+			better use of the available cores when individual frames are
+			light, at the expense of increased memory usage.
+			""",
+
+		),
 
 	}
 
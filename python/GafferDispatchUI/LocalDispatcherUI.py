@@ -97,6 +97,51 @@ Gaffer.Metadata.registerNode(
 
 		),
 
+		"concurrentBatches" : (
+
+			"description",
+			"""
+			The maximum number of batches to execute at once. Batches
+			are started as soon as the tasks they depend on have completed,
+			so independent batches, such as the variants of a Wedge, may
+			be executed concurrently. Batches which require sequence execution
+			are never executed concurrently with other batches from the same
+			node.
+			""",
+
+		),
+
+		"memoryPerBatch" : (
+
+			"description",
+			"""
+			The amount of memory, in gigabytes, that each batch is expected
+			to need. Additional batches are only started when there is enough
+			free memory for them, as well as for the batches already running to
+			grow to this size. A value of 0 disables this limit.
+			""",
+
+		),
+
+		"persistentWorkers" : (
+
+			"description",
+			"""
+			Executes batches in long-lived worker processes, rather than
+			launching a new process for each batch. Workers keep the script
+			loaded and caches warm between batches, which greatly reduces
+			the overhead of executing many short tasks. Workers are kept
+			alive until the application exits.
+
+			> Caution : Because workers are reused, any state modified by one
+			> batch, such as environment variables or Python globals, will be
+			> visible to subsequent batches.
+			""",
+
+			"layout:activator", "executeInBackgroundIsOn",
+
+		),
+
 	}
 
 )
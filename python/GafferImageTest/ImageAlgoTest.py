@@ -275,6 +275,55 @@ class ImageAlgoTest( GafferImageTest.ImageTestCase ) :
 			numTilesX * numTilesY * 4
 		)
 
+	def testParallelProcessTilesWithNUMA( self ) :
+
+		self.addCleanup( Gaffer.ParallelAlgo.setNUMANodes, Gaffer.ParallelAlgo.getNUMANodes() )
+
+		c = GafferImage.Checkerboard()
+		c["format"].setValue( GafferImage.Format( 20 * GafferImage.ImagePlug.tileSize(), 30 * GafferImage.ImagePlug.tileSize() ) )
+
+		for numNodes in ( 2, 3 ) :
+
+			Gaffer.ParallelAlgo.setNUMANodes( numNodes )
+			Gaffer.ValuePlug.clearCache()
+			Gaffer.ValuePlug.clearHashCache()
+
+			# Every tile is processed exactly once, even though
+			# the work is divided between nodes.
+
+			with Gaffer.PerformanceMonitor() as m :
+				GafferImageTest.processTiles( c["out"] )
+
+			self.assertEqual( m.plugStatistics( c["out"]["channelData"] ).computeCount, 20 * 30 * 4 )
+
+	def __processTilesPerformance( self, numNUMANodes ) :
+
+		self.addCleanup( Gaffer.ParallelAlgo.setNUMANodes, Gaffer.ParallelAlgo.getNUMANodes() )
+		Gaffer.ParallelAlgo.setNUMANodes( numNUMANodes )
+
+		checker = GafferImage.Checkerboard()
+		checker["format"].setValue( GafferImage.Format( 4000, 4000 ) )
+
+		transform = GafferImage.ImageTransform()
+		transform["in"].setInput( checker["out"] )
+		transform["transform"]["pivot"].setValue( imath.V2f( 2000 ) )
+		transform["transform"]["rotate"].setValue( 2.5 )
+
+		GafferImageTest.processTiles( checker["out"] )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			GafferImageTest.processTiles( transform["out"] )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testParallelProcessTilesPerformance( self ) :
+
+		self.__processTilesPerformance( numNUMANodes = 1 )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testParallelProcessTilesEmulatedNUMAPerformance( self ) :
+
+		self.__processTilesPerformance( numNUMANodes = 2 )
+
 	def testSortedChannelNames( self ):
 
 		# Sort RGBA
@@ -1959,5 +1959,50 @@ class ImageWriterTest( GafferImageTest.ImageTestCase ) :
 		imageReader["fileName"].setValue( self.temporaryDirectory() / "test.exr" )
 		self.assertNotIn( "fileValid", imageReader["out"].metadata() )
 
+	def __frameDependentImageScript( self, size ) :
+
+		script = Gaffer.ScriptNode()
+		script["constant"] = GafferImage.Constant()
+		script["constant"]["format"].setValue( GafferImage.Format( size, size ) )
+		script["expression"] = Gaffer.Expression()
+		script["expression"].setExpression( 'parent["constant"]["color"]["r"] = context.getFrame()' )
+
+		script["writer"] = GafferImage.ImageWriter()
+		script["writer"]["in"].setInput( script["constant"]["out"] )
+		script["writer"]["fileName"].setValue( self.temporaryDirectory() / "test.####.exr" )
+
+		return script
+
+	def testConcurrentFrames( self ) :
+
+		script = self.__frameDependentImageScript( 64 )
+		script["writer"]["dispatcher"]["concurrentFrames"].setValue( 4 )
+		script["writer"]["task"].executeSequence( range( 1, 11 ) )
+
+		reader = GafferImage.ImageReader()
+		reader["fileName"].setValue( self.temporaryDirectory() / "test.####.exr" )
+
+		with Gaffer.Context() as context :
+			for frame in range( 1, 11 ) :
+				context.setFrame( frame )
+				self.assertImagesEqual( reader["out"], script["constant"]["out"], ignoreMetadata = True )
+
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 1 )
+	def testSerialFramesPerformance( self ) :
+
+		script = self.__frameDependentImageScript( 256 )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			script["writer"]["task"].executeSequence( range( 1, 101 ) )
+
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 1 )
+	def testConcurrentFramesPerformance( self ) :
+
+		script = self.__frameDependentImageScript( 256 )
+		script["writer"]["dispatcher"]["concurrentFrames"].setValue( 8 )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			script["writer"]["task"].executeSequence( range( 1, 101 ) )
+
 if __name__ == "__main__":
 	unittest.main()
@@ -250,6 +250,73 @@ class OpenImageIOReaderTest( GafferImageTest.ImageTestCase ) :
 		reader["refreshCount"].setValue( reader["refreshCount"].getValue() + 1 )
 		self.assertNotEqual( GafferImage.ImageAlgo.image( reader["out"] ), image1 )
 
+	def testPersistentCacheWithModifiedFile( self ) :
+
+		testFile = self.temporaryDirectory() / "persistent.exr"
+		shutil.copyfile( self.fileName, testFile )
+
+		originalDirectory = Gaffer.ValuePlug.getPersistentCacheDirectory()
+		Gaffer.ValuePlug.setPersistentCacheDirectory( ( self.temporaryDirectory() / "persistentCache" ).as_posix() )
+		self.addCleanup( Gaffer.ValuePlug.setPersistentCacheDirectory, originalDirectory )
+
+		reader = GafferImage.OpenImageIOReader()
+		reader["fileName"].setValue( testFile )
+		image1 = GafferImage.ImageAlgo.image( reader["out"] )
+		self.assertGreater( Gaffer.ValuePlug.persistentCacheUsage(), 0 )
+
+		# Rewrite the file, and simulate a fresh process by clearing all
+		# the in-memory caches. The persistent cache must not serve up
+		# the tiles from the old file.
+
+		shutil.copyfile( self.offsetDataWindowFileName, testFile )
+		Gaffer.ValuePlug.clearCache()
+		Gaffer.ValuePlug.clearHashCache( now = True )
+		reader["refreshCount"].setValue( 1 )
+		reader["refreshCount"].setValue( 0 )
+
+		expectedReader = GafferImage.OpenImageIOReader()
+		expectedReader["fileName"].setValue( self.offsetDataWindowFileName )
+
+		image2 = GafferImage.ImageAlgo.image( reader["out"] )
+		self.assertNotEqual( image2, image1 )
+		self.assertEqual( image2, GafferImage.ImageAlgo.image( expectedReader["out"] ) )
+
+	def testPersistentCacheWithModifiedHeldFrame( self ) :
+
+		for frame in ( 1, 3 ) :
+			shutil.copyfile( self.fileName, self.temporaryDirectory() / f"held.{frame:04d}.exr" )
+
+		originalDirectory = Gaffer.ValuePlug.getPersistentCacheDirectory()
+		Gaffer.ValuePlug.setPersistentCacheDirectory( ( self.temporaryDirectory() / "persistentCache" ).as_posix() )
+		self.addCleanup( Gaffer.ValuePlug.setPersistentCacheDirectory, originalDirectory )
+
+		reader = GafferImage.OpenImageIOReader()
+		reader["fileName"].setValue( self.temporaryDirectory() / "held.####.exr" )
+		reader["missingFrameMode"].setValue( GafferImage.OpenImageIOReader.MissingFrameMode.Hold )
+
+		with Gaffer.Context() as context :
+
+			# Frame 2 is missing, so frame 1 is held in its place.
+
+			context.setFrame( 2 )
+			image1 = GafferImage.ImageAlgo.image( reader["out"] )
+
+			# Rewrite the held frame, and simulate a fresh process. The tile
+			# batches for frame 2 must account for the file actually read.
+
+			shutil.copyfile( self.offsetDataWindowFileName, self.temporaryDirectory() / "held.0001.exr" )
+			Gaffer.ValuePlug.clearCache()
+			Gaffer.ValuePlug.clearHashCache( now = True )
+			GafferImage.OpenImageIOReader.clearFileCache()
+
+			image2 = GafferImage.ImageAlgo.image( reader["out"] )
+
+		expectedReader = GafferImage.OpenImageIOReader()
+		expectedReader["fileName"].setValue( self.offsetDataWindowFileName )
+
+		self.assertNotEqual( image2, image1 )
+		self.assertEqual( image2, GafferImage.ImageAlgo.image( expectedReader["out"] ) )
+
 	def testNonexistentFiles( self ) :
 
 		reader = GafferImage.OpenImageIOReader()
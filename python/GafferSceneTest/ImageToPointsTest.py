@@ -41,6 +41,7 @@ import IECore
 import IECoreScene
 
 import Gaffer
+import GafferTest
 import GafferImage
 import GafferScene
 import GafferSceneTest
@@ -287,5 +288,28 @@ class ImageToPointsTest( GafferSceneTest.SceneTestCase ) :
 			] )
 		)
 
+	def testNUMA( self ) :
+
+		self.addCleanup( Gaffer.ParallelAlgo.setNUMANodes, Gaffer.ParallelAlgo.getNUMANodes() )
+
+		checker = GafferImage.Checkerboard()
+		checker["format"].setValue( GafferImage.Format( 1000, 1000 ) )
+
+		imageToPoints = GafferScene.ImageToPoints()
+		imageToPoints["image"].setInput( checker["out"] )
+
+		expected = imageToPoints["out"].object( "/points" )
+
+		Gaffer.ParallelAlgo.setNUMANodes( 2 )
+		Gaffer.ValuePlug.clearCache()
+
+		# The compute calls `parallelProcessTiles()` from worker threads,
+		# which must not block waiting for the NUMA arenas.
+		with Gaffer.Context() as context :
+			context["scene:path"] = IECore.InternedStringVectorData( [ "points" ] )
+			GafferTest.parallelGetValue( imageToPoints["out"]["object"], 100 )
+
+		self.assertEqual( imageToPoints["out"].object( "/points" ), expected )
+
 if __name__ == "__main__":
 	unittest.main()
@@ -2654,6 +2654,78 @@ class SceneAlgoTest( GafferSceneTest.SceneTestCase ) :
 		for i in range( 1, 101 ) :
 			self.assertGreater( indices[f"/group{i}/plane"], indices[f"/group{i}"] )
 
+	def testParallelGatherLocationsWithNUMA( self ) :
+
+		self.addCleanup( Gaffer.ParallelAlgo.setNUMANodes, Gaffer.ParallelAlgo.getNUMANodes() )
+
+		plane = GafferScene.Plane()
+		group = GafferScene.Group()
+		group["in"][0].setInput( plane["out"] )
+
+		groupFilter = GafferScene.PathFilter()
+		groupFilter["paths"].setValue( IECore.StringVectorData( [ "/group" ] ) )
+
+		duplicate = GafferScene.Duplicate()
+		duplicate["in"].setInput( group["out"] )
+		duplicate["filter"].setInput( groupFilter["out"] )
+		duplicate["copies"].setValue( 100 )
+
+		expected = set(
+			[ "/", "/group", "/group/plane" ] +
+			[ f"/group{x}" for x in range( 1, 101 ) ] +
+			[ f"/group{x}/plane" for x in range( 1, 101 ) ]
+		)
+
+		for numNodes in ( 2, 3 ) :
+
+			Gaffer.ParallelAlgo.setNUMANodes( numNodes )
+
+			gathered = []
+			GafferScene.SceneAlgo.parallelGatherLocations(
+				duplicate["out"],
+				lambda scene, path : path,
+				lambda path : gathered.append( path )
+			)
+
+			self.assertEqual( len( gathered ), len( expected ) )
+			self.assertEqual( set( gathered ), expected )
+
+			indices = { value : index for index, value in enumerate( gathered ) }
+			self.assertEqual( gathered[0], "/" )
+			for i in range( 1, 101 ) :
+				self.assertGreater( indices[f"/group{i}/plane"], indices[f"/group{i}"] )
+
+	def __traversePerformance( self, numNUMANodes ) :
+
+		self.addCleanup( Gaffer.ParallelAlgo.setNUMANodes, Gaffer.ParallelAlgo.getNUMANodes() )
+		Gaffer.ParallelAlgo.setNUMANodes( numNUMANodes )
+
+		sphere = GafferScene.Sphere()
+
+		plane = GafferScene.Plane()
+		plane["divisions"].setValue( imath.V2i( 250 ) )
+
+		planeFilter = GafferScene.PathFilter()
+		planeFilter["paths"].setValue( IECore.StringVectorData( [ "/plane" ] ) )
+
+		instancer = GafferScene.Instancer()
+		instancer["in"].setInput( plane["out"] )
+		instancer["prototypes"].setInput( sphere["out"] )
+		instancer["filter"].setInput( planeFilter["out"] )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			GafferSceneTest.traverseScene( instancer["out"] )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testTraversePerformance( self ) :
+
+		self.__traversePerformance( numNUMANodes = 1 )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testTraverseEmulatedNUMAPerformance( self ) :
+
+		self.__traversePerformance( numNUMANodes = 2 )
+
 	def testParallelGatherExceptionHandling( self ) :
 
 		plane = GafferScene.Plane()
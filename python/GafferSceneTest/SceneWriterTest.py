@@ -42,6 +42,7 @@ import IECore
 import IECoreScene
 
 import Gaffer
+import GafferTest
 import GafferDispatch
 import GafferScene
 import GafferSceneTest
@@ -516,5 +517,104 @@ class SceneWriterTest( GafferSceneTest.SceneTestCase ) :
 		scene = IECoreScene.SceneCache( writer["fileName"].getValue(), IECore.IndexedIO.Read )
 		self.assertEqual( scene.readAttribute( "gaffer:globals", 1 ), writer["in"].globals() )
 
+	def __animatedSceneScript( self, divisions = imath.V2i( 20, 40 ), copies = 1 ) :
+
+		script = Gaffer.ScriptNode()
+		script["sphere"] = GafferScene.Sphere()
+		script["sphere"]["divisions"].setValue( divisions )
+		script["sphere"]["sets"].setValue( "spheres" )
+
+		script["plane"] = GafferScene.Plane()
+		script["plane"]["divisions"].setValue( imath.V2i( copies, 1 ) )
+
+		script["filter"] = GafferScene.PathFilter()
+		script["filter"]["paths"].setValue( IECore.StringVectorData( [ "/plane" ] ) )
+
+		script["instancer"] = GafferScene.Instancer()
+		script["instancer"]["in"].setInput( script["plane"]["out"] )
+		script["instancer"]["prototypes"].setInput( script["sphere"]["out"] )
+		script["instancer"]["filter"].setInput( script["filter"]["out"] )
+
+		script["group"] = GafferScene.Group()
+		script["group"]["in"][0].setInput( script["instancer"]["out"] )
+
+		script["expression"] = Gaffer.Expression()
+		script["expression"].setExpression( inspect.cleandoc(
+			"""
+			parent["group"]["transform"]["translate"]["x"] = context.getFrame()
+			parent["sphere"]["radius"] = 1 + context.getFrame() / 10.0
+			"""
+		) )
+
+		script["writer"] = GafferScene.SceneWriter()
+		script["writer"]["in"].setInput( script["group"]["out"] )
+
+		return script
+
+	def testConcurrentFrames( self ) :
+
+		script = self.__animatedSceneScript( copies = 4 )
+		frames = [ 1, 1.5, 2, 3, 4, 5, 6, 7, 8 ]
+
+		for extension in self.__extensions :
+			with self.subTest( extension = extension ) :
+
+				script["writer"]["dispatcher"]["concurrentFrames"].setValue( 1 )
+				script["writer"]["fileName"].setValue( self.temporaryDirectory() / ( "serial" + extension ) )
+				script["writer"]["task"].executeSequence( frames )
+
+				script["writer"]["dispatcher"]["concurrentFrames"].setValue( 4 )
+				script["writer"]["fileName"].setValue( self.temporaryDirectory() / ( "concurrent" + extension ) )
+				script["writer"]["task"].executeSequence( frames )
+
+				serialReader = GafferScene.SceneReader()
+				serialReader["fileName"].setValue( self.temporaryDirectory() / ( "serial" + extension ) )
+				concurrentReader = GafferScene.SceneReader()
+				concurrentReader["fileName"].setValue( self.temporaryDirectory() / ( "concurrent" + extension ) )
+
+				with Gaffer.Context() as context :
+					for frame in frames :
+						context.setFrame( frame )
+						self.assertScenesEqual( concurrentReader["out"], serialReader["out"] )
+
+	def testConcurrentFramesWithFrameDependentFileName( self ) :
+
+		script = self.__animatedSceneScript()
+		script["writer"]["fileName"].setValue( self.temporaryDirectory() / "test.####.scc" )
+		script["writer"]["dispatcher"]["concurrentFrames"].setValue( 4 )
+		script["writer"]["task"].executeSequence( range( 1, 11 ) )
+
+		with Gaffer.Context( script.context() ) as context :
+			for frame in range( 1, 11 ) :
+				context.setFrame( frame )
+				scene = IECoreScene.SceneInterface.create(
+					script["writer"]["fileName"].getValue(),
+					IECore.IndexedIO.OpenMode.Read
+				)
+				self.assertTrue(
+					scene.child( "group" ).readTransformAsMatrix( context.getTime() ).equalWithAbsError(
+						imath.M44d().translate( imath.V3d( frame, 0, 0 ) ), 1e-6
+					)
+				)
+
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 1 )
+	def testSerialFramesPerformance( self ) :
+
+		script = self.__animatedSceneScript( copies = 100 )
+		script["writer"]["fileName"].setValue( self.temporaryDirectory() / "test.scc" )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			script["writer"]["task"].executeSequence( range( 1, 51 ) )
+
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 1 )
+	def testConcurrentFramesPerformance( self ) :
+
+		script = self.__animatedSceneScript( copies = 100 )
+		script["writer"]["fileName"].setValue( self.temporaryDirectory() / "test.scc" )
+		script["writer"]["dispatcher"]["concurrentFrames"].setValue( 8 )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			script["writer"]["task"].executeSequence( range( 1, 51 ) )
+
 if __name__ == "__main__":
 	unittest.main()
@@ -4163,5 +4163,162 @@ class AnimationTest( GafferTest.TestCase ) :
 		# check that in tangent slope of third key that is now unconstrained is tied correctly to its opposite tangent
 		self.assertEqual( ti3.getSlope(), 60 )
 
+	@staticmethod
+	def __denseCurve( numKeys, interpolations = None ) :
+
+		import random
+		r = random.Random( 0 )
+
+		curve = Gaffer.Animation.CurvePlug()
+		interpolations = interpolations or [
+			Gaffer.Animation.Interpolation.Constant,
+			Gaffer.Animation.Interpolation.Linear,
+			Gaffer.Animation.Interpolation.Cubic,
+			Gaffer.Animation.Interpolation.Bezier,
+		]
+		for i in range( 0, numKeys ) :
+			curve.addKey( Gaffer.Animation.Key( i, r.uniform( -10, 10 ), interpolations[i % len( interpolations )] ) )
+
+		return curve
+
+	def testBatchEvaluate( self ) :
+
+		import random
+		r = random.Random( 0 )
+
+		curve = self.__denseCurve( 50 )
+		curve.setExtrapolation( Gaffer.Animation.Direction.In, Gaffer.Animation.Extrapolation.CycleOffset )
+		curve.setExtrapolation( Gaffer.Animation.Direction.Out, Gaffer.Animation.Extrapolation.Linear )
+
+		# Sorted times, including exact key times and times outside the key range.
+		sortedTimes = IECore.FloatVectorData( [ -60 + i * 0.25 for i in range( 0, 480 ) ] )
+		# Unsorted times, with both small and large jumps between them.
+		unsortedTimes = IECore.FloatVectorData( [ r.uniform( -60, 60 ) for i in range( 0, 500 ) ] )
+		backwardTimes = IECore.FloatVectorData( list( reversed( sortedTimes ) ) )
+
+		for times in ( sortedTimes, unsortedTimes, backwardTimes ) :
+			values = curve.evaluate( times )
+			self.assertIsInstance( values, IECore.FloatVectorData )
+			self.assertEqual( len( values ), len( times ) )
+			for t, v in zip( times, values ) :
+				self.assertEqual( v, curve.evaluate( t ) )
+
+		self.assertEqual( curve.evaluate( IECore.FloatVectorData() ), IECore.FloatVectorData() )
+		self.assertEqual(
+			Gaffer.Animation.CurvePlug().evaluate( IECore.FloatVectorData( [ 0, 1, 2 ] ) ),
+			IECore.FloatVectorData( [ 0, 0, 0 ] )
+		)
+
+	def testBaked( self ) :
+
+		curve = Gaffer.Animation.CurvePlug()
+		curve.addKey( Gaffer.Animation.Key( 0, 0, Gaffer.Animation.Interpolation.Linear ) )
+		curve.addKey( Gaffer.Animation.Key( 10, 5, Gaffer.Animation.Interpolation.Linear ) )
+
+		baked = curve.baked( 0, 10, 11 )
+		self.assertEqual( baked.startTime(), 0 )
+		self.assertEqual( baked.endTime(), 10 )
+		self.assertEqual( len( baked.samples() ), 11 )
+
+		for t in ( 0, 0.5, 2.25, 9.75, 10 ) :
+			self.assertAlmostEqual( baked.evaluate( t ), curve.evaluate( t ), places = 5 )
+
+		# Times outside the baked range are clamped to it.
+		self.assertEqual( baked.evaluate( -1 ), baked.evaluate( 0 ) )
+		self.assertEqual( baked.evaluate( 11 ), baked.evaluate( 10 ) )
+
+		self.assertEqual(
+			baked.evaluate( IECore.FloatVectorData( [ 0, 2.25, 11 ] ) ),
+			IECore.FloatVectorData( [ baked.evaluate( 0 ), baked.evaluate( 2.25 ), baked.evaluate( 11 ) ] )
+		)
+
+		with self.assertRaises( Exception ) :
+			curve.baked( 0, 10, 1 )
+		with self.assertRaises( Exception ) :
+			curve.baked( 10, 0, 11 )
+
+	def testBakedAccuracy( self ) :
+
+		# Only continuous interpolations, since a baked curve smooths over steps.
+		curve = self.__denseCurve(
+			100, [ Gaffer.Animation.Interpolation.Linear, Gaffer.Animation.Interpolation.Cubic, Gaffer.Animation.Interpolation.Bezier ]
+		)
+		baked = curve.baked( 0, 99, 99 * 64 + 1 )
+
+		for i in range( 0, 1000 ) :
+			t = i * 0.099
+			self.assertAlmostEqual( baked.evaluate( t ), curve.evaluate( t ), delta = 0.1 )
+
+	def testBakedInvalidation( self ) :
+
+		curve = Gaffer.Animation.CurvePlug()
+		key = Gaffer.Animation.Key( 0, 0, Gaffer.Animation.Interpolation.Linear )
+		curve.addKey( key )
+		curve.addKey( Gaffer.Animation.Key( 10, 10, Gaffer.Animation.Interpolation.Linear ) )
+
+		# Repeated requests share the same result.
+		baked = curve.baked( 0, 10, 11 )
+		self.assertTrue( curve.baked( 0, 10, 11 ).isSame( baked ) )
+		self.assertFalse( curve.baked( 0, 10, 21 ).isSame( baked ) )
+		baked = curve.baked( 0, 10, 11 )
+
+		# But edits to the curve cause it to be rebaked.
+
+		key.setValue( 5 )
+		rebaked = curve.baked( 0, 10, 11 )
+		self.assertFalse( rebaked.isSame( baked ) )
+		self.assertEqual( baked.evaluate( 0 ), 0 )
+		self.assertEqual( rebaked.evaluate( 0 ), 5 )
+
+		curve.addKey( Gaffer.Animation.Key( 5, 0, Gaffer.Animation.Interpolation.Linear ) )
+		self.assertEqual( curve.baked( 0, 10, 11 ).evaluate( 5 ), 0 )
+
+		curve.setExtrapolation( Gaffer.Animation.Direction.Out, Gaffer.Animation.Extrapolation.Linear )
+		self.assertFalse( curve.baked( 0, 10, 11 ).isSame( rebaked ) )
+
+	def __evaluatePerformance( self, numKeys, method ) :
+
+		curve = self.__denseCurve( numKeys )
+		numSamples = 1000000
+		times = IECore.FloatVectorData( [ i * ( numKeys - 1 ) / ( numSamples - 1 ) for i in range( 0, numSamples ) ] )
+
+		if method == "baked" :
+			baked = curve.baked( 0, numKeys - 1, numKeys * 16 )
+			with GafferTest.TestRunner.PerformanceScope() :
+				baked.evaluate( times )
+		else :
+			with GafferTest.TestRunner.PerformanceScope() :
+				curve.evaluate( times )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testBatchEvaluatePerformance10Keys( self ) :
+
+		self.__evaluatePerformance( 10, "batch" )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testBatchEvaluatePerformance1000Keys( self ) :
+
+		self.__evaluatePerformance( 1000, "batch" )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testBatchEvaluatePerformance10000Keys( self ) :
+
+		self.__evaluatePerformance( 10000, "batch" )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testBakedEvaluatePerformance10Keys( self ) :
+
+		self.__evaluatePerformance( 10, "baked" )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testBakedEvaluatePerformance1000Keys( self ) :
+
+		self.__evaluatePerformance( 1000, "baked" )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testBakedEvaluatePerformance10000Keys( self ) :
+
+		self.__evaluatePerformance( 10000, "baked" )
+
 if __name__ == "__main__":
 	unittest.main()
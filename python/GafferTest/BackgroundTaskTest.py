@@ -255,5 +255,15 @@ class BackgroundTaskTest( GafferTest.TestCase ) :
 		# check for cancellation, and we'll deadlock.
 		del task
 
+	def testPriority( self ) :
+
+		Gaffer.ParallelAlgo.resetQueueStatistics()
+
+		for priority in Gaffer.ParallelAlgo.Priority.values.values() :
+			task = Gaffer.BackgroundTask( None, lambda canceller : None, priority )
+			task.wait()
+			self.assertEqual( task.status(), task.Status.Completed )
+			self.assertEqual( Gaffer.ParallelAlgo.queueStatistics( priority ).numTasks, 1 )
+
 if __name__ == "__main__":
 	unittest.main()
@@ -809,6 +809,44 @@ class ContextTest( GafferTest.TestCase ) :
 
 		GafferTest.testContextCopyPerformance( 10, 10 )
 
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testContextScopePerformance( self ) :
+
+		nanosecondsPerScope = GafferTest.testContextScopePerformance( 1000000 )
+		self.assertGreater( nanosecondsPerScope, 0 )
+
+	def testHashAfterEdits( self ) :
+
+		# The hash is updated incrementally as variables are edited,
+		# so check that it always matches the hash of an equivalent
+		# context built from scratch.
+
+		c = Gaffer.Context()
+		c["a"] = "apple"
+		h = c.hash()
+
+		c["b"] = "bear"
+		c["a"] = "ant"
+		c.remove( "b" )
+		c["a"] = "apple"
+		self.assertEqual( c.hash(), h )
+
+		c2 = Gaffer.Context()
+		c2["a"] = "apple"
+		self.assertEqual( c2, c )
+		self.assertEqual( c2.hash(), c.hash() )
+
+		c["c"] = "cat"
+		c["d"] = "dog"
+		c.removeMatching( "c d" )
+		self.assertEqual( c.hash(), h )
+
+		c3 = Gaffer.Context( c )
+		self.assertEqual( c3.hash(), h )
+		c3["a"] = "aardvark"
+		self.assertNotEqual( c3, c )
+		self.assertNotEqual( c3.hash(), h )
+
 	def testCopyEditableScope( self ) :
 
 		GafferTest.testCopyEditableScope()
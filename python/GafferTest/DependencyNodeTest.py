@@ -728,5 +728,96 @@ class DependencyNodeTest( GafferTest.TestCase ) :
 		self.assertEqual( mh.messages[0].context, "Plug dirty propagation" )
 		self.assertRegex( mh.messages[0].message, r"Cycle detected between node.* and node.*" )
 
+	def testDirtyPropagationFollowsGraphEdits( self ) :
+
+		class DynamicOutputs( Gaffer.DependencyNode ) :
+
+			def __init__( self, name = "DynamicOutputs" ) :
+
+				Gaffer.DependencyNode.__init__( self, name )
+
+				self["in"] = Gaffer.IntPlug()
+				self["out"] = Gaffer.Plug( direction = Gaffer.Plug.Direction.Out )
+
+			def affects( self, input ) :
+
+				result = Gaffer.DependencyNode.affects( self, input )
+				if input.isSame( self["in"] ) :
+					result.extend( self["out"].children() )
+
+				return result
+
+		IECore.registerRunTimeTyped( DynamicOutputs )
+
+		script = Gaffer.ScriptNode()
+		script["a"] = GafferTest.MultiplyNode()
+		script["b"] = GafferTest.MultiplyNode()
+		script["c"] = DynamicOutputs()
+		script["b"]["op1"].setInput( script["a"]["product"] )
+
+		def dirtiedBy( plug ) :
+
+			dirtied = set()
+			connections = [
+				node.plugDirtiedSignal().connect( lambda p : dirtied.add( p.fullName() ), scoped = True )
+				for node in script.children( Gaffer.Node )
+			]
+			plug.setValue( plug.getValue() + 1 )
+			del connections
+			return dirtied
+
+		self.assertIn( "ScriptNode.b.product", dirtiedBy( script["a"]["op1"] ) )
+		self.assertNotIn( "ScriptNode.c.in", dirtiedBy( script["a"]["op1"] ) )
+
+		# Connection
+
+		with Gaffer.UndoScope( script ) :
+			script["c"]["in"].setInput( script["b"]["product"] )
+		self.assertIn( "ScriptNode.c.in", dirtiedBy( script["a"]["op1"] ) )
+
+		# Plug addition
+
+		script["c"]["out"]["o1"] = Gaffer.IntPlug( direction = Gaffer.Plug.Direction.Out, flags = Gaffer.Plug.Flags.Default | Gaffer.Plug.Flags.Dynamic )
+		self.assertIn( "ScriptNode.c.out.o1", dirtiedBy( script["a"]["op1"] ) )
+
+		script["c"]["out"]["o2"] = Gaffer.IntPlug( direction = Gaffer.Plug.Direction.Out, flags = Gaffer.Plug.Flags.Default | Gaffer.Plug.Flags.Dynamic )
+		self.assertTrue( { "ScriptNode.c.out.o1", "ScriptNode.c.out.o2" }.issubset( dirtiedBy( script["a"]["op1"] ) ) )
+
+		# Plug removal
+
+		del script["c"]["out"]["o1"]
+		dirtied = dirtiedBy( script["a"]["op1"] )
+		self.assertNotIn( "ScriptNode.c.out.o1", dirtied )
+		self.assertIn( "ScriptNode.c.out.o2", dirtied )
+
+		# Disconnection
+
+		script["c"]["in"].setInput( None )
+		self.assertNotIn( "ScriptNode.c.in", dirtiedBy( script["a"]["op1"] ) )
+
+		# Node deletion
+
+		del script["b"]
+		self.assertEqual( dirtiedBy( script["a"]["op1"] ), { "ScriptNode.a.op1", "ScriptNode.a.product" } )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testSetValueDirtyPropagationPerformance( self ) :
+
+		# Binary tree with 15000 nodes, so that setting a value
+		# on the root dirties every node.
+
+		script = Gaffer.ScriptNode()
+		nodes = []
+		for i in range( 0, 15000 ) :
+			node = GafferTest.MultiplyNode( "n{}".format( i ) )
+			script.addChild( node )
+			if i :
+				node["op1"].setInput( nodes[(i-1)//2]["product"] )
+			nodes.append( node )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			for i in range( 0, 50 ) :
+				nodes[0]["op2"].setValue( i )
+
 if __name__ == "__main__":
 	unittest.main()
@@ -1740,5 +1740,190 @@ class ExpressionTest( GafferTest.TestCase ) :
 		# mechanism for handling it, this will deadlock.
 		script["n"]["user"]["p4"].getValue()
 
+	def __nativeTestScript( self ) :
+
+		s = Gaffer.ScriptNode()
+		s["n"] = Gaffer.Node()
+		s["n"]["user"]["b"] = Gaffer.BoolPlug( flags = Gaffer.Plug.Flags.Default | Gaffer.Plug.Flags.Dynamic )
+		s["n"]["user"]["i"] = Gaffer.IntPlug( flags = Gaffer.Plug.Flags.Default | Gaffer.Plug.Flags.Dynamic )
+		s["n"]["user"]["f"] = Gaffer.FloatPlug( flags = Gaffer.Plug.Flags.Default | Gaffer.Plug.Flags.Dynamic )
+		s["n"]["user"]["s"] = Gaffer.StringPlug( flags = Gaffer.Plug.Flags.Default | Gaffer.Plug.Flags.Dynamic )
+		s["n"]["user"]["v"] = Gaffer.V3fPlug( flags = Gaffer.Plug.Flags.Default | Gaffer.Plug.Flags.Dynamic )
+		s["n"]["user"]["c"] = Gaffer.Color3fPlug( flags = Gaffer.Plug.Flags.Default | Gaffer.Plug.Flags.Dynamic )
+
+		return s
+
+	def testNativeLanguage( self ) :
+
+		self.assertIn( "native", Gaffer.Expression.languages() )
+
+		s = self.__nativeTestScript()
+		s["n"]["user"]["v"].setValue( imath.V3f( 1, 2, 3.5 ) )
+
+		s["e"] = Gaffer.Expression()
+		s["e"].setExpression(
+			inspect.cleandoc(
+				"""
+				shot = context.get( "shot", "s001" )
+				if context.getFrame() > 10 :
+					parent["n"]["user"]["i"] = 2 ** 10 + context["x"] // 2
+				else :
+					parent["n"]["user"]["i"] = -7 % 3
+				parent["n"]["user"]["f"] = parent["n"]["user"]["v"].y + parent["n"]["user"]["v"].z / 2
+				parent["n"]["user"]["s"] = f"{shot.upper()}_{int( context.getFrame() ):04d}.{'exr'}"
+				parent["n"]["user"]["b"] = "x" in context and not context["x"] > 100
+				"""
+			),
+			"native"
+		)
+
+		self.assertEqual(
+			{ p.getName() for p in s["e"]["__in"] }, { "p0" }
+		)
+
+		with Gaffer.Context() as c :
+
+			c.setFrame( 20 )
+			c["x"] = 5
+			self.assertEqual( s["n"]["user"]["i"].getValue(), 1026 )
+			self.assertEqual( s["n"]["user"]["f"].getValue(), 3.75 )
+			self.assertEqual( s["n"]["user"]["s"].getValue(), "S001_0020.exr" )
+			self.assertEqual( s["n"]["user"]["b"].getValue(), True )
+
+			c.setFrame( 1 )
+			c["shot"] = "s002"
+			del c["x"]
+			self.assertEqual( s["n"]["user"]["i"].getValue(), 2 )
+			self.assertEqual( s["n"]["user"]["s"].getValue(), "S002_0001.exr" )
+			self.assertEqual( s["n"]["user"]["b"].getValue(), False )
+
+		# Identifiers track renames just as they do for Python.
+
+		s["n"].setName( "m" )
+		expression = s["e"].getExpression()[0]
+		self.assertNotIn( 'parent["n"]', expression )
+		self.assertIn( 'parent["m"]["user"]["v"].y', expression )
+
+		# Serialisation doesn't require any extra modules.
+
+		s2 = Gaffer.ScriptNode()
+		s2.execute( s.serialise() )
+		with Gaffer.Context() as c :
+			c.setFrame( 20 )
+			c["x"] = 5
+			self.assertEqual( s2["m"]["user"]["s"].getValue(), "S001_0020.exr" )
+
+	def testNativeLanguageRejectsUnsupportedSyntax( self ) :
+
+		s = self.__nativeTestScript()
+		s["e"] = Gaffer.Expression()
+
+		for expression, error in [
+			( "import os\nparent['n']['user']['i'] = 1", 'Line 1 : "import" is not supported' ),
+			( "parent['n']['user']['i'] = foo", 'Name "foo" is not defined' ),
+			( "parent['n']['user']['i'] += 1", "Augmented assignment is not supported" ),
+			( "parent['n']['user']['i'] = 1 < 2 < 3", "Chained comparisons are not supported" ),
+		] :
+			with self.subTest( expression = expression ) :
+				with self.assertRaisesRegex( Exception, error ) :
+					s["e"].setExpression( expression, "native" )
+				self.assertEqual( s["e"].getExpression(), ( "", "" ) )
+
+	def testNativeLanguageMatchesPython( self ) :
+
+		s = self.__nativeTestScript()
+
+		for expression in [
+			'parent["n"]["user"]["i"] = context["x"] * 3 - 7 // 2 + -7 % 3',
+			'parent["n"]["user"]["f"] = context["x"] / 3 + context.getTime() - 7.5 // 2 + -7.5 % 2',
+			'parent["n"]["user"]["f"] = abs( context["x"] ) ** 0.5 + 2 ** -2',
+			'parent["n"]["user"]["i"] = round( 2.5 ) + round( 3.5 ) + round( -context["x"] / 2 ) + int( -3.9 )',
+			'parent["n"]["user"]["i"] = max( 1, context["x"], 3 ) + min( 4, 2 ) + abs( -context["x"] ) + len( "abc" )',
+			'parent["n"]["user"]["b"] = context["x"] == 5.0 or context["x"] >= 10',
+			'parent["n"]["user"]["s"] = str( context["x"] / 3 ) + str( 1e20 ) + str( 1e-5 ) + str( context.getFrame() )',
+			'parent["n"]["user"]["s"] = "{:>6}|{:<4}|{:^7}|{:+.3e}|{:.2f}|{:x}".format( "a", context["x"], "c", 12345.678, 2, 255 )',
+			'parent["n"]["user"]["s"] = "%s-%04d-%.2f-%x%%" % ( "a", context["x"], 1.5, 255 )',
+			'parent["n"]["user"]["s"] = "hello".replace( "l", "L" ).zfill( 8 ).strip( "0" ) + "ab" * context["x"]',
+			'parent["n"]["user"]["s"] = "hello"[1] + "hello"[-1] + ( "y" if "hello".startswith( "he" ) else "n" )',
+			'parent["n"]["user"]["i"] = 3.7 * context["x"]',
+			'parent["n"]["user"]["f"] = True + context["x"]',
+		] :
+			with self.subTest( expression = expression ) :
+
+				s["e"] = Gaffer.Expression()
+				s["e"].setExpression( expression, "native" )
+				plug = s["e"]["__out"][0].outputs()[0]
+
+				for x in range( -3, 12 ) :
+					with Gaffer.Context() as c :
+						c.setFrame( x * 2 + 1 )
+						c["x"] = x
+						nativeValue = plug.getValue()
+						s["e"].setExpression( expression, "python" )
+						self.assertEqual( nativeValue, plug.getValue() )
+						s["e"].setExpression( expression, "native" )
+
+	def testTranslatedPythonFallsBack( self ) :
+
+		s = self.__nativeTestScript()
+		s["e"] = Gaffer.Expression()
+
+		# Errors are reported by Python exactly as they would be
+		# without translation.
+
+		s["e"].setExpression( 'parent["n"]["user"]["i"] = int( context["x"] )' )
+		with Gaffer.Context() as c :
+			c["x"] = "10"
+			self.assertEqual( s["n"]["user"]["i"].getValue(), 10 )
+			c["x"] = "abc"
+			with self.assertRaisesRegex( Gaffer.ProcessException, "ValueError: invalid literal" ) :
+				s["n"]["user"]["i"].getValue()
+
+		# Operations that the native engine can't perform are executed
+		# by Python instead.
+
+		s["e"].setExpression( 'parent["n"]["user"]["f"] = float( 2 ** 100 ) / 2 ** 99' )
+		self.assertEqual( s["n"]["user"]["f"].getValue(), 2 )
+
+		# Including conversions that the Python engine performs when
+		# applying values to plugs.
+
+		s["e"].setExpression( 'parent["n"]["user"]["i"] = str( context["x"] )' )
+		with Gaffer.Context() as c :
+			c["x"] = 12
+			self.assertEqual( s["n"]["user"]["i"].getValue(), 12 )
+
+		s["e"].setExpression( 'parent["n"]["user"]["s"] = None' )
+		with self.assertRaisesRegex( Gaffer.ProcessException, 'TypeError: Unsupported type for result "None"' ) :
+			s["n"]["user"]["s"].getValue()
+
+	def testTranslatedPythonContextHashing( self ) :
+
+		s = self.__nativeTestScript()
+		s["e"] = Gaffer.Expression()
+		s["e"].setExpression( 'parent["n"]["user"]["i"] = context.get( "x", 1 ) * 2' )
+
+		with Gaffer.Context() as c :
+			h1 = s["e"]["__execute"].hash()
+			c.setFrame( 100 )
+			self.assertEqual( s["e"]["__execute"].hash(), h1 )
+			self.assertEqual( s["n"]["user"]["i"].getValue(), 2 )
+			c["x"] = 3
+			self.assertNotEqual( s["e"]["__execute"].hash(), h1 )
+			self.assertEqual( s["n"]["user"]["i"].getValue(), 6 )
+
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 1 )
+	def testTranslatedPythonPerformance( self ) :
+
+		s = self.__nativeTestScript()
+		s["e"] = Gaffer.Expression()
+		s["e"].setExpression(
+			'parent["n"]["user"]["s"] = "{}_{:04d}".format( context.get( "shot", "s001" ), context["i"] )'
+		)
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			GafferTest.parallelGetValue( s["n"]["user"]["s"], 100000, "i" )
+
 if __name__ == "__main__":
 	unittest.main()
@@ -995,6 +995,118 @@ class GraphComponentTest( GafferTest.TestCase ) :
 			c = s[n]
 			self.assertEqual( c.getName(), n )
 
+	def testManyChildren( self ) :
+
+		# Enough children to exceed the threshold at which
+		# an index is used for lookups by name.
+
+		script = Gaffer.ScriptNode()
+		script["parent"] = Gaffer.Node()
+		parent = script["parent"]["user"]
+
+		def assertLookupsValid() :
+
+			for c in parent.children() :
+				self.assertTrue( parent[c.getName()].isSame( c ) )
+				self.assertTrue( script.descendant( c.relativeName( script ) ).isSame( c ) )
+
+		children = []
+		for i in range( 0, 200 ) :
+			c = Gaffer.Plug( flags = Gaffer.Plug.Flags.Default | Gaffer.Plug.Flags.Dynamic )
+			parent.addChild( c )
+			children.append( c )
+			self.assertEqual( c.getName(), "Plug" if i == 0 else "Plug{}".format( i ) )
+
+		assertLookupsValid()
+		self.assertNotIn( "Plug200", parent )
+
+		# Rename
+
+		with Gaffer.UndoScope( script ) :
+			children[10].setName( "renamed" )
+		self.assertIn( "renamed", parent )
+		self.assertNotIn( "Plug10", parent )
+		assertLookupsValid()
+
+		script.undo()
+		self.assertNotIn( "renamed", parent )
+		self.assertTrue( parent["Plug10"].isSame( children[10] ) )
+		assertLookupsValid()
+
+		# Rename to existing name
+
+		children[11].setName( "Plug12" )
+		self.assertEqual( children[11].getName(), "Plug200" )
+		self.assertTrue( parent["Plug12"].isSame( children[12] ) )
+		assertLookupsValid()
+
+		# Remove
+
+		with Gaffer.UndoScope( script ) :
+			parent.removeChild( children[20] )
+		self.assertNotIn( "Plug20", parent )
+		assertLookupsValid()
+
+		script.undo()
+		self.assertTrue( parent["Plug20"].isSame( children[20] ) )
+		assertLookupsValid()
+
+		# Reparent
+
+		newParent = Gaffer.Plug( flags = Gaffer.Plug.Flags.Default | Gaffer.Plug.Flags.Dynamic )
+		script["parent"]["user"]["newParent"] = newParent
+		newParent.addChild( children[30] )
+		self.assertNotIn( "Plug30", parent )
+		self.assertTrue( newParent["Plug30"].isSame( children[30] ) )
+		assertLookupsValid()
+
+		# Add with clashing name
+
+		c = Gaffer.Plug( "Plug40", flags = Gaffer.Plug.Flags.Default | Gaffer.Plug.Flags.Dynamic )
+		parent.addChild( c )
+		self.assertEqual( c.getName(), "Plug201" )
+		self.assertTrue( parent["Plug40"].isSame( children[40] ) )
+		assertLookupsValid()
+
+		# Reorder
+
+		parent.reorderChildren( list( reversed( parent.children() ) ) )
+		assertLookupsValid()
+
+		# Clear
+
+		parent.clearChildren()
+		self.assertNotIn( "Plug0", parent )
+		self.assertIsNone( parent.getChild( "Plug0" ) )
+		self.assertIsNone( script.descendant( "parent.user.Plug0" ) )
+
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 1 )
+	def testLoadManyNodesPerformance( self ) :
+
+		script = Gaffer.ScriptNode()
+		for i in range( 0, 20000 ) :
+			script.addChild( GafferTest.AddNode( "AddNode{}".format( i ) ) )
+			if i :
+				script["AddNode{}".format( i )]["op1"].setInput( script["AddNode{}".format( i - 1 )]["sum"] )
+
+		serialisation = script.serialise()
+
+		script2 = Gaffer.ScriptNode()
+		with GafferTest.TestRunner.PerformanceScope() :
+			script2.execute( serialisation )
+
+		self.assertEqual( len( script2.children( Gaffer.Node ) ), 20000 )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testDescendantPerformance( self ) :
+
+		script = Gaffer.ScriptNode()
+		for i in range( 0, 10000 ) :
+			script.addChild( GafferTest.AddNode( "AddNode{}".format( i ) ) )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			GafferTest.testDescendantPerformance( script, 1000000 )
+
 	def testNoneIsNotAGraphComponent( self ) :
 
 		g = Gaffer.GraphComponent()
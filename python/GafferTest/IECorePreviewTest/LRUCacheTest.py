@@ -34,6 +34,9 @@
 #
 ##########################################################################
 
+import os
+import random
+import sys
 import unittest
 
 import GafferTest
@@ -52,6 +55,14 @@ class LRUCacheTest( GafferTest.TestCase ) :
 
 		GafferTest.testLRUCache( "taskParallel", numIterations = 100000, numValues = 100, maxCost = 100 )
 
+	def test100PercentOfWorkingSetGreedyDual( self ) :
+
+		GafferTest.testLRUCache( "greedyDual", numIterations = 100000, numValues = 100, maxCost = 100 )
+
+	def test100PercentOfWorkingSetSharded( self ) :
+
+		GafferTest.testLRUCache( "sharded", numIterations = 100000, numValues = 100, maxCost = 100 )
+
 	def test90PercentOfWorkingSetSerial( self ) :
 
 		GafferTest.testLRUCache( "serial", numIterations = 100000, numValues = 100, maxCost = 90 )
@@ -64,6 +75,14 @@ class LRUCacheTest( GafferTest.TestCase ) :
 
 		GafferTest.testLRUCache( "taskParallel", numIterations = 100000, numValues = 100, maxCost = 90 )
 
+	def test90PercentOfWorkingSetGreedyDual( self ) :
+
+		GafferTest.testLRUCache( "greedyDual", numIterations = 100000, numValues = 100, maxCost = 90 )
+
+	def test90PercentOfWorkingSetSharded( self ) :
+
+		GafferTest.testLRUCache( "sharded", numIterations = 100000, numValues = 100, maxCost = 90 )
+
 	def test2PercentOfWorkingSetSerial( self ) :
 
 		GafferTest.testLRUCache( "serial", numIterations = 100000, numValues = 100, maxCost = 2 )
@@ -76,6 +95,14 @@ class LRUCacheTest( GafferTest.TestCase ) :
 
 		GafferTest.testLRUCache( "taskParallel", numIterations = 10000, numValues = 100, maxCost = 2 )
 
+	def test2PercentOfWorkingSetGreedyDual( self ) :
+
+		GafferTest.testLRUCache( "greedyDual", numIterations = 100000, numValues = 100, maxCost = 2 )
+
+	def test2PercentOfWorkingSetSharded( self ) :
+
+		GafferTest.testLRUCache( "sharded", numIterations = 100000, numValues = 100, maxCost = 2 )
+
 	def testRemovalCallbackSerial( self ) :
 
 		GafferTest.testLRUCacheRemovalCallback( "serial" )
@@ -88,6 +115,14 @@ class LRUCacheTest( GafferTest.TestCase ) :
 
 		GafferTest.testLRUCacheRemovalCallback( "taskParallel" )
 
+	def testRemovalCallbackGreedyDual( self ) :
+
+		GafferTest.testLRUCacheRemovalCallback( "greedyDual" )
+
+	def testRemovalCallbackSharded( self ) :
+
+		GafferTest.testLRUCacheRemovalCallback( "sharded" )
+
 	def testClearAndGetSerial( self ) :
 
 		GafferTest.testLRUCache( "serial", numIterations = 100000, numValues = 1000, maxCost = 90, clearFrequency = 20 )
@@ -100,6 +135,14 @@ class LRUCacheTest( GafferTest.TestCase ) :
 
 		GafferTest.testLRUCache( "taskParallel", numIterations = 10000, numValues = 1000, maxCost = 90, clearFrequency = 20 )
 
+	def testClearAndGetGreedyDual( self ) :
+
+		GafferTest.testLRUCache( "greedyDual", numIterations = 100000, numValues = 1000, maxCost = 90, clearFrequency = 20 )
+
+	def testClearAndGetSharded( self ) :
+
+		GafferTest.testLRUCache( "sharded", numIterations = 100000, numValues = 1000, maxCost = 90, clearFrequency = 20 )
+
 	@GafferTest.TestRunner.PerformanceTestMethod()
 	def testContentionForOneItemSerial( self ) :
 
@@ -130,6 +173,26 @@ class LRUCacheTest( GafferTest.TestCase ) :
 
 		GafferTest.testLRUCacheContentionForOneItem( "taskParallel", withCanceller = True )
 
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testContentionForOneItemGreedyDual( self ) :
+
+		GafferTest.testLRUCacheContentionForOneItem( "greedyDual" )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testContentionForOneItemGreedyDualWithCanceller( self ) :
+
+		GafferTest.testLRUCacheContentionForOneItem( "greedyDual", withCanceller = True )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testContentionForOneItemSharded( self ) :
+
+		GafferTest.testLRUCacheContentionForOneItem( "sharded" )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testContentionForOneItemShardedWithCanceller( self ) :
+
+		GafferTest.testLRUCacheContentionForOneItem( "sharded", withCanceller = True )
+
 	def testRecursionSerial( self ) :
 
 		GafferTest.testLRUCacheRecursion( "serial", numIterations = 100000, numValues = 10000, maxCost = 10000 )
@@ -142,6 +205,14 @@ class LRUCacheTest( GafferTest.TestCase ) :
 
 		GafferTest.testLRUCacheRecursion( "taskParallel", numIterations = 100000, numValues = 10000, maxCost = 10000 )
 
+	def testRecursionGreedyDual( self ) :
+
+		GafferTest.testLRUCacheRecursion( "greedyDual", numIterations = 100000, numValues = 10000, maxCost = 10000 )
+
+	def testRecursionSharded( self ) :
+
+		GafferTest.testLRUCacheRecursion( "sharded", numIterations = 100000, numValues = 10000, maxCost = 10000 )
+
 	def testRecursionWithEvictionsSerial( self ) :
 
 		GafferTest.testLRUCacheRecursion( "serial", numIterations = 100000, numValues = 1000, maxCost = 100 )
@@ -154,6 +225,14 @@ class LRUCacheTest( GafferTest.TestCase ) :
 
 		GafferTest.testLRUCacheRecursion( "taskParallel", numIterations = 100000, numValues = 1000, maxCost = 100 )
 
+	def testRecursionWithEvictionsGreedyDual( self ) :
+
+		GafferTest.testLRUCacheRecursion( "greedyDual", numIterations = 100000, numValues = 1000, maxCost = 100 )
+
+	def testRecursionWithEvictionsSharded( self ) :
+
+		GafferTest.testLRUCacheRecursion( "sharded", numIterations = 100000, numValues = 1000, maxCost = 100 )
+
 	def testClearFromGetSerial( self ) :
 
 		GafferTest.testLRUCacheClearFromGet( "serial" )
@@ -166,6 +245,14 @@ class LRUCacheTest( GafferTest.TestCase ) :
 
 		GafferTest.testLRUCacheClearFromGet( "taskParallel" )
 
+	def testClearFromGetGreedyDual( self ) :
+
+		GafferTest.testLRUCacheClearFromGet( "greedyDual" )
+
+	def testClearFromGetSharded( self ) :
+
+		GafferTest.testLRUCacheClearFromGet( "sharded" )
+
 	def testExceptionsSerial( self ) :
 
 		GafferTest.testLRUCacheExceptions( "serial" )
@@ -178,6 +265,14 @@ class LRUCacheTest( GafferTest.TestCase ) :
 
 		GafferTest.testLRUCacheExceptions( "taskParallel" )
 
+	def testExceptionsGreedyDual( self ) :
+
+		GafferTest.testLRUCacheExceptions( "greedyDual" )
+
+	def testExceptionsSharded( self ) :
+
+		GafferTest.testLRUCacheExceptions( "sharded" )
+
 	def testCancellationSerial( self ) :
 
 		GafferTest.testLRUCacheCancellation( "serial" )
@@ -190,6 +285,14 @@ class LRUCacheTest( GafferTest.TestCase ) :
 
 		GafferTest.testLRUCacheCancellation( "taskParallel" )
 
+	def testCancellationGreedyDual( self ) :
+
+		GafferTest.testLRUCacheCancellation( "greedyDual" )
+
+	def testCancellationSharded( self ) :
+
+		GafferTest.testLRUCacheCancellation( "sharded" )
+
 	def testCancellationOfSecondGetParallel( self ) :
 
 		GafferTest.testLRUCacheCancellationOfSecondGet( "parallel" )
@@ -198,6 +301,14 @@ class LRUCacheTest( GafferTest.TestCase ) :
 
 		GafferTest.testLRUCacheCancellationOfSecondGet( "taskParallel" )
 
+	def testCancellationOfSecondGetGreedyDual( self ) :
+
+		GafferTest.testLRUCacheCancellationOfSecondGet( "greedyDual" )
+
+	def testCancellationOfSecondGetSharded( self ) :
+
+		GafferTest.testLRUCacheCancellationOfSecondGet( "sharded" )
+
 	def testUncacheableItemSerial( self ) :
 
 		GafferTest.testLRUCacheUncacheableItem( "serial" )
@@ -210,6 +321,14 @@ class LRUCacheTest( GafferTest.TestCase ) :
 
 		GafferTest.testLRUCacheUncacheableItem( "taskParallel" )
 
+	def testUncacheableItemGreedyDual( self ) :
+
+		GafferTest.testLRUCacheUncacheableItem( "greedyDual" )
+
+	def testUncacheableItemSharded( self ) :
+
+		GafferTest.testLRUCacheUncacheableItem( "sharded" )
+
 	def testGetIfCachedSerial( self ) :
 
 		GafferTest.testLRUCacheGetIfCached( "serial" )
@@ -222,11 +341,189 @@ class LRUCacheTest( GafferTest.TestCase ) :
 
 		GafferTest.testLRUCacheGetIfCached( "taskParallel" )
 
+	def testGetIfCachedGreedyDual( self ) :
+
+		GafferTest.testLRUCacheGetIfCached( "greedyDual" )
+
+	def testGetIfCachedSharded( self ) :
+
+		GafferTest.testLRUCacheGetIfCached( "sharded" )
+
 	def testSetIfUncached( self ) :
 
-		for policy in [ "serial", "parallel", "taskParallel" ] :
+		for policy in [ "serial", "parallel", "taskParallel", "greedyDual", "sharded" ] :
 			with self.subTest( policy = policy ) :
 				GafferTest.testLRUCacheSetIfUncached( policy )
 
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testGetSetMixSerialOneThread( self ) :
+
+		GafferTest.testLRUCacheGetSetMix( "serial", numThreads = 1, numIterations = 1000000, numValues = 10000, maxCost = 5000 )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testGetSetMixParallelOneThread( self ) :
+
+		GafferTest.testLRUCacheGetSetMix( "parallel", numThreads = 1, numIterations = 1000000, numValues = 10000, maxCost = 5000 )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testGetSetMixParallelFourThreads( self ) :
+
+		GafferTest.testLRUCacheGetSetMix( "parallel", numThreads = 4, numIterations = 1000000, numValues = 10000, maxCost = 5000 )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testGetSetMixParallelSixteenThreads( self ) :
+
+		GafferTest.testLRUCacheGetSetMix( "parallel", numThreads = 16, numIterations = 1000000, numValues = 10000, maxCost = 5000 )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testGetSetMixParallelSixtyFourThreads( self ) :
+
+		GafferTest.testLRUCacheGetSetMix( "parallel", numThreads = 64, numIterations = 1000000, numValues = 10000, maxCost = 5000 )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testGetSetMixParallelAllThreads( self ) :
+
+		GafferTest.testLRUCacheGetSetMix( "parallel", numThreads = 0, numIterations = 1000000, numValues = 10000, maxCost = 5000 )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testGetSetMixTaskParallelOneThread( self ) :
+
+		GafferTest.testLRUCacheGetSetMix( "taskParallel", numThreads = 1, numIterations = 1000000, numValues = 10000, maxCost = 5000 )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testGetSetMixTaskParallelFourThreads( self ) :
+
+		GafferTest.testLRUCacheGetSetMix( "taskParallel", numThreads = 4, numIterations = 1000000, numValues = 10000, maxCost = 5000 )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testGetSetMixTaskParallelSixteenThreads( self ) :
+
+		GafferTest.testLRUCacheGetSetMix( "taskParallel", numThreads = 16, numIterations = 1000000, numValues = 10000, maxCost = 5000 )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testGetSetMixTaskParallelSixtyFourThreads( self ) :
+
+		GafferTest.testLRUCacheGetSetMix( "taskParallel", numThreads = 64, numIterations = 1000000, numValues = 10000, maxCost = 5000 )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testGetSetMixTaskParallelAllThreads( self ) :
+
+		GafferTest.testLRUCacheGetSetMix( "taskParallel", numThreads = 0, numIterations = 1000000, numValues = 10000, maxCost = 5000 )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testGetSetMixGreedyDualOneThread( self ) :
+
+		GafferTest.testLRUCacheGetSetMix( "greedyDual", numThreads = 1, numIterations = 1000000, numValues = 10000, maxCost = 5000 )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testGetSetMixGreedyDualFourThreads( self ) :
+
+		GafferTest.testLRUCacheGetSetMix( "greedyDual", numThreads = 4, numIterations = 1000000, numValues = 10000, maxCost = 5000 )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testGetSetMixGreedyDualSixteenThreads( self ) :
+
+		GafferTest.testLRUCacheGetSetMix( "greedyDual", numThreads = 16, numIterations = 1000000, numValues = 10000, maxCost = 5000 )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testGetSetMixGreedyDualSixtyFourThreads( self ) :
+
+		GafferTest.testLRUCacheGetSetMix( "greedyDual", numThreads = 64, numIterations = 1000000, numValues = 10000, maxCost = 5000 )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testGetSetMixGreedyDualAllThreads( self ) :
+
+		GafferTest.testLRUCacheGetSetMix( "greedyDual", numThreads = 0, numIterations = 1000000, numValues = 10000, maxCost = 5000 )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testGetSetMixShardedOneThread( self ) :
+
+		GafferTest.testLRUCacheGetSetMix( "sharded", numThreads = 1, numIterations = 1000000, numValues = 10000, maxCost = 5000 )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testGetSetMixShardedFourThreads( self ) :
+
+		GafferTest.testLRUCacheGetSetMix( "sharded", numThreads = 4, numIterations = 1000000, numValues = 10000, maxCost = 5000 )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testGetSetMixShardedSixteenThreads( self ) :
+
+		GafferTest.testLRUCacheGetSetMix( "sharded", numThreads = 16, numIterations = 1000000, numValues = 10000, maxCost = 5000 )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testGetSetMixShardedSixtyFourThreads( self ) :
+
+		GafferTest.testLRUCacheGetSetMix( "sharded", numThreads = 64, numIterations = 1000000, numValues = 10000, maxCost = 5000 )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testGetSetMixShardedAllThreads( self ) :
+
+		GafferTest.testLRUCacheGetSetMix( "sharded", numThreads = 0, numIterations = 1000000, numValues = 10000, maxCost = 5000 )
+
+	def __replayTrace( self, trace, maxCost ) :
+
+		results = {}
+		for policy in [ "serial", "parallel", "taskParallel", "greedyDual", "sharded" ] :
+			hits, misses, recomputeTime = GafferTest.testLRUCacheTraceReplay( policy, trace, maxCost = maxCost )
+			self.assertEqual( hits + misses, len( trace ) )
+			results[policy] = ( hits, misses, recomputeTime )
+
+		sys.stderr.write( "\n{:<14}{:>12}{:>18}\n".format( "Policy", "Hit ratio", "Recompute time" ) )
+		for policy, ( hits, misses, recomputeTime ) in results.items() :
+			sys.stderr.write( "{:<14}{:>12.3f}{:>17.2f}s\n".format( policy, hits / len( trace ), recomputeTime ) )
+
+		return results
+
+	def testTraceReplay( self ) :
+
+		# Synthetic trace with Zipf-like key popularity, varied costs
+		# and a bimodal distribution of compute times, where a minority
+		# of items are two orders of magnitude more expensive to compute
+		# than the rest. This is typical of a Gaffer graph, where cheap
+		# pass-throughs and attribute computes are interleaved with
+		# expensive tessellation or file loading.
+
+		numKeys = 1000
+		random.seed( 0 )
+		costs = [ random.randint( 1, 10 ) for k in range( 0, numKeys ) ]
+		computeTimes = [ 0.1 if random.random() < 0.1 else 0.001 for k in range( 0, numKeys ) ]
+		weights = [ 1.0 / ( k + 1 ) ** 0.8 for k in range( 0, numKeys ) ]
+
+		trace = [
+			( k, costs[k], computeTimes[k] )
+			for k in random.choices( range( 0, numKeys ), weights, k = 100000 )
+		]
+
+		results = self.__replayTrace( trace, maxCost = 500 )
+
+		# Cost-aware eviction should spend less time recomputing than
+		# recency-based eviction.
+		self.assertLess( results["greedyDual"][2], results["parallel"][2] )
+		self.assertLess( results["greedyDual"][2], results["serial"][2] )
+
+	@unittest.skipIf( "GAFFERTEST_LRUCACHE_TRACE" not in os.environ, "GAFFERTEST_LRUCACHE_TRACE not set" )
+	def testRecordedTraceReplay( self ) :
+
+		# Replays a trace recorded from a real workload, so that policies
+		# can be compared on production scenes. The file contains one
+		# access per line, in the form `key cost computeTime`, and the
+		# cache size is taken from `GAFFERTEST_LRUCACHE_TRACE_MAXCOST`.
+
+		keys = {}
+		trace = []
+		with open( os.environ["GAFFERTEST_LRUCACHE_TRACE"], encoding = "utf-8" ) as f :
+			for line in f :
+				fields = line.split()
+				if len( fields ) != 3 :
+					continue
+				key = keys.setdefault( fields[0], len( keys ) )
+				trace.append( ( key, int( fields[1] ), float( fields[2] ) ) )
+
+		self.__replayTrace(
+			trace,
+			# Default to a tenth of the working set.
+			maxCost = int( os.environ.get( "GAFFERTEST_LRUCACHE_TRACE_MAXCOST", sum( dict( ( t[0], t[1] ) for t in trace ).values() ) // 10 ) )
+		)
+
 if __name__ == "__main__":
 	unittest.main()
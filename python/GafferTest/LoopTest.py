@@ -34,6 +34,7 @@
 #
 ##########################################################################
 
+import json
 import unittest
 
 import Gaffer
@@ -342,5 +343,102 @@ class LoopTest( GafferTest.TestCase ) :
 		self.assertTrue( iteration[0].isSame( loop["in"] ) )
 		self.assertNotIn( "loop:index", iteration[1] )
 
+	def __maxProcessDepth( self, traceMonitor ) :
+
+		fileName = self.temporaryDirectory() / "trace.json"
+		traceMonitor.writeChromeTrace( str( fileName ) )
+		with open( fileName ) as f :
+			trace = json.load( f )
+
+		events = { e["args"]["id"] : e for e in trace["traceEvents"] if e["ph"] == "X" }
+
+		def depth( event ) :
+			result = 0
+			while event is not None :
+				result += 1
+				parentId = event["args"]["parentId"]
+				event = events[parentId] if parentId is not None else None
+			return result
+
+		return max( depth( e ) for e in events.values() )
+
+	def testManyIterations( self ) :
+
+		loop = self.intLoop()
+
+		loopBody = GafferTest.AddNode()
+		loopBody["op1"].setInput( loop["previous"] )
+		loopBody["op2"].setValue( 1 )
+		loop["next"].setInput( loopBody["sum"] )
+		loop["iterations"].setValue( 5000 )
+
+		hashMonitor = Gaffer.TraceMonitor( processMask = [ "computeNode:hash" ] )
+		computeMonitor = Gaffer.TraceMonitor( processMask = [ "computeNode:compute" ] )
+		performanceMonitor = Gaffer.PerformanceMonitor()
+		with hashMonitor, computeMonitor, performanceMonitor :
+			self.assertEqual( loop["out"].getValue(), 5000 )
+
+		# Each iteration is hashed and computed exactly once.
+
+		statistics = performanceMonitor.plugStatistics( loopBody["sum"] )
+		self.assertEqual( statistics.hashCount, 5000 )
+		self.assertEqual( statistics.computeCount, 5000 )
+
+		# And recursion is bounded, rather than being proportional to
+		# the number of iterations. There are two processes per iteration,
+		# one for `loopBody.sum` and one for `loop.previous`.
+
+		hashDepth = self.__maxProcessDepth( hashMonitor )
+		computeDepth = self.__maxProcessDepth( computeMonitor )
+		self.assertLess( hashDepth, 200 )
+		self.assertLess( computeDepth, 200 )
+
+		# Iterations are evaluated identically regardless of which
+		# have been evaluated before.
+
+		for iterations in ( 1, 63, 64, 65, 130, 4999, 5000 ) :
+			loop["iterations"].setValue( iterations )
+			self.assertEqual( loop["out"].getValue(), iterations )
+			Gaffer.ValuePlug.clearCache()
+			Gaffer.ValuePlug.clearHashCache()
+			self.assertEqual( loop["out"].getValue(), iterations )
+
+	def testManyIterationsWithIndex( self ) :
+
+		script = Gaffer.ScriptNode()
+
+		script["loop"] = self.intLoop()
+		script["add"] = GafferTest.AddNode()
+
+		script["loop"]["in"].setValue( 0 )
+		script["loop"]["next"].setInput( script["add"]["sum"] )
+		script["add"]["op1"].setInput( script["loop"]["previous"] )
+
+		script["e"] = Gaffer.Expression()
+		script["e"].setExpression( 'parent["add"]["op2"] = context.get( "loop:index", 0 )' )
+
+		script["loop"]["iterations"].setValue( 1000 )
+		self.assertEqual( script["loop"]["out"].getValue(), sum( range( 0, 1000 ) ) )
+
+		# Pull on an intermediate iteration via the `previous` plug.
+		context = Gaffer.Context()
+		context["loop:index"] = 500
+		with context :
+			self.assertEqual( script["loop"]["previous"].getValue(), sum( range( 0, 500 ) ) )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testManyIterationsPerformance( self ) :
+
+		loop = self.intLoop()
+
+		loopBody = GafferTest.AddNode()
+		loopBody["op1"].setInput( loop["previous"] )
+		loopBody["op2"].setValue( 1 )
+		loop["next"].setInput( loopBody["sum"] )
+		loop["iterations"].setValue( 20000 )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			loop["out"].getValue()
+
 if __name__ == "__main__":
 	unittest.main()
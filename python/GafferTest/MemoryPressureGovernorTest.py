@@ -0,0 +1,267 @@
+##########################################################################
+#
+#  Copyright (c) 2025, Cinesite VFX Ltd. All rights reserved.
+#
+#  Redistribution and use in source and binary forms, with or without
+#  modification, are permitted provided that the following conditions are
+#  met:
+#
+#      * Redistributions of source code must retain the above
+#        copyright notice, this list of conditions and the following
+#        disclaimer.
+#
+#      * Redistributions in binary form must reproduce the above
+#        copyright notice, this list of conditions and the following
+#        disclaimer in the documentation and/or other materials provided with
+#        the distribution.
+#
+#      * Neither the name of John Haddon nor the names of
+#        any other contributors to this software may be used to endorse or
+#        promote products derived from this software without specific prior
+#        written permission.
+#
+#  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+#  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+#  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+#  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+#  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+#  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+#  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+#  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+#  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+#  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+#  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+##########################################################################
+
+
+import time
+import unittest
+
+import IECore
+
+import Gaffer
+import GafferTest
+
+class MemoryPressureGovernorTest( GafferTest.TestCase ) :
+
+	__gigabyte = 1024 ** 3
+
+	def setUp( self ) :
+
+		GafferTest.TestCase.setUp( self )
+
+		self.__originalCacheMemoryLimit = Gaffer.ValuePlug.getCacheMemoryLimit()
+		self.__originalHashCacheSizeLimit = Gaffer.ValuePlug.getHashCacheSizeLimit()
+
+		Gaffer.ValuePlug.setCacheMemoryLimit( self.__gigabyte )
+		Gaffer.ValuePlug.setHashCacheSizeLimit( 1000 )
+
+	def tearDown( self ) :
+
+		GafferTest.TestCase.tearDown( self )
+
+		Gaffer.ValuePlug.setCacheMemoryLimit( self.__originalCacheMemoryLimit )
+		Gaffer.ValuePlug.setHashCacheSizeLimit( self.__originalHashCacheSizeLimit )
+
+	# Fakes a cgroup by writing its interface files into a
+	# temporary directory.
+	def __writeCGroup( self, current, high = None, max = None ) :
+
+		directory = self.temporaryDirectory() / "cgroup"
+		directory.mkdir( exist_ok = True )
+
+		for name, value in [ ( "current", current ), ( "high", high ), ( "max", max ) ] :
+			( directory / f"memory.{name}" ).write_text( "max\n" if value is None else f"{value}\n" )
+
+		return directory
+
+	def testCGroupSource( self ) :
+
+		directory = self.__writeCGroup( current = 100, high = 1000, max = 2000 )
+		source = Gaffer.MemoryPressureGovernor.cgroupSource( str( directory ) )
+		self.assertIn( "cgroup", source.description() )
+
+		status = source.read()
+		self.assertEqual( status.used, 100 )
+		self.assertEqual( status.limit, 1000 )
+
+		# Falls back to `memory.max` when `memory.high` is unlimited.
+
+		self.__writeCGroup( current = 100, max = 2000 )
+		status = source.read()
+		self.assertEqual( status.used, 100 )
+		self.assertEqual( status.limit, 2000 )
+
+		# And can't provide a status when there is no limit at all.
+
+		self.__writeCGroup( current = 100 )
+		self.assertIsNone( source.read() )
+
+		self.assertIsNone( Gaffer.MemoryPressureGovernor.cgroupSource( str( self.temporaryDirectory() / "missing" ) ).read() )
+
+	def testMemInfoSource( self ) :
+
+		memInfo = self.temporaryDirectory() / "meminfo"
+		memInfo.write_text(
+			"MemTotal:       16000000 kB\n"
+			"MemFree:         1000000 kB\n"
+			"MemAvailable:    4000000 kB\n"
+			"Buffers:          100000 kB\n"
+		)
+
+		status = Gaffer.MemoryPressureGovernor.memInfoSource( str( memInfo ) ).read()
+		self.assertEqual( status.limit, 16000000 * 1024 )
+		self.assertEqual( status.used, 12000000 * 1024 )
+
+	def testRegisteredCaches( self ) :
+
+		caches = Gaffer.MemoryPressureGovernor.registeredCaches()
+		self.assertIn( "ValuePlug:computeCache", caches )
+		self.assertIn( "ValuePlug:hashCache", caches )
+
+	def testPressure( self ) :
+
+		directory = self.__writeCGroup( current = int( 9.5 * self.__gigabyte ), high = 10 * self.__gigabyte )
+
+		governor = Gaffer.MemoryPressureGovernor(
+			Gaffer.MemoryPressureGovernor.cgroupSource( str( directory ) ),
+			targetUsage = 0.9, minimumScale = 0.1, interval = 0
+		)
+		self.assertEqual( governor.scale(), 1 )
+
+		# We're over our target, so the caches are shrunk as
+		# far as is allowed.
+
+		with IECore.CapturingMessageHandler() as mh :
+			self.assertAlmostEqual( governor.update(), 0.1 )
+
+		self.assertAlmostEqual( Gaffer.ValuePlug.getCacheMemoryLimit(), 0.1 * self.__gigabyte, delta = 1024 )
+		self.assertEqual( Gaffer.ValuePlug.getHashCacheSizeLimit(), 100 )
+
+		infoMessages = [ m for m in mh.messages if m.level == IECore.Msg.Level.Info ]
+		self.assertEqual( len( infoMessages ), 1 )
+		self.assertEqual( infoMessages[0].context, "MemoryPressureGovernor" )
+		self.assertIn( "Reducing cache limits to 10%", infoMessages[0].message )
+
+		# When there is no change, nothing more happens.
+
+		with IECore.CapturingMessageHandler() as mh :
+			self.assertAlmostEqual( governor.update(), 0.1 )
+		self.assertEqual( [ m for m in mh.messages if m.level == IECore.Msg.Level.Info ], [] )
+
+		# When the pressure is relieved, the caches grow back
+		# to their configured limits, but gradually.
+
+		self.__writeCGroup( current = 5 * self.__gigabyte, high = 10 * self.__gigabyte )
+
+		scales = [ governor.update() for i in range( 0, 5 ) ]
+		self.assertEqual( sorted( scales ), scales )
+		self.assertLess( scales[0], 1 )
+		self.assertEqual( scales[-1], 1 )
+
+		self.assertEqual( Gaffer.ValuePlug.getCacheMemoryLimit(), self.__gigabyte )
+		self.assertEqual( Gaffer.ValuePlug.getHashCacheSizeLimit(), 1000 )
+
+		# Usage just below the target gives an intermediate scale,
+		# leaving room for the caches to fill to the target.
+
+		Gaffer.ValuePlug.clearCache()
+		self.__writeCGroup( current = int( 8.5 * self.__gigabyte ), high = 10 * self.__gigabyte )
+		scale = governor.update()
+		self.assertGreater( scale, 0.1 )
+		self.assertLess( scale, 1 )
+
+	def testConfiguredLimitsRestored( self ) :
+
+		directory = self.__writeCGroup( current = 10 * self.__gigabyte, high = 10 * self.__gigabyte )
+		governor = Gaffer.MemoryPressureGovernor(
+			Gaffer.MemoryPressureGovernor.cgroupSource( str( directory ) ),
+			minimumScale = 0.5, interval = 0
+		)
+
+		self.assertEqual( governor.update(), 0.5 )
+		self.assertEqual( Gaffer.ValuePlug.getCacheMemoryLimit(), self.__gigabyte // 2 )
+
+		# Limits edited while the governor is active are
+		# treated as the new configured limits.
+
+		Gaffer.ValuePlug.setCacheMemoryLimit( 2 * self.__gigabyte )
+		self.assertEqual( governor.update(), 0.5 )
+		self.assertEqual( Gaffer.ValuePlug.getCacheMemoryLimit(), self.__gigabyte )
+
+		# And the configured limits are restored when the
+		# governor is destroyed.
+
+		del governor
+		self.assertEqual( Gaffer.ValuePlug.getCacheMemoryLimit(), 2 * self.__gigabyte )
+		self.assertEqual( Gaffer.ValuePlug.getHashCacheSizeLimit(), 1000 )
+
+	def testReadFailure( self ) :
+
+		governor = Gaffer.MemoryPressureGovernor(
+			Gaffer.MemoryPressureGovernor.cgroupSource( str( self.temporaryDirectory() / "missing" ) ),
+			interval = 0
+		)
+
+		with IECore.CapturingMessageHandler() as mh :
+			self.assertEqual( governor.update(), 1 )
+			self.assertEqual( governor.update(), 1 )
+
+		# Failure is only reported once.
+		self.assertEqual( len( mh.messages ), 1 )
+		self.assertEqual( mh.messages[0].level, IECore.Msg.Level.Warning )
+		self.assertEqual( Gaffer.ValuePlug.getCacheMemoryLimit(), self.__gigabyte )
+
+	def testBackgroundThread( self ) :
+
+		directory = self.__writeCGroup( current = 10 * self.__gigabyte, high = 10 * self.__gigabyte )
+		governor = Gaffer.MemoryPressureGovernor(
+			Gaffer.MemoryPressureGovernor.cgroupSource( str( directory ) ),
+			interval = 10
+		)
+		self.assertEqual( governor.interval(), 10 )
+
+		for i in range( 0, 100 ) :
+			if governor.scale() != 1 :
+				break
+			time.sleep( 0.05 )
+
+		self.assertAlmostEqual( governor.scale(), 0.1 )
+		self.assertAlmostEqual( Gaffer.ValuePlug.getCacheMemoryLimit(), 0.1 * self.__gigabyte, delta = 1024 )
+
+	def testDestructionWithPythonMessageHandler( self ) :
+
+		# The background thread reports the read failure via a Python
+		# message handler, which requires the GIL. Destroying the governor
+		# from Python must not deadlock while waiting for the thread.
+
+		class Handler( IECore.MessageHandler ) :
+
+			def handle( self, level, context, message ) :
+
+				pass
+
+		with Handler() :
+			for i in range( 0, 20 ) :
+				governor = Gaffer.MemoryPressureGovernor(
+					Gaffer.MemoryPressureGovernor.cgroupSource( str( self.temporaryDirectory() / "missing" ) ),
+					interval = 1
+				)
+				time.sleep( 0.001 * ( i % 3 ) )
+				del governor
+
+	def testInstance( self ) :
+
+		self.assertIsNone( Gaffer.MemoryPressureGovernor.getInstance() )
+
+		directory = self.__writeCGroup( current = 0, high = 10 * self.__gigabyte )
+		governor = Gaffer.MemoryPressureGovernor( Gaffer.MemoryPressureGovernor.cgroupSource( str( directory ) ), interval = 0 )
+		Gaffer.MemoryPressureGovernor.setInstance( governor )
+		self.assertTrue( Gaffer.MemoryPressureGovernor.getInstance().isSame( governor ) )
+
+		Gaffer.MemoryPressureGovernor.setInstance( None )
+		self.assertIsNone( Gaffer.MemoryPressureGovernor.getInstance() )
+
+if __name__ == "__main__":
+	unittest.main()
@@ -1410,6 +1410,117 @@ class MetadataTest( GafferTest.TestCase ) :
 		self.assertEqual( Gaffer.Metadata.targetsWithMetadata( "target*", "k1" ), [ "target1", "targetA" ] )
 		self.assertEqual( Gaffer.Metadata.targetsWithMetadata( "*", "k3" ), [ "target2" ] )
 
+	def testPlugValueLookupsFollowRegistrationChanges( self ) :
+
+		n = GafferTest.AddNode()
+		self.assertIsNone( Gaffer.Metadata.value( n["op1"], "cacheTest" ) )
+
+		Gaffer.Metadata.registerValue( Gaffer.Node, "op*", "cacheTest", "nodeWildcard" )
+		self.assertEqual( Gaffer.Metadata.value( n["op1"], "cacheTest" ), "nodeWildcard" )
+		self.assertEqual( Gaffer.Metadata.value( n["op2"], "cacheTest" ), "nodeWildcard" )
+
+		# Registrations to derived types take precedence.
+
+		Gaffer.Metadata.registerValue( GafferTest.AddNode, "op*", "cacheTest", "addWildcard" )
+		self.assertEqual( Gaffer.Metadata.value( n["op1"], "cacheTest" ), "addWildcard" )
+
+		# Exact paths take precedence over wildcards.
+
+		Gaffer.Metadata.registerValue( GafferTest.AddNode, "op1", "cacheTest", "addExact" )
+		self.assertEqual( Gaffer.Metadata.value( n["op1"], "cacheTest" ), "addExact" )
+		self.assertEqual( Gaffer.Metadata.value( n["op2"], "cacheTest" ), "addWildcard" )
+
+		# Lookups are made by path, so follow renames.
+
+		n["op1"].setName( "renamed" )
+		self.assertIsNone( Gaffer.Metadata.value( n["renamed"], "cacheTest" ) )
+		n["renamed"].setName( "op1" )
+		self.assertEqual( Gaffer.Metadata.value( n["op1"], "cacheTest" ), "addExact" )
+
+		# And deregistrations.
+
+		Gaffer.Metadata.deregisterValue( GafferTest.AddNode, "op1", "cacheTest" )
+		self.assertEqual( Gaffer.Metadata.value( n["op1"], "cacheTest" ), "addWildcard" )
+
+		Gaffer.Metadata.deregisterValue( GafferTest.AddNode, "op*", "cacheTest" )
+		self.assertEqual( Gaffer.Metadata.value( n["op1"], "cacheTest" ), "nodeWildcard" )
+
+		Gaffer.Metadata.deregisterValue( Gaffer.Node, "op*", "cacheTest" )
+		self.assertIsNone( Gaffer.Metadata.value( n["op1"], "cacheTest" ) )
+
+	def testPlugValuePrecedenceBetweenAncestors( self ) :
+
+		class MetadataTestNodeH( Gaffer.Node ) :
+
+			def __init__( self, name = "MetadataTestNodeH" ) :
+
+				Gaffer.Node.__init__( self, name )
+
+				self["p"] = Gaffer.Plug()
+				self["p"]["c"] = Gaffer.IntPlug()
+
+		IECore.registerRunTimeTyped( MetadataTestNodeH )
+
+		class MetadataTestNodeI( MetadataTestNodeH ) :
+
+			def __init__( self, name = "MetadataTestNodeI" ) :
+
+				MetadataTestNodeH.__init__( self, name )
+
+		IECore.registerRunTimeTyped( MetadataTestNodeI )
+
+		n = MetadataTestNodeI()
+
+		Gaffer.Metadata.registerValue( Gaffer.Node, "p.c", "precedenceTest", "node" )
+		self.addCleanup( Gaffer.Metadata.deregisterValue, Gaffer.Node, "p.c", "precedenceTest" )
+		self.assertEqual( Gaffer.Metadata.value( n["p"]["c"], "precedenceTest" ), "node" )
+
+		Gaffer.Metadata.registerValue( Gaffer.Plug, "c", "precedenceTest", "plug" )
+		self.addCleanup( Gaffer.Metadata.deregisterValue, Gaffer.Plug, "c", "precedenceTest" )
+
+		# Neither MetadataTestNodeI nor MetadataTestNodeH has any registrations,
+		# so the search of the outer ancestor continues to Gaffer.Node, whose
+		# registration overrides the one to the inner ancestor.
+
+		self.assertEqual( Gaffer.Metadata.value( n["p"]["c"], "precedenceTest" ), "node" )
+
+		# Once MetadataTestNodeH has registrations of any sort, the search of
+		# the outer ancestor stops there, and the inner value is retained.
+
+		Gaffer.Metadata.registerValue( MetadataTestNodeH, "p", "unrelatedKey", "h" )
+		self.addCleanup( Gaffer.Metadata.deregisterValue, MetadataTestNodeH, "p", "unrelatedKey" )
+		self.assertEqual( Gaffer.Metadata.value( n["p"]["c"], "precedenceTest" ), "plug" )
+
+		# Unless that registration is for the key in question.
+
+		Gaffer.Metadata.registerValue( MetadataTestNodeH, "p.c", "precedenceTest", "h" )
+		self.addCleanup( Gaffer.Metadata.deregisterValue, MetadataTestNodeH, "p.c", "precedenceTest" )
+		self.assertEqual( Gaffer.Metadata.value( n["p"]["c"], "precedenceTest" ), "h" )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testPlugValuePerformance( self ) :
+
+		n = Gaffer.Node()
+		for i in range( 0, 100 ) :
+			n["p{}".format( i )] = Gaffer.Plug()
+			for j in range( 0, 10 ) :
+				n["p{}".format( i )]["c{}".format( j )] = Gaffer.IntPlug()
+
+		keys = [ "performanceTest{}".format( i ) for i in range( 0, 20 ) ]
+		for i, key in enumerate( keys ) :
+			Gaffer.Metadata.registerValue( Gaffer.Node, "p{}.c*".format( i ), key, i )
+			Gaffer.Metadata.registerValue( Gaffer.Node, "p{}".format( i ), key, i )
+			self.addCleanup( Gaffer.Metadata.deregisterValue, Gaffer.Node, "p{}.c*".format( i ), key )
+			self.addCleanup( Gaffer.Metadata.deregisterValue, Gaffer.Node, "p{}".format( i ), key )
+
+		plugs = list( Gaffer.Plug.RecursiveRange( n ) )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			for i in range( 0, 10 ) :
+				for plug in plugs :
+					for key in keys :
+						Gaffer.Metadata.value( plug, key )
+
 	def tearDown( self ) :
 
 		GafferTest.TestCase.tearDown( self )
@@ -35,6 +35,7 @@
 ##########################################################################
 
 import threading
+import time
 import unittest
 import timeit
 import queue
@@ -265,5 +266,92 @@ class ParallelAlgoTest( GafferTest.TestCase ) :
 		# background thread and remained active there for the duration.
 		self.assertEqual( m.plugStatistics( s["n"]["product"] ).computeCount, 10000 )
 
+	def testNUMANodes( self ) :
+
+		self.addCleanup( Gaffer.ParallelAlgo.setNUMANodes, Gaffer.ParallelAlgo.getNUMANodes() )
+
+		# Emulated nodes are available on all hardware, even if the
+		# CPUs must be shared between them.
+
+		for numNodes in ( 2, 3 ) :
+			Gaffer.ParallelAlgo.setNUMANodes( numNodes )
+			self.assertEqual( Gaffer.ParallelAlgo.getNUMANodes(), numNodes )
+			self.assertEqual( Gaffer.ParallelAlgo.currentNUMANode(), -1 )
+
+		Gaffer.ParallelAlgo.setNUMANodes( 1 )
+		self.assertEqual( Gaffer.ParallelAlgo.getNUMANodes(), 1 )
+
+		# The hardware topology has at least one node.
+
+		Gaffer.ParallelAlgo.setNUMANodes( 0 )
+		self.assertGreaterEqual( Gaffer.ParallelAlgo.getNUMANodes(), 1 )
+
+	def testThreadBudgets( self ) :
+
+		for priority in Gaffer.ParallelAlgo.Priority.values.values() :
+			self.addCleanup( Gaffer.ParallelAlgo.setThreadBudget, priority, Gaffer.ParallelAlgo.getThreadBudget( priority ) )
+
+		Gaffer.ParallelAlgo.setThreadBudget( Gaffer.ParallelAlgo.Priority.Background, 1 )
+		self.assertEqual( Gaffer.ParallelAlgo.getThreadBudget( Gaffer.ParallelAlgo.Priority.Background ), 1 )
+		self.assertEqual( Gaffer.ParallelAlgo.getThreadBudget( Gaffer.ParallelAlgo.Priority.Interactive ), 0 )
+
+		# Only one task at a time may run in the Background class.
+
+		lock = threading.Lock()
+		running = [ 0, 0 ]
+
+		def f() :
+
+			with lock :
+				running[0] += 1
+				running[1] = max( running )
+			time.sleep( 0.01 )
+			with lock :
+				running[0] -= 1
+
+		tasks = [
+			Gaffer.ParallelAlgo.callOnBackgroundThread( None, f, Gaffer.ParallelAlgo.Priority.Background )
+			for i in range( 0, 10 )
+		]
+		for t in tasks :
+			t.wait()
+			self.assertEqual( t.status(), Gaffer.BackgroundTask.Status.Completed )
+
+		self.assertEqual( running[1], 1 )
+
+		# Removing the budget returns the class to the shared arena.
+
+		Gaffer.ParallelAlgo.setThreadBudget( Gaffer.ParallelAlgo.Priority.Background, 0 )
+		t = Gaffer.ParallelAlgo.callOnBackgroundThread( None, f, priority = Gaffer.ParallelAlgo.Priority.Background )
+		t.wait()
+		self.assertEqual( t.status(), Gaffer.BackgroundTask.Status.Completed )
+
+	def testQueueStatistics( self ) :
+
+		Gaffer.ParallelAlgo.resetQueueStatistics()
+		for priority in Gaffer.ParallelAlgo.Priority.values.values() :
+			statistics = Gaffer.ParallelAlgo.queueStatistics( priority )
+			self.assertEqual( statistics.numTasks, 0 )
+			self.assertEqual( statistics.totalLatency, 0 )
+			self.assertEqual( statistics.maxLatency, 0 )
+
+		tasks = [
+			Gaffer.ParallelAlgo.callOnBackgroundThread( None, lambda : None, Gaffer.ParallelAlgo.Priority.Interactive )
+			for i in range( 0, 5 )
+		]
+		for t in tasks :
+			t.wait()
+
+		statistics = Gaffer.ParallelAlgo.queueStatistics( Gaffer.ParallelAlgo.Priority.Interactive )
+		self.assertEqual( statistics.numTasks, 5 )
+		self.assertEqual( statistics.numPending, 0 )
+		self.assertGreaterEqual( statistics.totalLatency, statistics.maxLatency )
+		self.assertGreaterEqual( statistics.maxLatency, 0 )
+
+		self.assertEqual( Gaffer.ParallelAlgo.queueStatistics( Gaffer.ParallelAlgo.Priority.Background ).numTasks, 0 )
+
+		Gaffer.ParallelAlgo.resetQueueStatistics()
+		self.assertEqual( Gaffer.ParallelAlgo.queueStatistics( Gaffer.ParallelAlgo.Priority.Interactive ).numTasks, 0 )
+
 if __name__ == "__main__":
 	unittest.main()
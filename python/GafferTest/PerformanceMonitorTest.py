@@ -37,6 +37,7 @@
 import os
 import gc
 import time
+import inspect
 import unittest
 
 import IECore
@@ -222,6 +223,83 @@ class PerformanceMonitorTest( GafferTest.TestCase ) :
 		self.assertAlmostEqual( seconds( m.plugStatistics( n2["out"] ).hashDuration ), 0.2, delta = delta )
 		self.assertAlmostEqual( seconds( m.plugStatistics( n2["out"] ).computeDuration ), 0.2, delta = delta )
 
+	def testHistogram( self ) :
+
+		h = Gaffer.PerformanceMonitor.Histogram()
+		self.assertEqual( h.count(), 0 )
+		self.assertEqual( h.max(), 0 )
+		self.assertEqual( h.percentile( 50 ), 0 )
+
+		for i in range( 1, 101 ) :
+			h.addSample( i * 1000 )
+
+		self.assertEqual( h.count(), 100 )
+		self.assertEqual( h.max(), 100000 )
+		self.assertAlmostEqual( h.percentile( 50 ), 50000, delta = 50000 / 16 )
+		self.assertAlmostEqual( h.percentile( 95 ), 95000, delta = 95000 / 16 )
+		self.assertAlmostEqual( h.percentile( 99 ), 99000, delta = 99000 / 16 )
+		self.assertEqual( h.percentile( 100 ), 100000 )
+		self.assertLessEqual( h.percentile( 0 ), 1000 )
+
+		# Small durations are recorded exactly.
+
+		h2 = Gaffer.PerformanceMonitor.Histogram()
+		for i in range( 0, 10 ) :
+			h2.addSample( i )
+		self.assertEqual( h2.percentile( 50 ), 4 )
+		self.assertNotEqual( h, h2 )
+
+		h3 = Gaffer.PerformanceMonitor.Histogram()
+		for i in range( 0, 10 ) :
+			h3.addSample( i )
+		self.assertEqual( h2, h3 )
+
+	def testHistogramsAndSlowestProcesses( self ) :
+
+		s = Gaffer.ScriptNode()
+		s["n"] = GafferTest.AddNode()
+		s["e"] = Gaffer.Expression()
+		s["e"].setExpression( inspect.cleandoc(
+			"""
+			import time
+			f = context.getFrame()
+			time.sleep( 0.1 if f == 5 else 0.001 )
+			parent["n"]["op1"] = int( f )
+			"""
+		) )
+
+		with Gaffer.PerformanceMonitor( maxSlowProcesses = 2 ) as m :
+			with Gaffer.Context() as c :
+				for f in range( 0, 10 ) :
+					c.setFrame( f )
+					s["n"]["sum"].getValue()
+
+		self.assertEqual( m.maxSlowProcesses(), 2 )
+
+		statistics = m.plugStatistics( s["e"]["__execute"] )
+		self.assertEqual( statistics.computeHistogram.count(), 10 )
+		self.assertEqual( statistics.hashHistogram.count(), statistics.hashCount )
+		self.assertGreaterEqual( statistics.computeHistogram.max(), 100000000 )
+		self.assertLess( statistics.computeHistogram.percentile( 50 ), statistics.computeHistogram.max() / 10 )
+
+		slowest = m.slowestProcesses()
+		self.assertEqual( len( slowest ), 2 )
+		self.assertTrue( slowest[0].plug.isSame( s["e"]["__execute"] ) )
+		self.assertEqual( slowest[0].type, "computeNode:compute" )
+		self.assertEqual( slowest[0].context.getFrame(), 5 )
+		self.assertEqual( slowest[0].duration, statistics.computeHistogram.max() )
+		self.assertGreaterEqual( slowest[0].duration, slowest[1].duration )
+
+		self.assertEqual( len( Gaffer.PerformanceMonitor().slowestProcesses() ), 0 )
+
+		distributions = Gaffer.MonitorAlgo.formatDistributions( m )
+		self.assertIn( "99th percentile duration per compute process", distributions )
+		self.assertIn( "e.__execute", distributions )
+
+		slowestText = Gaffer.MonitorAlgo.formatSlowestProcesses( m )
+		self.assertIn( "Slowest 2 processes", slowestText )
+		self.assertRegex( slowestText, r"frame\s+5" )
+
 	def testDontMonitorPreExistingBackgroundTasks( self ) :
 
 		s = Gaffer.ScriptNode()
@@ -0,0 +1,141 @@
+##########################################################################
+#
+#  Copyright (c) 2025, Cinesite VFX Ltd. All rights reserved.
+#
+#  Redistribution and use in source and binary forms, with or without
+#  modification, are permitted provided that the following conditions are
+#  met:
+#
+#      * Redistributions of source code must retain the above
+#        copyright notice, this list of conditions and the following
+#        disclaimer.
+#
+#      * Redistributions in binary form must reproduce the above
+#        copyright notice, this list of conditions and the following
+#        disclaimer in the documentation and/or other materials provided with
+#        the distribution.
+#
+#      * Neither the name of John Haddon nor the names of
+#        any other contributors to this software may be used to endorse or
+#        promote products derived from this software without specific prior
+#        written permission.
+#
+#  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+#  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+#  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+#  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+#  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+#  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+#  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+#  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+#  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+#  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+#  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+##########################################################################
+
+import unittest
+
+import Gaffer
+import GafferTest
+
+class SamplingMonitorTest( GafferTest.TestCase ) :
+
+	def __slowScript( self ) :
+
+		script = Gaffer.ScriptNode()
+		script["n"] = Gaffer.Node()
+		script["n"]["user"]["out"] = Gaffer.FloatPlug( flags = Gaffer.Plug.Flags.Default | Gaffer.Plug.Flags.Dynamic )
+
+		script["e"] = Gaffer.Expression()
+		script["e"].setExpression( "import time; time.sleep( 0.25 ); parent['n']['user']['out'] = 1" )
+
+		return script
+
+	def testConstruction( self ) :
+
+		monitor = Gaffer.SamplingMonitor()
+		self.assertEqual( monitor.interval(), 1000 )
+		self.assertEqual( monitor.numSamples(), 0 )
+		self.assertEqual( monitor.allStatistics(), {} )
+
+		monitor = Gaffer.SamplingMonitor( interval = 500 )
+		self.assertEqual( monitor.interval(), 500 )
+
+	def testStatistics( self ) :
+
+		s = Gaffer.SamplingMonitor.Statistics()
+		self.assertEqual( s.inclusiveSamples, 0 )
+		self.assertEqual( s.exclusiveSamples, 0 )
+
+		s = Gaffer.SamplingMonitor.Statistics( inclusiveSamples = 10, exclusiveSamples = 2 )
+		self.assertEqual( s.inclusiveSamples, 10 )
+		self.assertEqual( s.exclusiveSamples, 2 )
+		self.assertEqual( s, Gaffer.SamplingMonitor.Statistics( 10, 2 ) )
+		self.assertNotEqual( s, Gaffer.SamplingMonitor.Statistics( 10, 3 ) )
+
+	def testSampling( self ) :
+
+		script = self.__slowScript()
+
+		monitor = Gaffer.SamplingMonitor( interval = 1000 )
+		with monitor :
+			script["n"]["user"]["out"].getValue()
+
+		self.assertGreater( monitor.numSamples(), 0 )
+
+		statistics = monitor.allStatistics()
+		self.assertIn( script["e"]["__execute"], statistics )
+		self.assertGreater( statistics[script["e"]["__execute"]].exclusiveSamples, 0 )
+
+		for plug, s in statistics.items() :
+			self.assertEqual( monitor.plugStatistics( plug ), s )
+			self.assertGreaterEqual( s.inclusiveSamples, s.exclusiveSamples )
+
+		self.assertEqual( monitor.plugStatistics( script["n"]["user"] ), Gaffer.SamplingMonitor.Statistics() )
+
+	def testFlameGraph( self ) :
+
+		script = self.__slowScript()
+
+		monitor = Gaffer.SamplingMonitor()
+		with monitor :
+			script["n"]["user"]["out"].getValue()
+
+		fileName = self.temporaryDirectory() / "samples.folded"
+		monitor.writeFlameGraph( str( fileName ) )
+
+		with open( fileName ) as f :
+			lines = f.readlines()
+
+		self.assertGreater( len( lines ), 0 )
+		total = 0
+		for line in lines :
+			stack, count = line.rsplit( " ", 1 )
+			self.assertIn( "e.__execute", stack.split( ";" ) )
+			total += int( count )
+
+		self.assertEqual( total, sum( s.exclusiveSamples for s in monitor.allStatistics().values() ) )
+
+		with self.assertRaisesRegex( RuntimeError, "Unable to open file" ) :
+			monitor.writeFlameGraph( str( self.temporaryDirectory() / "missing" / "samples.folded" ) )
+
+	def testAnnotate( self ) :
+
+		script = self.__slowScript()
+
+		monitor = Gaffer.SamplingMonitor()
+		with monitor :
+			script["n"]["user"]["out"].getValue()
+
+		Gaffer.MonitorAlgo.annotate( script, monitor )
+		annotation = Gaffer.MetadataAlgo.getAnnotation( script["e"], "samplingMonitor" )
+		self.assertIsNotNone( annotation )
+		self.assertTrue( annotation.text().startswith( "Sampled time : " ) )
+		self.assertIsNone( Gaffer.MetadataAlgo.getAnnotation( script["n"], "samplingMonitor" ) )
+
+		Gaffer.MonitorAlgo.removePerformanceAnnotations( script )
+		self.assertIsNone( Gaffer.MetadataAlgo.getAnnotation( script["e"], "samplingMonitor" ) )
+
+if __name__ == "__main__":
+	unittest.main()
@@ -1837,5 +1837,161 @@ class ScriptNodeTest( GafferTest.TestCase ) :
 		self.assertTrue( "Line 3" in mh.messages[0].context )
 		self.assertTrue( "name 'b' is not defined" in mh.messages[0].message )
 
+	def testEditCount( self ) :
+
+		script = Gaffer.ScriptNode()
+		self.assertEqual( script.editCount( Gaffer.Node() ), 0 )
+
+		script["node"] = GafferTest.AddNode()
+		script["box"] = Gaffer.Box()
+		script["box"]["node"] = GafferTest.AddNode()
+
+		def assertEdited( node, edit ) :
+
+			before = script.editCount( node )
+			self.assertNotEqual( before, 0 )
+			edit()
+			self.assertNotEqual( script.editCount( node ), before )
+
+		def assertNotEdited( node, edit ) :
+
+			before = script.editCount( node )
+			edit()
+			self.assertEqual( script.editCount( node ), before )
+
+		assertEdited( script["node"], lambda : script["node"]["op1"].setValue( 1 ) )
+		with Gaffer.UndoScope( script ) :
+			assertEdited( script["node"], lambda : script["node"]["op1"].setValue( 2 ) )
+		assertEdited( script["node"], script.undo )
+		assertEdited( script["node"], lambda : script["node"].addChild( Gaffer.IntPlug( flags = Gaffer.Plug.Flags.Default | Gaffer.Plug.Flags.Dynamic ) ) )
+		assertEdited( script["node"], lambda : Gaffer.Metadata.registerValue( script["node"], "test", 1 ) )
+		assertEdited( script["node"], lambda : Gaffer.Metadata.registerValue( script["node"]["op2"], "test", 1 ) )
+
+		# Edits to nested nodes are attributed to the top-level node.
+
+		assertEdited( script["box"], lambda : script["box"]["node"]["op1"].setValue( 1 ) )
+		assertEdited( script["box"], lambda : script["box"].addChild( GafferTest.AddNode( "node2" ) ) )
+		assertEdited( script["box"], lambda : script["box"]["node2"]["op1"].setValue( 1 ) )
+		assertEdited( script["box"], lambda : script["box"]["node2"].setName( "node3" ) )
+
+		# Edits upstream don't affect downstream nodes, unless the
+		# upstream node is renamed, because the downstream node refers
+		# to it by name.
+
+		script["box"]["node"]["op1"].setInput( script["node"]["sum"] )
+		assertNotEdited( script["box"], lambda : script["node"]["op1"].setValue( 10 ) )
+		assertEdited( script["box"], lambda : script["node"].setName( "renamed" ) )
+
+		# Removed nodes are no longer tracked.
+
+		node = script["renamed"]
+		script.removeChild( node )
+		self.assertEqual( script.editCount( node ), 0 )
+
+	def testIncrementalSerialisation( self ) :
+
+		script = Gaffer.ScriptNode()
+		script["a"] = GafferTest.AddNode()
+		script["b"] = GafferTest.AddNode()
+		script["b"]["op1"].setInput( script["a"]["sum"] )
+		script["box"] = Gaffer.Box()
+		script["box"]["c"] = GafferTest.AddNode()
+		script["box"]["c"]["op1"].setInput( script["b"]["sum"] )
+		script["d"] = GafferTest.AddNode()
+
+		def assertUpToDate() :
+
+			# Serialising via `Gaffer.Serialisation` bypasses the cache
+			# used by the ScriptNode.
+			self.assertEqual( script.serialise(), Gaffer.Serialisation( script ).result() )
+
+		assertUpToDate()
+
+		script["a"]["op2"].setValue( 10 )
+		assertUpToDate()
+
+		with Gaffer.UndoScope( script ) :
+			script["box"]["c"]["op2"].setValue( 20 )
+		assertUpToDate()
+
+		script.undo()
+		assertUpToDate()
+
+		script.redo()
+		assertUpToDate()
+
+		script["a"].setName( "e" )
+		assertUpToDate()
+
+		with Gaffer.UndoScope( script ) :
+			script["b"]["sum"].setName( "total" )
+		assertUpToDate()
+
+		script["d"]["user"]["p"] = Gaffer.IntPlug( flags = Gaffer.Plug.Flags.Default | Gaffer.Plug.Flags.Dynamic )
+		assertUpToDate()
+
+		Gaffer.Metadata.registerValue( script["box"]["c"], "test", 10 )
+		assertUpToDate()
+
+		Gaffer.PlugAlgo.promote( script["box"]["c"]["op2"] )
+		assertUpToDate()
+
+		script["box"]["f"] = GafferTest.AddNode()
+		assertUpToDate()
+
+		del script["b"]
+		assertUpToDate()
+
+		script.addChild( GafferTest.AddNode( "b" ) )
+		assertUpToDate()
+
+		# Moving a node between parents.
+		script["box"].addChild( script["d"] )
+		assertUpToDate()
+
+		# And a round trip, to make sure nothing was lost.
+		script2 = Gaffer.ScriptNode()
+		script2.execute( script.serialise() )
+		self.assertEqual( script2.serialise(), script.serialise() )
+
+	def __buildIncrementalSerialisationScript( self ) :
+
+		script = Gaffer.ScriptNode()
+		with Gaffer.DirtyPropagationScope() :
+			for i in range( 0, 200 ) :
+				box = Gaffer.Box( "Box{}".format( i ) )
+				script.addChild( box )
+				upstream = None
+				for j in range( 0, 50 ) :
+					node = GafferTest.AddNode()
+					box.addChild( node )
+					node["op2"].setValue( j )
+					if upstream is not None :
+						node["op1"].setInput( upstream["sum"] )
+					upstream = node
+
+		return script
+
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 1 )
+	def testFullSerialisationPerformance( self ) :
+
+		script = self.__buildIncrementalSerialisationScript()
+		with GafferTest.TestRunner.PerformanceScope() :
+			script.serialise()
+
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 1 )
+	def testIncrementalSerialisationPerformance( self ) :
+
+		script = self.__buildIncrementalSerialisationScript()
+		script.serialise()
+
+		with Gaffer.UndoScope( script ) :
+			script["Box10"]["AddNode10"]["op2"].setValue( 1000 )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			script.serialise()
+
 if __name__ == "__main__":
 	unittest.main()
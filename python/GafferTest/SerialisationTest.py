@@ -324,5 +324,188 @@ class SerialisationTest( GafferTest.TestCase ) :
 
 		self.assertEqual( serialisation.result().count( "import MyModule" ), 1 )
 
+	def testBinaryFormat( self ) :
+
+		script = Gaffer.ScriptNode()
+
+		script["a"] = GafferTest.AddNode()
+		script["a"]["op1"].setValue( 10 )
+		script["a"]["user"]["f"] = Gaffer.FloatPlug( defaultValue = 1, flags = Gaffer.Plug.Flags.Default | Gaffer.Plug.Flags.Dynamic )
+		script["a"]["user"]["f"].setValue( 2.5 )
+		script["a"]["user"]["v"] = Gaffer.V3fPlug( flags = Gaffer.Plug.Flags.Default | Gaffer.Plug.Flags.Dynamic )
+		script["a"]["user"]["v"].setValue( imath.V3f( 1, 2, 3 ) )
+		script["a"]["user"]["s"] = Gaffer.StringVectorDataPlug( defaultValue = IECore.StringVectorData(), flags = Gaffer.Plug.Flags.Default | Gaffer.Plug.Flags.Dynamic )
+		script["a"]["user"]["s"].setValue( IECore.StringVectorData( [ "x", "y" ] ) )
+		Gaffer.Metadata.registerValue( script["a"], "description", "test" )
+		Gaffer.Metadata.registerValue( script["a"]["op1"], "layout:section", "Settings" )
+
+		script["b"] = GafferTest.AddNode()
+		script["b"]["op1"].setInput( script["a"]["sum"] )
+
+		script["box"] = Gaffer.Box()
+		script["box"]["c"] = GafferTest.AddNode()
+		script["box"]["c"]["op2"].setValue( 3 )
+		script["box"]["c"]["op1"].setInput( script["b"]["sum"] )
+
+		serialisation = Gaffer.Serialisation( script, format = Gaffer.Serialisation.Format.Binary )
+		self.assertEqual( serialisation.format(), Gaffer.Serialisation.Format.Binary )
+		result = serialisation.result()
+		self.assertIsInstance( result, bytes )
+		self.assertTrue( Gaffer.Serialisation.isBinary( result ) )
+		self.assertFalse( Gaffer.Serialisation.isBinary( script.serialise() ) )
+
+		script["fileName"].setValue( self.temporaryDirectory() / "test.gfrb" )
+		script.save()
+
+		script2 = Gaffer.ScriptNode()
+		script2["fileName"].setValue( script["fileName"].getValue() )
+		script2.load()
+
+		self.assertEqual( script2["a"]["op1"].getValue(), 10 )
+		self.assertEqual( script2["a"]["user"]["f"].getValue(), 2.5 )
+		self.assertEqual( script2["a"]["user"]["f"].defaultValue(), 1 )
+		self.assertEqual( script2["a"]["user"]["v"].getValue(), imath.V3f( 1, 2, 3 ) )
+		self.assertEqual( script2["a"]["user"]["s"].getValue(), IECore.StringVectorData( [ "x", "y" ] ) )
+		self.assertEqual( Gaffer.Metadata.value( script2["a"], "description" ), "test" )
+		self.assertEqual( Gaffer.Metadata.value( script2["a"]["op1"], "layout:section" ), "Settings" )
+		self.assertTrue( script2["b"]["op1"].getInput().isSame( script2["a"]["sum"] ) )
+		self.assertEqual( script2["box"]["c"]["op2"].getValue(), 3 )
+		self.assertTrue( script2["box"]["c"]["op1"].getInput().isSame( script2["b"]["sum"] ) )
+		self.assertEqual( script2.serialise(), script.serialise() )
+
+	def testImportFile( self ) :
+
+		script = Gaffer.ScriptNode()
+		script["a"] = GafferTest.AddNode()
+		script["a"]["op1"].setValue( 10 )
+		script["b"] = GafferTest.AddNode()
+		script["b"]["op1"].setInput( script["a"]["sum"] )
+
+		for extension in ( ".gfr", ".gfrb" ) :
+			with self.subTest( extension = extension ) :
+
+				fileName = self.temporaryDirectory() / ( "import" + extension )
+				script.serialiseToFile( fileName )
+
+				script2 = Gaffer.ScriptNode()
+				script2["box"] = Gaffer.Box()
+				script2.importFile( fileName, parent = script2["box"] )
+
+				self.assertEqual( script2["box"]["a"]["op1"].getValue(), 10 )
+				self.assertTrue( script2["box"]["b"]["op1"].getInput().isSame( script2["box"]["a"]["sum"] ) )
+
+	def testBinaryFormatPythonFallback( self ) :
+
+		script = Gaffer.ScriptNode()
+		script["n"] = GafferTest.AddNode()
+		script["e"] = Gaffer.Expression()
+		script["e"].setExpression( "parent['n']['op1'] = 2" )
+		Gaffer.MetadataAlgo.setNumericBookmark( script, 1, script["n"] )
+
+		serialisation = Gaffer.Serialisation( script, format = Gaffer.Serialisation.Format.Binary ).result()
+
+		script2 = Gaffer.ScriptNode()
+		with Gaffer.Serialisation.LoadStatistics() as statistics :
+			script2.executeFile( self.__writeBinary( serialisation ) )
+
+		self.assertEqual( script2["n"]["op1"].getValue(), 2 )
+		self.assertTrue( Gaffer.MetadataAlgo.getNumericBookmark( script2, 1 ).isSame( script2["n"] ) )
+
+		entries = statistics.entries()
+		self.assertIn( "Gaffer::Expression", entries )
+		self.assertGreater( entries["Gaffer::Expression"]["pythonFragments"], 0 )
+		self.assertGreater( entries["GafferTest::AddNode"]["nativeOperations"], 0 )
+
+	def testBinaryFormatPythonSerialiser( self ) :
+
+		class CustomSerialiser( Gaffer.NodeSerialiser ) :
+
+			def postHierarchy( self, node, identifier, serialisation ) :
+
+				return Gaffer.NodeSerialiser.postHierarchy( self, node, identifier, serialisation ) + identifier + "[\"op2\"].setValue( 20 )\n"
+
+		Gaffer.Serialisation.registerSerialiser( GafferTest.AddNode, CustomSerialiser() )
+		try :
+			script = Gaffer.ScriptNode()
+			script["n"] = GafferTest.AddNode()
+			serialisation = Gaffer.Serialisation( script, format = Gaffer.Serialisation.Format.Binary ).result()
+		finally :
+			Gaffer.Serialisation.registerSerialiser( GafferTest.AddNode, Gaffer.NodeSerialiser() )
+
+		script2 = Gaffer.ScriptNode()
+		script2.executeFile( self.__writeBinary( serialisation ) )
+		self.assertEqual( script2["n"]["op2"].getValue(), 20 )
+
+	def testBinaryFormatCppSerialiser( self ) :
+
+		# The serialiser reimplements `postHierarchy()` but not `binaryPostHierarchy()`,
+		# so its output must be embedded as Python rather than silently dropped.
+		Gaffer.Serialisation.registerSerialiser( GafferTest.AddNode, GafferTest.postHierarchyTestSerialiser() )
+		try :
+			script = Gaffer.ScriptNode()
+			script["n"] = GafferTest.AddNode()
+			serialisation = Gaffer.Serialisation( script, format = Gaffer.Serialisation.Format.Binary ).result()
+		finally :
+			Gaffer.Serialisation.registerSerialiser( GafferTest.AddNode, Gaffer.NodeSerialiser() )
+
+		script2 = Gaffer.ScriptNode()
+		script2.executeFile( self.__writeBinary( serialisation ) )
+		self.assertEqual( script2["n"]["op2"].getValue(), 20 )
+
+	def testBinaryFormatPaste( self ) :
+
+		script = Gaffer.ScriptNode()
+		script["n"] = GafferTest.AddNode()
+		script["n"]["op1"].setValue( 1 )
+		serialisation = self.__writeBinary(
+			Gaffer.Serialisation( script, filter = Gaffer.StandardSet( [ script["n"] ] ), format = Gaffer.Serialisation.Format.Binary ).result()
+		)
+
+		# Executing again must rename the new node, and all
+		# operations must be applied to the renamed node.
+		script.executeFile( serialisation )
+		self.assertIn( "n1", script )
+		self.assertEqual( script["n1"]["op1"].getValue(), 1 )
+		script.executeFile( serialisation )
+		self.assertEqual( script["n2"]["op1"].getValue(), 1 )
+
+	def testBinaryFormatContinueOnError( self ) :
+
+		class BrokenSerialiser( Gaffer.NodeSerialiser ) :
+
+			def postConstructor( self, node, identifier, serialisation ) :
+
+				return identifier + ".nonExistentMethod()\n"
+
+		Gaffer.Serialisation.registerSerialiser( GafferTest.AddNode, BrokenSerialiser() )
+		try :
+			script = Gaffer.ScriptNode()
+			script["n"] = GafferTest.AddNode()
+			script["n"]["op1"].setValue( 2 )
+			fileName = self.__writeBinary( Gaffer.Serialisation( script, format = Gaffer.Serialisation.Format.Binary ).result() )
+		finally :
+			Gaffer.Serialisation.registerSerialiser( GafferTest.AddNode, Gaffer.NodeSerialiser() )
+
+		script2 = Gaffer.ScriptNode()
+		with self.assertRaisesRegex( Exception, "nonExistentMethod" ) :
+			script2.executeFile( fileName )
+
+		script3 = Gaffer.ScriptNode()
+		with IECore.CapturingMessageHandler() as mh :
+			self.assertTrue( script3.executeFile( fileName, continueOnError = True ) )
+
+		self.assertEqual( len( mh.messages ), 1 )
+		self.assertIn( "nonExistentMethod", mh.messages[0].message )
+		# Native operations following the error are still performed.
+		self.assertEqual( script3["n"]["op1"].getValue(), 2 )
+
+	def __writeBinary( self, serialisation ) :
+
+		fileName = self.temporaryDirectory() / "test.gfrb"
+		with open( fileName, "wb" ) as f :
+			f.write( serialisation )
+
+		return fileName
+
 if __name__ == "__main__":
 	unittest.main()
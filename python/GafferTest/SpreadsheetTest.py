@@ -619,6 +619,57 @@ class SpreadsheetTest( GafferTest.TestCase ) :
 		row2["name"].setValue( "ca*" )
 		self.assertEqual( s["out"]["v"].getValue(), 2 )
 
+	def testWildcardsFirstMatch( self ) :
+
+		s = Gaffer.Spreadsheet()
+		s["rows"].addColumn( Gaffer.IntPlug( "v" ) )
+		s["selector"].setValue( "${name}" )
+
+		for i, name in enumerate( [
+			"catalogue",
+			"*dog",
+			"cat*",
+			"hat bat*",
+			"*a*",
+			"ca?",
+			"rat",
+			"[bcr]at",
+			"*",
+		] ) :
+			row = s["rows"].addRow()
+			row["name"].setValue( name )
+			row["cells"]["v"]["value"].setValue( i + 1 )
+
+		with Gaffer.Context() as c :
+			for name, expected in [
+				( "catalogue", 1 ),
+				( "hotdog", 2 ),
+				( "dog", 2 ),
+				( "cat", 3 ),
+				( "cattle", 3 ),
+				( "hat", 4 ),
+				( "batman", 4 ),
+				( "rat", 5 ),
+				( "man", 5 ),
+				( "cow", 9 ),
+				( "", 9 ),
+			] :
+				c["name"] = name
+				self.assertEqual( s["out"]["v"].getValue(), expected, name )
+
+		s["rows"][9]["enabled"].setValue( False )
+		s["rows"][5]["enabled"].setValue( False )
+		with Gaffer.Context() as c :
+			for name, expected in [
+				( "man", 0 ),
+				( "rat", 7 ),
+				( "bat", 4 ),
+				( "cat", 3 ),
+				( "cab", 6 ),
+			] :
+				c["name"] = name
+				self.assertEqual( s["out"]["v"].getValue(), expected, name )
+
 	def testSelectorVariablesRemovedFromRowNameContext( self ) :
 
 		s = Gaffer.ScriptNode()
@@ -1068,6 +1119,66 @@ class SpreadsheetTest( GafferTest.TestCase ) :
 					c["index"] = i
 					self.assertEqual( out.getValue(), i )
 
+	def __wildcardRowIndexPerformance( self, rowNames, selectors ) :
+
+		s = Gaffer.Spreadsheet()
+		s["selector"].setValue( "${name}" )
+		s["rows"].addColumn( Gaffer.IntPlug( "v" ) )
+		s["rows"].addRows( len( rowNames ) )
+		for i, name in enumerate( rowNames ) :
+			s["rows"][i+1]["name"].setValue( name )
+			s["rows"][i+1]["cells"]["v"]["value"].setValue( i + 1 )
+
+		# Compute the rows map up front, so we measure only lookups.
+		s["enabledRowNames"].getValue()
+
+		c = Gaffer.Context()
+		out = s["out"]["v"]
+		with c :
+			with GafferTest.TestRunner.PerformanceScope() :
+				for selector, expected in selectors :
+					c["name"] = selector
+					self.assertEqual( out.getValue(), expected )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testExactRowIndexPerformance( self ) :
+
+		rowNames = [ "asset{}".format( i ) for i in range( 0, 5000 ) ]
+		self.__wildcardRowIndexPerformance(
+			rowNames, [ ( n, i + 1 ) for i, n in enumerate( rowNames ) ]
+		)
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testPrefixWildcardRowIndexPerformance( self ) :
+
+		rowNames = [ "asset{}_*".format( i ) for i in range( 0, 5000 ) ]
+		self.__wildcardRowIndexPerformance(
+			rowNames, [ ( "asset{}_GEO".format( i ), i + 1 ) for i in range( 0, 5000 ) ]
+		)
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testMixedWildcardRowIndexPerformance( self ) :
+
+		rowNames = []
+		for i in range( 0, 1250 ) :
+			rowNames.extend( [
+				"exact{}".format( i ),
+				"prefix{}_*".format( i ),
+				"*suffix{}".format( i ),
+				"choice{}_[ab]".format( i ),
+			] )
+
+		selectors = []
+		for i in range( 0, 1250 ) :
+			selectors.extend( [
+				( "exact{}".format( i ), i * 4 + 1 ),
+				( "prefix{}_GEO".format( i ), i * 4 + 2 ),
+				( "GEO_suffix{}".format( i ), i * 4 + 3 ),
+				( "choice{}_b".format( i ), i * 4 + 4 ),
+			] )
+
+		self.__wildcardRowIndexPerformance( rowNames, selectors )
+
 	@GafferTest.TestRunner.PerformanceTestMethod()
 	def testRowAccessorPerformance( self ) :
 
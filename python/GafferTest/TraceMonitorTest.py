@@ -0,0 +1,217 @@
+##########################################################################
+#
+#  Copyright (c) 2025, Cinesite VFX Ltd. All rights reserved.
+#
+#  Redistribution and use in source and binary forms, with or without
+#  modification, are permitted provided that the following conditions are
+#  met:
+#
+#      * Redistributions of source code must retain the above
+#        copyright notice, this list of conditions and the following
+#        disclaimer.
+#
+#      * Redistributions in binary form must reproduce the above
+#        copyright notice, this list of conditions and the following
+#        disclaimer in the documentation and/or other materials provided with
+#        the distribution.
+#
+#      * Neither the name of John Haddon nor the names of
+#        any other contributors to this software may be used to endorse or
+#        promote products derived from this software without specific prior
+#        written permission.
+#
+#  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+#  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+#  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+#  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+#  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+#  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+#  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+#  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+#  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+#  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+#  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+##########################################################################
+
+import json
+import unittest
+
+import Gaffer
+import GafferTest
+
+class TraceMonitorTest( GafferTest.TestCase ) :
+
+	def testConstruction( self ) :
+
+		monitor = Gaffer.TraceMonitor()
+		self.assertEqual( monitor.numEvents(), 0 )
+
+	def testMonitoring( self ) :
+
+		script = Gaffer.ScriptNode()
+		script["random"] = Gaffer.Random()
+
+		monitor = Gaffer.TraceMonitor()
+		with monitor :
+			script["random"]["outFloat"].getValue()
+
+		# One event for a hash and one for a compute.
+		self.assertEqual( monitor.numEvents(), 2 )
+
+		fileName = self.temporaryDirectory() / "trace.json"
+		monitor.writeChromeTrace( str( fileName ) )
+		with open( fileName ) as f :
+			trace = json.load( f )
+
+		events = [ e for e in trace["traceEvents"] if e["ph"] != "M" ]
+		self.assertEqual( [ e["ph"] for e in events ], [ "X", "X" ] )
+		self.assertEqual( { e["name"] for e in events }, { "random.outFloat" } )
+		self.assertEqual(
+			[ e["args"]["processType"] for e in events ],
+			[ "computeNode:hash", "computeNode:compute" ]
+		)
+
+		for e in events :
+			self.assertEqual( e["tid"], Gaffer.ThreadMonitor.thisThreadId() )
+			self.assertGreaterEqual( e["dur"], 0 )
+		self.assertLessEqual( events[0]["ts"] + events[0]["dur"], events[1]["ts"] )
+
+		monitor.clear()
+		self.assertEqual( monitor.numEvents(), 0 )
+
+	def testParent( self ) :
+
+		script = Gaffer.ScriptNode()
+		script["add1"] = GafferTest.AddNode()
+		script["add2"] = GafferTest.AddNode()
+		script["add2"]["op1"].setInput( script["add1"]["sum"] )
+
+		monitor = Gaffer.TraceMonitor()
+		with monitor :
+			script["add2"]["sum"].getValue()
+
+		fileName = self.temporaryDirectory() / "trace.json"
+		monitor.writeChromeTrace( str( fileName ) )
+		with open( fileName ) as f :
+			trace = json.load( f )
+
+		events = { e["args"]["id"] : e for e in trace["traceEvents"] if e["ph"] == "X" }
+		self.assertEqual(
+			{
+				(
+					e["name"], e["args"]["processType"], e["args"]["parent"],
+					events[e["args"]["parentId"]]["args"]["processType"] if e["args"]["parentId"] is not None else None
+				)
+				for e in events.values()
+			},
+			{
+				( "add2.sum", "computeNode:hash", "", None ),
+				( "add1.sum", "computeNode:hash", "add2.sum", "computeNode:hash" ),
+				( "add2.sum", "computeNode:compute", "", None ),
+				( "add1.sum", "computeNode:compute", "add2.sum", "computeNode:compute" ),
+			}
+		)
+
+	def testParentIdDistinguishesProcessesOnSamePlug( self ) :
+
+		# Hashing `add2.sum` involves a hash process for `add1.sum`, and
+		# computing it involves a compute process for the same plug. The
+		# parent plugs are identical, so only the parent id can tell us
+		# which process each child belongs to.
+
+		script = Gaffer.ScriptNode()
+		script["add1"] = GafferTest.AddNode()
+		script["add2"] = GafferTest.AddNode()
+		script["add2"]["op1"].setInput( script["add1"]["sum"] )
+
+		monitor = Gaffer.TraceMonitor()
+		with monitor :
+			script["add2"]["sum"].getValue()
+
+		fileName = self.temporaryDirectory() / "trace.json"
+		monitor.writeChromeTrace( str( fileName ) )
+		with open( fileName ) as f :
+			trace = json.load( f )
+
+		events = { e["args"]["id"] : e for e in trace["traceEvents"] if e["ph"] == "X" }
+		for e in events.values() :
+			if e["args"]["parentId"] is None :
+				continue
+			parent = events[e["args"]["parentId"]]
+			self.assertEqual( parent["args"]["processType"], e["args"]["processType"] )
+			self.assertLessEqual( parent["ts"], e["ts"] )
+			self.assertGreaterEqual( parent["ts"] + parent["dur"], e["ts"] + e["dur"] )
+
+	def testProcessMask( self ) :
+
+		random = Gaffer.Random()
+		monitor = Gaffer.TraceMonitor( processMask = [ "computeNode:hash" ] )
+		with monitor :
+			random["outFloat"].getValue()
+
+		self.assertEqual( monitor.numEvents(), 2 )
+
+	def testMultipleThreads( self ) :
+
+		random = Gaffer.Random()
+		random["seedVariable"].setValue( "test" )
+
+		monitor = Gaffer.TraceMonitor()
+		with monitor :
+			GafferTest.parallelGetValue( random["outFloat"], 1000, "test" )
+
+		fileName = self.temporaryDirectory() / "trace.json"
+		monitor.writeChromeTrace( str( fileName ) )
+		with open( fileName ) as f :
+			trace = json.load( f )
+
+		# Every event should have a parent on the same thread or another
+		# one, unless it was the process that started the computation.
+		events = { e["args"]["id"] : e for e in trace["traceEvents"] if e["ph"] == "X" }
+		self.assertEqual( len( events ), monitor.numEvents() )
+		for e in events.values() :
+			if e["args"]["parentId"] is not None :
+				self.assertIn( e["args"]["parentId"], events )
+
+	def testMaxEventsPerThread( self ) :
+
+		random = Gaffer.Random()
+		random["seedVariable"].setValue( "test" )
+
+		monitor = Gaffer.TraceMonitor( maxEventsPerThread = 10 )
+		with monitor :
+			with Gaffer.Context() as context :
+				for i in range( 0, 100 ) :
+					context["test"] = i
+					random["outFloat"].getValue()
+
+		# Each getValue() records a hash and a compute, but only the most
+		# recent events are kept.
+		self.assertEqual( monitor.numEvents(), 10 )
+		self.assertEqual( monitor.numDroppedEvents(), 190 )
+
+		fileName = self.temporaryDirectory() / "trace.json"
+		monitor.writeChromeTrace( str( fileName ) )
+		with open( fileName ) as f :
+			trace = json.load( f )
+		self.assertEqual( len( [ e for e in trace["traceEvents"] if e["ph"] == "X" ] ), 10 )
+
+	def testPlugsOutliveGraph( self ) :
+
+		monitor = Gaffer.TraceMonitor()
+		with monitor :
+			Gaffer.Random()["outFloat"].getValue()
+
+		# The node has been destroyed, but the monitor keeps
+		# enough information alive to write the trace.
+		monitor.writeChromeTrace( str( self.temporaryDirectory() / "trace.json" ) )
+
+	def testFileError( self ) :
+
+		monitor = Gaffer.TraceMonitor()
+		with self.assertRaisesRegex( RuntimeError, "Unable to open file" ) :
+			monitor.writeChromeTrace( str( self.temporaryDirectory() / "nonexistent" / "trace.json" ) )
+
+if __name__ == "__main__":
+	unittest.main()
@@ -77,6 +77,7 @@ class ValuePlugTest( GafferTest.TestCase ) :
 		self.assertFalse( v3.isSame( v2 ) )
 
 		Gaffer.ValuePlug.setCacheMemoryLimit( self.__originalCacheMemoryLimit )
+		Gaffer.ValuePlug.setPersistentCacheDirectory( self.__originalPersistentCacheDirectory )
 
 		v1 = n["out"].getValue( _copy=False )
 		v2 = n["out"].getValue( _copy=False )
@@ -1067,17 +1068,192 @@ class ValuePlugTest( GafferTest.TestCase ) :
 					node["in"].setValue( i )
 					self.assertEqual( node["out"].getValue(), i )
 
+	class PersistentNode( Gaffer.ComputeNode ) :
+
+		def __init__( self, name="PersistentNode" ) :
+
+			Gaffer.ComputeNode.__init__( self, name )
+
+			self["in"] = Gaffer.StringPlug()
+			self["out"] = Gaffer.StringVectorDataPlug( direction = Gaffer.Plug.Direction.Out, defaultValue = IECore.StringVectorData() )
+			self.numComputes = 0
+
+		def affects( self, input ) :
+
+			result = Gaffer.ComputeNode.affects( self, input )
+			if input == self["in"] :
+				result.append( self["out"] )
+
+			return result
+
+		def hash( self, output, context, h ) :
+
+			Gaffer.ComputeNode.hash( self, output, context, h )
+			self["in"].hash( h )
+
+		def compute( self, output, context ) :
+
+			self.numComputes += 1
+			output.setValue( IECore.StringVectorData( [ self["in"].getValue() ] * 10 ) )
+
+		def computeCachePolicy( self, output ) :
+
+			return Gaffer.ValuePlug.CachePolicy.Persistent
+
+	IECore.registerRunTimeTyped( PersistentNode )
+
+	def testPersistentCache( self ) :
+
+		self.assertEqual( Gaffer.ValuePlug.getPersistentCacheDirectory(), "" )
+
+		node = self.PersistentNode()
+		node["in"].setValue( "a" )
+
+		# Persistent cache disabled. Clearing the in-memory cache
+		# means we have to compute again.
+
+		self.assertEqual( node["out"].getValue(), IECore.StringVectorData( [ "a" ] * 10 ) )
+		self.assertEqual( node.numComputes, 1 )
+		Gaffer.ValuePlug.clearCache()
+		self.assertEqual( node["out"].getValue(), IECore.StringVectorData( [ "a" ] * 10 ) )
+		self.assertEqual( node.numComputes, 2 )
+
+		# Persistent cache enabled. We should be able to retrieve
+		# the value after clearing the in-memory cache.
+
+		directory = self.temporaryDirectory() / "persistentCache"
+		Gaffer.ValuePlug.setPersistentCacheDirectory( directory.as_posix() )
+		self.assertEqual( Gaffer.ValuePlug.getPersistentCacheDirectory(), directory.as_posix() )
+		self.assertTrue( directory.is_dir() )
+
+		node["in"].setValue( "b" )
+		self.assertEqual( node["out"].getValue(), IECore.StringVectorData( [ "b" ] * 10 ) )
+		self.assertEqual( node.numComputes, 3 )
+		self.assertGreater( Gaffer.ValuePlug.persistentCacheUsage(), 0 )
+
+		Gaffer.ValuePlug.clearCache()
+		self.assertEqual( node["out"].getValue(), IECore.StringVectorData( [ "b" ] * 10 ) )
+		self.assertEqual( node.numComputes, 3 )
+
+		# Clearing the persistent cache means we have to compute again.
+
+		Gaffer.ValuePlug.clearPersistentCache()
+		self.assertEqual( Gaffer.ValuePlug.persistentCacheUsage(), 0 )
+		Gaffer.ValuePlug.clearCache()
+		self.assertEqual( node["out"].getValue(), IECore.StringVectorData( [ "b" ] * 10 ) )
+		self.assertEqual( node.numComputes, 4 )
+
+	def testPersistentCacheClearWithSharedDirectory( self ) :
+
+		GafferTest.testPersistentCacheClear( ( self.temporaryDirectory() / "persistentCache" ).as_posix() )
+
+	def testFrameInvariantHashCache( self ) :
+
+		script = Gaffer.ScriptNode()
+
+		# Static branch, which doesn't depend on the frame.
+		script["static1"] = GafferTest.AddNode()
+		script["static2"] = GafferTest.AddNode()
+		script["static2"]["op1"].setInput( script["static1"]["sum"] )
+		script["static1"]["op1"].setValue( 1 )
+
+		# Animated branch, which does.
+		script["animated"] = GafferTest.AddNode()
+		script["expression"] = Gaffer.Expression()
+		script["expression"].setExpression( 'parent["animated"]["op1"] = int( context.getFrame() )' )
+
+		# And a node which combines the two.
+		script["combine"] = GafferTest.AddNode()
+		script["combine"]["op1"].setInput( script["static2"]["sum"] )
+		script["combine"]["op2"].setInput( script["animated"]["sum"] )
+
+		def evaluate( frames, variables = {} ) :
+
+			monitor = Gaffer.PerformanceMonitor()
+			result = []
+			with monitor :
+				for frame in frames :
+					context = Gaffer.Context( script.context() )
+					context.setFrame( frame )
+					for name, value in variables.items() :
+						context[name] = value
+					with context :
+						result.append( ( script["combine"]["sum"].hash(), script["combine"]["sum"].getValue() ) )
+
+			return result, monitor
+
+		frames = range( 1, 11 )
+		Gaffer.ValuePlug.setFrameInvariantHashCacheEnabled( False )
+		expected, monitor = evaluate( frames )
+		self.assertEqual( monitor.plugStatistics( script["static2"]["sum"] ).hashCount, len( frames ) )
+
+		Gaffer.ValuePlug.setFrameInvariantHashCacheEnabled( True )
+		self.assertTrue( Gaffer.ValuePlug.getFrameInvariantHashCacheEnabled() )
+		Gaffer.ValuePlug.clearHashCache()
+		statistics = Gaffer.ValuePlug.frameInvariantHashCacheStatistics()
+
+		# The static branch is only hashed once, but everything depending on
+		# the animated branch must be hashed for every frame. Results are
+		# identical.
+
+		result, monitor = evaluate( frames )
+		self.assertEqual( result, expected )
+		self.assertEqual( monitor.plugStatistics( script["static1"]["sum"] ).hashCount, 1 )
+		self.assertEqual( monitor.plugStatistics( script["static2"]["sum"] ).hashCount, 1 )
+		self.assertEqual( monitor.plugStatistics( script["animated"]["sum"] ).hashCount, len( frames ) )
+		self.assertEqual( monitor.plugStatistics( script["combine"]["sum"] ).hashCount, len( frames ) )
+		self.assertGreater( Gaffer.ValuePlug.frameInvariantHashCacheStatistics().hits, statistics.hits )
+		self.assertGreater( Gaffer.ValuePlug.frameInvariantHashCacheStatistics().entries, 0 )
+
+		# Hashes are shared for each value of other context variables,
+		# not between them.
+
+		result, monitor = evaluate( frames, { "myVariable" : 10 } )
+		self.assertEqual( [ r[1] for r in result ], [ e[1] for e in expected ] )
+		self.assertEqual( monitor.plugStatistics( script["static2"]["sum"] ).hashCount, 1 )
+
+		# Edits to the static branch are accounted for.
+
+		script["static1"]["op2"].setValue( 1 )
+		result, monitor = evaluate( frames )
+		self.assertEqual( [ r[1] for r in result ], [ e[1] + 1 for e in expected ] )
+		self.assertEqual( monitor.plugStatistics( script["static2"]["sum"] ).hashCount, 1 )
+
+	def testFrameInvariantHashCacheWithWholeContextAccess( self ) :
+
+		Gaffer.ValuePlug.setFrameInvariantHashCacheEnabled( True )
+
+		script = Gaffer.ScriptNode()
+		script["node"] = GafferTest.AddNode()
+		script["expression"] = Gaffer.Expression()
+		# Accessing all variables must be considered to access the frame too.
+		script["expression"].setExpression( 'parent["node"]["op1"] = len( context.keys() )' )
+
+		monitor = Gaffer.PerformanceMonitor()
+		with monitor :
+			for frame in range( 1, 5 ) :
+				context = Gaffer.Context( script.context() )
+				context.setFrame( frame )
+				with context :
+					script["node"]["sum"].hash()
+
+		self.assertEqual( monitor.plugStatistics( script["node"]["sum"] ).hashCount, 4 )
+
 	def setUp( self ) :
 
 		GafferTest.TestCase.setUp( self )
 
 		self.__originalCacheMemoryLimit = Gaffer.ValuePlug.getCacheMemoryLimit()
+		self.__originalPersistentCacheDirectory = Gaffer.ValuePlug.getPersistentCacheDirectory()
+		self.__originalFrameInvariantHashCacheEnabled = Gaffer.ValuePlug.getFrameInvariantHashCacheEnabled()
 
 	def tearDown( self ) :
 
 		GafferTest.TestCase.tearDown( self )
 
 		Gaffer.ValuePlug.setCacheMemoryLimit( self.__originalCacheMemoryLimit )
+		Gaffer.ValuePlug.setPersistentCacheDirectory( self.__originalPersistentCacheDirectory )
+		Gaffer.ValuePlug.setFrameInvariantHashCacheEnabled( self.__originalFrameInvariantHashCacheEnabled )
 
 if __name__ == "__main__":
 	unittest.main()
@@ -160,6 +160,9 @@ from .HiddenFilePathFilterTest import HiddenFilePathFilterTest
 from .ContextVariableTweaksTest import ContextVariableTweaksTest
 from .OptionalValuePlugTest import OptionalValuePlugTest
 from .ThreadMonitorTest import ThreadMonitorTest
+from .TraceMonitorTest import TraceMonitorTest
+from .SamplingMonitorTest import SamplingMonitorTest
+from .MemoryPressureGovernorTest import MemoryPressureGovernorTest
 from .CollectTest import CollectTest
 from .ProcessTest import ProcessTest
 from .PatternMatchTest import PatternMatchTest
@@ -379,3 +379,10 @@ def __pythonCompleter( node ) :
 
 ExpressionWidget.registerHighlighter( "python", lambda node : GafferUI.CodeWidget.PythonHighlighter() )
 ExpressionWidget.registerCommentPrefix( "python", "#" )
+
+# Native Language Support
+##########################################################################
+
+# The native language is a subset of Python, so can share its highlighting.
+ExpressionWidget.registerHighlighter( "native", lambda node : GafferUI.CodeWidget.PythonHighlighter() )
+ExpressionWidget.registerCommentPrefix( "native", "#" )
@@ -74,6 +74,30 @@ class NodeEditorTest( GafferUITest.TestCase ) :
 				ne.setNodeSet( b )
 				ne.nodeUI()
 
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testSpreadsheetPerformance( self ) :
+
+		s = Gaffer.ScriptNode()
+		s["spreadsheet"] = Gaffer.Spreadsheet()
+		for i in range( 0, 20 ) :
+			s["spreadsheet"]["rows"].addColumn( Gaffer.IntPlug( "column{}".format( i ) ) )
+		s["spreadsheet"]["rows"].addRows( 50 )
+
+		s["smallNode"] = Gaffer.Node()
+
+		a = Gaffer.StandardSet( [ s["smallNode"] ] )
+		b = Gaffer.StandardSet( [ s["spreadsheet"] ] )
+
+		sw = GafferUI.ScriptWindow.acquire( s )
+		ne = GafferUI.NodeEditor.acquire( s["smallNode"] )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			for i in range( 2 ) :
+				ne.setNodeSet( b )
+				ne.nodeUI()
+				ne.setNodeSet( a )
+				ne.nodeUI()
+
 	def testAcquireReusesEditors( self ) :
 
 		self.maxDiff = None
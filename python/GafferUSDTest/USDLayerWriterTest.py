@@ -53,7 +53,7 @@ import GafferSceneTest
 
 class USDLayerWriterTest( GafferSceneTest.SceneTestCase ) :
 
-	def __writeLayerAndComposition( self, base, layer, frames = None ) :
+	def __writeLayerAndComposition( self, base, layer, frames = None, concurrentFrames = 1 ) :
 
 		baseWriter = GafferScene.SceneWriter()
 		baseWriter["in"].setInput( base )
@@ -64,6 +64,7 @@ class USDLayerWriterTest( GafferSceneTest.SceneTestCase ) :
 		layerWriter["base"].setInput( base )
 		layerWriter["layer"].setInput( layer )
 		layerWriter["fileName"].setValue( self.temporaryDirectory() / "layer.usda" )
+		layerWriter["dispatcher"]["concurrentFrames"].setValue( concurrentFrames )
 		if frames is None :
 			layerWriter["task"].execute()
 		else :
@@ -399,6 +400,27 @@ class USDLayerWriterTest( GafferSceneTest.SceneTestCase ) :
 				context.setFrame( frame )
 				self.assertEqual( reader["out"].transform( "/sphere" ), animatedSphere["out"].transform( "/sphere" ) )
 
+	def testConcurrentFrames( self ) :
+
+		sphere = GafferScene.Sphere()
+
+		frame = GafferTest.FrameNode()
+		animatedSphere = GafferScene.Sphere()
+		animatedSphere["transform"]["translate"]["x"].setInput( frame["output"] )
+
+		with Gaffer.Context() as context :
+			layerFileName, compositionFileName = self.__writeLayerAndComposition(
+				sphere["out"], animatedSphere["out"], frames = range( 0, 10 ), concurrentFrames = 4
+			)
+
+		reader = GafferScene.SceneReader()
+		reader["fileName"].setValue( compositionFileName )
+
+		with Gaffer.Context() as context :
+			for frame in range( 0, 10 ) :
+				context.setFrame( frame )
+				self.assertEqual( reader["out"].transform( "/sphere" ), animatedSphere["out"].transform( "/sphere" ) )
+
 	def testDispatch( self ) :
 
 		script = Gaffer.ScriptNode()
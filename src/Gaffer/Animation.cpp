@@ -1006,13 +1006,13 @@ void Animation::Tangent::setSlopeAndScale( double slope, double scale, const boo
 			[ this, key, slope, scale ] {
 				m_slope = slope;
 				m_scale = scale;
-				key->m_parent->propagateDirtiness( key->m_parent->outPlug() );
+				key->m_parent->curveChanged();
 			},
 			// Undo
 			[ this, key, previousSlope, previousScale ] {
 				m_slope = previousSlope;
 				m_scale = previousScale;
-				key->m_parent->propagateDirtiness( key->m_parent->outPlug() );
+				key->m_parent->curveChanged();
 			}
 		);
 	}
@@ -1154,12 +1154,12 @@ void Animation::Tangent::setScale( double scale, const bool force )
 			// Do
 			[ this, key, scale ] {
 				m_scale = scale;
-				key->m_parent->propagateDirtiness( key->m_parent->outPlug() );
+				key->m_parent->curveChanged();
 			},
 			// Undo
 			[ this, key, previousScale ] {
 				m_scale = previousScale;
-				key->m_parent->propagateDirtiness( key->m_parent->outPlug() );
+				key->m_parent->curveChanged();
 			}
 		);
 	}
@@ -1506,14 +1506,14 @@ void Animation::Key::setTieMode( const Animation::TieMode tieMode )
 				key->m_tieMode = tieMode;
 				key->m_tieScaleRatio = newTieScaleRatio;
 				key->m_parent->m_keyTieModeChangedSignal( key->m_parent, key.get() );
-				key->m_parent->propagateDirtiness( key->m_parent->outPlug() );
+				key->m_parent->curveChanged();
 			},
 			// Undo
 			[ key, previousTieMode, previousTieScaleRatio ] {
 				key->m_tieMode = previousTieMode;
 				key->m_tieScaleRatio = previousTieScaleRatio;
 				key->m_parent->m_keyTieModeChangedSignal( key->m_parent, key.get() );
-				key->m_parent->propagateDirtiness( key->m_parent->outPlug() );
+				key->m_parent->curveChanged();
 			}
 		);
 	}
@@ -1672,7 +1672,7 @@ Animation::KeyPtr Animation::Key::setTime( const float time )
 				}
 
 				curve->m_keyTimeChangedSignal( key->m_parent, key.get() );
-				curve->propagateDirtiness( curve->outPlug() );
+				curve->curveChanged();
 			},
 			// Undo
 			[ curve, time, previousTime, active, key, clashingKey, clashingInactiveKey ] {
@@ -1783,7 +1783,7 @@ Animation::KeyPtr Animation::Key::setTime( const float time )
 				}
 
 				curve->m_keyTimeChangedSignal( key->m_parent, key.get() );
-				curve->propagateDirtiness( curve->outPlug() );
+				curve->curveChanged();
 			}
 		);
 
@@ -1825,7 +1825,7 @@ void Animation::Key::setValue( const float value )
 				if( Key* const kn = key->nextKey() ){ kn->m_tangentIn.update(); }
 				if( Key* const kp = key->prevKey() ){ kp->m_tangentOut.update(); }
 				key->m_parent->m_keyValueChangedSignal( key->m_parent, key.get() );
-				key->m_parent->propagateDirtiness( key->m_parent->outPlug() );
+				key->m_parent->curveChanged();
 			},
 			// Undo
 			[ key, previousValue ] {
@@ -1835,7 +1835,7 @@ void Animation::Key::setValue( const float value )
 				if( Key* const kn = key->nextKey() ){ kn->m_tangentIn.update(); }
 				if( Key* const kp = key->prevKey() ){ kp->m_tangentOut.update(); }
 				key->m_parent->m_keyValueChangedSignal( key->m_parent, key.get() );
-				key->m_parent->propagateDirtiness( key->m_parent->outPlug() );
+				key->m_parent->curveChanged();
 			}
 		);
 	}
@@ -1871,13 +1871,13 @@ void Animation::Key::setInterpolation( const Animation::Interpolation interpolat
 			[ key, interpolator ] {
 				key->m_interpolator = interpolator;
 				key->m_parent->m_keyInterpolationChangedSignal( key->m_parent, key.get() );
-				key->m_parent->propagateDirtiness( key->m_parent->outPlug() );
+				key->m_parent->curveChanged();
 			},
 			// Undo
 			[ key, previousInterpolator ] {
 				key->m_interpolator = previousInterpolator;
 				key->m_parent->m_keyInterpolationChangedSignal( key->m_parent, key.get() );
-				key->m_parent->propagateDirtiness( key->m_parent->outPlug() );
+				key->m_parent->curveChanged();
 			}
 		);
 	}
@@ -2132,7 +2132,7 @@ Animation::KeyPtr Animation::CurvePlug::addKey( const Animation::KeyPtr &key, co
 			}
 
 			m_keyAddedSignal( this, key.get() );
-			propagateDirtiness( outPlug() );
+			curveChanged();
 		},
 		// Undo
 		[ this, key, clashingKey, time ] {
@@ -2189,7 +2189,7 @@ Animation::KeyPtr Animation::CurvePlug::addKey( const Animation::KeyPtr &key, co
 			}
 
 			m_keyRemovedSignal( this, key.get() );
-			propagateDirtiness( outPlug() );
+			curveChanged();
 		}
 	);
 
@@ -2504,7 +2504,7 @@ void Animation::CurvePlug::removeKey( const Animation::KeyPtr &key )
 			}
 
 			m_keyRemovedSignal( this, key.get() );
-			propagateDirtiness( outPlug() );
+			curveChanged();
 		},
 		// Undo
 		[ this, key, clashingKey, active, time ] {
@@ -2567,7 +2567,7 @@ void Animation::CurvePlug::removeKey( const Animation::KeyPtr &key )
 			}
 
 			m_keyAddedSignal( this, key.get() );
-			propagateDirtiness( outPlug() );
+			curveChanged();
 		}
 	);
 
@@ -2733,13 +2733,13 @@ void Animation::CurvePlug::setExtrapolation( const Animation::Direction directio
 		[ this, extrapolator, direction ] {
 			this->*m_extrapolators[ static_cast< int >( direction ) ] = extrapolator;
 			this->m_extrapolationChangedSignal( this, direction );
-			this->propagateDirtiness( this->outPlug() );
+			this->curveChanged();
 		},
 		// Undo
 		[ this, previousExtrapolator, direction ] {
 			this->*m_extrapolators[ static_cast< int >( direction ) ] = previousExtrapolator;
 			this->m_extrapolationChangedSignal( this, direction );
-			this->propagateDirtiness( this->outPlug() );
+			this->curveChanged();
 		}
 	);
 }
@@ -2749,6 +2749,57 @@ float Animation::CurvePlug::evaluate( const float time ) const
 	return evaluateInternal( time, /* extrapolate = */ true );
 }
 
+void Animation::CurvePlug::evaluate( boost::span<const float> times, boost::span<float> values ) const
+{
+	if( times.size() != values.size() )
+	{
+		throw IECore::Exception( "Number of values does not match number of times" );
+	}
+
+	// NOTE : no keys return 0
+
+	if( m_keys.empty() )
+	{
+		std::fill( values.begin(), values.end(), 0.f );
+		return;
+	}
+
+	// NOTE : rather than search for the keys bracketing each time independently, walk from
+	//        the keys found for the previous time. When the times are sorted this visits each
+	//        key at most once. When they are not, we fall back to a search for large jumps.
+
+	Keys::const_iterator hiIt = m_keys.begin();
+	for( size_t i = 0, e = times.size(); i < e; ++i )
+	{
+		const float time = times[i];
+
+		int steps = 0;
+		while( true )
+		{
+			if( hiIt != m_keys.end() && hiIt->m_time < time )
+			{
+				++hiIt;
+			}
+			else if( hiIt != m_keys.begin() && std::prev( hiIt )->m_time >= time )
+			{
+				--hiIt;
+			}
+			else
+			{
+				break;
+			}
+
+			if( ++steps == 8 )
+			{
+				hiIt = m_keys.lower_bound( time );
+				break;
+			}
+		}
+
+		values[i] = evaluateInternal( time, hiIt, /* extrapolate = */ true );
+	}
+}
+
 double Animation::CurvePlug::evaluateInternal( const double time, const bool extrapolate ) const
 {
 	// NOTE : no keys return 0
@@ -2758,10 +2809,16 @@ double Animation::CurvePlug::evaluateInternal( const double time, const bool ext
 		return 0.f;
 	}
 
+	return evaluateInternal( time, m_keys.lower_bound( time ), extrapolate );
+}
+
+double Animation::CurvePlug::evaluateInternal( const double time, const Keys::const_iterator hiIt, const bool extrapolate ) const
+{
+	assert( !m_keys.empty() );
+
 	// NOTE : each key determines value at a specific time therefore only
 	//        interpolate for times which are between the keys.
 
-	Keys::const_iterator hiIt = m_keys.lower_bound( time );
 	if( hiIt == m_keys.end() )
 	{
 		return ( extrapolate )
@@ -2795,6 +2852,30 @@ double Animation::CurvePlug::evaluateInternal( const double time, const bool ext
 	return lo.m_interpolator->evaluate( lo, hi, nt, dt );
 }
 
+Animation::CurvePlug::ConstBakedPtr Animation::CurvePlug::baked( const float startTime, const float endTime, const size_t numSamples ) const
+{
+	std::lock_guard<std::mutex> lock( m_bakedMutex );
+	if(
+		!m_baked ||
+		m_baked->m_startTime != startTime ||
+		m_baked->m_endTime != endTime ||
+		m_baked->m_samples.size() != numSamples
+	)
+	{
+		m_baked = new Baked( this, startTime, endTime, numSamples );
+	}
+	return m_baked;
+}
+
+void Animation::CurvePlug::curveChanged()
+{
+	{
+		std::lock_guard<std::mutex> lock( m_bakedMutex );
+		m_baked = nullptr;
+	}
+	propagateDirtiness( outPlug() );
+}
+
 FloatPlug *Animation::CurvePlug::outPlug()
 {
 	return getChild<FloatPlug>( 0 );
@@ -2805,6 +2886,86 @@ const FloatPlug *Animation::CurvePlug::outPlug() const
 	return getChild<FloatPlug>( 0 );
 }
 
+//////////////////////////////////////////////////////////////////////////
+// CurvePlug::Baked implementation
+//////////////////////////////////////////////////////////////////////////
+
+Animation::CurvePlug::Baked::Baked( const CurvePlug *curve, const float startTime, const float endTime, const size_t numSamples )
+: m_startTime( startTime )
+, m_endTime( endTime )
+, m_samplesPerUnit( 0.0 )
+{
+	if( numSamples < 2 )
+	{
+		throw IECore::Exception( "Baked curve must have at least 2 samples" );
+	}
+
+	if( !( endTime > startTime ) )
+	{
+		throw IECore::Exception( "Baked curve end time must be greater than start time" );
+	}
+
+	m_samplesPerUnit = static_cast< double >( numSamples - 1 ) / ( static_cast< double >( endTime ) - startTime );
+
+	std::vector<float> times( numSamples );
+	for( size_t i = 0; i < numSamples; ++i )
+	{
+		times[i] = static_cast< float >( startTime + static_cast< double >( i ) / m_samplesPerUnit );
+	}
+	times.back() = endTime;
+
+	m_samples.resize( numSamples );
+	curve->evaluate( times, m_samples );
+}
+
+float Animation::CurvePlug::Baked::startTime() const
+{
+	return m_startTime;
+}
+
+float Animation::CurvePlug::Baked::endTime() const
+{
+	return m_endTime;
+}
+
+const std::vector<float> &Animation::CurvePlug::Baked::samples() const
+{
+	return m_samples;
+}
+
+float Animation::CurvePlug::Baked::evaluate( const float time ) const
+{
+	const double position = ( static_cast< double >( time ) - m_startTime ) * m_samplesPerUnit;
+	// NOTE : negated comparison so that NaN is clamped too.
+	if( !( position > 0.0 ) )
+	{
+		return m_samples.front();
+	}
+
+	const size_t last = m_samples.size() - 1;
+	if( position >= static_cast< double >( last ) )
+	{
+		return m_samples.back();
+	}
+
+	const size_t i = static_cast< size_t >( position );
+	const double t = position - static_cast< double >( i );
+	return static_cast< float >( ( 1.0 - t ) * m_samples[i] + t * m_samples[i+1] );
+}
+
+void Animation::CurvePlug::Baked::evaluate( boost::span<const float> times, boost::span<float> values ) const
+{
+	if( times.size() != values.size() )
+	{
+		throw IECore::Exception( "Number of values does not match number of times" );
+	}
+
+	for( size_t i = 0, e = times.size(); i < e; ++i )
+	{
+		values[i] = evaluate( times[i] );
+	}
+}
+
 //////////////////////////////////////////////////////////////////////////
 // Animation implementation
 //////////////////////////////////////////////////////////////////////////
@@ -46,8 +46,6 @@
 #include "boost/multi_index/hashed_index.hpp"
 #include "boost/multi_index_container.hpp"
 
-#include "tbb/task_arena.h"
-
 #include "fmt/format.h"
 
 #include <thread>
@@ -162,7 +160,7 @@ struct BackgroundTask::TaskData : public boost::noncopyable
 	std::thread::id threadId; // Thread that is executing `function`, if any
 };
 
-BackgroundTask::BackgroundTask( const Plug *subject, const Function &function )
+BackgroundTask::BackgroundTask( const Plug *subject, const Function &function, ParallelAlgo::Priority priority )
 	:	m_function( function ), m_taskData( std::make_shared<TaskData>( &m_function ) )
 {
 	const ScriptNode *s = scriptNode( subject );
@@ -173,8 +171,9 @@ BackgroundTask::BackgroundTask( const Plug *subject, const Function &function )
 
 	activeTasks().insert( ActiveTask{ this, s } );
 
-	// Enqueue task into current arena.
-	tbb::task_arena( tbb::task_arena::attach() ).enqueue(
+	// Enqueue task into the arena for its priority class.
+	ParallelAlgo::enqueue(
+		priority,
 		[taskData = m_taskData] {
 
 			// Early out if we were cancelled before the task
@@ -37,6 +37,8 @@
 
 #include "Gaffer/Context.h"
 
+#include "Gaffer/ValuePlug.h"
+
 #include "IECore/SimpleTypedData.h"
 #include "IECore/VectorTypedData.h"
 #include "IECore/PathMatcherData.h"
@@ -258,6 +260,9 @@ Context::Context( const Context &other, CopyMode mode )
 	}
 	else
 	{
+		// Our hash is already correct, so we don't want `internalSetWithOwner()`
+		// to update it as we insert the variables.
+		m_hashValid = false;
 		// We need ownership of the stored values so that we remain valid even
 		// if the source context is destroyed.
 		m_allocMap.reserve( other.m_map.size() + 1 );
@@ -281,6 +286,7 @@ Context::Context( const Context &other, CopyMode mode )
 				internalSetWithOwner( i.first, v, std::move( owner ) );
 			}
 		}
+		m_hashValid = other.m_hashValid;
 	}
 }
 
@@ -335,8 +341,8 @@ void Context::remove( const IECore::InternedString &name )
 	Map::iterator it = m_map.find( name );
 	if( it != m_map.end() )
 	{
+		updateHash( it->second.hash(), MurmurHash() );
 		m_map.erase( it );
-		m_hashValid = false;
 		if( m_changedSignal )
 		{
 			(*m_changedSignal)( this, name );
@@ -355,8 +361,8 @@ void Context::removeMatching( const StringAlgo::MatchPattern &pattern )
 	{
 		if( StringAlgo::matchMultiple( it->first, pattern ) )
 		{
+			updateHash( it->second.hash(), MurmurHash() );
 			it = m_map.erase( it );
-			m_hashValid = false;
 			if( m_changedSignal )
 			{
 				(*m_changedSignal)( this, it->first );
@@ -371,6 +377,11 @@ void Context::removeMatching( const StringAlgo::MatchPattern &pattern )
 
 void Context::names( std::vector<IECore::InternedString> &names ) const
 {
+	if( g_accessTracking.load( std::memory_order_relaxed ) )
+	{
+		variableAccessed( nullptr );
+	}
+
 	for( Map::const_iterator it = m_map.begin(), eIt = m_map.end(); it != eIt; it++ )
 	{
 		names.push_back( it->first );
@@ -423,6 +434,15 @@ Context::ChangedSignal &Context::changedSignal()
 }
 
 IECore::MurmurHash Context::hash() const
+{
+	if( g_accessTracking.load( std::memory_order_relaxed ) )
+	{
+		variableAccessed( nullptr );
+	}
+	return hashInternal();
+}
+
+IECore::MurmurHash Context::hashInternal() const
 {
 	if( m_hashValid )
 	{
@@ -443,7 +463,21 @@ IECore::MurmurHash Context::hash() const
 
 bool Context::operator == ( const Context &other ) const
 {
-	return this == &other || m_map == other.m_map;
+	if( g_accessTracking.load( std::memory_order_relaxed ) )
+	{
+		variableAccessed( nullptr );
+	}
+	if( this == &other )
+	{
+		return true;
+	}
+	if( m_hashValid && other.m_hashValid && m_hash != other.m_hash )
+	{
+		// Equal contexts always have equal hashes, so we can
+		// reject without comparing the variables.
+		return false;
+	}
+	return m_map == other.m_map;
 }
 
 bool Context::operator != ( const Context &other ) const
@@ -477,20 +511,69 @@ Context::Scope::~Scope()
 {
 }
 
+namespace
+{
+
+// Contexts available for reuse by EditableScopes on this thread. Because
+// scopes are strictly nested, this never needs to hold more than the
+// maximum nesting depth, and is usually very small.
+thread_local std::vector<ContextPtr> g_recycledContexts;
+const size_t g_maxRecycledContexts = 16;
+
+} // namespace
+
+Context::Ptr Context::nonOwningCopy( const Context &other )
+{
+	if( g_recycledContexts.empty() )
+	{
+		return new Context( other, CopyMode::NonOwning );
+	}
+
+	Ptr result = std::move( g_recycledContexts.back() );
+	g_recycledContexts.pop_back();
+
+	// Assignment reuses the storage already allocated by the map.
+	result->m_map = other.m_map;
+	result->m_hash = other.m_hash;
+	result->m_hashValid = other.m_hashValid;
+	result->m_canceller = other.m_canceller;
+	return result;
+}
+
+void Context::recycleNonOwningCopy( Ptr &&context )
+{
+	if(
+		context->refCount() != 1 || context->m_changedSignal ||
+		g_recycledContexts.size() >= g_maxRecycledContexts
+	)
+	{
+		// Either someone else is still referencing the context,
+		// or we don't want to keep it. Let it be destroyed in
+		// the usual way.
+		context = nullptr;
+		return;
+	}
+
+	// Release any data allocated by `EditableScope::setAllocated()`.
+	context->m_allocMap.clear();
+	g_recycledContexts.push_back( std::move( context ) );
+}
+
 Context::EditableScope::EditableScope( const Context *context )
-	:	m_context( new Context( *context, CopyMode::NonOwning ) )
+	:	m_context( nonOwningCopy( *context ) )
 {
 	m_threadState->m_context = m_context.get();
 }
 
 Context::EditableScope::EditableScope( const ThreadState &threadState )
-	:	ThreadState::Scope( threadState ), m_context( new Context( *threadState.m_context, CopyMode::NonOwning ) )
+	:	ThreadState::Scope( threadState ), m_context( nonOwningCopy( *threadState.m_context ) )
 {
 	m_threadState->m_context = m_context.get();
 }
 
 Context::EditableScope::~EditableScope()
 {
+	recycleNonOwningCopy( std::move( m_context ) );
 }
 
 void Context::EditableScope::setCanceller( const IECore::Canceller *canceller )
@@ -534,6 +617,13 @@ const Context *Context::current()
 	return ThreadState::current().m_context;
 }
 
+std::atomic_bool Context::g_accessTracking( false );
+
+void Context::variableAccessed( const IECore::InternedString *name )
+{
+	ValuePlug::contextVariableAccessed( name );
+}
+
 //////////////////////////////////////////////////////////////////////////
 // SubstitutionProvider implementation
 //////////////////////////////////////////////////////////////////////////
@@ -40,6 +40,7 @@
 #include "Gaffer/Action.h"
 #include "Gaffer/Context.h"
 #include "Gaffer/NumericPlug.h"
+#include "Gaffer/Private/NativeExpressionEngine.h"
 #include "Gaffer/ScriptNode.h"
 #include "Gaffer/StringPlug.h"
 
@@ -51,10 +52,40 @@
 
 #include "fmt/format.h"
 
+#include <cstring>
+
 using namespace boost::placeholders;
 using namespace IECore;
 using namespace Gaffer;
 
+//////////////////////////////////////////////////////////////////////////
+// Internal utilities
+//////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+bool translationEnabled()
+{
+	static const bool g_enabled = []() {
+		const char *e = getenv( "GAFFER_PYTHONEXPRESSION_TRANSLATION" );
+		return !e || strcmp( e, "0" );
+	}();
+	return g_enabled;
+}
+
+template<typename T>
+bool sameElements( std::vector<T> a, std::vector<T> b )
+{
+	std::sort( a.begin(), a.end() );
+	a.erase( std::unique( a.begin(), a.end() ), a.end() );
+	std::sort( b.begin(), b.end() );
+	b.erase( std::unique( b.begin(), b.end() ), b.end() );
+	return a == b;
+}
+
+} // namespace
+
 //////////////////////////////////////////////////////////////////////////
 // Expression implementation
 //////////////////////////////////////////////////////////////////////////
@@ -168,6 +199,7 @@ void Expression::setExpression( const std::string &expression, const std::string
 	);
 
 	m_engine = engine;
+	m_nativeEngine = translate( this, expression, language, inPlugs, outPlugs, contextNames );
 	m_contextNames = contextNames;
 	updatePlugs( inPlugs, outPlugs );
 	enginePlug()->setValue( language );
@@ -334,6 +366,8 @@ Gaffer::ValuePlug::CachePolicy Expression::computeCachePolicy( const Gaffer::Val
 	{
 		if( m_engine )
 		{
+			// Even when the expression has been translated for `m_nativeEngine`,
+			// `compute()` may fall back to `m_engine`, so we must use its policy.
 			return m_engine->executeCachePolicy();
 		}
 	}
@@ -347,10 +381,19 @@ void Expression::compute( ValuePlug *output, const Context *context ) const
 	{
 		if( m_engine )
 		{
-			std::vector<const ValuePlug *> inputs;
-			for( ValuePlug::Iterator it( inPlug() ); !it.done(); ++it )
+			const std::vector<const ValuePlug *> inputs = executeInputs();
+			if( m_nativeEngine )
 			{
-				inputs.push_back( it->get() );
+				try
+				{
+					static_cast<ObjectVectorPlug *>( output )->setValue( m_nativeEngine->execute( context, inputs ) );
+					return;
+				}
+				catch( const Private::NativeExpressionEngine::UnsupportedOperation & )
+				{
+					// Fall through to let Python deal with it, including
+					// reporting any errors.
+				}
 			}
 			static_cast<ObjectVectorPlug *>( output )->setValue( m_engine->execute( context, inputs ) );
 		}
@@ -388,6 +431,21 @@ void Expression::compute( ValuePlug *output, const Context *context ) const
 
 		if( index < values->members().size() )
 		{
+			if( m_nativeEngine )
+			{
+				try
+				{
+					m_nativeEngine->apply( output, outPlugChild, values->members()[index].get() );
+					return;
+				}
+				catch( const Private::NativeExpressionEngine::UnsupportedOperation & )
+				{
+					// The value may have come from either engine, and the
+					// Python engine may convert it differently. Re-execute
+					// with Python so that it applies a value of its own.
+					values = m_engine->execute( context, executeInputs() );
+				}
+			}
 			m_engine->apply( output, outPlugChild, values->members()[index].get() );
 		}
 		else
@@ -529,6 +587,7 @@ void Expression::plugSet( const Plug *plug )
 	expression = transcribe( expression, /* toInternalForm = */ false );
 	std::vector<ValuePlug *> inPlugs, outPlugs;
 	m_engine->parse( this, expression, inPlugs, outPlugs, m_contextNames );
+	m_nativeEngine = translate( this, expression, engineType, inPlugs, outPlugs, m_contextNames );
 
 	// Alas, it's not quite that simple. Nodes might have been renamed
 	// during deserialisation (to avoid name clashes between duplicates).
@@ -542,6 +601,55 @@ void Expression::plugSet( const Plug *plug )
 
 }
 
+Expression::EnginePtr Expression::translate(
+	Expression *node, const std::string &expression, const std::string &language,
+	const std::vector<ValuePlug *> &inPlugs, const std::vector<ValuePlug *> &outPlugs,
+	const std::vector<IECore::InternedString> &contextNames
+)
+{
+	if( language != "python" || !translationEnabled() )
+	{
+		return nullptr;
+	}
+
+	EnginePtr engine = new Private::NativeExpressionEngine;
+	std::vector<ValuePlug *> nativeInPlugs, nativeOutPlugs;
+	std::vector<IECore::InternedString> nativeContextNames;
+	try
+	{
+		engine->parse( node, expression, nativeInPlugs, nativeOutPlugs, nativeContextNames );
+	}
+	catch( const std::exception & )
+	{
+		// Uses Python features we don't support.
+		return nullptr;
+	}
+
+	// The plugs must match exactly, since they are used to index the
+	// inputs to `execute()` and the results it returns. The context
+	// variables are used only for hashing, so they just need to be the
+	// same set.
+	if(
+		nativeInPlugs != inPlugs || nativeOutPlugs != outPlugs ||
+		!sameElements( nativeContextNames, contextNames )
+	)
+	{
+		return nullptr;
+	}
+
+	return engine;
+}
+
+std::vector<const ValuePlug *> Expression::executeInputs() const
+{
+	std::vector<const ValuePlug *> inputs;
+	for( ValuePlug::Iterator it( inPlug() ); !it.done(); ++it )
+	{
+		inputs.push_back( it->get() );
+	}
+	return inputs;
+}
+
 //////////////////////////////////////////////////////////////////////////
 // Expression::Engine implementation
 //////////////////////////////////////////////////////////////////////////
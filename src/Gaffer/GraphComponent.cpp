@@ -106,6 +106,31 @@ void validateName( const InternedString &name )
 
 } // namespace
 
+//////////////////////////////////////////////////////////////////////////
+// GraphComponent::ChildIndex
+//
+// Lookups via a linear search of `m_children` are cheap for the small
+// numbers of children typical of most GraphComponents, but become
+// quadratic for things like large Boxes and Spreadsheets. So above a
+// threshold we maintain an index from name to child. This is only
+// modified at the same time as `m_children` itself, so has the same
+// thread-safety guarantees.
+//////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+const size_t g_childIndexThreshold = 64;
+
+} // namespace
+
+struct GraphComponent::ChildIndex : boost::noncopyable
+{
+
+	std::unordered_map<InternedString, GraphComponent *> children;
+
+};
+
 //////////////////////////////////////////////////////////////////////////
 // GraphComponent::Signals
 //
@@ -165,6 +190,7 @@ GraphComponent::~GraphComponent()
 		MemberSignals::emitLazily( (*it)->m_signals.get(), &MemberSignals::parentChangedSignal, (*it).get(), nullptr );
 	}
 	m_children.clear();
+	m_childIndex.reset();
 }
 
 const IECore::InternedString &GraphComponent::setName( const IECore::InternedString &name )
@@ -177,12 +203,20 @@ const IECore::InternedString &GraphComponent::setName( const IECore::InternedStr
 	if( m_parent )
 	{
 		bool uniqueAlready = true;
-		for( ChildContainer::const_iterator it=m_parent->m_children.begin(), eIt=m_parent->m_children.end(); it != eIt; it++ )
+		if( m_parent->m_childIndex )
 		{
-			if( *it != this && (*it)->m_name == newName )
+			const GraphComponent *sibling = m_parent->getChildInternal( newName );
+			uniqueAlready = !sibling || sibling == this;
+		}
+		else
+		{
+			for( ChildContainer::const_iterator it=m_parent->m_children.begin(), eIt=m_parent->m_children.end(); it != eIt; it++ )
 			{
-				uniqueAlready = false;
-				break;
+				if( *it != this && (*it)->m_name == newName )
+				{
+					uniqueAlready = false;
+					break;
+				}
 			}
 		}
 
@@ -237,6 +271,18 @@ void GraphComponent::setNameInternal( const IECore::InternedString &name )
 	DirtyPropagationScope dirtyPropagationScope;
 	const InternedString oldName = m_name;
 	m_name = name;
+	if( m_parent && m_parent->m_childIndex )
+	{
+		auto &siblings = m_parent->m_childIndex->children;
+		auto it = siblings.find( oldName );
+		// When we're being added to a parent, our old name may
+		// belong to the sibling that made us rename ourselves.
+		if( it != siblings.end() && it->second == this )
+		{
+			siblings.erase( it );
+		}
+		siblings[m_name] = this;
+	}
 	nameChanged( oldName );
 	MemberSignals::emitLazily( m_signals.get(), &MemberSignals::nameChangedSignal, this, oldName );
 }
@@ -396,6 +442,19 @@ void GraphComponent::addChildInternal( GraphComponentPtr child, size_t index )
 	m_children.insert( m_children.begin() + min( index, m_children.size() ), child );
 	child->m_parent = this;
 	child->setName( child->m_name.value() ); // to force uniqueness
+	if( m_childIndex )
+	{
+		m_childIndex->children[child->m_name] = child.get();
+	}
+	else if( m_children.size() > g_childIndexThreshold )
+	{
+		m_childIndex = std::make_unique<ChildIndex>();
+		m_childIndex->children.reserve( m_children.size() );
+		for( const auto &c : m_children )
+		{
+			m_childIndex->children[c->m_name] = c.get();
+		}
+	}
 	MemberSignals::emitLazily( m_signals.get(), &MemberSignals::childAddedSignal, this, child.get() );
 	child->parentChanged( previousParent );
 	MemberSignals::emitLazily( child->m_signals.get(), &MemberSignals::parentChangedSignal, child.get(), previousParent );
@@ -449,6 +508,10 @@ void GraphComponent::removeChildInternal( GraphComponentPtr child, bool emitPare
 		throw Exception( fmt::format( "GraphComponent::removeChildInternal : \"{}\" is not a child of \"{}\".", child->fullName(), fullName() ) );
 	}
 	m_children.erase( it );
+	if( m_childIndex )
+	{
+		m_childIndex->children.erase( child->m_name );
+	}
 	child->m_parent = nullptr;
 	MemberSignals::emitLazily( m_signals.get(), &MemberSignals::childRemovedSignal, this, child.get() );
 	if( emitParentChanged )
@@ -458,6 +521,24 @@ void GraphComponent::removeChildInternal( GraphComponentPtr child, bool emitPare
 	}
 }
 
+const GraphComponent *GraphComponent::getChildInternal( const IECore::InternedString &name ) const
+{
+	if( m_childIndex )
+	{
+		auto it = m_childIndex->children.find( name );
+		return it != m_childIndex->children.end() ? it->second : nullptr;
+	}
+
+	for( const auto &child : m_children )
+	{
+		if( child->m_name == name )
+		{
+			return child.get();
+		}
+	}
+	return nullptr;
+}
+
 size_t GraphComponent::index() const
 {
 	assert( m_parent );
@@ -516,7 +597,8 @@ void GraphComponent::reorderChildren( const ChildContainer &newOrder )
 	/// This could be compressed with a form of run-length encoding to limit
 	/// the amount of data we store in the undo queue.
 
-	// Add an action to do the work.
+	// Add an action to do the work. Note that `m_childIndex` maps from
+	// name to child, so is unaffected by reordering.
 
 	Action::enact(
 		this,
@@ -40,6 +40,66 @@
 #include "Gaffer/MetadataAlgo.h"
 
 #include "boost/bind/bind.hpp"
+#include "boost/noncopyable.hpp"
+
+#include <algorithm>
+
+//////////////////////////////////////////////////////////////////////////
+// Internal utilities
+//////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+// Each iteration of a loop is evaluated by pulling on the previous one, so
+// naive evaluation of iteration N recurses N iterations deep, risking stack
+// exhaustion for loops with many iterations. We bound the recursion by first
+// evaluating every `g_iterationStride`th iteration in ascending order, so that
+// each evaluation finds its predecessor already in the cache and recurses at
+// most `g_iterationStride` iterations.
+const int g_iterationStride = 64;
+
+// The loops whose iterations are being evaluated by the current thread. While
+// a loop is in this list, nested evaluations of it are served by the iterations
+// already evaluated, so don't need to evaluate them again.
+thread_local std::vector<const Gaffer::Loop *> g_iteratingLoops;
+
+class IterationScope : boost::noncopyable
+{
+
+	public :
+
+		IterationScope( const Gaffer::Loop *loop )
+			:	m_outermost( std::find( g_iteratingLoops.begin(), g_iteratingLoops.end(), loop ) == g_iteratingLoops.end() )
+		{
+			if( m_outermost )
+			{
+				g_iteratingLoops.push_back( loop );
+			}
+		}
+
+		~IterationScope()
+		{
+			if( m_outermost )
+			{
+				g_iteratingLoops.pop_back();
+			}
+		}
+
+		// Returns true if previous iterations need to be evaluated
+		// before evaluating iteration `index`.
+		bool needsPreviousIterations( int index ) const
+		{
+			return m_outermost && index >= g_iterationStride;
+		}
+
+	private :
+
+		const bool m_outermost;
+
+};
+
+} // namespace
 
 namespace Gaffer
 {
@@ -217,9 +277,18 @@ void Loop::hash( const ValuePlug *output, const Context *context, IECore::Murmur
 	IECore::InternedString indexVariable;
 	if( const ValuePlug *plug = sourcePlug( output, context, index, indexVariable ) )
 	{
+		IterationScope iterationScope( this );
 		Context::EditableScope tmpContext( context );
 		if( index >= 0 )
 		{
+			if( iterationScope.needsPreviousIterations( index ) )
+			{
+				for( int i = g_iterationStride - 1; i < index; i += g_iterationStride )
+				{
+					tmpContext.set( indexVariable, &i );
+					plug->hash();
+				}
+			}
 			tmpContext.set( indexVariable, &index );
 		}
 		else
@@ -239,9 +308,21 @@ void Loop::compute( ValuePlug *output, const Context *context ) const
 	IECore::InternedString indexVariable;
 	if( const ValuePlug *plug = sourcePlug( output, context, index, indexVariable ) )
 	{
+		IterationScope iterationScope( this );
 		Context::EditableScope tmpContext( context );
 		if( index >= 0 )
 		{
+			if( iterationScope.needsPreviousIterations( index ) )
+			{
+				// We have no use for the values of the previous iterations
+				// other than to get them into the cache, so each is overwritten
+				// by the next, and finally by the value for `index`.
+				for( int i = g_iterationStride - 1; i < index; i += g_iterationStride )
+				{
+					tmpContext.set( indexVariable, &i );
+					output->setFrom( plug );
+				}
+			}
 			tmpContext.set( indexVariable, &index );
 		}
 		else
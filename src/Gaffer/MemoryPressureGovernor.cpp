@@ -0,0 +1,516 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2025, Cinesite VFX Ltd. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//      * Redistributions of source code must retain the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer.
+//
+//      * Redistributions in binary form must reproduce the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer in the documentation and/or other materials provided with
+//        the distribution.
+//
+//      * Neither the name of John Haddon nor the names of
+//        any other contributors to this software may be used to endorse or
+//        promote products derived from this software without specific prior
+//        written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//////////////////////////////////////////////////////////////////////////
+
+#include "Gaffer/MemoryPressureGovernor.h"
+
+#include "Gaffer/ValuePlug.h"
+
+#include "IECore/Exception.h"
+#include "IECore/MessageHandler.h"
+
+#include "fmt/format.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+
+using namespace std;
+using namespace IECore;
+using namespace Gaffer;
+
+//////////////////////////////////////////////////////////////////////////
+// Sources
+//////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+// Reads a single value from a cgroup interface file, returning false
+// if the file doesn't exist or contains "max", meaning unlimited.
+bool readCGroupValue( const std::filesystem::path &file, size_t &value )
+{
+	std::ifstream stream( file );
+	std::string text;
+	if( !( stream >> text ) || text == "max" )
+	{
+		return false;
+	}
+
+	char *end = nullptr;
+	const unsigned long long v = strtoull( text.c_str(), &end, 10 );
+	if( end == text.c_str() )
+	{
+		return false;
+	}
+
+	value = v;
+	return true;
+}
+
+class CGroupSource : public MemoryPressureGovernor::Source
+{
+
+	public :
+
+		CGroupSource( const std::filesystem::path &directory )
+			:	m_directory( directory )
+		{
+		}
+
+		bool read( MemoryPressureGovernor::Status &status ) const override
+		{
+			if( !readCGroupValue( m_directory / "memory.current", status.used ) )
+			{
+				return false;
+			}
+
+			// `memory.high` is the point at which the kernel starts
+			// throttling and reclaiming, so we prefer that to the
+			// point at which processes are killed.
+			return
+				readCGroupValue( m_directory / "memory.high", status.limit ) ||
+				readCGroupValue( m_directory / "memory.max", status.limit )
+			;
+		}
+
+		std::string description() const override
+		{
+			return fmt::format( "cgroup \"{}\"", m_directory.string() );
+		}
+
+	private :
+
+		const std::filesystem::path m_directory;
+
+};
+
+class MemInfoSource : public MemoryPressureGovernor::Source
+{
+
+	public :
+
+		MemInfoSource( const std::filesystem::path &file )
+			:	m_file( file )
+		{
+		}
+
+		bool read( MemoryPressureGovernor::Status &status ) const override
+		{
+			std::ifstream stream( m_file );
+			size_t total = 0;
+			size_t available = 0;
+			bool haveTotal = false;
+			bool haveAvailable = false;
+
+			std::string line;
+			while( std::getline( stream, line ) && !( haveTotal && haveAvailable ) )
+			{
+				std::istringstream lineStream( line );
+				std::string name;
+				size_t kiloBytes;
+				if( !( lineStream >> name >> kiloBytes ) )
+				{
+					continue;
+				}
+
+				if( name == "MemTotal:" )
+				{
+					total = kiloBytes * 1024;
+					haveTotal = true;
+				}
+				else if( name == "MemAvailable:" )
+				{
+					available = kiloBytes * 1024;
+					haveAvailable = true;
+				}
+			}
+
+			if( !haveTotal || !haveAvailable )
+			{
+				return false;
+			}
+
+			status.limit = total;
+			status.used = total - std::min( available, total );
+			return true;
+		}
+
+		std::string description() const override
+		{
+			return fmt::format( "\"{}\"", m_file.string() );
+		}
+
+	private :
+
+		const std::filesystem::path m_file;
+
+};
+
+} // namespace
+
+MemoryPressureGovernor::SourcePtr MemoryPressureGovernor::cgroupSource( const std::filesystem::path &directory )
+{
+	return new CGroupSource( directory );
+}
+
+MemoryPressureGovernor::SourcePtr MemoryPressureGovernor::memInfoSource( const std::filesystem::path &file )
+{
+	return new MemInfoSource( file );
+}
+
+MemoryPressureGovernor::SourcePtr MemoryPressureGovernor::defaultSource()
+{
+	SourcePtr cgroup = cgroupSource();
+	Status status;
+	if( cgroup->read( status ) )
+	{
+		return cgroup;
+	}
+	return memInfoSource();
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Cache registry
+//////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+struct Registry
+{
+
+	Registry()
+	{
+		caches.push_back( {
+			"ValuePlug:computeCache",
+			{ &ValuePlug::getCacheMemoryLimit, &ValuePlug::setCacheMemoryLimit, &ValuePlug::cacheMemoryUsage }
+		} );
+		caches.push_back( {
+			"ValuePlug:hashCache",
+			{ &ValuePlug::getHashCacheSizeLimit, &ValuePlug::setHashCacheSizeLimit, nullptr }
+		} );
+	}
+
+	std::mutex mutex;
+	std::vector<std::pair<std::string, MemoryPressureGovernor::Cache>> caches;
+
+};
+
+Registry &registry()
+{
+	static Registry g_registry;
+	return g_registry;
+}
+
+} // namespace
+
+void MemoryPressureGovernor::registerCache( const std::string &name, const Cache &cache )
+{
+	Registry &r = registry();
+	std::lock_guard<std::mutex> lock( r.mutex );
+	auto it = std::find_if( r.caches.begin(), r.caches.end(), [&name] ( const auto &c ) { return c.first == name; } );
+	if( it != r.caches.end() )
+	{
+		it->second = cache;
+	}
+	else
+	{
+		r.caches.push_back( { name, cache } );
+	}
+}
+
+std::vector<std::string> MemoryPressureGovernor::registeredCaches()
+{
+	Registry &r = registry();
+	std::lock_guard<std::mutex> lock( r.mutex );
+	std::vector<std::string> result;
+	for( const auto &c : r.caches )
+	{
+		result.push_back( c.first );
+	}
+	return result;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// MemoryPressureGovernor
+//////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+// Shrinking happens immediately, but growth is limited to this
+// much per update, so that we don't overshoot while other processes
+// are still ramping up.
+const float g_maxGrowth = 0.25f;
+// Changes smaller than this are ignored, to avoid churn
+// and excessive logging.
+const float g_minChange = 0.01f;
+
+std::string formatBytes( double bytes )
+{
+	return fmt::format( "{:.2f}GB", bytes / ( 1024.0 * 1024.0 * 1024.0 ) );
+}
+
+std::mutex g_instanceMutex;
+MemoryPressureGovernorPtr g_instance;
+
+} // namespace
+
+MemoryPressureGovernor::MemoryPressureGovernor( const SourcePtr &source, float targetUsage, float minimumScale, std::chrono::milliseconds interval )
+	:	m_source( source ), m_targetUsage( targetUsage ), m_minimumScale( std::clamp( minimumScale, 0.0f, 1.0f ) ), m_interval( interval ),
+		m_scale( 1.0f ), m_readFailed( false ), m_stop( false )
+{
+	if( !m_source )
+	{
+		throw IECore::Exception( "MemoryPressureGovernor : Source must not be null" );
+	}
+
+	if( m_interval.count() > 0 )
+	{
+		m_thread = std::thread(
+			[this] {
+				std::unique_lock<std::mutex> lock( m_stopMutex );
+				while( !m_stopCondition.wait_for( lock, m_interval, [this] { return m_stop; } ) )
+				{
+					update();
+				}
+			}
+		);
+	}
+}
+
+MemoryPressureGovernor::~MemoryPressureGovernor()
+{
+	stopUpdates();
+
+	std::lock_guard<std::mutex> lock( m_mutex );
+	applyScale( 1.0f );
+}
+
+void MemoryPressureGovernor::stopUpdates()
+{
+	if( !m_thread.joinable() )
+	{
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock( m_stopMutex );
+		m_stop = true;
+	}
+	m_stopCondition.notify_one();
+	m_thread.join();
+}
+
+const MemoryPressureGovernor::Source *MemoryPressureGovernor::source() const
+{
+	return m_source.get();
+}
+
+float MemoryPressureGovernor::targetUsage() const
+{
+	return m_targetUsage;
+}
+
+float MemoryPressureGovernor::minimumScale() const
+{
+	return m_minimumScale;
+}
+
+std::chrono::milliseconds MemoryPressureGovernor::interval() const
+{
+	return m_interval;
+}
+
+float MemoryPressureGovernor::update()
+{
+	std::lock_guard<std::mutex> lock( m_mutex );
+
+	Status status;
+	if( !m_source->read( status ) || !status.limit )
+	{
+		if( !m_readFailed )
+		{
+			IECore::msg( IECore::Msg::Warning, "MemoryPressureGovernor", fmt::format( "Unable to read memory usage from {}", m_source->description() ) );
+			m_readFailed = true;
+		}
+		return m_scale;
+	}
+	m_readFailed = false;
+
+	// Pick up newly registered caches, and account for any limits
+	// that have been edited since our last update.
+
+	{
+		Registry &r = registry();
+		std::lock_guard<std::mutex> registryLock( r.mutex );
+		for( const auto &[name, cache] : r.caches )
+		{
+			auto it = std::find_if( m_caches.begin(), m_caches.end(), [&name] ( const GovernedCache &c ) { return c.name == name; } );
+			if( it == m_caches.end() )
+			{
+				const size_t limit = cache.getLimit();
+				m_caches.push_back( { name, cache, limit, limit, limit } );
+			}
+		}
+	}
+
+	size_t configuredBytes = 0;
+	size_t cachedBytes = 0;
+	for( auto &c : m_caches )
+	{
+		const size_t limit = c.cache.getLimit();
+		if( limit != c.appliedLimit )
+		{
+			c.configuredLimit = c.requestedLimit = c.appliedLimit = limit;
+		}
+		if( c.cache.memoryUsage )
+		{
+			configuredBytes += c.configuredLimit;
+			cachedBytes += c.cache.memoryUsage();
+		}
+	}
+
+	// Choose a scale that would bring the total usage to the target,
+	// assuming that the caches fill to their limits. When no caches
+	// report their usage, we can only scale in proportion to the
+	// pressure.
+
+	const double target = m_targetUsage * (double)status.limit;
+	double desiredScale;
+	if( configuredBytes )
+	{
+		desiredScale = ( (double)cachedBytes + target - (double)status.used ) / (double)configuredBytes;
+	}
+	else
+	{
+		desiredScale = status.used ? m_scale * target / (double)status.used : 1.0;
+	}
+
+	float scale = std::clamp( (float)desiredScale, m_minimumScale, 1.0f );
+	if( scale > m_scale )
+	{
+		scale = std::min( scale, m_scale + g_maxGrowth );
+	}
+
+	if(
+		std::abs( scale - m_scale ) < g_minChange &&
+		scale != 1.0f && scale != m_minimumScale
+	)
+	{
+		scale = m_scale;
+	}
+
+	if( scale != m_scale )
+	{
+		IECore::msg(
+			IECore::Msg::Info, "MemoryPressureGovernor",
+			fmt::format(
+				"Memory usage is {} of {} ({}), with {} cached. {} cache limits to {:.0f}%",
+				formatBytes( status.used ), formatBytes( status.limit ), m_source->description(),
+				formatBytes( cachedBytes ), scale < m_scale ? "Reducing" : "Increasing", scale * 100.0f
+			)
+		);
+	}
+
+	applyScale( scale );
+	return m_scale;
+}
+
+float MemoryPressureGovernor::scale() const
+{
+	std::lock_guard<std::mutex> lock( m_mutex );
+	return m_scale;
+}
+
+void MemoryPressureGovernor::applyScale( float scale )
+{
+	m_scale = scale;
+	for( auto &c : m_caches )
+	{
+		const size_t currentLimit = c.cache.getLimit();
+		if( currentLimit != c.appliedLimit )
+		{
+			// Edited by someone else since we last applied a limit.
+			c.configuredLimit = c.requestedLimit = c.appliedLimit = currentLimit;
+		}
+
+		const size_t limit = scale == 1.0f ? c.configuredLimit : (size_t)std::llround( (double)c.configuredLimit * scale );
+		if( limit == c.requestedLimit )
+		{
+			continue;
+		}
+
+		IECore::msg(
+			IECore::Msg::Debug, "MemoryPressureGovernor",
+			fmt::format( "Setting limit for \"{}\" to {} (configured limit {})", c.name, limit, c.configuredLimit )
+		);
+
+		c.cache.setLimit( limit );
+		c.requestedLimit = limit;
+		c.appliedLimit = c.cache.getLimit();
+	}
+}
+
+void MemoryPressureGovernor::setInstance( const MemoryPressureGovernorPtr &governor )
+{
+	MemoryPressureGovernorPtr previous;
+	{
+		std::lock_guard<std::mutex> lock( g_instanceMutex );
+		static bool g_registeredExitHandler = false;
+		if( !g_registeredExitHandler )
+		{
+			// Stop the governor before static destruction
+			// begins, so that it can't adjust caches which
+			// have already been destroyed.
+			std::atexit( [] { setInstance( nullptr ); } );
+			g_registeredExitHandler = true;
+		}
+		previous = g_instance;
+		g_instance = governor;
+	}
+	// Destroy outside the lock, since destruction
+	// waits for the update thread.
+	previous.reset();
+}
+
+MemoryPressureGovernorPtr MemoryPressureGovernor::getInstance()
+{
+	std::lock_guard<std::mutex> lock( g_instanceMutex );
+	return g_instance;
+}
@@ -45,6 +45,7 @@
 #include "IECore/StringAlgo.h"
 
 #include "boost/bind/bind.hpp"
+#include "boost/functional/hash.hpp"
 #include "boost/multi_index/member.hpp"
 #include "boost/multi_index/ordered_index.hpp"
 #include "boost/multi_index/sequenced_index.hpp"
@@ -52,6 +53,7 @@
 
 #include "tbb/concurrent_hash_map.h"
 #include "tbb/recursive_mutex.h"
+#include "tbb/spin_rw_mutex.h"
 
 #include <unordered_map>
 
@@ -279,6 +281,208 @@ GraphComponentMetadataMap &graphComponentMetadataMap()
 	return *g_m;
 }
 
+// Compiled plug path lookups
+// ==========================
+//
+// Finding the value for a plug requires its path to be matched against the
+// patterns registered to every type of every ancestor, which is costly for
+// nodes with many plugs and many registrations. We accelerate this by compiling
+// the registrations for each type and key into a map of exact paths and a
+// list of wildcard patterns, and by memoising the function found for each
+// path. Both are discarded whenever a plug path registration is changed.
+
+using PlugPath = vector<InternedString>;
+
+struct PlugValueQuery
+{
+	IECore::TypeId typeId;
+	InternedString key;
+	PlugPath path;
+	// When true, the search stops at the first type (starting with `typeId`
+	// and moving to its base types) which has any registrations at all.
+	bool firstRegisteredTypeOnly;
+
+	bool operator == ( const PlugValueQuery &rhs ) const
+	{
+		return typeId == rhs.typeId && key == rhs.key && path == rhs.path && firstRegisteredTypeOnly == rhs.firstRegisteredTypeOnly;
+	}
+};
+
+size_t hashPlugPath( const PlugPath &path )
+{
+	size_t result = 0;
+	for( const auto &name : path )
+	{
+		boost::hash_combine( result, name.c_str() );
+	}
+	return result;
+}
+
+struct PlugPathHash
+{
+	size_t operator()( const PlugPath &path ) const
+	{
+		return hashPlugPath( path );
+	}
+};
+
+struct PlugValueQueryHash
+{
+	size_t operator()( const PlugValueQuery &query ) const
+	{
+		size_t result = hashPlugPath( query.path );
+		boost::hash_combine( result, query.typeId );
+		boost::hash_combine( result, query.key.c_str() );
+		boost::hash_combine( result, query.firstRegisteredTypeOnly );
+		return result;
+	}
+};
+
+const InternedString g_ellipsis( "..." );
+
+bool isLiteral( const InternedString &element )
+{
+	return element != g_ellipsis && !StringAlgo::hasWildcards( element.c_str() );
+}
+
+class PlugValueCache
+{
+
+	public :
+
+		// Returns the function registered to the key for `query.path`, relative
+		// to an ancestor of type `query.typeId` or one of its base types, or an
+		// empty function if there is none.
+		Metadata::PlugValueFunction valueFunction( const PlugValueQuery &query )
+		{
+			Mutex::scoped_lock lock( m_mutex, /* write = */ false );
+			auto it = m_resolved.find( query );
+			if( it != m_resolved.end() )
+			{
+				return it->second ? *it->second : Metadata::PlugValueFunction();
+			}
+
+			lock.upgrade_to_writer();
+			if( m_resolved.size() >= g_maxResolved )
+			{
+				// Paths are unbounded, so we must bound the memory we use
+				// for them. Compiled values are bounded by the registrations,
+				// so can be kept.
+				m_resolved.clear();
+			}
+
+			const Metadata::PlugValueFunction *f = resolve( query );
+			m_resolved[query] = f;
+			return f ? *f : Metadata::PlugValueFunction();
+		}
+
+		void clear()
+		{
+			Mutex::scoped_lock lock( m_mutex );
+			m_resolved.clear();
+			m_compiled.clear();
+		}
+
+	private :
+
+		struct CompiledPlugValues
+		{
+			std::unordered_map<PlugPath, const Metadata::PlugValueFunction *, PlugPathHash> exact;
+			vector<std::pair<const StringAlgo::MatchPatternPath *, const Metadata::PlugValueFunction *>> wildcards;
+		};
+
+		// Returns null if there are no registrations of any sort for `typeId`,
+		// and an empty result if there are registrations but none for `key`.
+		// Must be called with a write lock held.
+		const CompiledPlugValues *compiled( IECore::TypeId typeId, InternedString key )
+		{
+			auto [it, inserted] = m_compiled.try_emplace( { typeId, key.c_str() } );
+			if( !inserted )
+			{
+				return it->second.get();
+			}
+
+			auto nIt = graphComponentMetadataMap().find( typeId );
+			if( nIt == graphComponentMetadataMap().end() )
+			{
+				return nullptr;
+			}
+
+			auto c = std::make_unique<CompiledPlugValues>();
+			// Wildcards are kept in the order of `plugPathsToValues`, so
+			// that we choose between multiple matches in the same way
+			// as a search of `plugPathsToValues` would.
+			for( const auto &[pattern, values] : nIt->second.plugPathsToValues )
+			{
+				auto vIt = values.find( key );
+				if( vIt == values.end() )
+				{
+					continue;
+				}
+				if( std::all_of( pattern.begin(), pattern.end(), []( const InternedString &e ) { return isLiteral( e ); } ) )
+				{
+					c->exact[pattern] = &vIt->second;
+				}
+				else
+				{
+					c->wildcards.push_back( { &pattern, &vIt->second } );
+				}
+			}
+
+			it->second = std::move( c );
+			return it->second.get();
+		}
+
+		// Must be called with a write lock held.
+		const Metadata::PlugValueFunction *resolve( const PlugValueQuery &query )
+		{
+			IECore::TypeId typeId = query.typeId;
+			while( typeId != InvalidTypeId )
+			{
+				if( const CompiledPlugValues *c = compiled( typeId, query.key ) )
+				{
+					// Exact matches are preferred to wildcards.
+					auto it = c->exact.find( query.path );
+					if( it != c->exact.end() )
+					{
+						return it->second;
+					}
+
+					for( const auto &[pattern, function] : c->wildcards )
+					{
+						if( StringAlgo::match( query.path, *pattern ) )
+						{
+							return function;
+						}
+					}
+
+					if( query.firstRegisteredTypeOnly )
+					{
+						break;
+					}
+				}
+				typeId = RunTimeTyped::baseTypeId( typeId );
+			}
+			return nullptr;
+		}
+
+		using Mutex = tbb::spin_rw_mutex;
+		Mutex m_mutex;
+
+		using CompiledKey = std::pair<IECore::TypeId, const char *>;
+		std::unordered_map<CompiledKey, std::unique_ptr<CompiledPlugValues>, boost::hash<CompiledKey>> m_compiled;
+		std::unordered_map<PlugValueQuery, const Metadata::PlugValueFunction *, PlugValueQueryHash> m_resolved;
+
+		static const size_t g_maxResolved = 100000;
+
+};
+
+PlugValueCache &plugValueCache()
+{
+	static auto g_c = new PlugValueCache;
+	return *g_c;
+}
+
 // Value storage for instance targets
 // ==================================
 
@@ -638,6 +842,7 @@ void Metadata::deregisterValue( IECore::TypeId ancestorTypeId, const StringAlgo:
 	}
 
 	plugValues.erase( it );
+	plugValueCache().clear();
 
 	emitPlugValueChangedSignals( ancestorTypeId, plugPath, matchPatternPath, key, Metadata::ValueChangedReason::StaticDeregistration );
 }
@@ -705,6 +910,7 @@ void Metadata::registerValue( IECore::TypeId ancestorTypeId, const StringAlgo::M
 	{
 		plugValues.replace( it, namedValue );
 	}
+	plugValueCache().clear();
 
 	emitPlugValueChangedSignals( ancestorTypeId, plugPath, matchPatternPath, key, Metadata::ValueChangedReason::StaticRegistration );
 }
@@ -860,53 +1066,21 @@ IECore::ConstDataPtr Metadata::valueInternal( const GraphComponent *target, IECo
 		if( const Plug *plug = runTimeCast<const Plug>( target ) )
 		{
 			const GraphComponent *ancestor = plug->parent();
-			vector<InternedString> plugPath( { plug->getName() } );
+			PlugValueQuery query{ InvalidTypeId, key, { plug->getName() }, /* firstRegisteredTypeOnly = */ false };
 			Metadata::PlugValueFunction valueFn;
 			while( ancestor )
 			{
-				IECore::TypeId typeId = ancestor->typeId();
-				while( typeId != InvalidTypeId )
+				query.typeId = ancestor->typeId();
+				if( auto f = plugValueCache().valueFunction( query ) )
 				{
-					auto nIt = graphComponentMetadataMap().find( typeId );
-					if( nIt != graphComponentMetadataMap().end() )
-					{
-						// First do a direct lookup using the plug path.
-						auto it = nIt->second.plugPathsToValues.find( plugPath );
-						const auto eIt = nIt->second.plugPathsToValues.end();
-						if( it != eIt )
-						{
-							auto vIt = it->second.find( key );
-							if( vIt != it->second.end() )
-							{
-								valueFn = vIt->second;
-								break;
-							}
-						}
-
-						// And only if the direct lookup fails, do a full search using
-						// wildcard matches.
-						for( it = nIt->second.plugPathsToValues.begin(); it != eIt; ++it )
-						{
-							if( StringAlgo::match( plugPath, it->first ) )
-							{
-								auto vIt = it->second.find( key );
-								if( vIt != it->second.end() )
-								{
-									valueFn = vIt->second;
-									break;
-								}
-							}
-						}
-
-						if( valueFn != nullptr )
-						{
-							break;
-						}
-					}
-					typeId = RunTimeTyped::baseTypeId( typeId );
+					valueFn = f;
+					// Once a value has been found, outer ancestors may only
+					// override it via registrations to the first of their
+					// types to have any registrations at all.
+					query.firstRegisteredTypeOnly = true;
 				}
 
-				plugPath.insert( plugPath.begin(), ancestor->getName() );
+				query.path.insert( query.path.begin(), ancestor->getName() );
 				ancestor = ancestor->parent();
 			}
 
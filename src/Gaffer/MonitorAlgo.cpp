@@ -36,13 +36,18 @@
 
 #include "Gaffer/MonitorAlgo.h"
 
+#include "Gaffer/Context.h"
 #include "Gaffer/ContextMonitor.h"
 #include "Gaffer/MetadataAlgo.h"
 #include "Gaffer/Node.h"
 #include "Gaffer/PerformanceMonitor.h"
 #include "Gaffer/Plug.h"
+#include "Gaffer/SamplingMonitor.h"
 
+#include "IECore/DataAlgo.h"
 #include "IECore/SimpleTypedData.h"
+#include "IECore/TypeTraits.h"
+#include "IECore/VectorTypedData.h"
 
 #include "boost/lexical_cast.hpp"
 
@@ -232,6 +237,7 @@ std::invoke_result_t<F, const HashCountMetric &> dispatchMetric( const F &f, Mon
 }
 
 const std::string g_contextAnnotationName = "contextMonitor";
+const std::string g_samplingAnnotationName = "samplingMonitor";
 
 struct AnnotationRegistrations
 {
@@ -259,6 +265,12 @@ struct AnnotationRegistrations
 			MetadataAlgo::Annotation( "" ),
 			/* user = */ false
 		);
+
+		MetadataAlgo::addAnnotationTemplate(
+			g_samplingAnnotationName,
+			MetadataAlgo::Annotation( "" ),
+			/* user = */ false
+		);
 	}
 };
 
@@ -387,6 +399,118 @@ struct FormatTotalStatistics
 	const PerformanceMonitor::Statistics &combinedStatistics;
 };
 
+using HistogramAccessor = const PerformanceMonitor::Histogram &(*)( const PerformanceMonitor::Statistics & );
+
+const PerformanceMonitor::Histogram &hashHistogram( const PerformanceMonitor::Statistics &s )
+{
+	return s.hashHistogram;
+}
+
+const PerformanceMonitor::Histogram &computeHistogram( const PerformanceMonitor::Statistics &s )
+{
+	return s.computeHistogram;
+}
+
+std::string formatDuration( boost::chrono::nanoseconds duration )
+{
+	std::stringstream s;
+	s << std::fixed << boost::chrono::duration<double>( duration ).count() << "s";
+	return s.str();
+}
+
+std::string formatDistribution( const PerformanceMonitor::StatisticsMap &statistics, HistogramAccessor histogram, const std::string &description, size_t maxLines )
+{
+	std::vector<PlugAndStatistics> v;
+	for( const auto &s : statistics )
+	{
+		if( histogram( s.second ).count() )
+		{
+			v.push_back( s );
+		}
+	}
+
+	if( v.empty() )
+	{
+		return "";
+	}
+
+	std::sort(
+		v.begin(), v.end(),
+		[histogram] ( const PlugAndStatistics &lhs, const PlugAndStatistics &rhs ) {
+			return histogram( lhs.statistics ).percentile( 99 ) > histogram( rhs.statistics ).percentile( 99 );
+		}
+	);
+	if( v.size() > maxLines )
+	{
+		v.erase( v.begin() + maxLines, v.end() );
+	}
+
+	std::vector<std::string> plugNames;
+	std::vector<std::string> distributions;
+	for( const auto &p : v )
+	{
+		const PerformanceMonitor::Histogram &h = histogram( p.statistics );
+		plugNames.push_back( p.plug->relativeName( p.plug->ancestor( (IECore::TypeId)ScriptNodeTypeId ) ) );
+		distributions.push_back(
+			"p50 " + formatDuration( h.percentile( 50 ) ) +
+			"  p95 " + formatDuration( h.percentile( 95 ) ) +
+			"  p99 " + formatDuration( h.percentile( 99 ) ) +
+			"  max " + formatDuration( h.max() )
+		);
+	}
+
+	std::stringstream s;
+	s << "Top " << plugNames.size() << " plugs by 99th percentile " << description << " :\n\n";
+	outputItems( plugNames, distributions, s );
+
+	return s.str();
+}
+
+std::string formatContextVariable( const Context *context, const InternedString &name )
+{
+	ConstDataPtr data = context->getAsData( name );
+	try
+	{
+		return dispatch(
+			data.get(),
+			[] ( const auto *typedData ) -> std::string {
+				using DataType = std::remove_cv_t<std::remove_pointer_t<decltype( typedData )>>;
+				if constexpr( std::is_same_v<DataType, StringData> )
+				{
+					return typedData->readable();
+				}
+				else if constexpr( std::is_same_v<DataType, InternedStringData> )
+				{
+					return typedData->readable().string();
+				}
+				else if constexpr( std::is_same_v<DataType, InternedStringVectorData> )
+				{
+					// Most commonly a `scene:path`, so we format it as such.
+					std::string result;
+					for( const auto &n : typedData->readable() )
+					{
+						result += "/" + n.string();
+					}
+					return result.empty() ? "/" : result;
+				}
+				else if constexpr( TypeTraits::IsNumericSimpleTypedData<DataType>::value )
+				{
+					return boost::lexical_cast<std::string>( typedData->readable() );
+				}
+				else
+				{
+					return typedData->typeName();
+				}
+			}
+		);
+	}
+	catch( const IECore::Exception & )
+	{
+		// Type not supported by `dispatch()`.
+		return data->typeName();
+	}
+}
+
 } // namespace
 
 //////////////////////////////////////////////////////////////////////////
@@ -565,6 +689,63 @@ ContextMonitor::Statistics annotateContextWalk( Node &node, const ContextMonitor
 
 }
 
+size_t annotateSamplingWalk( Node &node, const SamplingMonitor::StatisticsMap &statistics, std::chrono::microseconds interval, bool persistent )
+{
+	using ChildSamples = std::pair<Node &, size_t>;
+
+	// Accumulate the samples for all plugs belonging to this node.
+
+	size_t result = 0;
+	for( Plug::RecursiveIterator plugIt( &node ); !plugIt.done(); ++plugIt )
+	{
+		auto it = statistics.find( plugIt->get() );
+		if( it != statistics.end() )
+		{
+			result += it->second.exclusiveSamples;
+		}
+	}
+
+	// Gather samples for all child nodes.
+
+	std::vector<ChildSamples> childSamples;
+	size_t maxChildSamples = 0;
+
+	for( Node::Iterator childNodeIt( &node ); !childNodeIt.done(); ++childNodeIt )
+	{
+		Node &childNode = **childNodeIt;
+		const size_t samples = annotateSamplingWalk( childNode, statistics, interval, persistent );
+		childSamples.push_back( ChildSamples( childNode, samples ) );
+		maxChildSamples = std::max( maxChildSamples, samples );
+	}
+
+	// Apply metadata for child nodes. We must do this
+	// after gathering because we need `maxChildSamples` to
+	// calculate the heat map.
+
+	for( const auto &cs : childSamples )
+	{
+		if( !cs.second )
+		{
+			continue;
+		}
+
+		const std::chrono::duration<double> time = cs.second * interval;
+		MetadataAlgo::addAnnotation(
+			&cs.first,
+			g_samplingAnnotationName,
+			MetadataAlgo::Annotation(
+				"Sampled time : " + boost::lexical_cast<std::string>( time.count() ) + "s",
+				heat( cs.second, maxChildSamples )
+			),
+			persistent
+		);
+
+		result += cs.second;
+	}
+
+	return result;
+}
+
 } // namespace
 
 //////////////////////////////////////////////////////////////////////////
@@ -615,6 +796,52 @@ std::string formatStatistics( const PerformanceMonitor &monitor, PerformanceMetr
 	return dispatchMetric<FormatStatistics>( FormatStatistics( monitor.allStatistics(), maxLines ), metric );
 }
 
+std::string formatDistributions( const PerformanceMonitor &monitor, size_t maxLines )
+{
+	const PerformanceMonitor::StatisticsMap &statistics = monitor.allStatistics();
+	std::string result = formatDistribution( statistics, computeHistogram, "duration per compute process", maxLines );
+	const std::string hashDistribution = formatDistribution( statistics, hashHistogram, "duration per hash process", maxLines );
+	if( !result.empty() && !hashDistribution.empty() )
+	{
+		result += "\n";
+	}
+	return result + hashDistribution;
+}
+
+std::string formatSlowestProcesses( const PerformanceMonitor &monitor )
+{
+	const PerformanceMonitor::SlowProcesses &processes = monitor.slowestProcesses();
+	if( processes.empty() )
+	{
+		return "";
+	}
+
+	std::stringstream s;
+	s << "Slowest " << processes.size() << " processes :\n\n";
+
+	for( const auto &process : processes )
+	{
+		s << "  " << process.plug->relativeName( process.plug->ancestor( (IECore::TypeId)ScriptNodeTypeId ) );
+		s << " (" << process.type.string() << ") : " << formatDuration( process.duration ) << "\n";
+
+		std::vector<InternedString> names;
+		process.context->names( names );
+		std::sort( names.begin(), names.end(), [] ( const InternedString &a, const InternedString &b ) { return a.string() < b.string(); } );
+
+		std::vector<std::string> values;
+		std::vector<std::string> nameStrings;
+		for( const auto &name : names )
+		{
+			nameStrings.push_back( "  " + name.string() );
+			values.push_back( formatContextVariable( process.context.get(), name ) );
+		}
+		outputItems( nameStrings, values, s );
+		s << "\n";
+	}
+
+	return s.str();
+}
+
 void annotate( Node &root, const PerformanceMonitor &monitor, bool persistent )
 {
 	for( int m = First; m <= Last; ++m )
@@ -633,8 +860,14 @@ void annotate( Node &root, const ContextMonitor &monitor, bool persistent )
 	annotateContextWalk( root, monitor.allStatistics(), persistent );
 }
 
+void annotate( Node &root, const SamplingMonitor &monitor, bool persistent )
+{
+	annotateSamplingWalk( root, monitor.allStatistics(), monitor.interval(), persistent );
+}
+
 void removePerformanceAnnotations( Node &root )
 {
+	MetadataAlgo::removeAnnotation( &root, g_samplingAnnotationName );
 	for( int m = Gaffer::MonitorAlgo::First; m <= Gaffer::MonitorAlgo::Last; ++m )
 	{
 		dispatchMetric(
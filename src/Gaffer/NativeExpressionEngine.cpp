@@ -0,0 +1,4082 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2025, Cinesite VFX Ltd. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//      * Redistributions of source code must retain the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer.
+//
+//      * Redistributions in binary form must reproduce the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer in the documentation and/or other materials provided with
+//        the distribution.
+//
+//      * Neither the name of John Haddon nor the names of
+//        any other contributors to this software may be used to endorse or
+//        promote products derived from this software without specific prior
+//        written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//////////////////////////////////////////////////////////////////////////
+
+#include "Gaffer/Private/NativeExpressionEngine.h"
+
+#include "Gaffer/CompoundNumericPlug.h"
+#include "Gaffer/Context.h"
+#include "Gaffer/NumericPlug.h"
+#include "Gaffer/PlugAlgo.h"
+#include "Gaffer/StringPlug.h"
+#include "Gaffer/TypedPlug.h"
+
+#include "IECore/NullObject.h"
+#include "IECore/SimpleTypedData.h"
+
+#include "boost/algorithm/string/replace.hpp"
+
+#include "fmt/format.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <map>
+#include <set>
+#include <unordered_map>
+
+using namespace IECore;
+using namespace Gaffer;
+using namespace Gaffer::Private;
+
+//////////////////////////////////////////////////////////////////////////
+// Values
+//
+// Values mirror the Python types that the equivalent Python expression
+// would be operating on, and all operations follow Python semantics
+// exactly. Where that isn't practical we throw UnsupportedOperation
+// rather than risk a different result.
+//////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+[[noreturn]] void unsupported( const std::string &what )
+{
+	throw NativeExpressionEngine::UnsupportedOperation( what );
+}
+
+struct Value
+{
+
+	enum class Type : char
+	{
+		None,
+		Bool,
+		Int,
+		Float,
+		String,
+		Tuple,
+		// Any other Data, such as vectors and colours. These may be
+		// passed through to outputs, and support component access.
+		Data
+	};
+
+	Value()
+		:	type( Type::None ), i( 0 )
+	{
+	}
+
+	static Value boolean( bool b )
+	{
+		Value v; v.type = Type::Bool; v.i = b; return v;
+	}
+
+	static Value integer( int64_t i )
+	{
+		Value v; v.type = Type::Int; v.i = i; return v;
+	}
+
+	static Value number( double f )
+	{
+		Value v; v.type = Type::Float; v.f = f; return v;
+	}
+
+	static Value string( std::string s )
+	{
+		Value v; v.type = Type::String; v.s = std::move( s ); return v;
+	}
+
+	static Value tuple( std::vector<Value> &&members )
+	{
+		Value v; v.type = Type::Tuple; v.members = std::make_shared<const std::vector<Value>>( std::move( members ) ); return v;
+	}
+
+	static Value data( const IECore::Data *d )
+	{
+		switch( d->typeId() )
+		{
+			case BoolDataTypeId :
+				return boolean( static_cast<const BoolData *>( d )->readable() );
+			case IntDataTypeId :
+				return integer( static_cast<const IntData *>( d )->readable() );
+			case UIntDataTypeId :
+				return integer( static_cast<const UIntData *>( d )->readable() );
+			case Int64DataTypeId :
+				return integer( static_cast<const Int64Data *>( d )->readable() );
+			case FloatDataTypeId :
+				return number( static_cast<const FloatData *>( d )->readable() );
+			case DoubleDataTypeId :
+				return number( static_cast<const DoubleData *>( d )->readable() );
+			case StringDataTypeId :
+				return string( static_cast<const StringData *>( d )->readable() );
+			default : {
+				Value v; v.type = Type::Data; v.d = d; return v;
+			}
+		}
+	}
+
+	Type type;
+	union
+	{
+		// Also used for Bool.
+		int64_t i;
+		double f;
+	};
+	std::string s;
+	ConstDataPtr d;
+	std::shared_ptr<const std::vector<Value>> members;
+
+};
+
+std::string typeName( const Value &v )
+{
+	switch( v.type )
+	{
+		case Value::Type::None : return "NoneType";
+		case Value::Type::Bool : return "bool";
+		case Value::Type::Int : return "int";
+		case Value::Type::Float : return "float";
+		case Value::Type::String : return "str";
+		case Value::Type::Tuple : return "tuple";
+		case Value::Type::Data : return v.d->typeName();
+	}
+	return "";
+}
+
+bool isIntegral( const Value &v )
+{
+	return v.type == Value::Type::Int || v.type == Value::Type::Bool;
+}
+
+bool isNumeric( const Value &v )
+{
+	return isIntegral( v ) || v.type == Value::Type::Float;
+}
+
+double toDouble( const Value &v )
+{
+	return v.type == Value::Type::Float ? v.f : (double)v.i;
+}
+
+bool isASCII( const std::string &s )
+{
+	for( auto c : s )
+	{
+		if( (unsigned char)c >= 0x80 )
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+// Equivalent to Python's `repr( float )`, which is also used by `str()`.
+std::string floatToString( double f )
+{
+	if( std::isnan( f ) )
+	{
+		return "nan";
+	}
+	else if( std::isinf( f ) )
+	{
+		return f > 0 ? "inf" : "-inf";
+	}
+
+	// `fmt` gives the shortest representation that round-trips, exactly
+	// as Python does. But it omits the decimal point for integral values.
+	std::string result = fmt::format( "{}", f );
+	if( result.find_first_of( ".e" ) == std::string::npos )
+	{
+		result += ".0";
+	}
+	return result;
+}
+
+std::string toString( const Value &v )
+{
+	switch( v.type )
+	{
+		case Value::Type::None : return "None";
+		case Value::Type::Bool : return v.i ? "True" : "False";
+		case Value::Type::Int : return std::to_string( v.i );
+		case Value::Type::Float : return floatToString( v.f );
+		case Value::Type::String : return v.s;
+		default :
+			unsupported( fmt::format( "Conversion of {} to str", typeName( v ) ) );
+	}
+}
+
+bool truthy( const Value &v )
+{
+	switch( v.type )
+	{
+		case Value::Type::None : return false;
+		case Value::Type::Bool :
+		case Value::Type::Int : return v.i != 0;
+		case Value::Type::Float : return v.f != 0.0;
+		case Value::Type::String : return !v.s.empty();
+		case Value::Type::Tuple : return !v.members->empty();
+		default :
+			unsupported( fmt::format( "Truth value of {}", typeName( v ) ) );
+	}
+}
+
+int64_t toInteger( double f )
+{
+	// Python would return an arbitrary precision integer, so we
+	// can only support values which fit in our representation.
+	if( !std::isfinite( f ) || std::fabs( f ) >= 9.2e18 )
+	{
+		unsupported( fmt::format( "Conversion of {} to int", floatToString( f ) ) );
+	}
+	return (int64_t)f;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Arithmetic
+//////////////////////////////////////////////////////////////////////////
+
+[[noreturn]] void unsupportedOperands( const char *op, const Value &a, const Value &b )
+{
+	unsupported( fmt::format( "unsupported operand type(s) for {}: '{}' and '{}'", op, typeName( a ), typeName( b ) ) );
+}
+
+[[noreturn]] void integerOverflow()
+{
+	// Python would promote to an arbitrary precision integer.
+	unsupported( "Integer overflow" );
+}
+
+[[noreturn]] void divisionByZero()
+{
+	unsupported( "division by zero" );
+}
+
+// Integers beyond this magnitude can't be converted exactly to double,
+// so we don't attempt true division on them.
+const int64_t g_maxExactInteger = int64_t( 1 ) << 53;
+
+Value add( const Value &a, const Value &b )
+{
+	if( isIntegral( a ) && isIntegral( b ) )
+	{
+		int64_t result;
+		if( __builtin_add_overflow( a.i, b.i, &result ) )
+		{
+			integerOverflow();
+		}
+		return Value::integer( result );
+	}
+	else if( isNumeric( a ) && isNumeric( b ) )
+	{
+		return Value::number( toDouble( a ) + toDouble( b ) );
+	}
+	else if( a.type == Value::Type::String && b.type == Value::Type::String )
+	{
+		return Value::string( a.s + b.s );
+	}
+	unsupportedOperands( "+", a, b );
+}
+
+Value subtract( const Value &a, const Value &b )
+{
+	if( isIntegral( a ) && isIntegral( b ) )
+	{
+		int64_t result;
+		if( __builtin_sub_overflow( a.i, b.i, &result ) )
+		{
+			integerOverflow();
+		}
+		return Value::integer( result );
+	}
+	else if( isNumeric( a ) && isNumeric( b ) )
+	{
+		return Value::number( toDouble( a ) - toDouble( b ) );
+	}
+	unsupportedOperands( "-", a, b );
+}
+
+Value repeat( const std::string &s, int64_t count )
+{
+	std::string result;
+	if( count <= 0 || s.empty() )
+	{
+		return Value::string( result );
+	}
+	if( count > ( 1 << 24 ) / (int64_t)s.size() )
+	{
+		unsupported( "String repetition too large" );
+	}
+	result.reserve( s.size() * count );
+	for( int64_t i = 0; i < count; ++i )
+	{
+		result += s;
+	}
+	return Value::string( result );
+}
+
+Value multiply( const Value &a, const Value &b )
+{
+	if( isIntegral( a ) && isIntegral( b ) )
+	{
+		int64_t result;
+		if( __builtin_mul_overflow( a.i, b.i, &result ) )
+		{
+			integerOverflow();
+		}
+		return Value::integer( result );
+	}
+	else if( isNumeric( a ) && isNumeric( b ) )
+	{
+		return Value::number( toDouble( a ) * toDouble( b ) );
+	}
+	else if( a.type == Value::Type::String && isIntegral( b ) )
+	{
+		return repeat( a.s, b.i );
+	}
+	else if( isIntegral( a ) && b.type == Value::Type::String )
+	{
+		return repeat( b.s, a.i );
+	}
+	unsupportedOperands( "*", a, b );
+}
+
+Value divide( const Value &a, const Value &b )
+{
+	if( !isNumeric( a ) || !isNumeric( b ) )
+	{
+		unsupportedOperands( "/", a, b );
+	}
+	if( ( isIntegral( a ) && std::abs( a.i ) > g_maxExactInteger ) || ( isIntegral( b ) && std::abs( b.i ) > g_maxExactInteger ) )
+	{
+		// Python performs correctly rounded division of the exact
+		// integer values.
+		unsupported( "Division of large integers" );
+	}
+	const double divisor = toDouble( b );
+	if( divisor == 0.0 )
+	{
+		divisionByZero();
+	}
+	return Value::number( toDouble( a ) / divisor );
+}
+
+// Python's float `%`, which takes the sign of the divisor.
+double floatModulo( double a, double b )
+{
+	if( b == 0.0 )
+	{
+		divisionByZero();
+	}
+	double mod = std::fmod( a, b );
+	if( mod != 0.0 )
+	{
+		if( ( b < 0 ) != ( mod < 0 ) )
+		{
+			mod += b;
+		}
+	}
+	else
+	{
+		mod = std::copysign( 0.0, b );
+	}
+	return mod;
+}
+
+// Python's float `//`, ported from CPython's `float_floor_div()`.
+double floatFloorDivide( double a, double b )
+{
+	if( b == 0.0 )
+	{
+		divisionByZero();
+	}
+	double mod = std::fmod( a, b );
+	double div = ( a - mod ) / b;
+	if( mod != 0.0 && ( ( b < 0 ) != ( mod < 0 ) ) )
+	{
+		div -= 1.0;
+	}
+	double result;
+	if( div != 0.0 )
+	{
+		result = std::floor( div );
+		if( div - result > 0.5 )
+		{
+			result += 1.0;
+		}
+	}
+	else
+	{
+		result = std::copysign( 0.0, a / b );
+	}
+	return result;
+}
+
+Value floorDivide( const Value &a, const Value &b )
+{
+	if( isIntegral( a ) && isIntegral( b ) )
+	{
+		if( b.i == 0 )
+		{
+			divisionByZero();
+		}
+		if( b.i == -1 )
+		{
+			if( a.i == std::numeric_limits<int64_t>::min() )
+			{
+				integerOverflow();
+			}
+			return Value::integer( -a.i );
+		}
+		int64_t result = a.i / b.i;
+		if( ( a.i % b.i != 0 ) && ( ( a.i < 0 ) != ( b.i < 0 ) ) )
+		{
+			result--;
+		}
+		return Value::integer( result );
+	}
+	else if( isNumeric( a ) && isNumeric( b ) )
+	{
+		return Value::number( floatFloorDivide( toDouble( a ), toDouble( b ) ) );
+	}
+	unsupportedOperands( "//", a, b );
+}
+
+std::string percentFormat( const std::string &format, const Value &arguments );
+
+Value modulo( const Value &a, const Value &b )
+{
+	if( isIntegral( a ) && isIntegral( b ) )
+	{
+		if( b.i == 0 )
+		{
+			divisionByZero();
+		}
+		if( b.i == -1 )
+		{
+			return Value::integer( 0 );
+		}
+		int64_t result = a.i % b.i;
+		if( result != 0 && ( ( result < 0 ) != ( b.i < 0 ) ) )
+		{
+			result += b.i;
+		}
+		return Value::integer( result );
+	}
+	else if( isNumeric( a ) && isNumeric( b ) )
+	{
+		return Value::number( floatModulo( toDouble( a ), toDouble( b ) ) );
+	}
+	else if( a.type == Value::Type::String )
+	{
+		return Value::string( percentFormat( a.s, b ) );
+	}
+	unsupportedOperands( "%", a, b );
+}
+
+Value power( const Value &a, const Value &b )
+{
+	if( isIntegral( a ) && isIntegral( b ) && b.i >= 0 )
+	{
+		int64_t result = 1;
+		int64_t base = a.i;
+		int64_t exponent = b.i;
+		while( exponent )
+		{
+			if( exponent & 1 )
+			{
+				if( __builtin_mul_overflow( result, base, &result ) )
+				{
+					integerOverflow();
+				}
+			}
+			exponent >>= 1;
+			if( exponent && __builtin_mul_overflow( base, base, &base ) )
+			{
+				integerOverflow();
+			}
+		}
+		return Value::integer( result );
+	}
+	else if( isNumeric( a ) && isNumeric( b ) )
+	{
+		const double x = toDouble( a );
+		const double y = toDouble( b );
+		if( x == 0.0 && y < 0.0 )
+		{
+			unsupported( "0.0 cannot be raised to a negative power" );
+		}
+		if( x < 0.0 && y != std::floor( y ) && std::isfinite( y ) )
+		{
+			// Python would return a complex number.
+			unsupported( "Negative number raised to a fractional power" );
+		}
+		const double result = std::pow( x, y );
+		if( std::isinf( result ) && std::isfinite( x ) && std::isfinite( y ) )
+		{
+			unsupported( "Numerical result out of range" );
+		}
+		return Value::number( result );
+	}
+	unsupportedOperands( "** or pow()", a, b );
+}
+
+Value negate( const Value &v )
+{
+	if( isIntegral( v ) )
+	{
+		if( v.i == std::numeric_limits<int64_t>::min() )
+		{
+			integerOverflow();
+		}
+		return Value::integer( -v.i );
+	}
+	else if( v.type == Value::Type::Float )
+	{
+		return Value::number( -v.f );
+	}
+	unsupported( fmt::format( "bad operand type for unary -: '{}'", typeName( v ) ) );
+}
+
+Value positive( const Value &v )
+{
+	if( isIntegral( v ) )
+	{
+		return Value::integer( v.i );
+	}
+	else if( v.type == Value::Type::Float )
+	{
+		return v;
+	}
+	unsupported( fmt::format( "bad operand type for unary +: '{}'", typeName( v ) ) );
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Comparison
+//////////////////////////////////////////////////////////////////////////
+
+// Returns -1, 0 or 1, or 2 if the values are unordered (NaN).
+int compareNumbers( const Value &a, const Value &b )
+{
+	if( isIntegral( a ) && isIntegral( b ) )
+	{
+		return a.i < b.i ? -1 : ( a.i > b.i ? 1 : 0 );
+	}
+	else if( a.type == Value::Type::Float && b.type == Value::Type::Float )
+	{
+		if( std::isnan( a.f ) || std::isnan( b.f ) )
+		{
+			return 2;
+		}
+		return a.f < b.f ? -1 : ( a.f > b.f ? 1 : 0 );
+	}
+	else if( a.type == Value::Type::Float )
+	{
+		const int c = compareNumbers( b, a );
+		return c == 2 ? c : -c;
+	}
+
+	// Integer `a` and float `b`. Python compares the exact values,
+	// which we can't do by converting `a` to double.
+	if( std::isnan( b.f ) )
+	{
+		return 2;
+	}
+	else if( b.f >= 9223372036854775808.0 )
+	{
+		return -1;
+	}
+	else if( b.f < -9223372036854775808.0 )
+	{
+		return 1;
+	}
+	const double floor = std::floor( b.f );
+	const int64_t i = (int64_t)floor;
+	if( a.i != i )
+	{
+		return a.i < i ? -1 : 1;
+	}
+	return b.f > floor ? -1 : 0;
+}
+
+bool equal( const Value &a, const Value &b )
+{
+	if( isNumeric( a ) && isNumeric( b ) )
+	{
+		return compareNumbers( a, b ) == 0;
+	}
+	else if( a.type == Value::Type::String && b.type == Value::Type::String )
+	{
+		return a.s == b.s;
+	}
+	else if( a.type == Value::Type::None && b.type == Value::Type::None )
+	{
+		return true;
+	}
+	else if(
+		a.type == Value::Type::Data || b.type == Value::Type::Data ||
+		a.type == Value::Type::Tuple || b.type == Value::Type::Tuple
+	)
+	{
+		unsupported( fmt::format( "Comparison of {} and {}", typeName( a ), typeName( b ) ) );
+	}
+	// Values of different types.
+	return false;
+}
+
+// Returns the result of `a op b` for the ordering operators, using
+// `lessThan` and `orEqual` to encode `<`, `<=`, `>` and `>=` in terms
+// of a three-way comparison.
+bool order( const Value &a, const Value &b, const char *op, int expected, bool orEqual )
+{
+	int c;
+	if( isNumeric( a ) && isNumeric( b ) )
+	{
+		c = compareNumbers( a, b );
+		if( c == 2 )
+		{
+			return false;
+		}
+	}
+	else if( a.type == Value::Type::String && b.type == Value::Type::String )
+	{
+		c = a.s.compare( b.s );
+		c = c < 0 ? -1 : ( c > 0 ? 1 : 0 );
+	}
+	else
+	{
+		unsupported( fmt::format( "'{}' not supported between instances of '{}' and '{}'", op, typeName( a ), typeName( b ) ) );
+	}
+	return c == expected || ( orEqual && c == 0 );
+}
+
+bool contains( const Value &container, const Value &v )
+{
+	if( container.type == Value::Type::String && v.type == Value::Type::String )
+	{
+		return container.s.find( v.s ) != std::string::npos;
+	}
+	else if( container.type == Value::Type::Tuple )
+	{
+		for( const auto &m : *container.members )
+		{
+			if( equal( m, v ) )
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+	unsupported( fmt::format( "'in' with {} and {}", typeName( v ), typeName( container ) ) );
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Components
+//////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+Value componentValue( const T &v, int64_t index )
+{
+	if( index < 0 || index >= (int64_t)T::dimensions() )
+	{
+		unsupported( "index out of range" );
+	}
+	if constexpr( std::is_integral_v<typename T::BaseType> )
+	{
+		return Value::integer( v[index] );
+	}
+	else
+	{
+		return Value::number( v[index] );
+	}
+}
+
+// Access to a component of a vector or colour, via `v[index]`.
+Value component( const Value &v, int64_t index )
+{
+	if( v.type == Value::Type::Data )
+	{
+		switch( v.d->typeId() )
+		{
+			case V2iDataTypeId :
+				return componentValue( static_cast<const V2iData *>( v.d.get() )->readable(), index );
+			case V3iDataTypeId :
+				return componentValue( static_cast<const V3iData *>( v.d.get() )->readable(), index );
+			case V2fDataTypeId :
+				return componentValue( static_cast<const V2fData *>( v.d.get() )->readable(), index );
+			case V3fDataTypeId :
+				return componentValue( static_cast<const V3fData *>( v.d.get() )->readable(), index );
+			case Color3fDataTypeId :
+				return componentValue( static_cast<const Color3fData *>( v.d.get() )->readable(), index );
+			case Color4fDataTypeId :
+				return componentValue( static_cast<const Color4fData *>( v.d.get() )->readable(), index );
+			default :
+				break;
+		}
+	}
+	unsupported( fmt::format( "'{}' object is not subscriptable", typeName( v ) ) );
+}
+
+enum class ComponentFamily
+{
+	// `.x`, `.y` and `.z`
+	Vector,
+	// `.r`, `.g`, `.b` and `.a`
+	Color
+};
+
+// Access to a component of a vector or colour, via `v.x` or `v.r` etc.
+// Imath vectors only have `xyz` accessors, Color4 only has `rgba` accessors
+// and Color3 (which derives from Vec3) has both.
+Value component( const Value &v, int64_t index, ComponentFamily family )
+{
+	if( v.type == Value::Type::Data )
+	{
+		const IECore::TypeId typeId = (IECore::TypeId)v.d->typeId();
+		const bool valid = family == ComponentFamily::Vector ?
+			typeId == V2iDataTypeId || typeId == V3iDataTypeId || typeId == V2fDataTypeId || typeId == V3fDataTypeId || typeId == Color3fDataTypeId :
+			typeId == Color3fDataTypeId || typeId == Color4fDataTypeId
+		;
+		if( valid )
+		{
+			return component( v, index );
+		}
+	}
+	static const char *g_names[2][4] = { { "x", "y", "z", "w" }, { "r", "g", "b", "a" } };
+	unsupported( fmt::format( "'{}' object has no attribute '{}'", typeName( v ), g_names[(int)family][index] ) );
+}
+
+Value subscript( const Value &container, const Value &index )
+{
+	if( !isIntegral( index ) )
+	{
+		unsupported( fmt::format( "Indexing with {}", typeName( index ) ) );
+	}
+
+	if( container.type == Value::Type::String )
+	{
+		// Python indexes by code point, so we only support ASCII.
+		if( !isASCII( container.s ) )
+		{
+			unsupported( "Indexing of non-ASCII string" );
+		}
+		const int64_t size = container.s.size();
+		const int64_t i = index.i < 0 ? index.i + size : index.i;
+		if( i < 0 || i >= size )
+		{
+			unsupported( "string index out of range" );
+		}
+		return Value::string( std::string( 1, container.s[i] ) );
+	}
+	else if( container.type == Value::Type::Tuple )
+	{
+		const int64_t size = container.members->size();
+		const int64_t i = index.i < 0 ? index.i + size : index.i;
+		if( i < 0 || i >= size )
+		{
+			unsupported( "tuple index out of range" );
+		}
+		return (*container.members)[i];
+	}
+
+	return component( container, index.i );
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Formatting
+//////////////////////////////////////////////////////////////////////////
+
+// The subset of Python's format specification mini-language which
+// `fmt` implements identically.
+struct FormatSpec
+{
+	char fill = 0;
+	char align = 0;
+	char sign = 0;
+	bool zero = false;
+	int width = -1;
+	int precision = -1;
+	char type = 0;
+};
+
+bool parseDigits( const std::string &s, size_t &i, int &result )
+{
+	const size_t start = i;
+	result = 0;
+	while( i < s.size() && isdigit( (unsigned char)s[i] ) )
+	{
+		if( i - start >= 4 )
+		{
+			return false;
+		}
+		result = result * 10 + ( s[i++] - '0' );
+	}
+	return i > start;
+}
+
+bool isAlign( char c )
+{
+	// Python's "=" alignment isn't supported by `fmt`.
+	return c == '<' || c == '>' || c == '^';
+}
+
+bool parseFormatSpec( const std::string &s, FormatSpec &spec )
+{
+	size_t i = 0;
+	if( s.size() >= 2 && isAlign( s[1] ) )
+	{
+		spec.fill = s[0];
+		spec.align = s[1];
+		i = 2;
+		if( spec.fill == '{' || spec.fill == '}' || (unsigned char)spec.fill >= 0x80 )
+		{
+			return false;
+		}
+	}
+	else if( s.size() >= 1 && isAlign( s[0] ) )
+	{
+		spec.align = s[0];
+		i = 1;
+	}
+
+	if( i < s.size() && ( s[i] == '+' || s[i] == '-' || s[i] == ' ' ) )
+	{
+		spec.sign = s[i++];
+	}
+
+	if( i < s.size() && s[i] == '0' )
+	{
+		spec.zero = true;
+		i++;
+	}
+
+	if( i < s.size() && isdigit( (unsigned char)s[i] ) && !parseDigits( s, i, spec.width ) )
+	{
+		return false;
+	}
+
+	if( i < s.size() && s[i] == '.' )
+	{
+		i++;
+		if( !parseDigits( s, i, spec.precision ) )
+		{
+			return false;
+		}
+	}
+
+	if( i < s.size() )
+	{
+		spec.type = s[i++];
+	}
+
+	// Anything left over is either an error, or a feature such as
+	// "#" or "," which we don't support.
+	return i == s.size();
+}
+
+std::string fmtFormatString( const FormatSpec &spec )
+{
+	std::string result = "{:";
+	if( spec.align )
+	{
+		if( spec.fill )
+		{
+			result += spec.fill;
+		}
+		result += spec.align;
+	}
+	if( spec.sign )
+	{
+		result += spec.sign;
+	}
+	if( spec.zero )
+	{
+		result += '0';
+	}
+	if( spec.width >= 0 )
+	{
+		result += std::to_string( spec.width );
+	}
+	if( spec.precision >= 0 )
+	{
+		result += '.';
+		result += std::to_string( spec.precision );
+	}
+	if( spec.type )
+	{
+		result += spec.type;
+	}
+	result += '}';
+	return result;
+}
+
+std::string formatString( const std::string &s, const FormatSpec &spec )
+{
+	if( spec.sign || spec.zero || ( spec.type && spec.type != 's' ) )
+	{
+		unsupported( "Format specification for str" );
+	}
+	if( ( spec.width >= 0 || spec.precision >= 0 ) && !isASCII( s ) )
+	{
+		// Python counts code points, whereas `fmt` counts display width.
+		unsupported( "Width or precision for non-ASCII string" );
+	}
+	return fmt::format( fmt::runtime( fmtFormatString( spec ) ), s );
+}
+
+bool isFloatType( char type )
+{
+	return type && strchr( "eEfFgG", type );
+}
+
+std::string formatFloat( double f, FormatSpec spec )
+{
+	if( !isFloatType( spec.type ) || ( spec.zero && spec.align ) )
+	{
+		// Without a type, Python uses a variant of `repr()` which
+		// `fmt` doesn't provide. And `fmt` ignores the "0" flag when
+		// an alignment is specified, whereas Python uses it as a fill.
+		unsupported( "Format specification for float" );
+	}
+	return fmt::format( fmt::runtime( fmtFormatString( spec ) ), f );
+}
+
+std::string formatInteger( int64_t i, FormatSpec spec )
+{
+	if( isFloatType( spec.type ) )
+	{
+		return formatFloat( (double)i, spec );
+	}
+	if( ( spec.type && !strchr( "bdoxX", spec.type ) ) || spec.precision >= 0 || ( spec.zero && spec.align ) )
+	{
+		unsupported( "Format specification for int" );
+	}
+	return fmt::format( fmt::runtime( fmtFormatString( spec ) ), i );
+}
+
+// Equivalent to Python's `format( value, spec )`.
+std::string formatValue( const Value &v, const std::string &specString )
+{
+	if( specString.empty() )
+	{
+		return toString( v );
+	}
+
+	FormatSpec spec;
+	if( !parseFormatSpec( specString, spec ) )
+	{
+		unsupported( fmt::format( "Format specification \"{}\"", specString ) );
+	}
+
+	try
+	{
+		switch( v.type )
+		{
+			case Value::Type::String :
+				return formatString( v.s, spec );
+			case Value::Type::Bool :
+			case Value::Type::Int :
+				return formatInteger( v.i, spec );
+			case Value::Type::Float :
+				return formatFloat( v.f, spec );
+			default :
+				unsupported( fmt::format( "Formatting of {}", typeName( v ) ) );
+		}
+	}
+	catch( const fmt::format_error &e )
+	{
+		unsupported( e.what() );
+	}
+}
+
+// Equivalent to Python's `str.format()`, for positional arguments.
+std::string strFormat( const std::string &format, const Value *arguments, size_t numArguments )
+{
+	std::string result;
+	size_t nextIndex = 0;
+	bool automaticNumbering = false;
+	bool manualNumbering = false;
+
+	for( size_t i = 0, size = format.size(); i < size; )
+	{
+		const char c = format[i];
+		if( c == '{' )
+		{
+			if( i + 1 < size && format[i+1] == '{' )
+			{
+				result += '{';
+				i += 2;
+				continue;
+			}
+
+			const size_t end = format.find( '}', i );
+			if( end == std::string::npos )
+			{
+				unsupported( "Single '{' encountered in format string" );
+			}
+
+			const std::string field = format.substr( i + 1, end - i - 1 );
+			if( field.find( '{' ) != std::string::npos )
+			{
+				unsupported( "Nested replacement fields" );
+			}
+
+			const size_t colon = field.find( ':' );
+			const std::string argument = field.substr( 0, colon );
+			const std::string spec = colon == std::string::npos ? "" : field.substr( colon + 1 );
+
+			size_t index;
+			if( argument.empty() )
+			{
+				automaticNumbering = true;
+				index = nextIndex++;
+			}
+			else if( argument.size() <= 3 && argument.find_first_not_of( "0123456789" ) == std::string::npos )
+			{
+				manualNumbering = true;
+				index = std::stoi( argument );
+			}
+			else
+			{
+				// Keyword arguments, attribute access or conversions.
+				unsupported( fmt::format( "Replacement field \"{}\"", field ) );
+			}
+
+			if( automaticNumbering && manualNumbering )
+			{
+				unsupported( "cannot switch between automatic field numbering and manual field specification" );
+			}
+			if( index >= numArguments )
+			{
+				unsupported( fmt::format( "Replacement index {} out of range for positional args tuple", index ) );
+			}
+
+			result += formatValue( arguments[index], spec );
+			i = end + 1;
+		}
+		else if( c == '}' )
+		{
+			if( i + 1 < size && format[i+1] == '}' )
+			{
+				result += '}';
+				i += 2;
+				continue;
+			}
+			unsupported( "Single '}' encountered in format string" );
+		}
+		else
+		{
+			result += c;
+			i++;
+		}
+	}
+
+	return result;
+}
+
+// Equivalent to Python's `format % arguments`.
+std::string percentFormat( const std::string &format, const Value &arguments )
+{
+	const Value *args = &arguments;
+	size_t numArgs = 1;
+	if( arguments.type == Value::Type::Tuple )
+	{
+		args = arguments.members->data();
+		numArgs = arguments.members->size();
+	}
+
+	std::string result;
+	size_t argIndex = 0;
+	for( size_t i = 0, size = format.size(); i < size; )
+	{
+		if( format[i] != '%' )
+		{
+			result += format[i++];
+			continue;
+		}
+
+		if( ++i >= size )
+		{
+			unsupported( "incomplete format" );
+		}
+
+		if( format[i] == '%' )
+		{
+			result += '%';
+			i++;
+			continue;
+		}
+
+		// Conversion flags
+
+		FormatSpec spec;
+		bool leftAlign = false;
+		for( ; i < size; ++i )
+		{
+			const char f = format[i];
+			if( f == '-' )
+			{
+				leftAlign = true;
+			}
+			else if( f == '0' )
+			{
+				spec.zero = true;
+			}
+			else if( f == '+' )
+			{
+				spec.sign = '+';
+			}
+			else if( f == ' ' )
+			{
+				if( spec.sign != '+' )
+				{
+					spec.sign = ' ';
+				}
+			}
+			else if( f == '#' || f == '(' )
+			{
+				unsupported( "Conversion flag" );
+			}
+			else
+			{
+				break;
+			}
+		}
+
+		// Width and precision
+
+		if( i < size && format[i] == '*' )
+		{
+			unsupported( "Variable width" );
+		}
+		if( i < size && isdigit( (unsigned char)format[i] ) && !parseDigits( format, i, spec.width ) )
+		{
+			unsupported( "Width" );
+		}
+		if( i < size && format[i] == '.' )
+		{
+			i++;
+			if( i < size && format[i] == '*' )
+			{
+				unsupported( "Variable precision" );
+			}
+			if( !parseDigits( format, i, spec.precision ) )
+			{
+				// Python treats "%.f" as precision 0.
+				spec.precision = 0;
+			}
+		}
+
+		// Length modifiers are accepted and ignored by Python.
+		while( i < size && ( format[i] == 'h' || format[i] == 'l' || format[i] == 'L' ) )
+		{
+			i++;
+		}
+
+		if( i >= size )
+		{
+			unsupported( "incomplete format" );
+		}
+
+		const char type = format[i++];
+		if( argIndex >= numArgs )
+		{
+			unsupported( "not enough arguments for format string" );
+		}
+		const Value &arg = args[argIndex++];
+
+		if( leftAlign )
+		{
+			spec.align = '<';
+			spec.zero = false;
+		}
+
+		try
+		{
+			if( type == 's' )
+			{
+				// Python ignores sign and zero flags for strings, and
+				// right-aligns by default.
+				spec.sign = 0;
+				spec.zero = false;
+				if( !spec.align && spec.width >= 0 )
+				{
+					spec.align = '>';
+				}
+				result += formatString( toString( arg ), spec );
+			}
+			else if( type == 'd' || type == 'i' || type == 'u' )
+			{
+				if( spec.precision >= 0 )
+				{
+					unsupported( "Precision for integer conversion" );
+				}
+				spec.type = 'd';
+				if( isIntegral( arg ) )
+				{
+					result += formatInteger( arg.i, spec );
+				}
+				else if( arg.type == Value::Type::Float )
+				{
+					result += formatInteger( toInteger( arg.f ), spec );
+				}
+				else
+				{
+					unsupported( fmt::format( "%{} format: a real number is required, not {}", type, typeName( arg ) ) );
+				}
+			}
+			else if( type == 'x' || type == 'X' || type == 'o' )
+			{
+				if( spec.precision >= 0 || !isIntegral( arg ) )
+				{
+					unsupported( fmt::format( "%{} format", type ) );
+				}
+				spec.type = type;
+				result += formatInteger( arg.i, spec );
+			}
+			else if( isFloatType( type ) )
+			{
+				if( !isNumeric( arg ) )
+				{
+					unsupported( fmt::format( "must be real number, not {}", typeName( arg ) ) );
+				}
+				spec.type = type;
+				result += formatFloat( toDouble( arg ), spec );
+			}
+			else
+			{
+				unsupported( fmt::format( "Conversion type '{}'", type ) );
+			}
+		}
+		catch( const fmt::format_error &e )
+		{
+			unsupported( e.what() );
+		}
+	}
+
+	if( argIndex != numArgs )
+	{
+		unsupported( "not all arguments converted during string formatting" );
+	}
+
+	return result;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Builtin functions and string methods
+//////////////////////////////////////////////////////////////////////////
+
+enum class Builtin
+{
+	Int,
+	Float,
+	Str,
+	Bool,
+	Abs,
+	Min,
+	Max,
+	Round,
+	Len
+};
+
+struct FunctionDescription
+{
+	int value;
+	size_t minArguments;
+	size_t maxArguments;
+};
+
+const std::unordered_map<std::string, FunctionDescription> &builtins()
+{
+	static const size_t g_unlimited = std::numeric_limits<size_t>::max();
+	static const std::unordered_map<std::string, FunctionDescription> g_builtins = {
+		{ "int", { (int)Builtin::Int, 0, 1 } },
+		{ "float", { (int)Builtin::Float, 0, 1 } },
+		{ "str", { (int)Builtin::Str, 0, 1 } },
+		{ "bool", { (int)Builtin::Bool, 0, 1 } },
+		{ "abs", { (int)Builtin::Abs, 1, 1 } },
+		// We don't support the single argument form which
+		// takes an iterable.
+		{ "min", { (int)Builtin::Min, 2, g_unlimited } },
+		{ "max", { (int)Builtin::Max, 2, g_unlimited } },
+		// We don't support `ndigits`, because Python's
+		// algorithm for it is non-trivial.
+		{ "round", { (int)Builtin::Round, 1, 1 } },
+		{ "len", { (int)Builtin::Len, 1, 1 } },
+	};
+	return g_builtins;
+}
+
+const char *g_whitespace = " \t\n\r\x0b\x0c\x1c\x1d\x1e\x1f";
+
+bool isStrictNumber( const std::string &s, bool allowFloat )
+{
+	// Python accepts many forms we don't, such as underscores,
+	// "inf" and non-ASCII digits. We only accept the plain forms
+	// that we're sure `strtod()` and `strtoll()` treat identically.
+	if( s.empty() )
+	{
+		return false;
+	}
+	size_t i = ( s[0] == '+' || s[0] == '-' ) ? 1 : 0;
+	bool digits = false;
+	for( ; i < s.size(); ++i )
+	{
+		const char c = s[i];
+		if( isdigit( (unsigned char)c ) )
+		{
+			digits = true;
+		}
+		else if( !allowFloat || !strchr( ".eE+-", c ) )
+		{
+			return false;
+		}
+	}
+	return digits;
+}
+
+std::string strip( const std::string &s, const char *chars, bool left, bool right )
+{
+	size_t begin = 0;
+	size_t end = s.size();
+	if( left )
+	{
+		begin = s.find_first_not_of( chars );
+		if( begin == std::string::npos )
+		{
+			return "";
+		}
+	}
+	if( right )
+	{
+		end = s.find_last_not_of( chars ) + 1;
+	}
+	return s.substr( begin, end - begin );
+}
+
+Value intBuiltin( const Value &v )
+{
+	switch( v.type )
+	{
+		case Value::Type::Bool :
+		case Value::Type::Int :
+			return Value::integer( v.i );
+		case Value::Type::Float :
+			return Value::integer( toInteger( v.f ) );
+		case Value::Type::String : {
+			if( !isASCII( v.s ) )
+			{
+				break;
+			}
+			const std::string s = strip( v.s, g_whitespace, true, true );
+			if( !isStrictNumber( s, false ) || s.size() > 18 )
+			{
+				break;
+			}
+			return Value::integer( std::stoll( s ) );
+		}
+		default :
+			break;
+	}
+	unsupported( fmt::format( "int() of {}", v.type == Value::Type::String ? "\"" + v.s + "\"" : typeName( v ) ) );
+}
+
+Value floatBuiltin( const Value &v )
+{
+	switch( v.type )
+	{
+		case Value::Type::Bool :
+		case Value::Type::Int :
+			return Value::number( (double)v.i );
+		case Value::Type::Float :
+			return v;
+		case Value::Type::String : {
+			if( !isASCII( v.s ) )
+			{
+				break;
+			}
+			const std::string s = strip( v.s, g_whitespace, true, true );
+			if( !isStrictNumber( s, true ) )
+			{
+				break;
+			}
+			char *end = nullptr;
+			const double result = strtod( s.c_str(), &end );
+			if( *end )
+			{
+				break;
+			}
+			return Value::number( result );
+		}
+		default :
+			break;
+	}
+	unsupported( fmt::format( "float() of {}", v.type == Value::Type::String ? "\"" + v.s + "\"" : typeName( v ) ) );
+}
+
+Value callBuiltin( Builtin builtin, const Value *args, size_t numArgs )
+{
+	switch( builtin )
+	{
+		case Builtin::Int :
+			return numArgs ? intBuiltin( args[0] ) : Value::integer( 0 );
+		case Builtin::Float :
+			return numArgs ? floatBuiltin( args[0] ) : Value::number( 0.0 );
+		case Builtin::Str :
+			return Value::string( numArgs ? toString( args[0] ) : "" );
+		case Builtin::Bool :
+			return Value::boolean( numArgs ? truthy( args[0] ) : false );
+		case Builtin::Abs :
+			if( isIntegral( args[0] ) )
+			{
+				if( args[0].i == std::numeric_limits<int64_t>::min() )
+				{
+					integerOverflow();
+				}
+				return Value::integer( std::abs( args[0].i ) );
+			}
+			else if( args[0].type == Value::Type::Float )
+			{
+				return Value::number( std::fabs( args[0].f ) );
+			}
+			unsupported( fmt::format( "bad operand type for abs(): '{}'", typeName( args[0] ) ) );
+		case Builtin::Min :
+		case Builtin::Max : {
+			// Python keeps the first of several equal values.
+			const int expected = builtin == Builtin::Min ? -1 : 1;
+			const char *op = builtin == Builtin::Min ? "<" : ">";
+			size_t result = 0;
+			for( size_t i = 1; i < numArgs; ++i )
+			{
+				if( order( args[i], args[result], op, expected, false ) )
+				{
+					result = i;
+				}
+			}
+			return args[result];
+		}
+		case Builtin::Round :
+			if( isIntegral( args[0] ) )
+			{
+				return Value::integer( args[0].i );
+			}
+			else if( args[0].type == Value::Type::Float )
+			{
+				// Python rounds half to even, as does `nearbyint()`
+				// in the default rounding mode.
+				return Value::integer( toInteger( std::nearbyint( args[0].f ) ) );
+			}
+			unsupported( fmt::format( "type {} doesn't define __round__ method", typeName( args[0] ) ) );
+		case Builtin::Len :
+			if( args[0].type == Value::Type::String )
+			{
+				// Count code points rather than bytes.
+				int64_t result = 0;
+				for( auto c : args[0].s )
+				{
+					result += ( (unsigned char)c & 0xC0 ) != 0x80;
+				}
+				return Value::integer( result );
+			}
+			else if( args[0].type == Value::Type::Tuple )
+			{
+				return Value::integer( args[0].members->size() );
+			}
+			unsupported( fmt::format( "object of type '{}' has no len()", typeName( args[0] ) ) );
+	}
+	unsupported( "Unknown builtin" );
+}
+
+enum class Method
+{
+	Format,
+	Upper,
+	Lower,
+	Strip,
+	LStrip,
+	RStrip,
+	Replace,
+	ZFill,
+	StartsWith,
+	EndsWith
+};
+
+const std::unordered_map<std::string, FunctionDescription> &methods()
+{
+	static const size_t g_unlimited = std::numeric_limits<size_t>::max();
+	static const std::unordered_map<std::string, FunctionDescription> g_methods = {
+		{ "format", { (int)Method::Format, 0, g_unlimited } },
+		{ "upper", { (int)Method::Upper, 0, 0 } },
+		{ "lower", { (int)Method::Lower, 0, 0 } },
+		{ "strip", { (int)Method::Strip, 0, 1 } },
+		{ "lstrip", { (int)Method::LStrip, 0, 1 } },
+		{ "rstrip", { (int)Method::RStrip, 0, 1 } },
+		{ "replace", { (int)Method::Replace, 2, 2 } },
+		{ "zfill", { (int)Method::ZFill, 1, 1 } },
+		{ "startswith", { (int)Method::StartsWith, 1, 1 } },
+		{ "endswith", { (int)Method::EndsWith, 1, 1 } },
+	};
+	return g_methods;
+}
+
+const std::string &stringArgument( const Value *args, size_t index )
+{
+	if( args[index].type != Value::Type::String )
+	{
+		unsupported( fmt::format( "Expected str argument, not {}", typeName( args[index] ) ) );
+	}
+	return args[index].s;
+}
+
+Value callMethod( Method method, const Value &self, const Value *args, size_t numArgs )
+{
+	if( self.type != Value::Type::String )
+	{
+		unsupported( fmt::format( "Method call on {}", typeName( self ) ) );
+	}
+
+	const std::string &s = self.s;
+	switch( method )
+	{
+		case Method::Format :
+			return Value::string( strFormat( s, args, numArgs ) );
+		case Method::Upper :
+		case Method::Lower : {
+			// Python's case conversion is Unicode-aware.
+			if( !isASCII( s ) )
+			{
+				unsupported( "Case conversion of non-ASCII string" );
+			}
+			std::string result = s;
+			for( auto &c : result )
+			{
+				c = method == Method::Upper ? toupper( c ) : tolower( c );
+			}
+			return Value::string( result );
+		}
+		case Method::Strip :
+		case Method::LStrip :
+		case Method::RStrip : {
+			const bool left = method != Method::RStrip;
+			const bool right = method != Method::LStrip;
+			if( numArgs )
+			{
+				const std::string &chars = stringArgument( args, 0 );
+				if( !isASCII( chars ) )
+				{
+					unsupported( "Stripping non-ASCII characters" );
+				}
+				return Value::string( strip( s, chars.c_str(), left, right ) );
+			}
+			// Python also strips Unicode whitespace, so we can only
+			// support strings which don't start or end with non-ASCII
+			// characters.
+			if( !s.empty() && ( ( left && (unsigned char)s.front() >= 0x80 ) || ( right && (unsigned char)s.back() >= 0x80 ) ) )
+			{
+				unsupported( "Stripping non-ASCII string" );
+			}
+			return Value::string( strip( s, g_whitespace, left, right ) );
+		}
+		case Method::Replace : {
+			const std::string &oldString = stringArgument( args, 0 );
+			const std::string &newString = stringArgument( args, 1 );
+			if( oldString.empty() )
+			{
+				unsupported( "Replacement of empty string" );
+			}
+			std::string result;
+			size_t pos = 0;
+			while( true )
+			{
+				const size_t next = s.find( oldString, pos );
+				result.append( s, pos, next == std::string::npos ? std::string::npos : next - pos );
+				if( next == std::string::npos )
+				{
+					break;
+				}
+				result += newString;
+				pos = next + oldString.size();
+			}
+			return Value::string( result );
+		}
+		case Method::ZFill : {
+			if( !isIntegral( args[0] ) )
+			{
+				unsupported( fmt::format( "zfill() argument must be int, not {}", typeName( args[0] ) ) );
+			}
+			if( !isASCII( s ) )
+			{
+				unsupported( "zfill() of non-ASCII string" );
+			}
+			if( args[0].i <= (int64_t)s.size() )
+			{
+				return self;
+			}
+			if( args[0].i > ( 1 << 24 ) )
+			{
+				unsupported( "zfill() width too large" );
+			}
+			std::string result = std::string( args[0].i - s.size(), '0' ) + s;
+			if( !s.empty() && ( s[0] == '+' || s[0] == '-' ) )
+			{
+				// Move sign to the front.
+				result[0] = s[0];
+				result[args[0].i - s.size()] = '0';
+			}
+			return Value::string( result );
+		}
+		case Method::StartsWith : {
+			const std::string &prefix = stringArgument( args, 0 );
+			return Value::boolean( s.compare( 0, prefix.size(), prefix ) == 0 && s.size() >= prefix.size() );
+		}
+		case Method::EndsWith : {
+			const std::string &suffix = stringArgument( args, 0 );
+			return Value::boolean( s.size() >= suffix.size() && s.compare( s.size() - suffix.size(), suffix.size(), suffix ) == 0 );
+		}
+	}
+	unsupported( "Unknown method" );
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Plug access
+//////////////////////////////////////////////////////////////////////////
+
+bool supportedPlug( const ValuePlug *plug )
+{
+	switch( (Gaffer::TypeId)plug->typeId() )
+	{
+		case BoolPlugTypeId :
+		case IntPlugTypeId :
+		case FloatPlugTypeId :
+		case StringPlugTypeId :
+		case V2iPlugTypeId :
+		case V3iPlugTypeId :
+		case V2fPlugTypeId :
+		case V3fPlugTypeId :
+		case Color3fPlugTypeId :
+		case Color4fPlugTypeId :
+			return true;
+		default :
+			return false;
+	}
+}
+
+Value plugValue( const ValuePlug *plug )
+{
+	switch( (Gaffer::TypeId)plug->typeId() )
+	{
+		case BoolPlugTypeId :
+			return Value::boolean( static_cast<const BoolPlug *>( plug )->getValue() );
+		case IntPlugTypeId :
+			return Value::integer( static_cast<const IntPlug *>( plug )->getValue() );
+		case FloatPlugTypeId :
+			return Value::number( static_cast<const FloatPlug *>( plug )->getValue() );
+		case StringPlugTypeId :
+			return Value::string( static_cast<const StringPlug *>( plug )->getValue() );
+		default :
+			return Value::data( PlugAlgo::getValueAsData( plug ).get() );
+	}
+}
+
+ObjectPtr toObject( const Value &v )
+{
+	switch( v.type )
+	{
+		case Value::Type::Bool :
+			return new BoolData( v.i );
+		case Value::Type::Int :
+			if( v.i < std::numeric_limits<int>::min() || v.i > std::numeric_limits<int>::max() )
+			{
+				unsupported( "Integer result out of range" );
+			}
+			return new IntData( v.i );
+		case Value::Type::Float :
+			return new DoubleData( v.f );
+		case Value::Type::String :
+			return new StringData( v.s );
+		case Value::Type::Data :
+			return const_cast<Data *>( v.d.get() );
+		default :
+			unsupported( fmt::format( "Unsupported type for result \"{}\"", typeName( v ) ) );
+	}
+}
+
+// Returns the data type which the Python engine would produce for
+// a compound plug.
+IECore::TypeId compoundDataType( const ValuePlug *plug )
+{
+	switch( (Gaffer::TypeId)plug->typeId() )
+	{
+		case V2iPlugTypeId : return V2iDataTypeId;
+		case V3iPlugTypeId : return V3iDataTypeId;
+		case V2fPlugTypeId : return V2fDataTypeId;
+		case V3fPlugTypeId : return V3fDataTypeId;
+		case Color3fPlugTypeId : return Color3fDataTypeId;
+		case Color4fPlugTypeId : return Color4fDataTypeId;
+		default : return InvalidTypeId;
+	}
+}
+
+bool applyValue( ValuePlug *plug, const ValuePlug *topLevelPlug, const Data *data )
+{
+	const IECore::TypeId dataType = (IECore::TypeId)data->typeId();
+	switch( (Gaffer::TypeId)plug->typeId() )
+	{
+		case BoolPlugTypeId :
+			if( plug == topLevelPlug && dataType == BoolDataTypeId )
+			{
+				static_cast<BoolPlug *>( plug )->setValue( static_cast<const BoolData *>( data )->readable() );
+				return true;
+			}
+			return false;
+		case StringPlugTypeId :
+			if( plug == topLevelPlug && dataType == StringDataTypeId )
+			{
+				static_cast<StringPlug *>( plug )->setValue( static_cast<const StringData *>( data )->readable() );
+				return true;
+			}
+			return false;
+		case IntPlugTypeId :
+		case FloatPlugTypeId : {
+			if( plug != topLevelPlug )
+			{
+				// Child of a compound plug.
+				return dataType == compoundDataType( topLevelPlug ) && PlugAlgo::setValueFromData( topLevelPlug, plug, data );
+			}
+			double value;
+			switch( dataType )
+			{
+				case BoolDataTypeId : value = static_cast<const BoolData *>( data )->readable(); break;
+				case IntDataTypeId : value = static_cast<const IntData *>( data )->readable(); break;
+				case DoubleDataTypeId : value = static_cast<const DoubleData *>( data )->readable(); break;
+				default : return false;
+			}
+			if( plug->typeId() == FloatPlugTypeId )
+			{
+				static_cast<FloatPlug *>( plug )->setValue( value );
+			}
+			else
+			{
+				// Python truncates with `int()`.
+				if( !std::isfinite( value ) || std::fabs( value ) >= 2147483648.0 )
+				{
+					return false;
+				}
+				static_cast<IntPlug *>( plug )->setValue( (int)value );
+			}
+			return true;
+		}
+		default :
+			return false;
+	}
+}
+
+std::string join( const std::vector<std::string> &path )
+{
+	std::string result;
+	for( const auto &n : path )
+	{
+		if( !result.empty() )
+		{
+			result += ".";
+		}
+		result += n;
+	}
+	return result;
+}
+
+std::string plugIdentifier( const Expression *node, const ValuePlug *plug )
+{
+	const GraphComponent *ancestor = node->isAncestorOf( plug ) ? static_cast<const GraphComponent *>( node ) : node->parent();
+	std::string result = "parent";
+	const std::string relativeName = plug->relativeName( ancestor );
+	size_t start = 0;
+	while( true )
+	{
+		const size_t end = relativeName.find( '.', start );
+		result += "[\"" + relativeName.substr( start, end == std::string::npos ? std::string::npos : end - start ) + "\"]";
+		if( end == std::string::npos )
+		{
+			break;
+		}
+		start = end + 1;
+	}
+	return result;
+}
+
+// Equivalent to Python's `repr()` for strings.
+std::string stringRepr( const std::string &s )
+{
+	const char quote = ( s.find( '\'' ) != std::string::npos && s.find( '"' ) == std::string::npos ) ? '"' : '\'';
+	std::string result( 1, quote );
+	for( auto c : s )
+	{
+		switch( c )
+		{
+			case '\\' : result += "\\\\"; break;
+			case '\n' : result += "\\n"; break;
+			case '\r' : result += "\\r"; break;
+			case '\t' : result += "\\t"; break;
+			default :
+				if( c == quote )
+				{
+					result += '\\';
+					result += c;
+				}
+				else if( (unsigned char)c < 0x20 || c == 0x7f )
+				{
+					result += fmt::format( "\\x{:02x}", (unsigned char)c );
+				}
+				else
+				{
+					result += c;
+				}
+		}
+	}
+	result += quote;
+	return result;
+}
+
+// Returns a literal for the default value of the plug, for use when
+// an input has been disconnected.
+std::string defaultValueLiteral( const ValuePlug *plug )
+{
+	switch( (Gaffer::TypeId)plug->typeId() )
+	{
+		case BoolPlugTypeId :
+			return static_cast<const BoolPlug *>( plug )->defaultValue() ? "True" : "False";
+		case IntPlugTypeId :
+			return std::to_string( static_cast<const IntPlug *>( plug )->defaultValue() );
+		case FloatPlugTypeId :
+			return floatToString( static_cast<const FloatPlug *>( plug )->defaultValue() );
+		case StringPlugTypeId :
+			return stringRepr( static_cast<const StringPlug *>( plug )->defaultValue() );
+		default :
+			// Compound values can't be expressed in the language.
+			return "None";
+	}
+}
+
+// Replaces all occurrences of `identifier`, accepting either quote
+// character wherever it contains `"`. This matches the regex used by
+// the Python engine.
+std::string replaceIdentifier( const std::string &expression, const std::string &identifier, const std::string &replacement )
+{
+	std::string result;
+	size_t i = 0;
+	while( i < expression.size() )
+	{
+		size_t j = 0;
+		while(
+			j < identifier.size() && i + j < expression.size() &&
+			(
+				expression[i+j] == identifier[j] ||
+				( identifier[j] == '"' && expression[i+j] == '\'' )
+			)
+		)
+		{
+			j++;
+		}
+
+		if( j == identifier.size() )
+		{
+			result += replacement;
+			i += j;
+		}
+		else
+		{
+			result += expression[i++];
+		}
+	}
+	return result;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Bytecode
+//////////////////////////////////////////////////////////////////////////
+
+enum class OpCode : uint8_t
+{
+	// Loads and stores
+	Constant,
+	Input,
+	LoadLocal,
+	StoreLocal,
+	StoreOutput,
+	Pop,
+	// Context access
+	ContextGet,
+	ContextGetDefault,
+	ContextContains,
+	Frame,
+	Time,
+	FramesPerSecond,
+	// Operators
+	Negate,
+	Positive,
+	Not,
+	Add,
+	Subtract,
+	Multiply,
+	Divide,
+	FloorDivide,
+	Modulo,
+	Power,
+	Equal,
+	NotEqual,
+	Less,
+	LessEqual,
+	Greater,
+	GreaterEqual,
+	In,
+	NotIn,
+	// Control flow. Offsets are relative to the next instruction.
+	Jump,
+	JumpIfFalse,
+	JumpIfFalseOrPop,
+	JumpIfTrueOrPop,
+	// Calls
+	CallBuiltin,
+	CallMethod,
+	// Miscellaneous
+	Component,
+	Index,
+	BuildTuple,
+	FormatValue,
+	BuildString
+};
+
+struct Instruction
+{
+	OpCode op;
+	int32_t a;
+	int32_t b;
+};
+
+struct Bytecode
+{
+
+	std::vector<Instruction> code;
+	std::vector<Value> constants;
+	std::vector<InternedString> contextNames;
+	std::vector<std::string> localNames;
+	size_t numOutputs = 0;
+
+	ConstObjectVectorPtr execute( const Context *context, const std::vector<const ValuePlug *> &proxyInputs ) const
+	{
+		std::vector<Value> inputs;
+		inputs.reserve( proxyInputs.size() );
+		for( const auto &plug : proxyInputs )
+		{
+			inputs.push_back( plugValue( plug ) );
+		}
+
+		std::vector<Value> locals( localNames.size() );
+		std::vector<char> localsAssigned( localNames.size(), false );
+		std::vector<Value> outputs( numOutputs );
+		std::vector<char> outputsAssigned( numOutputs, false );
+		std::vector<Value> stack;
+		stack.reserve( 16 );
+
+		try
+		{
+			for( size_t pc = 0, e = code.size(); pc < e; )
+			{
+				const Instruction &instruction = code[pc++];
+				switch( instruction.op )
+				{
+					case OpCode::Constant :
+						stack.push_back( constants[instruction.a] );
+						break;
+					case OpCode::Input :
+						stack.push_back( inputs[instruction.a] );
+						break;
+					case OpCode::LoadLocal :
+						if( !localsAssigned[instruction.a] )
+						{
+							unsupported( fmt::format( "name '{}' is not defined", localNames[instruction.a] ) );
+						}
+						stack.push_back( locals[instruction.a] );
+						break;
+					case OpCode::StoreLocal :
+						locals[instruction.a] = std::move( stack.back() );
+						localsAssigned[instruction.a] = true;
+						stack.pop_back();
+						break;
+					case OpCode::StoreOutput :
+						outputs[instruction.a] = std::move( stack.back() );
+						outputsAssigned[instruction.a] = true;
+						stack.pop_back();
+						break;
+					case OpCode::Pop :
+						stack.pop_back();
+						break;
+					case OpCode::ContextGet : {
+						ConstDataPtr d = context->getAsData( contextNames[instruction.a], nullptr );
+						if( d )
+						{
+							stack.push_back( Value::data( d.get() ) );
+						}
+						else if( instruction.b )
+						{
+							// `context.get()` returns None by default.
+							stack.push_back( Value() );
+						}
+						else
+						{
+							unsupported( fmt::format( "Context has no variable named \"{}\"", contextNames[instruction.a].string() ) );
+						}
+						break;
+					}
+					case OpCode::ContextGetDefault : {
+						ConstDataPtr d = context->getAsData( contextNames[instruction.a], nullptr );
+						if( d )
+						{
+							stack.back() = Value::data( d.get() );
+						}
+						break;
+					}
+					case OpCode::ContextContains :
+						stack.push_back( Value::boolean( context->variableHash( contextNames[instruction.a] ) != MurmurHash() ) );
+						break;
+					case OpCode::Frame :
+						stack.push_back( Value::number( context->getFrame() ) );
+						break;
+					case OpCode::Time :
+						stack.push_back( Value::number( context->getTime() ) );
+						break;
+					case OpCode::FramesPerSecond :
+						stack.push_back( Value::number( context->getFramesPerSecond() ) );
+						break;
+					case OpCode::Negate :
+						stack.back() = negate( stack.back() );
+						break;
+					case OpCode::Positive :
+						stack.back() = positive( stack.back() );
+						break;
+					case OpCode::Not :
+						stack.back() = Value::boolean( !truthy( stack.back() ) );
+						break;
+					case OpCode::Add :
+					case OpCode::Subtract :
+					case OpCode::Multiply :
+					case OpCode::Divide :
+					case OpCode::FloorDivide :
+					case OpCode::Modulo :
+					case OpCode::Power :
+					case OpCode::Equal :
+					case OpCode::NotEqual :
+					case OpCode::Less :
+					case OpCode::LessEqual :
+					case OpCode::Greater :
+					case OpCode::GreaterEqual :
+					case OpCode::In :
+					case OpCode::NotIn : {
+						const Value b = std::move( stack.back() );
+						stack.pop_back();
+						Value &a = stack.back();
+						a = binaryOperation( instruction.op, a, b );
+						break;
+					}
+					case OpCode::Jump :
+						pc += instruction.a;
+						break;
+					case OpCode::JumpIfFalse : {
+						const bool t = truthy( stack.back() );
+						stack.pop_back();
+						if( !t )
+						{
+							pc += instruction.a;
+						}
+						break;
+					}
+					case OpCode::JumpIfFalseOrPop :
+						if( !truthy( stack.back() ) )
+						{
+							pc += instruction.a;
+						}
+						else
+						{
+							stack.pop_back();
+						}
+						break;
+					case OpCode::JumpIfTrueOrPop :
+						if( truthy( stack.back() ) )
+						{
+							pc += instruction.a;
+						}
+						else
+						{
+							stack.pop_back();
+						}
+						break;
+					case OpCode::CallBuiltin : {
+						const size_t first = stack.size() - instruction.b;
+						Value result = callBuiltin( (Builtin)instruction.a, stack.data() + first, instruction.b );
+						stack.resize( first );
+						stack.push_back( std::move( result ) );
+						break;
+					}
+					case OpCode::CallMethod : {
+						const size_t first = stack.size() - instruction.b;
+						Value result = callMethod( (Method)instruction.a, stack[first-1], stack.data() + first, instruction.b );
+						stack.resize( first - 1 );
+						stack.push_back( std::move( result ) );
+						break;
+					}
+					case OpCode::Component :
+						stack.back() = component( stack.back(), instruction.a, (ComponentFamily)instruction.b );
+						break;
+					case OpCode::Index : {
+						const Value i = std::move( stack.back() );
+						stack.pop_back();
+						stack.back() = subscript( stack.back(), i );
+						break;
+					}
+					case OpCode::BuildTuple : {
+						const size_t first = stack.size() - instruction.a;
+						std::vector<Value> members(
+							std::make_move_iterator( stack.begin() + first ),
+							std::make_move_iterator( stack.end() )
+						);
+						stack.resize( first );
+						stack.push_back( Value::tuple( std::move( members ) ) );
+						break;
+					}
+					case OpCode::FormatValue :
+						stack.back() = Value::string( formatValue( stack.back(), constants[instruction.a].s ) );
+						break;
+					case OpCode::BuildString : {
+						const size_t first = stack.size() - instruction.a;
+						std::string result;
+						for( size_t i = first; i < stack.size(); ++i )
+						{
+							result += stack[i].s;
+						}
+						stack.resize( first );
+						stack.push_back( Value::string( std::move( result ) ) );
+						break;
+					}
+				}
+			}
+		}
+		catch( const NativeExpressionEngine::UnsupportedOperation & )
+		{
+			throw;
+		}
+		catch( const std::exception &e )
+		{
+			// Errors from the Context or plugs. Let the caller decide
+			// how to report them.
+			unsupported( e.what() );
+		}
+
+		ObjectVectorPtr result = new ObjectVector;
+		result->members().reserve( numOutputs );
+		for( size_t i = 0; i < numOutputs; ++i )
+		{
+			if( outputsAssigned[i] )
+			{
+				result->members().push_back( toObject( outputs[i] ) );
+			}
+			else
+			{
+				// Signifies that the expression didn't provide a value.
+				result->members().push_back( NullObject::defaultNullObject() );
+			}
+		}
+
+		return result;
+	}
+
+	private :
+
+		static Value binaryOperation( OpCode op, const Value &a, const Value &b )
+		{
+			switch( op )
+			{
+				case OpCode::Add : return add( a, b );
+				case OpCode::Subtract : return subtract( a, b );
+				case OpCode::Multiply : return multiply( a, b );
+				case OpCode::Divide : return divide( a, b );
+				case OpCode::FloorDivide : return floorDivide( a, b );
+				case OpCode::Modulo : return modulo( a, b );
+				case OpCode::Power : return power( a, b );
+				case OpCode::Equal : return Value::boolean( equal( a, b ) );
+				case OpCode::NotEqual : return Value::boolean( !equal( a, b ) );
+				case OpCode::Less : return Value::boolean( order( a, b, "<", -1, false ) );
+				case OpCode::LessEqual : return Value::boolean( order( a, b, "<=", -1, true ) );
+				case OpCode::Greater : return Value::boolean( order( a, b, ">", 1, false ) );
+				case OpCode::GreaterEqual : return Value::boolean( order( a, b, ">=", 1, true ) );
+				case OpCode::In : return Value::boolean( contains( b, a ) );
+				case OpCode::NotIn : return Value::boolean( !contains( b, a ) );
+				default : unsupported( "Unknown operation" );
+			}
+		}
+
+};
+
+//////////////////////////////////////////////////////////////////////////
+// Lexer
+//////////////////////////////////////////////////////////////////////////
+
+struct Token
+{
+	enum class Type
+	{
+		Name,
+		Int,
+		Float,
+		String,
+		FormattedString,
+		Operator,
+		Newline,
+		Indent,
+		Dedent,
+		End
+	};
+
+	Type type;
+	// Name, operator or string contents.
+	std::string text;
+	int64_t i;
+	double f;
+	int line;
+};
+
+[[noreturn]] void syntaxError( int line, const std::string &message )
+{
+	throw IECore::Exception( fmt::format( "Line {} : {}", line, message ) );
+}
+
+void appendUTF8( std::string &s, uint32_t codePoint, int line )
+{
+	if( codePoint < 0x80 )
+	{
+		s += (char)codePoint;
+	}
+	else if( codePoint < 0x800 )
+	{
+		s += (char)( 0xC0 | ( codePoint >> 6 ) );
+		s += (char)( 0x80 | ( codePoint & 0x3F ) );
+	}
+	else if( codePoint < 0x10000 )
+	{
+		if( codePoint >= 0xD800 && codePoint <= 0xDFFF )
+		{
+			syntaxError( line, "Surrogate code points are not supported" );
+		}
+		s += (char)( 0xE0 | ( codePoint >> 12 ) );
+		s += (char)( 0x80 | ( ( codePoint >> 6 ) & 0x3F ) );
+		s += (char)( 0x80 | ( codePoint & 0x3F ) );
+	}
+	else if( codePoint < 0x110000 )
+	{
+		s += (char)( 0xF0 | ( codePoint >> 18 ) );
+		s += (char)( 0x80 | ( ( codePoint >> 12 ) & 0x3F ) );
+		s += (char)( 0x80 | ( ( codePoint >> 6 ) & 0x3F ) );
+		s += (char)( 0x80 | ( codePoint & 0x3F ) );
+	}
+	else
+	{
+		syntaxError( line, "Invalid code point" );
+	}
+}
+
+bool isNameStart( char c )
+{
+	return isalpha( (unsigned char)c ) || c == '_';
+}
+
+bool isNameCharacter( char c )
+{
+	return isalnum( (unsigned char)c ) || c == '_';
+}
+
+class Lexer
+{
+
+	public :
+
+		// If `expressionOnly` is true, the source is treated as a single
+		// expression without statements, as for the replacement fields
+		// in f-strings.
+		Lexer( const std::string &source, int line, bool expressionOnly )
+			:	m_source( source ), m_pos( 0 ), m_line( line ), m_depth( expressionOnly ? 1 : 0 ), m_expressionOnly( expressionOnly )
+		{
+		}
+
+		std::vector<Token> tokenize()
+		{
+			std::vector<std::string> indents = { "" };
+			bool lineStart = !m_expressionOnly;
+
+			while( m_pos < m_source.size() )
+			{
+				if( lineStart )
+				{
+					lineStart = false;
+					if( !indentation( indents ) )
+					{
+						lineStart = true;
+					}
+					continue;
+				}
+
+				const char c = m_source[m_pos];
+				if( c == '\n' )
+				{
+					if( m_depth == 0 )
+					{
+						emit( Token::Type::Newline );
+						lineStart = true;
+					}
+					m_line++;
+					m_pos++;
+				}
+				else if( c == ' ' || c == '\t' || c == '\r' || c == '\f' )
+				{
+					m_pos++;
+				}
+				else if( c == '#' )
+				{
+					while( m_pos < m_source.size() && m_source[m_pos] != '\n' )
+					{
+						m_pos++;
+					}
+				}
+				else if( c == '\\' )
+				{
+					// Explicit line joining.
+					size_t next = m_pos + 1;
+					if( next < m_source.size() && m_source[next] == '\r' )
+					{
+						next++;
+					}
+					if( next >= m_source.size() || m_source[next] != '\n' )
+					{
+						syntaxError( m_line, "Unexpected character after line continuation character" );
+					}
+					m_pos = next + 1;
+					m_line++;
+				}
+				else if( isNameStart( c ) )
+				{
+					name();
+				}
+				else if( isdigit( (unsigned char)c ) || ( c == '.' && m_pos + 1 < m_source.size() && isdigit( (unsigned char)m_source[m_pos+1] ) ) )
+				{
+					number();
+				}
+				else if( c == '"' || c == '\'' )
+				{
+					string( false, false );
+				}
+				else
+				{
+					op();
+				}
+			}
+
+			if( m_depth != ( m_expressionOnly ? 1 : 0 ) )
+			{
+				syntaxError( m_line, "Unexpected end of expression" );
+			}
+
+			if( !m_expressionOnly )
+			{
+				if( !m_tokens.empty() && m_tokens.back().type != Token::Type::Newline )
+				{
+					emit( Token::Type::Newline );
+				}
+				while( indents.size() > 1 )
+				{
+					indents.pop_back();
+					emit( Token::Type::Dedent );
+				}
+			}
+			emit( Token::Type::End );
+
+			return m_tokens;
+		}
+
+	private :
+
+		Token &emit( Token::Type type, const std::string &text = std::string() )
+		{
+			m_tokens.push_back( { type, text, 0, 0.0, m_line } );
+			return m_tokens.back();
+		}
+
+		// Processes the indentation at the start of a line, returning
+		// false if the line is blank.
+		bool indentation( std::vector<std::string> &indents )
+		{
+			size_t end = m_pos;
+			while( end < m_source.size() && ( m_source[end] == ' ' || m_source[end] == '\t' || m_source[end] == '\f' ) )
+			{
+				end++;
+			}
+
+			if( end == m_source.size() )
+			{
+				m_pos = end;
+				return false;
+			}
+			else if( m_source[end] == '\n' || m_source[end] == '\r' || m_source[end] == '#' )
+			{
+				while( end < m_source.size() && m_source[end] != '\n' )
+				{
+					end++;
+				}
+				m_pos = end + 1;
+				m_line++;
+				return false;
+			}
+
+			const std::string indent = m_source.substr( m_pos, end - m_pos );
+			m_pos = end;
+			if( indent == indents.back() )
+			{
+				return true;
+			}
+
+			if( indent.size() > indents.back().size() && indent.compare( 0, indents.back().size(), indents.back() ) == 0 )
+			{
+				indents.push_back( indent );
+				emit( Token::Type::Indent );
+				return true;
+			}
+
+			while( indents.size() > 1 && indents.back() != indent )
+			{
+				indents.pop_back();
+				emit( Token::Type::Dedent );
+			}
+			if( indents.back() != indent )
+			{
+				syntaxError( m_line, "Inconsistent indentation" );
+			}
+			return true;
+		}
+
+		void name()
+		{
+			const size_t start = m_pos;
+			while( m_pos < m_source.size() && isNameCharacter( m_source[m_pos] ) )
+			{
+				m_pos++;
+			}
+			std::string text = m_source.substr( start, m_pos - start );
+
+			if( m_pos < m_source.size() && ( m_source[m_pos] == '"' || m_source[m_pos] == '\'' ) && text.size() <= 2 )
+			{
+				// String prefix.
+				std::string prefix = text;
+				for( auto &c : prefix )
+				{
+					c = tolower( c );
+				}
+				if( prefix == "r" || prefix == "u" )
+				{
+					string( prefix == "r", false );
+					return;
+				}
+				else if( prefix == "f" )
+				{
+					string( false, true );
+					return;
+				}
+				else if( prefix == "rf" || prefix == "fr" )
+				{
+					string( true, true );
+					return;
+				}
+				else if( prefix == "b" || prefix == "br" || prefix == "rb" )
+				{
+					syntaxError( m_line, "Bytes are not supported" );
+				}
+			}
+
+			emit( Token::Type::Name, text );
+		}
+
+		void number()
+		{
+			const size_t start = m_pos;
+			const std::string &s = m_source;
+
+			if( s[m_pos] == '0' && m_pos + 1 < s.size() && s[m_pos+1] && strchr( "xXoObB", s[m_pos+1] ) )
+			{
+				const char prefix = tolower( s[m_pos+1] );
+				const int base = prefix == 'x' ? 16 : ( prefix == 'o' ? 8 : 2 );
+				m_pos += 2;
+				int64_t value = 0;
+				bool digits = false;
+				while( m_pos < s.size() && ( isalnum( (unsigned char)s[m_pos] ) || s[m_pos] == '_' ) )
+				{
+					const char c = tolower( s[m_pos++] );
+					if( c == '_' )
+					{
+						continue;
+					}
+					const int digit = isdigit( (unsigned char)c ) ? c - '0' : ( c >= 'a' && c <= 'f' ? c - 'a' + 10 : 99 );
+					if( digit >= base )
+					{
+						syntaxError( m_line, fmt::format( "Invalid digit '{}' in integer literal", c ) );
+					}
+					if( __builtin_mul_overflow( value, (int64_t)base, &value ) || __builtin_add_overflow( value, (int64_t)digit, &value ) )
+					{
+						syntaxError( m_line, "Integer literal is too large" );
+					}
+					digits = true;
+				}
+				if( !digits )
+				{
+					syntaxError( m_line, "Invalid integer literal" );
+				}
+				emit( Token::Type::Int, s.substr( start, m_pos - start ) ).i = value;
+				return;
+			}
+
+			auto digits = [&] {
+				while( m_pos < s.size() && ( isdigit( (unsigned char)s[m_pos] ) || s[m_pos] == '_' ) )
+				{
+					m_pos++;
+				}
+			};
+
+			bool isFloat = false;
+			digits();
+			if( m_pos < s.size() && s[m_pos] == '.' )
+			{
+				isFloat = true;
+				m_pos++;
+				digits();
+			}
+			if( m_pos < s.size() && ( s[m_pos] == 'e' || s[m_pos] == 'E' ) )
+			{
+				isFloat = true;
+				m_pos++;
+				if( m_pos < s.size() && ( s[m_pos] == '+' || s[m_pos] == '-' ) )
+				{
+					m_pos++;
+				}
+				if( m_pos >= s.size() || !isdigit( (unsigned char)s[m_pos] ) )
+				{
+					syntaxError( m_line, "Invalid float literal" );
+				}
+				digits();
+			}
+			if( m_pos < s.size() && isNameCharacter( s[m_pos] ) )
+			{
+				syntaxError( m_line, "Invalid numeric literal" );
+			}
+
+			const std::string text = s.substr( start, m_pos - start );
+			std::string stripped;
+			for( auto c : text )
+			{
+				if( c != '_' )
+				{
+					stripped += c;
+				}
+			}
+
+			if( isFloat )
+			{
+				emit( Token::Type::Float, text ).f = strtod( stripped.c_str(), nullptr );
+				return;
+			}
+
+			if( stripped.size() > 1 && stripped[0] == '0' && stripped.find_first_not_of( '0' ) != std::string::npos )
+			{
+				syntaxError( m_line, "Leading zeros in decimal integer literals are not permitted" );
+			}
+
+			int64_t value = 0;
+			for( auto c : stripped )
+			{
+				if( __builtin_mul_overflow( value, (int64_t)10, &value ) || __builtin_add_overflow( value, (int64_t)( c - '0' ), &value ) )
+				{
+					syntaxError( m_line, "Integer literal is too large" );
+				}
+			}
+			emit( Token::Type::Int, text ).i = value;
+		}
+
+		void string( bool raw, bool formatted )
+		{
+			const std::string &s = m_source;
+			const char quote = s[m_pos];
+			const bool triple = m_pos + 2 < s.size() && s[m_pos+1] == quote && s[m_pos+2] == quote;
+			m_pos += triple ? 3 : 1;
+
+			const int startLine = m_line;
+			std::string value;
+			while( true )
+			{
+				if( m_pos >= s.size() )
+				{
+					syntaxError( startLine, "Unterminated string literal" );
+				}
+
+				const char c = s[m_pos];
+				if( c == quote )
+				{
+					if( !triple )
+					{
+						m_pos++;
+						break;
+					}
+					else if( m_pos + 2 < s.size() && s[m_pos+1] == quote && s[m_pos+2] == quote )
+					{
+						m_pos += 3;
+						break;
+					}
+				}
+				else if( c == '\n' )
+				{
+					if( !triple )
+					{
+						syntaxError( startLine, "Unterminated string literal" );
+					}
+					m_line++;
+				}
+				else if( c == '\\' )
+				{
+					if( formatted )
+					{
+						// The replacement fields would need unescaped
+						// source, so we don't support this at all.
+						syntaxError( m_line, "Backslashes in f-strings are not supported" );
+					}
+					if( m_pos + 1 >= s.size() )
+					{
+						syntaxError( startLine, "Unterminated string literal" );
+					}
+					if( raw )
+					{
+						value += c;
+						value += s[m_pos+1];
+						m_line += s[m_pos+1] == '\n';
+						m_pos += 2;
+					}
+					else
+					{
+						m_pos++;
+						escape( value );
+					}
+					continue;
+				}
+
+				value += c;
+				m_pos++;
+			}
+
+			emit( formatted ? Token::Type::FormattedString : Token::Type::String, value );
+		}
+
+		uint32_t hexDigits( size_t count )
+		{
+			uint32_t result = 0;
+			for( size_t i = 0; i < count; ++i )
+			{
+				const char c = m_pos < m_source.size() ? tolower( m_source[m_pos] ) : 0;
+				if( !isxdigit( (unsigned char)c ) )
+				{
+					syntaxError( m_line, "Truncated escape sequence" );
+				}
+				result = result * 16 + ( isdigit( (unsigned char)c ) ? c - '0' : c - 'a' + 10 );
+				m_pos++;
+			}
+			return result;
+		}
+
+		// Processes the escape sequence following a backslash.
+		void escape( std::string &value )
+		{
+			const char c = m_source[m_pos++];
+			switch( c )
+			{
+				case '\n' : m_line++; break;
+				case '\\' : value += '\\'; break;
+				case '\'' : value += '\''; break;
+				case '"' : value += '"'; break;
+				case 'a' : value += '\a'; break;
+				case 'b' : value += '\b'; break;
+				case 'f' : value += '\f'; break;
+				case 'n' : value += '\n'; break;
+				case 'r' : value += '\r'; break;
+				case 't' : value += '\t'; break;
+				case 'v' : value += '\v'; break;
+				case 'x' : appendUTF8( value, hexDigits( 2 ), m_line ); break;
+				case 'u' : appendUTF8( value, hexDigits( 4 ), m_line ); break;
+				case 'U' : appendUTF8( value, hexDigits( 8 ), m_line ); break;
+				case 'N' : syntaxError( m_line, "Named unicode escapes are not supported" );
+				default :
+					if( c >= '0' && c <= '7' )
+					{
+						uint32_t codePoint = c - '0';
+						for( int i = 0; i < 2 && m_pos < m_source.size() && m_source[m_pos] >= '0' && m_source[m_pos] <= '7'; ++i )
+						{
+							codePoint = codePoint * 8 + ( m_source[m_pos++] - '0' );
+						}
+						appendUTF8( value, codePoint, m_line );
+					}
+					else
+					{
+						// Python preserves unrecognised escapes.
+						value += '\\';
+						value += c;
+						m_line += c == '\n';
+					}
+			}
+		}
+
+		void op()
+		{
+			static const char *g_operators[] = {
+				"**=", "//=", "**", "//", "==", "!=", "<=", ">=",
+				"+=", "-=", "*=", "/=", "%=",
+				"+", "-", "*", "/", "%", "<", ">", "(", ")", "[", "]", ",", ".", ":", ";", "="
+			};
+
+			for( const char *o : g_operators )
+			{
+				const size_t length = strlen( o );
+				if( m_source.compare( m_pos, length, o ) == 0 )
+				{
+					if( length == 1 )
+					{
+						if( *o == '(' || *o == '[' )
+						{
+							m_depth++;
+						}
+						else if( ( *o == ')' || *o == ']' ) && m_depth > 0 )
+						{
+							m_depth--;
+						}
+					}
+					emit( Token::Type::Operator, o );
+					m_pos += length;
+					return;
+				}
+			}
+
+			syntaxError( m_line, fmt::format( "Unsupported character '{}'", m_source[m_pos] ) );
+		}
+
+		const std::string &m_source;
+		size_t m_pos;
+		int m_line;
+		int m_depth;
+		const bool m_expressionOnly;
+		std::vector<Token> m_tokens;
+
+};
+
+//////////////////////////////////////////////////////////////////////////
+// Parser
+//
+// A recursive descent parser for our subset of Python, emitting
+// Bytecode directly. We also determine the plugs and context variables
+// used, in exactly the same way as the Python engine does.
+//////////////////////////////////////////////////////////////////////////
+
+const std::set<std::string> &reservedNames()
+{
+	static const std::set<std::string> g_names = {
+		// Python keywords
+		"False", "None", "True", "and", "as", "assert", "async", "await", "break",
+		"class", "continue", "def", "del", "elif", "else", "except", "finally",
+		"for", "from", "global", "if", "import", "in", "is", "lambda", "nonlocal",
+		"not", "or", "pass", "raise", "return", "try", "while", "with", "yield",
+		// Names provided by the Python engine
+		"parent", "context", "imath", "IECore"
+	};
+	return g_names;
+}
+
+class Parser
+{
+
+	public :
+
+		Parser( Expression *node, const std::string &expression )
+			:	m_node( node ), m_pos( 0 )
+		{
+			m_tokens = Lexer( expression, 1, /* expressionOnly = */ false ).tokenize();
+			while( peek().type != Token::Type::End )
+			{
+				statement();
+			}
+
+			for( size_t i = 0; i < m_localsAssigned.size(); ++i )
+			{
+				if( !m_localsAssigned[i] )
+				{
+					throw IECore::Exception( fmt::format( "Name \"{}\" is not defined", m_bytecode.localNames[i] ) );
+				}
+			}
+
+			sortPlugs();
+		}
+
+		Bytecode bytecode;
+		std::vector<ValuePlug *> inputs;
+		std::vector<ValuePlug *> outputs;
+		std::vector<InternedString> contextVariables;
+
+	private :
+
+		// Token utilities
+		// ===============
+
+		const Token &peek( size_t offset = 0 ) const
+		{
+			return m_tokens[std::min( m_pos + offset, m_tokens.size() - 1 )];
+		}
+
+		Token next()
+		{
+			const Token &result = peek();
+			if( m_pos < m_tokens.size() - 1 )
+			{
+				m_pos++;
+			}
+			return result;
+		}
+
+		static bool isOperator( const Token &token, const char *op )
+		{
+			return token.type == Token::Type::Operator && token.text == op;
+		}
+
+		static bool isKeyword( const Token &token, const char *keyword )
+		{
+			return token.type == Token::Type::Name && token.text == keyword;
+		}
+
+		bool acceptOperator( const char *op )
+		{
+			if( isOperator( peek(), op ) )
+			{
+				m_pos++;
+				return true;
+			}
+			return false;
+		}
+
+		bool acceptKeyword( const char *keyword )
+		{
+			if( isKeyword( peek(), keyword ) )
+			{
+				m_pos++;
+				return true;
+			}
+			return false;
+		}
+
+		void expectOperator( const char *op )
+		{
+			if( !acceptOperator( op ) )
+			{
+				error( fmt::format( "Expected \"{}\" but found {}", op, description( peek() ) ) );
+			}
+		}
+
+		static std::string description( const Token &token )
+		{
+			switch( token.type )
+			{
+				case Token::Type::Newline : return "end of line";
+				case Token::Type::Indent : return "indent";
+				case Token::Type::Dedent : return "dedent";
+				case Token::Type::End : return "end of expression";
+				case Token::Type::String :
+				case Token::Type::FormattedString : return "string";
+				default : return "\"" + token.text + "\"";
+			}
+		}
+
+		[[noreturn]] void error( const std::string &message ) const
+		{
+			syntaxError( peek().line, message );
+		}
+
+		// Code generation
+		// ===============
+
+		size_t emit( OpCode op, int32_t a = 0, int32_t b = 0 )
+		{
+			m_bytecode.code.push_back( { op, a, b } );
+			return m_bytecode.code.size() - 1;
+		}
+
+		void patchJump( size_t jump )
+		{
+			m_bytecode.code[jump].a = m_bytecode.code.size() - ( jump + 1 );
+		}
+
+		int32_t constant( const Value &value )
+		{
+			m_bytecode.constants.push_back( value );
+			return m_bytecode.constants.size() - 1;
+		}
+
+		int32_t contextName( const std::string &name )
+		{
+			m_contextReads.insert( name );
+			const InternedString internedName( name );
+			auto it = std::find( m_bytecode.contextNames.begin(), m_bytecode.contextNames.end(), internedName );
+			if( it != m_bytecode.contextNames.end() )
+			{
+				return it - m_bytecode.contextNames.begin();
+			}
+			m_bytecode.contextNames.push_back( internedName );
+			return m_bytecode.contextNames.size() - 1;
+		}
+
+		int32_t local( const std::string &name, bool assign )
+		{
+			auto inserted = m_locals.insert( { name, m_bytecode.localNames.size() } );
+			if( inserted.second )
+			{
+				m_bytecode.localNames.push_back( name );
+				m_localsAssigned.push_back( false );
+			}
+			if( assign )
+			{
+				m_localsAssigned[inserted.first->second] = true;
+			}
+			return inserted.first->second;
+		}
+
+		// Plugs
+		// =====
+
+		ValuePlug *plug( const std::vector<std::string> &path ) const
+		{
+			GraphComponent *graphComponent = m_node->parent();
+			for( const auto &name : path )
+			{
+				graphComponent = graphComponent ? graphComponent->getChild( name ) : nullptr;
+				if( !graphComponent )
+				{
+					error( fmt::format( "\"{}\" does not exist", join( path ) ) );
+				}
+			}
+
+			auto valuePlug = runTimeCast<ValuePlug>( graphComponent );
+			if( !valuePlug )
+			{
+				error( fmt::format( "\"{}\" is not a ValuePlug", join( path ) ) );
+			}
+			if( !supportedPlug( valuePlug ) )
+			{
+				error( fmt::format( "\"{}\" has unsupported type \"{}\"", join( path ), valuePlug->typeName() ) );
+			}
+
+			return valuePlug;
+		}
+
+		using PlugPaths = std::map<std::vector<std::string>, int32_t>;
+
+		int32_t plugIndex( PlugPaths &paths, const std::vector<std::string> &path )
+		{
+			// Validate eagerly, so errors have the right line number.
+			plug( path );
+			return paths.insert( { path, paths.size() } ).first->second;
+		}
+
+		// Parses `["a"]["b"]...`, stopping at the first subscript which
+		// isn't a string literal.
+		std::vector<std::string> subscriptPath()
+		{
+			std::vector<std::string> result;
+			while( isOperator( peek(), "[" ) && peek( 1 ).type == Token::Type::String && isOperator( peek( 2 ), "]" ) )
+			{
+				result.push_back( peek( 1 ).text );
+				m_pos += 3;
+			}
+			return result;
+		}
+
+		// The Python engine sorts plugs by path, and the indices used
+		// in `execute()` must match. Now we know all the paths, we can
+		// remap the indices we used during parsing.
+		void sortPlugs()
+		{
+			std::vector<int32_t> inputIndices( m_reads.size() );
+			for( const auto &[path, index] : m_reads )
+			{
+				inputIndices[index] = inputs.size();
+				inputs.push_back( plug( path ) );
+			}
+
+			std::vector<int32_t> outputIndices( m_writes.size() );
+			for( const auto &[path, index] : m_writes )
+			{
+				outputIndices[index] = outputs.size();
+				outputs.push_back( plug( path ) );
+			}
+
+			for( auto &instruction : m_bytecode.code )
+			{
+				if( instruction.op == OpCode::Input )
+				{
+					instruction.a = inputIndices[instruction.a];
+				}
+				else if( instruction.op == OpCode::StoreOutput )
+				{
+					instruction.a = outputIndices[instruction.a];
+				}
+			}
+
+			m_bytecode.numOutputs = outputs.size();
+			contextVariables.insert( contextVariables.end(), m_contextReads.begin(), m_contextReads.end() );
+			bytecode = std::move( m_bytecode );
+		}
+
+		// Statements
+		// ==========
+
+		void statement()
+		{
+			const Token &token = peek();
+			if( token.type == Token::Type::Indent )
+			{
+				error( "Unexpected indent" );
+			}
+			else if( token.type == Token::Type::Newline )
+			{
+				next();
+			}
+			else if( isKeyword( token, "if" ) )
+			{
+				ifStatement();
+			}
+			else
+			{
+				simpleStatements();
+			}
+		}
+
+		void simpleStatements()
+		{
+			while( true )
+			{
+				simpleStatement();
+				if( !acceptOperator( ";" ) || peek().type == Token::Type::Newline || peek().type == Token::Type::End )
+				{
+					break;
+				}
+			}
+
+			if( peek().type == Token::Type::End )
+			{
+				return;
+			}
+			else if( peek().type != Token::Type::Newline )
+			{
+				error( fmt::format( "Unexpected {}", description( peek() ) ) );
+			}
+			next();
+		}
+
+		void simpleStatement()
+		{
+			if( acceptKeyword( "pass" ) )
+			{
+				return;
+			}
+
+			// Look ahead for an assignment.
+			size_t assignments = 0;
+			int depth = 0;
+			for( size_t i = m_pos; i < m_tokens.size(); ++i )
+			{
+				const Token &t = m_tokens[i];
+				if( t.type == Token::Type::Newline || t.type == Token::Type::End || ( depth == 0 && isOperator( t, ";" ) ) )
+				{
+					break;
+				}
+				else if( isOperator( t, "(" ) || isOperator( t, "[" ) )
+				{
+					depth++;
+				}
+				else if( isOperator( t, ")" ) || isOperator( t, "]" ) )
+				{
+					depth--;
+				}
+				else if( t.type == Token::Type::Operator && t.text.size() >= 2 && t.text.back() == '=' && t.text != "==" && t.text != "!=" && t.text != "<=" && t.text != ">=" )
+				{
+					error( "Augmented assignment is not supported" );
+				}
+				else if( depth == 0 && isOperator( t, "=" ) )
+				{
+					assignments++;
+				}
+			}
+
+			if( assignments > 1 )
+			{
+				error( "Multiple assignment is not supported" );
+			}
+			else if( assignments == 1 )
+			{
+				assignment();
+			}
+			else
+			{
+				expression();
+				emit( OpCode::Pop );
+			}
+		}
+
+		void assignment()
+		{
+			const Token target = next();
+			if( target.type != Token::Type::Name )
+			{
+				error( "Unsupported assignment target" );
+			}
+
+			if( target.text == "parent" )
+			{
+				const std::vector<std::string> path = subscriptPath();
+				if( path.empty() || !isOperator( peek(), "=" ) )
+				{
+					error( "Unsupported assignment target" );
+				}
+				const int32_t index = plugIndex( m_writes, path );
+				expectOperator( "=" );
+				expression();
+				emit( OpCode::StoreOutput, index );
+			}
+			else
+			{
+				if( reservedNames().count( target.text ) || builtins().count( target.text ) )
+				{
+					error( fmt::format( "Cannot assign to \"{}\"", target.text ) );
+				}
+				expectOperator( "=" );
+				expression();
+				emit( OpCode::StoreLocal, local( target.text, /* assign = */ true ) );
+			}
+		}
+
+		void ifStatement()
+		{
+			std::vector<size_t> endJumps;
+			next();
+			while( true )
+			{
+				expression();
+				expectOperator( ":" );
+				const size_t jump = emit( OpCode::JumpIfFalse );
+				block();
+				if( isKeyword( peek(), "elif" ) || isKeyword( peek(), "else" ) )
+				{
+					endJumps.push_back( emit( OpCode::Jump ) );
+					patchJump( jump );
+					if( next().text == "elif" )
+					{
+						continue;
+					}
+					expectOperator( ":" );
+					block();
+				}
+				else
+				{
+					patchJump( jump );
+				}
+				break;
+			}
+
+			for( auto jump : endJumps )
+			{
+				patchJump( jump );
+			}
+		}
+
+		void block()
+		{
+			if( peek().type != Token::Type::Newline )
+			{
+				simpleStatements();
+				return;
+			}
+
+			next();
+			if( peek().type != Token::Type::Indent )
+			{
+				error( "Expected an indented block" );
+			}
+			next();
+
+			while( peek().type != Token::Type::Dedent && peek().type != Token::Type::End )
+			{
+				statement();
+			}
+			if( peek().type == Token::Type::Dedent )
+			{
+				next();
+			}
+		}
+
+		// Expressions
+		// ===========
+
+		void expression()
+		{
+			// `a if condition else b`. We emit the code for `a` before
+			// we know we're in a conditional expression, so we move it
+			// after the code for the condition. This is valid because
+			// all jumps are relative.
+
+			std::vector<Instruction> &code = m_bytecode.code;
+			const size_t start = code.size();
+			orExpression();
+			if( !acceptKeyword( "if" ) )
+			{
+				return;
+			}
+
+			const std::vector<Instruction> trueCode( code.begin() + start, code.end() );
+			code.resize( start );
+
+			orExpression();
+			const size_t falseJump = emit( OpCode::JumpIfFalse );
+			code.insert( code.end(), trueCode.begin(), trueCode.end() );
+			const size_t endJump = emit( OpCode::Jump );
+			patchJump( falseJump );
+
+			if( !acceptKeyword( "else" ) )
+			{
+				error( fmt::format( "Expected \"else\" but found {}", description( peek() ) ) );
+			}
+			expression();
+			patchJump( endJump );
+		}
+
+		void orExpression()
+		{
+			andExpression();
+			std::vector<size_t> jumps;
+			while( acceptKeyword( "or" ) )
+			{
+				jumps.push_back( emit( OpCode::JumpIfTrueOrPop ) );
+				andExpression();
+			}
+			for( auto jump : jumps )
+			{
+				patchJump( jump );
+			}
+		}
+
+		void andExpression()
+		{
+			notExpression();
+			std::vector<size_t> jumps;
+			while( acceptKeyword( "and" ) )
+			{
+				jumps.push_back( emit( OpCode::JumpIfFalseOrPop ) );
+				notExpression();
+			}
+			for( auto jump : jumps )
+			{
+				patchJump( jump );
+			}
+		}
+
+		void notExpression()
+		{
+			if( acceptKeyword( "not" ) )
+			{
+				notExpression();
+				emit( OpCode::Not );
+			}
+			else
+			{
+				comparison();
+			}
+		}
+
+		bool comparisonOperator( OpCode &op )
+		{
+			static const std::vector<std::pair<const char *, OpCode>> g_operators = {
+				{ "==", OpCode::Equal }, { "!=", OpCode::NotEqual },
+				{ "<", OpCode::Less }, { "<=", OpCode::LessEqual },
+				{ ">", OpCode::Greater }, { ">=", OpCode::GreaterEqual }
+			};
+
+			for( const auto &[text, code] : g_operators )
+			{
+				if( acceptOperator( text ) )
+				{
+					op = code;
+					return true;
+				}
+			}
+
+			if( acceptKeyword( "in" ) )
+			{
+				op = OpCode::In;
+				return true;
+			}
+			else if( isKeyword( peek(), "not" ) && isKeyword( peek( 1 ), "in" ) )
+			{
+				m_pos += 2;
+				op = OpCode::NotIn;
+				return true;
+			}
+			else if( isKeyword( peek(), "is" ) )
+			{
+				error( "\"is\" is not supported" );
+			}
+
+			return false;
+		}
+
+		void comparison()
+		{
+			const size_t start = m_bytecode.code.size();
+			arithmetic();
+
+			OpCode op;
+			if( !comparisonOperator( op ) )
+			{
+				return;
+			}
+
+			if(
+				( op == OpCode::In || op == OpCode::NotIn ) &&
+				isKeyword( peek(), "context" ) && !isOperator( peek( 1 ), "[" ) && !isOperator( peek( 1 ), "." )
+			)
+			{
+				// `"x" in context`
+				const std::vector<Instruction> &code = m_bytecode.code;
+				if(
+					code.size() != start + 1 || code.back().op != OpCode::Constant ||
+					m_bytecode.constants[code.back().a].type != Value::Type::String
+				)
+				{
+					error( "Context name must be a string" );
+				}
+				const std::string name = m_bytecode.constants[code.back().a].s;
+				m_bytecode.code.pop_back();
+				next();
+				emit( OpCode::ContextContains, contextName( name ) );
+				if( op == OpCode::NotIn )
+				{
+					emit( OpCode::Not );
+				}
+			}
+			else
+			{
+				arithmetic();
+				emit( op );
+			}
+
+			if( comparisonOperator( op ) )
+			{
+				error( "Chained comparisons are not supported" );
+			}
+		}
+
+		void arithmetic()
+		{
+			term();
+			while( true )
+			{
+				if( acceptOperator( "+" ) )
+				{
+					term();
+					emit( OpCode::Add );
+				}
+				else if( acceptOperator( "-" ) )
+				{
+					term();
+					emit( OpCode::Subtract );
+				}
+				else
+				{
+					break;
+				}
+			}
+		}
+
+		void term()
+		{
+			factor();
+			while( true )
+			{
+				OpCode op;
+				if( acceptOperator( "*" ) )
+				{
+					op = OpCode::Multiply;
+				}
+				else if( acceptOperator( "/" ) )
+				{
+					op = OpCode::Divide;
+				}
+				else if( acceptOperator( "//" ) )
+				{
+					op = OpCode::FloorDivide;
+				}
+				else if( acceptOperator( "%" ) )
+				{
+					op = OpCode::Modulo;
+				}
+				else
+				{
+					break;
+				}
+				factor();
+				emit( op );
+			}
+		}
+
+		void factor()
+		{
+			if( acceptOperator( "-" ) )
+			{
+				factor();
+				emit( OpCode::Negate );
+			}
+			else if( acceptOperator( "+" ) )
+			{
+				factor();
+				emit( OpCode::Positive );
+			}
+			else
+			{
+				power();
+			}
+		}
+
+		void power()
+		{
+			primary();
+			if( acceptOperator( "**" ) )
+			{
+				// Right associative, and binds less tightly than
+				// a unary operator on the right.
+				factor();
+				emit( OpCode::Power );
+			}
+		}
+
+		void primary()
+		{
+			atom();
+			while( true )
+			{
+				if( acceptOperator( "." ) )
+				{
+					const Token attribute = next();
+					if( attribute.type != Token::Type::Name )
+					{
+						error( fmt::format( "Expected attribute name but found {}", description( attribute ) ) );
+					}
+					if( acceptOperator( "(" ) )
+					{
+						const auto it = methods().find( attribute.text );
+						if( it == methods().end() )
+						{
+							error( fmt::format( "Method \"{}\" is not supported", attribute.text ) );
+						}
+						const size_t numArguments = arguments( attribute.text, it->second );
+						emit( OpCode::CallMethod, it->second.value, numArguments );
+					}
+					else
+					{
+						static const std::string g_vectorComponents = "xyz";
+						static const std::string g_colorComponents = "rgba";
+						if( attribute.text.size() == 1 && g_vectorComponents.find( attribute.text[0] ) != std::string::npos )
+						{
+							emit( OpCode::Component, g_vectorComponents.find( attribute.text[0] ), (int32_t)ComponentFamily::Vector );
+						}
+						else if( attribute.text.size() == 1 && g_colorComponents.find( attribute.text[0] ) != std::string::npos )
+						{
+							emit( OpCode::Component, g_colorComponents.find( attribute.text[0] ), (int32_t)ComponentFamily::Color );
+						}
+						else
+						{
+							error( fmt::format( "Attribute \"{}\" is not supported", attribute.text ) );
+						}
+					}
+				}
+				else if( acceptOperator( "[" ) )
+				{
+					expression();
+					if( isOperator( peek(), ":" ) )
+					{
+						error( "Slices are not supported" );
+					}
+					expectOperator( "]" );
+					emit( OpCode::Index );
+				}
+				else if( isOperator( peek(), "(" ) )
+				{
+					error( "Unsupported function call" );
+				}
+				else
+				{
+					break;
+				}
+			}
+		}
+
+		// Parses a parenthesised argument list, assuming the opening
+		// parenthesis has been consumed already. Returns the number of
+		// arguments.
+		size_t arguments( const std::string &name, const FunctionDescription &description )
+		{
+			size_t result = 0;
+			while( !acceptOperator( ")" ) )
+			{
+				if( peek().type == Token::Type::Name && isOperator( peek( 1 ), "=" ) )
+				{
+					error( "Keyword arguments are not supported" );
+				}
+				expression();
+				result++;
+				if( !acceptOperator( "," ) )
+				{
+					expectOperator( ")" );
+					break;
+				}
+			}
+
+			if( result < description.minArguments || result > description.maxArguments )
+			{
+				error( fmt::format( "Unsupported number of arguments for \"{}\"", name ) );
+			}
+
+			return result;
+		}
+
+		void atom()
+		{
+			const Token token = next();
+			switch( token.type )
+			{
+				case Token::Type::Int :
+					emit( OpCode::Constant, constant( Value::integer( token.i ) ) );
+					break;
+				case Token::Type::Float :
+					emit( OpCode::Constant, constant( Value::number( token.f ) ) );
+					break;
+				case Token::Type::String :
+				case Token::Type::FormattedString :
+					m_pos--;
+					strings();
+					break;
+				case Token::Type::Name :
+					name( token );
+					break;
+				case Token::Type::Operator :
+					if( token.text == "(" )
+					{
+						parenthesised();
+						break;
+					}
+					[[fallthrough]];
+				default :
+					m_pos--;
+					error( fmt::format( "Unexpected {}", description( token ) ) );
+			}
+		}
+
+		void parenthesised()
+		{
+			if( acceptOperator( ")" ) )
+			{
+				emit( OpCode::BuildTuple, 0 );
+				return;
+			}
+
+			expression();
+			if( acceptOperator( ")" ) )
+			{
+				return;
+			}
+
+			expectOperator( "," );
+			size_t size = 1;
+			while( !acceptOperator( ")" ) )
+			{
+				expression();
+				size++;
+				if( !acceptOperator( "," ) )
+				{
+					expectOperator( ")" );
+					break;
+				}
+			}
+			emit( OpCode::BuildTuple, size );
+		}
+
+		void name( const Token &token )
+		{
+			const std::string &name = token.text;
+			if( name == "True" || name == "False" )
+			{
+				emit( OpCode::Constant, constant( Value::boolean( name == "True" ) ) );
+			}
+			else if( name == "None" )
+			{
+				emit( OpCode::Constant, constant( Value() ) );
+			}
+			else if( name == "parent" )
+			{
+				const std::vector<std::string> path = subscriptPath();
+				if( path.empty() )
+				{
+					error( "Expected plug name after \"parent\"" );
+				}
+				emit( OpCode::Input, plugIndex( m_reads, path ) );
+			}
+			else if( name == "context" )
+			{
+				contextAccess();
+			}
+			else if( reservedNames().count( name ) )
+			{
+				m_pos--;
+				error( fmt::format( "\"{}\" is not supported", name ) );
+			}
+			else if( builtins().count( name ) )
+			{
+				const FunctionDescription &function = builtins().at( name );
+				if( !acceptOperator( "(" ) )
+				{
+					error( fmt::format( "\"{}\" must be called", name ) );
+				}
+				const size_t numArguments = arguments( name, function );
+				emit( OpCode::CallBuiltin, function.value, numArguments );
+			}
+			else
+			{
+				emit( OpCode::LoadLocal, local( name, /* assign = */ false ) );
+			}
+		}
+
+		void contextAccess()
+		{
+			if( acceptOperator( "[" ) )
+			{
+				if( peek().type != Token::Type::String || !isOperator( peek( 1 ), "]" ) )
+				{
+					error( "Context name must be a string" );
+				}
+				emit( OpCode::ContextGet, contextName( next().text ) );
+				next();
+				return;
+			}
+
+			if( !acceptOperator( "." ) )
+			{
+				error( "Unsupported use of \"context\"" );
+			}
+
+			const Token method = next();
+			expectOperator( "(" );
+			if( method.text == "get" )
+			{
+				if( peek().type != Token::Type::String )
+				{
+					error( "Context name must be a string" );
+				}
+				const int32_t name = contextName( next().text );
+				if( acceptOperator( "," ) )
+				{
+					expression();
+					expectOperator( ")" );
+					emit( OpCode::ContextGetDefault, name );
+				}
+				else
+				{
+					expectOperator( ")" );
+					emit( OpCode::ContextGet, name, /* default to None = */ 1 );
+				}
+			}
+			else if( method.text == "getFrame" )
+			{
+				expectOperator( ")" );
+				contextName( "frame" );
+				emit( OpCode::Frame );
+			}
+			else if( method.text == "getTime" )
+			{
+				expectOperator( ")" );
+				contextName( "frame" );
+				contextName( "framesPerSecond" );
+				emit( OpCode::Time );
+			}
+			else if( method.text == "getFramesPerSecond" )
+			{
+				expectOperator( ")" );
+				contextName( "framesPerSecond" );
+				emit( OpCode::FramesPerSecond );
+			}
+			else
+			{
+				error( fmt::format( "Context method \"{}\" is not supported", method.text ) );
+			}
+		}
+
+		// Parses a sequence of adjacent string literals, which Python
+		// concatenates.
+		void strings()
+		{
+			std::string literal;
+			size_t parts = 0;
+			auto flush = [&] {
+				if( !literal.empty() )
+				{
+					emit( OpCode::Constant, constant( Value::string( literal ) ) );
+					literal.clear();
+					parts++;
+				}
+			};
+
+			while( peek().type == Token::Type::String || peek().type == Token::Type::FormattedString )
+			{
+				const Token token = next();
+				if( token.type == Token::Type::String )
+				{
+					literal += token.text;
+					continue;
+				}
+
+				const std::string &s = token.text;
+				for( size_t i = 0; i < s.size(); )
+				{
+					if( s[i] == '{' && i + 1 < s.size() && s[i+1] == '{' )
+					{
+						literal += '{';
+						i += 2;
+					}
+					else if( s[i] == '}' )
+					{
+						if( i + 1 >= s.size() || s[i+1] != '}' )
+						{
+							error( "Single '}' is not allowed in f-string" );
+						}
+						literal += '}';
+						i += 2;
+					}
+					else if( s[i] == '{' )
+					{
+						flush();
+						i = replacementField( s, i, token.line );
+						parts++;
+					}
+					else
+					{
+						literal += s[i++];
+					}
+				}
+			}
+
+			if( parts == 0 || !literal.empty() )
+			{
+				if( parts == 0 )
+				{
+					emit( OpCode::Constant, constant( Value::string( literal ) ) );
+					return;
+				}
+				flush();
+			}
+
+			if( parts > 1 )
+			{
+				emit( OpCode::BuildString, parts );
+			}
+		}
+
+		// Parses the f-string replacement field starting at `s[start]`,
+		// returning the index following it.
+		size_t replacementField( const std::string &s, size_t start, int line )
+		{
+			// Find the end of the expression.
+			size_t i = start + 1;
+			int depth = 0;
+			char quote = 0;
+			for( ; i < s.size(); ++i )
+			{
+				const char c = s[i];
+				if( quote )
+				{
+					if( c == quote )
+					{
+						quote = 0;
+					}
+				}
+				else if( c == '\'' || c == '"' )
+				{
+					quote = c;
+				}
+				else if( c == '(' || c == '[' || c == '{' )
+				{
+					depth++;
+				}
+				else if( depth && ( c == ')' || c == ']' || c == '}' ) )
+				{
+					depth--;
+				}
+				else if( !depth && ( c == '}' || c == ':' || ( c == '!' && i + 1 < s.size() && s[i+1] != '=' ) ) )
+				{
+					break;
+				}
+			}
+
+			if( i >= s.size() )
+			{
+				syntaxError( line, "Expecting '}' in f-string" );
+			}
+
+			const std::string source = s.substr( start + 1, i - start - 1 );
+
+			char conversion = 0;
+			if( s[i] == '!' )
+			{
+				conversion = i + 1 < s.size() ? s[i+1] : 0;
+				i += 2;
+				if( conversion != 's' )
+				{
+					syntaxError( line, "Only the \"!s\" conversion is supported in f-strings" );
+				}
+			}
+
+			std::string spec;
+			if( i < s.size() && s[i] == ':' )
+			{
+				const size_t end = s.find( '}', i );
+				if( end == std::string::npos )
+				{
+					syntaxError( line, "Expecting '}' in f-string" );
+				}
+				spec = s.substr( i + 1, end - i - 1 );
+				if( spec.find( '{' ) != std::string::npos )
+				{
+					syntaxError( line, "Nested replacement fields are not supported" );
+				}
+				i = end;
+			}
+
+			if( i >= s.size() || s[i] != '}' )
+			{
+				syntaxError( line, "Expecting '}' in f-string" );
+			}
+
+			// Parse the expression, by temporarily switching our token
+			// stream.
+
+			std::vector<Token> tokens = Lexer( source, line, /* expressionOnly = */ true ).tokenize();
+			std::swap( tokens, m_tokens );
+			const size_t pos = m_pos;
+			m_pos = 0;
+
+			expression();
+			if( peek().type != Token::Type::End )
+			{
+				error( fmt::format( "Unexpected {} in f-string", description( peek() ) ) );
+			}
+
+			std::swap( tokens, m_tokens );
+			m_pos = pos;
+
+			if( conversion )
+			{
+				emit( OpCode::CallBuiltin, (int32_t)Builtin::Str, 1 );
+			}
+			emit( OpCode::FormatValue, constant( Value::string( spec ) ) );
+
+			return i + 1;
+		}
+
+		Expression *m_node;
+		std::vector<Token> m_tokens;
+		size_t m_pos;
+
+		Bytecode m_bytecode;
+		std::unordered_map<std::string, int32_t> m_locals;
+		std::vector<bool> m_localsAssigned;
+		PlugPaths m_reads;
+		PlugPaths m_writes;
+		std::set<std::string> m_contextReads;
+
+};
+
+} // namespace
+
+//////////////////////////////////////////////////////////////////////////
+// NativeExpressionEngine
+//////////////////////////////////////////////////////////////////////////
+
+struct NativeExpressionEngine::Program : public Bytecode
+{
+
+	Program( Bytecode &&bytecode )
+		:	Bytecode( std::move( bytecode ) )
+	{
+	}
+
+};
+
+NativeExpressionEngine::UnsupportedOperation::UnsupportedOperation( const std::string &what )
+	:	IECore::Exception( what )
+{
+}
+
+Expression::Engine::EngineDescription<NativeExpressionEngine> NativeExpressionEngine::g_engineDescription( "native" );
+
+NativeExpressionEngine::NativeExpressionEngine()
+{
+}
+
+NativeExpressionEngine::~NativeExpressionEngine()
+{
+}
+
+void NativeExpressionEngine::parse( Expression *node, const std::string &expression, std::vector<ValuePlug *> &inputs, std::vector<ValuePlug *> &outputs, std::vector<IECore::InternedString> &contextVariables )
+{
+	Parser parser( node, expression );
+	m_program = std::make_unique<Program>( std::move( parser.bytecode ) );
+	inputs.insert( inputs.end(), parser.inputs.begin(), parser.inputs.end() );
+	outputs.insert( outputs.end(), parser.outputs.begin(), parser.outputs.end() );
+	contextVariables.insert( contextVariables.end(), parser.contextVariables.begin(), parser.contextVariables.end() );
+}
+
+IECore::ConstObjectVectorPtr NativeExpressionEngine::execute( const Context *context, const std::vector<const ValuePlug *> &proxyInputs ) const
+{
+	return m_program->execute( context, proxyInputs );
+}
+
+ValuePlug::CachePolicy NativeExpressionEngine::executeCachePolicy() const
+{
+	// We don't spawn tasks, and are typically cheap enough that
+	// collaboration wouldn't pay off.
+	return ValuePlug::CachePolicy::Standard;
+}
+
+void NativeExpressionEngine::apply( ValuePlug *proxyOutput, const ValuePlug *topLevelProxyOutput, const IECore::Object *value ) const
+{
+	if( value->typeId() == NullObjectTypeId )
+	{
+		// The expression didn't provide a value.
+		proxyOutput->setToDefault();
+		return;
+	}
+
+	const Data *data = runTimeCast<const Data>( value );
+	if( !data || !applyValue( proxyOutput, topLevelProxyOutput, data ) )
+	{
+		throw UnsupportedOperation( fmt::format( "Unsupported value type \"{}\"", value->typeName() ) );
+	}
+}
+
+std::string NativeExpressionEngine::identifier( const Expression *node, const ValuePlug *plug ) const
+{
+	if( !supportedPlug( plug ) )
+	{
+		return "";
+	}
+	return plugIdentifier( node, plug );
+}
+
+std::string NativeExpressionEngine::replace( const Expression *node, const std::string &expression, const std::vector<const ValuePlug *> &oldPlugs, const std::vector<const ValuePlug *> &newPlugs ) const
+{
+	std::string result = expression;
+	for( size_t i = 0, e = std::min( oldPlugs.size(), newPlugs.size() ); i < e; ++i )
+	{
+		std::string replacement;
+		if( newPlugs[i] )
+		{
+			replacement = plugIdentifier( node, newPlugs[i] );
+		}
+		else if( oldPlugs[i]->direction() == Plug::In )
+		{
+			replacement = defaultValueLiteral( oldPlugs[i] );
+		}
+		else
+		{
+			replacement = "__disconnected";
+		}
+
+		result = replaceIdentifier( result, plugIdentifier( node, oldPlugs[i] ), replacement );
+	}
+	return result;
+}
+
+std::string NativeExpressionEngine::defaultExpression( const ValuePlug *output ) const
+{
+	const Node *parentNode = output->node() ? output->node()->ancestor<Node>() : nullptr;
+	if( !parentNode )
+	{
+		return "";
+	}
+
+	std::string value;
+	switch( (Gaffer::TypeId)output->typeId() )
+	{
+		case BoolPlugTypeId :
+			value = static_cast<const BoolPlug *>( output )->getValue() ? "True" : "False";
+			break;
+		case IntPlugTypeId :
+			value = std::to_string( static_cast<const IntPlug *>( output )->getValue() );
+			break;
+		case FloatPlugTypeId :
+			value = floatToString( static_cast<const FloatPlug *>( output )->getValue() );
+			break;
+		case StringPlugTypeId :
+			value = stringRepr( static_cast<const StringPlug *>( output )->getValue() );
+			break;
+		default :
+			// We have no literals for compound values.
+			return "";
+	}
+
+	std::string relativeName = output->relativeName( parentNode );
+	return "parent[\"" + boost::replace_all_copy( relativeName, ".", "\"][\"" ) + "\"] = " + value;
+}
@@ -39,9 +39,34 @@
 #include "Gaffer/BackgroundTask.h"
 #include "Gaffer/Context.h"
 #include "Gaffer/Monitor.h"
+#include "Gaffer/Process.h"
 
+#include "IECore/MessageHandler.h"
+
+#include "boost/algorithm/string/classification.hpp"
+#include "boost/algorithm/string/split.hpp"
+
+#include "tbb/task_arena.h"
+#include "tbb/task_group.h"
+#include "tbb/task_scheduler_observer.h"
+
+#include "fmt/format.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <map>
 #include <mutex>
 #include <stack>
+#include <thread>
+
+#ifdef __linux__
+#include <sched.h>
+#endif
 
 using namespace Gaffer;
 
@@ -113,7 +138,7 @@ bool ParallelAlgo::canCallOnUIThread()
 	return handlers->size();
 }
 
-GAFFER_API std::unique_ptr<BackgroundTask> ParallelAlgo::callOnBackgroundThread( const Plug *subject, BackgroundFunction function )
+GAFFER_API std::unique_ptr<BackgroundTask> ParallelAlgo::callOnBackgroundThread( const Plug *subject, BackgroundFunction function, Priority priority )
 {
 	ContextPtr backgroundContext = new Context( *Context::current() );
 	Monitor::MonitorSet backgroundMonitors = Monitor::current();
@@ -130,7 +155,558 @@ GAFFER_API std::unique_ptr<BackgroundTask> ParallelAlgo::callOnBackgroundThread(
 
 			function();
 
+		},
+
+		priority
+
+	);
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Priority classes
+//////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+using Clock = std::chrono::steady_clock;
+
+class PriorityClass
+{
+
+	public :
+
+		void setBudget( size_t numThreads )
+		{
+			ArenaPtr arena;
+			if( numThreads )
+			{
+				// No thread is reserved for masters, so that the budget is
+				// available to enqueued work in its entirety.
+				arena = std::make_shared<tbb::task_arena>( numThreads, /* reserved_for_masters = */ 0 );
+			}
+
+			std::lock_guard<std::mutex> lock( m_mutex );
+			m_budget = numThreads;
+			// Destroying the previous arena doesn't cancel work that is
+			// already queued in it, and anyone executing in it holds a
+			// reference until they are done.
+			std::swap( m_arena, arena );
+		}
+
+		size_t getBudget()
+		{
+			std::lock_guard<std::mutex> lock( m_mutex );
+			return m_budget;
+		}
+
+		void enqueue( const ParallelAlgo::PriorityFunction &function )
+		{
+			ArenaPtr a = queued();
+			auto f = [this, function, queueTime = Clock::now()] {
+				started( queueTime );
+				function();
+			};
+
+			if( a )
+			{
+				a->enqueue( f );
+			}
+			else
+			{
+				tbb::task_arena( tbb::task_arena::attach() ).enqueue( f );
+			}
+		}
+
+		void execute( const ParallelAlgo::PriorityFunction &function )
+		{
+			ArenaPtr a = queued();
+			if( !a )
+			{
+				started( Clock::now() );
+				function();
+				return;
+			}
+
+			const Clock::time_point queueTime = Clock::now();
+			a->execute(
+				[&] {
+					started( queueTime );
+					function();
+				}
+			);
+		}
+
+		ParallelAlgo::QueueStatistics statistics()
+		{
+			std::lock_guard<std::mutex> lock( m_mutex );
+			return m_statistics;
+		}
+
+		void resetStatistics()
+		{
+			std::lock_guard<std::mutex> lock( m_mutex );
+			// Work that is still pending will be counted
+			// when it starts, so must remain pending.
+			const size_t numPending = m_statistics.numPending;
+			m_statistics = ParallelAlgo::QueueStatistics();
+			m_statistics.numPending = numPending;
+		}
+
+	private :
+
+		using ArenaPtr = std::shared_ptr<tbb::task_arena>;
+
+		// Records the queuing of a task, returning the
+		// arena it should be run in.
+		ArenaPtr queued()
+		{
+			std::lock_guard<std::mutex> lock( m_mutex );
+			m_statistics.numPending++;
+			return m_arena;
+		}
+
+		void started( Clock::time_point queueTime )
+		{
+			const double latency = std::chrono::duration<double>( Clock::now() - queueTime ).count();
+			std::lock_guard<std::mutex> lock( m_mutex );
+			m_statistics.numPending--;
+			m_statistics.numTasks++;
+			m_statistics.totalLatency += latency;
+			m_statistics.maxLatency = std::max( m_statistics.maxLatency, latency );
+		}
+
+		std::mutex m_mutex;
+		size_t m_budget = 0;
+		// Null when there is no budget, in which case
+		// we use the current arena.
+		ArenaPtr m_arena;
+		ParallelAlgo::QueueStatistics m_statistics;
+
+};
+
+const size_t g_numPriorities = 3;
+
+PriorityClass &priorityClass( ParallelAlgo::Priority priority )
+{
+	// Deliberately leaked, so that the arenas outlive any background
+	// tasks that are still running during shutdown.
+	static PriorityClass *g_priorityClasses = new PriorityClass[g_numPriorities];
+	const size_t index = static_cast<size_t>( priority );
+	if( index >= g_numPriorities )
+	{
+		throw IECore::Exception( fmt::format( "Invalid priority {}", index ) );
+	}
+	return g_priorityClasses[index];
+}
+
+} // namespace
+
+void ParallelAlgo::setThreadBudget( Priority priority, size_t numThreads )
+{
+	priorityClass( priority ).setBudget( numThreads );
+}
+
+size_t ParallelAlgo::getThreadBudget( Priority priority )
+{
+	return priorityClass( priority ).getBudget();
+}
+
+void ParallelAlgo::enqueue( Priority priority, const PriorityFunction &function )
+{
+	priorityClass( priority ).enqueue( function );
+}
+
+void ParallelAlgo::execute( Priority priority, const PriorityFunction &function )
+{
+	priorityClass( priority ).execute( function );
+}
+
+ParallelAlgo::QueueStatistics ParallelAlgo::queueStatistics( Priority priority )
+{
+	return priorityClass( priority ).statistics();
+}
+
+void ParallelAlgo::resetQueueStatistics()
+{
+	for( size_t i = 0; i < g_numPriorities; ++i )
+	{
+		priorityClass( static_cast<Priority>( i ) ).resetStatistics();
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////
+// NUMA
+//////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+thread_local int g_currentNUMANode = -1;
+thread_local bool g_isWorker = false;
+
+// Records which threads are TBB workers. Workers must not block waiting
+// for the NUMA arenas, since they may be holding up tasks in their own
+// arena that the NUMA work depends on.
+class WorkerObserver : public tbb::task_scheduler_observer
+{
+
+	public :
+
+		WorkerObserver()
+		{
+			observe( true );
+		}
+
+		void on_scheduler_entry( bool isWorker ) override
+		{
+			if( isWorker )
+			{
+				g_isWorker = true;
+			}
 		}
 
+};
+
+using CPUList = std::vector<int>;
+
+CPUList availableCPUs()
+{
+	CPUList result;
+#ifdef __linux__
+	cpu_set_t cpuSet;
+	CPU_ZERO( &cpuSet );
+	if( sched_getaffinity( 0, sizeof( cpuSet ), &cpuSet ) == 0 )
+	{
+		for( int cpu = 0; cpu < CPU_SETSIZE; ++cpu )
+		{
+			if( CPU_ISSET( cpu, &cpuSet ) )
+			{
+				result.push_back( cpu );
+			}
+		}
+		return result;
+	}
+#endif
+	for( int cpu = 0, e = std::thread::hardware_concurrency(); cpu < e; ++cpu )
+	{
+		result.push_back( cpu );
+	}
+	return result;
+}
+
+// Parses lists of the form "0-3,8,10-11", as found in
+// `/sys/devices/system/node/node*/cpulist`.
+CPUList parseCPUList( const std::string &text )
+{
+	CPUList result;
+	std::vector<std::string> ranges;
+	boost::split( ranges, text, boost::is_any_of( ",\n" ), boost::token_compress_on );
+	for( const auto &range : ranges )
+	{
+		if( range.empty() )
+		{
+			continue;
+		}
+		const size_t dash = range.find( '-' );
+		const int first = std::atoi( range.c_str() );
+		const int last = dash == std::string::npos ? first : std::atoi( range.c_str() + dash + 1 );
+		for( int cpu = first; cpu <= last; ++cpu )
+		{
+			result.push_back( cpu );
+		}
+	}
+	return result;
+}
+
+std::vector<CPUList> hardwareNodes( const CPUList &available )
+{
+	std::map<int, CPUList> nodes;
+	const std::filesystem::path nodesDirectory( "/sys/devices/system/node" );
+	std::error_code errorCode;
+	for( const auto &entry : std::filesystem::directory_iterator( nodesDirectory, errorCode ) )
+	{
+		const std::string name = entry.path().filename().string();
+		if( name.compare( 0, 4, "node" ) || name.size() == 4 || !std::isdigit( name[4] ) )
+		{
+			continue;
+		}
+
+		std::ifstream stream( entry.path() / "cpulist" );
+		std::string text;
+		std::getline( stream, text );
+
+		CPUList cpus;
+		for( int cpu : parseCPUList( text ) )
+		{
+			if( std::find( available.begin(), available.end(), cpu ) != available.end() )
+			{
+				cpus.push_back( cpu );
+			}
+		}
+
+		if( cpus.size() )
+		{
+			nodes[std::atoi( name.c_str() + 4 )] = cpus;
+		}
+	}
+
+	std::vector<CPUList> result;
+	for( auto &[index, cpus] : nodes )
+	{
+		result.push_back( cpus );
+	}
+	return result;
+}
+
+// Divides the available CPUs into contiguous groups, to emulate NUMA
+// nodes on hardware that doesn't have them. If there are more nodes
+// than CPUs, the CPUs are shared between nodes.
+std::vector<CPUList> emulatedNodes( const CPUList &available, size_t numNodes )
+{
+	std::vector<CPUList> result( numNodes );
+	if( available.empty() )
+	{
+		return result;
+	}
+
+	if( numNodes > available.size() )
+	{
+		for( size_t i = 0; i < numNodes; ++i )
+		{
+			result[i].push_back( available[i % available.size()] );
+		}
+		return result;
+	}
+
+	for( size_t i = 0; i < available.size(); ++i )
+	{
+		result[i * numNodes / available.size()].push_back( available[i] );
+	}
+	return result;
+}
+
+#ifdef __linux__
+
+void setAffinity( const CPUList &cpus )
+{
+	cpu_set_t cpuSet;
+	CPU_ZERO( &cpuSet );
+	for( int cpu : cpus )
+	{
+		CPU_SET( cpu, &cpuSet );
+	}
+	// Failure is harmless, since binding is only an optimisation.
+	sched_setaffinity( 0, sizeof( cpuSet ), &cpuSet );
+}
+
+#endif
+
+// Binds workers to the CPUs of a node while they are in its arena,
+// releasing them again when they leave to work elsewhere.
+class NUMAObserver : public tbb::task_scheduler_observer
+{
+
+	public :
+
+		NUMAObserver( tbb::task_arena &arena, int node, const CPUList &cpus, const CPUList &allCPUs )
+			:	tbb::task_scheduler_observer( arena ), m_node( node ), m_cpus( cpus ), m_allCPUs( allCPUs )
+		{
+			observe( true );
+		}
+
+		~NUMAObserver() override
+		{
+			observe( false );
+		}
+
+		void on_scheduler_entry( bool isWorker ) override
+		{
+			g_currentNUMANode = m_node;
+#ifdef __linux__
+			if( isWorker )
+			{
+				setAffinity( m_cpus );
+			}
+#endif
+		}
+
+		void on_scheduler_exit( bool isWorker ) override
+		{
+			g_currentNUMANode = -1;
+#ifdef __linux__
+			if( isWorker )
+			{
+				setAffinity( m_allCPUs );
+			}
+#endif
+		}
+
+	private :
+
+		const int m_node;
+		const CPUList m_cpus;
+		const CPUList &m_allCPUs;
+
+};
+
+struct NUMANode
+{
+
+	// We don't reserve a slot for the calling thread, because it only
+	// joins one arena at a time, and the workers should be able to
+	// occupy all the CPUs of every node.
+	NUMANode( int index, const CPUList &cpus, const CPUList &allCPUs )
+		:	arena( cpus.size(), /* reserved_for_masters = */ 0 )
+	{
+		arena.initialize();
+		observer = std::make_unique<NUMAObserver>( arena, index, cpus, allCPUs );
+	}
+
+	~NUMANode()
+	{
+		observer.reset();
+		arena.terminate();
+	}
+
+	tbb::task_arena arena;
+	std::unique_ptr<NUMAObserver> observer;
+
+};
+
+struct NUMATopology
+{
+
+	NUMATopology( const std::vector<CPUList> &nodeCPUs, const CPUList &allCPUs )
+		:	allCPUs( allCPUs )
+	{
+		for( size_t i = 0; i < nodeCPUs.size(); ++i )
+		{
+			nodes.push_back( std::make_unique<NUMANode>( i, nodeCPUs[i], this->allCPUs ) );
+		}
+	}
+
+	const CPUList allCPUs;
+	std::vector<std::unique_ptr<NUMANode>> nodes;
+
+};
+
+using NUMATopologyPtr = std::shared_ptr<NUMATopology>;
+
+std::mutex g_numaMutex;
+NUMATopologyPtr g_numaTopology;
+std::atomic_size_t g_numNUMANodes( 1 );
+std::once_flag g_numaInitialised;
+
+void setNUMANodesInternal( size_t numNodes )
+{
+	NUMATopologyPtr topology;
+	if( numNodes != 1 )
+	{
+		const CPUList cpus = availableCPUs();
+		const std::vector<CPUList> nodeCPUs = numNodes ? emulatedNodes( cpus, numNodes ) : hardwareNodes( cpus );
+		if( nodeCPUs.size() > 1 )
+		{
+			topology = std::make_shared<NUMATopology>( nodeCPUs, cpus );
+			IECore::msg(
+				IECore::Msg::Debug, "ParallelAlgo",
+				fmt::format( "Using {} {}NUMA nodes", nodeCPUs.size(), numNodes ? "emulated " : "" )
+			);
+		}
+	}
+
+	std::lock_guard<std::mutex> lock( g_numaMutex );
+	// Work in progress keeps the previous topology
+	// alive until it is complete.
+	std::swap( g_numaTopology, topology );
+	g_numNUMANodes = g_numaTopology ? g_numaTopology->nodes.size() : 1;
+}
+
+void initialiseNUMA()
+{
+	std::call_once(
+		g_numaInitialised,
+		[] {
+			// Deliberately leaked, since workers may outlive
+			// static destruction.
+			new WorkerObserver;
+			if( const char *e = getenv( "GAFFER_NUMA_NODES" ) )
+			{
+				setNUMANodesInternal( std::atoi( e ) );
+			}
+		}
 	);
 }
+
+NUMATopologyPtr numaTopology()
+{
+	initialiseNUMA();
+	std::lock_guard<std::mutex> lock( g_numaMutex );
+	return g_numaTopology;
+}
+
+} // namespace
+
+void ParallelAlgo::setNUMANodes( size_t numNodes )
+{
+	initialiseNUMA();
+	setNUMANodesInternal( numNodes );
+}
+
+size_t ParallelAlgo::getNUMANodes()
+{
+	initialiseNUMA();
+	return g_numNUMANodes;
+}
+
+int ParallelAlgo::currentNUMANode()
+{
+	return g_currentNUMANode;
+}
+
+void ParallelAlgo::parallelForEachNUMANode( const NUMAFunction &f )
+{
+	NUMATopologyPtr topology = numaTopology();
+	if( !topology || g_isWorker || Process::current() )
+	{
+		// Blocking in `arena.execute()` is only safe from the outermost
+		// level. Worker threads and computes may be running in another
+		// arena (including the arenas used by `TaskCollaboration`), and
+		// waiting on our arenas from there can deadlock. So we just do
+		// all the work in the current arena instead.
+		f( 0, 1 );
+		return;
+	}
+
+	const size_t numNodes = topology->nodes.size();
+	std::vector<tbb::task_group> taskGroups( numNodes );
+	for( size_t i = 0; i < numNodes; ++i )
+	{
+		topology->nodes[i]->arena.execute(
+			[&, i] {
+				taskGroups[i].run( [&f, i, numNodes] { f( i, numNodes ); } );
+			}
+		);
+	}
+
+	std::exception_ptr exception;
+	for( size_t i = 0; i < numNodes; ++i )
+	{
+		try
+		{
+			topology->nodes[i]->arena.execute( [&, i] { taskGroups[i].wait(); } );
+		}
+		catch( ... )
+		{
+			if( !exception )
+			{
+				exception = std::current_exception();
+			}
+		}
+	}
+
+	if( exception )
+	{
+		std::rethrow_exception( exception );
+	}
+}
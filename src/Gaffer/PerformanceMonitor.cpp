@@ -39,12 +39,179 @@
 #include "Gaffer/Plug.h"
 #include "Gaffer/Process.h"
 
+#include <algorithm>
+#include <cmath>
+
 using namespace Gaffer;
 
 static IECore::InternedString g_hashType( "computeNode:hash" );
 static IECore::InternedString g_computeType( "computeNode:compute" );
 static PerformanceMonitor::Statistics g_emptyStatistics;
 
+//////////////////////////////////////////////////////////////////////////
+// PerformanceMonitor::Histogram
+//////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+// Durations below `g_linearLimit` nanoseconds get a bucket each. Above that,
+// each octave is divided into `g_subBuckets` buckets.
+const int g_subBucketBits = 3;
+const size_t g_subBuckets = 1 << g_subBucketBits;
+const size_t g_linearLimit = 2 * g_subBuckets;
+
+int log2Floor( uint64_t v )
+{
+	int result = 0;
+	while( v >>= 1 )
+	{
+		result++;
+	}
+	return result;
+}
+
+bool slowProcessGreater( const PerformanceMonitor::SlowProcess &a, const PerformanceMonitor::SlowProcess &b )
+{
+	return a.duration > b.duration;
+}
+
+} // namespace
+
+PerformanceMonitor::Histogram::Histogram()
+	:	m_firstBucket( 0 ), m_count( 0 ), m_max( 0 )
+{
+}
+
+void PerformanceMonitor::Histogram::addSample( boost::chrono::nanoseconds duration )
+{
+	const size_t index = bucketIndex( duration );
+	if( m_counts.empty() )
+	{
+		m_firstBucket = index;
+		m_counts.resize( 1, 0 );
+	}
+	else if( index < m_firstBucket )
+	{
+		m_counts.insert( m_counts.begin(), m_firstBucket - index, 0 );
+		m_firstBucket = index;
+	}
+	else if( index >= m_firstBucket + m_counts.size() )
+	{
+		m_counts.resize( index - m_firstBucket + 1, 0 );
+	}
+
+	m_counts[index-m_firstBucket]++;
+	m_count++;
+	m_max = std::max( m_max, duration );
+}
+
+size_t PerformanceMonitor::Histogram::count() const
+{
+	return m_count;
+}
+
+boost::chrono::nanoseconds PerformanceMonitor::Histogram::max() const
+{
+	return m_max;
+}
+
+boost::chrono::nanoseconds PerformanceMonitor::Histogram::percentile( float p ) const
+{
+	if( !m_count )
+	{
+		return boost::chrono::nanoseconds( 0 );
+	}
+
+	const float fraction = std::clamp( p / 100.0f, 0.0f, 1.0f );
+	const size_t target = std::clamp<size_t>( static_cast<size_t>( std::ceil( fraction * m_count ) ), 1, m_count );
+	size_t accumulated = 0;
+	for( size_t i = 0; i < m_counts.size(); ++i )
+	{
+		accumulated += m_counts[i];
+		if( accumulated >= target )
+		{
+			return std::min( bucketMidpoint( m_firstBucket + i ), m_max );
+		}
+	}
+
+	return m_max;
+}
+
+PerformanceMonitor::Histogram & PerformanceMonitor::Histogram::operator += ( const Histogram &rhs )
+{
+	if( rhs.m_counts.empty() )
+	{
+		return *this;
+	}
+
+	if( m_counts.empty() )
+	{
+		*this = rhs;
+		return *this;
+	}
+
+	const size_t first = std::min( m_firstBucket, rhs.m_firstBucket );
+	const size_t end = std::max( m_firstBucket + m_counts.size(), rhs.m_firstBucket + rhs.m_counts.size() );
+	if( first < m_firstBucket )
+	{
+		m_counts.insert( m_counts.begin(), m_firstBucket - first, 0 );
+		m_firstBucket = first;
+	}
+	m_counts.resize( end - m_firstBucket, 0 );
+
+	for( size_t i = 0; i < rhs.m_counts.size(); ++i )
+	{
+		m_counts[rhs.m_firstBucket + i - m_firstBucket] += rhs.m_counts[i];
+	}
+
+	m_count += rhs.m_count;
+	m_max = std::max( m_max, rhs.m_max );
+	return *this;
+}
+
+bool PerformanceMonitor::Histogram::operator == ( const Histogram &rhs ) const
+{
+	return
+		m_count == rhs.m_count &&
+		m_max == rhs.m_max &&
+		m_firstBucket == rhs.m_firstBucket &&
+		m_counts == rhs.m_counts
+	;
+}
+
+bool PerformanceMonitor::Histogram::operator != ( const Histogram &rhs ) const
+{
+	return !( *this == rhs );
+}
+
+size_t PerformanceMonitor::Histogram::bucketIndex( boost::chrono::nanoseconds duration )
+{
+	const uint64_t v = std::max<boost::chrono::nanoseconds::rep>( duration.count(), 0 );
+	if( v < g_linearLimit )
+	{
+		return v;
+	}
+
+	const int octave = log2Floor( v );
+	const size_t subBucket = ( v >> ( octave - g_subBucketBits ) ) & ( g_subBuckets - 1 );
+	return g_linearLimit + ( octave - g_subBucketBits - 1 ) * g_subBuckets + subBucket;
+}
+
+boost::chrono::nanoseconds PerformanceMonitor::Histogram::bucketMidpoint( size_t index )
+{
+	if( index < g_linearLimit )
+	{
+		return boost::chrono::nanoseconds( index );
+	}
+
+	const int octave = ( index - g_linearLimit ) / g_subBuckets + g_subBucketBits + 1;
+	const uint64_t subBucket = ( index - g_linearLimit ) % g_subBuckets;
+	const uint64_t width = uint64_t( 1 ) << ( octave - g_subBucketBits );
+	const uint64_t lowerBound = ( g_subBuckets + subBucket ) * width;
+	return boost::chrono::nanoseconds( lowerBound + width / 2 );
+}
+
 //////////////////////////////////////////////////////////////////////////
 // PerformanceMonitor::Statistics
 //////////////////////////////////////////////////////////////////////////
@@ -60,6 +227,8 @@ PerformanceMonitor::Statistics & PerformanceMonitor::Statistics::operator += ( c
 	computeCount += rhs.computeCount;
 	hashDuration += rhs.hashDuration;
 	computeDuration += rhs.computeDuration;
+	hashHistogram += rhs.hashHistogram;
+	computeHistogram += rhs.computeHistogram;
 	return *this;
 }
 
@@ -69,7 +238,9 @@ bool PerformanceMonitor::Statistics::operator == ( const Statistics &rhs )
 		hashCount == rhs.hashCount &&
 		computeCount == rhs.computeCount &&
 		hashDuration == rhs.hashDuration &&
-		computeDuration == rhs.computeDuration
+		computeDuration == rhs.computeDuration &&
+		hashHistogram == rhs.hashHistogram &&
+		computeHistogram == rhs.computeHistogram
 	;
 }
 
@@ -82,7 +253,8 @@ bool PerformanceMonitor::Statistics::operator != ( const Statistics &rhs )
 // PerformanceMonitor
 //////////////////////////////////////////////////////////////////////////
 
-PerformanceMonitor::PerformanceMonitor()
+PerformanceMonitor::PerformanceMonitor( size_t maxSlowProcesses )
+	:	m_maxSlowProcesses( maxSlowProcesses )
 {
 }
 
@@ -113,6 +285,16 @@ const PerformanceMonitor::Statistics &PerformanceMonitor::combinedStatistics() c
 	return m_combinedStatistics;
 }
 
+size_t PerformanceMonitor::maxSlowProcesses() const
+{
+	return m_maxSlowProcesses;
+}
+
+const PerformanceMonitor::SlowProcesses &PerformanceMonitor::slowestProcesses() const
+{
+	collate();
+	return m_slowestProcesses;
+}
 
 void PerformanceMonitor::processStarted( const Process *process )
 {
@@ -127,7 +309,9 @@ void PerformanceMonitor::processStarted( const Process *process )
 	boost::chrono::high_resolution_clock::time_point now = boost::chrono::high_resolution_clock::now();
 	if( !threadData.durationStack.empty() )
 	{
-		*(threadData.durationStack.top()) += now - threadData.then;
+		ThreadData::StackEntry &top = threadData.durationStack.top();
+		*top.duration += now - threadData.then;
+		top.processDuration += now - threadData.then;
 	}
 	threadData.then = now;
 
@@ -135,12 +319,12 @@ void PerformanceMonitor::processStarted( const Process *process )
 	if( type == g_hashType )
 	{
 		s.hashCount++;
-		threadData.durationStack.push( &s.hashDuration );
+		threadData.durationStack.push( { &s.hashDuration, &s.hashHistogram, boost::chrono::nanoseconds( 0 ) } );
 	}
 	else
 	{
 		s.computeCount++;
-		threadData.durationStack.push( &s.computeDuration );
+		threadData.durationStack.push( { &s.computeDuration, &s.computeHistogram, boost::chrono::nanoseconds( 0 ) } );
 	}
 }
 
@@ -154,7 +338,33 @@ void PerformanceMonitor::processFinished( const Process *process )
 
 	ThreadData &threadData = m_threadData.local();
 	boost::chrono::high_resolution_clock::time_point now = boost::chrono::high_resolution_clock::now();
-	*(threadData.durationStack.top()) += now - threadData.then;
+	ThreadData::StackEntry &top = threadData.durationStack.top();
+	*top.duration += now - threadData.then;
+	top.processDuration += now - threadData.then;
+	top.histogram->addSample( top.processDuration );
+
+	if( m_maxSlowProcesses && top.processDuration > threadData.slowThreshold )
+	{
+		// Copying the context is relatively expensive, but we only do it
+		// for processes slower than all but `m_maxSlowProcesses` seen so far.
+		SlowProcesses &slowest = threadData.slowestProcesses;
+		slowest.push_back( {
+			process->plug(), type,
+			new Context( *process->context(), /* omitCanceller = */ true ),
+			top.processDuration
+		} );
+		std::push_heap( slowest.begin(), slowest.end(), slowProcessGreater );
+		if( slowest.size() > m_maxSlowProcesses )
+		{
+			std::pop_heap( slowest.begin(), slowest.end(), slowProcessGreater );
+			slowest.pop_back();
+		}
+		if( slowest.size() == m_maxSlowProcesses )
+		{
+			threadData.slowThreshold = slowest.front().duration;
+		}
+	}
+
 	threadData.durationStack.pop();
 	threadData.then = now;
 }
@@ -171,5 +381,24 @@ void PerformanceMonitor::collate() const
 			m_combinedStatistics += mIt->second;
 		}
 		m.clear();
+
+		m_slowestProcesses.insert( m_slowestProcesses.end(), it->slowestProcesses.begin(), it->slowestProcesses.end() );
+		it->slowestProcesses.clear();
+	}
+
+	std::sort( m_slowestProcesses.begin(), m_slowestProcesses.end(), slowProcessGreater );
+	if( m_slowestProcesses.size() > m_maxSlowProcesses )
+	{
+		m_slowestProcesses.resize( m_maxSlowProcesses );
+	}
+
+	if( m_slowestProcesses.size() == m_maxSlowProcesses && m_maxSlowProcesses )
+	{
+		// Avoid collecting processes we know will be discarded
+		// by the next collation.
+		for( it = m_threadData.begin(), eIt = m_threadData.end(); it != eIt; ++it )
+		{
+			it->slowThreshold = std::max( it->slowThreshold, m_slowestProcesses.back().duration );
+		}
 	}
 }
@@ -0,0 +1,766 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2025, Cinesite VFX Ltd. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//      * Redistributions of source code must retain the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer.
+//
+//      * Redistributions in binary form must reproduce the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer in the documentation and/or other materials provided with
+//        the distribution.
+//
+//      * Neither the name of John Haddon nor the names of
+//        any other contributors to this software may be used to endorse or
+//        promote products derived from this software without specific prior
+//        written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+#include "Gaffer/Private/PersistentCache.h"
+
+#include "Gaffer/Version.h"
+
+#include "IECore/MemoryIndexedIO.h"
+#include "IECore/MessageHandler.h"
+#include "IECore/VectorTypedData.h"
+
+#include "fmt/format.h"
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+
+#ifndef _MSC_VER
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+using namespace IECore;
+using namespace Gaffer::Private;
+
+//////////////////////////////////////////////////////////////////////////
+// File format
+//////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+// Each segment file is a sequence of records, each consisting of a
+// RecordHeader followed by `size` bytes of payload, padded to an 8 byte
+// boundary. The payload is the Object serialised via MemoryIndexedIO.
+struct RecordHeader
+{
+	uint64_t magic;
+	uint64_t key[2];
+	uint64_t checksum[2];
+	uint64_t size;
+	uint64_t headerChecksum;
+};
+
+const uint64_t g_recordMagic = 0x3143504746464147; // "GAFFGPC1"
+
+// Stored at the start of the lock file, and only accessed while holding the lock.
+// `committedSize` is the size of the current segment after the last _complete_
+// append. If a process dies while appending, the segment size won't match and
+// the next writer moves on to a new segment, so that readers never see records
+// following a torn one.
+struct LockState
+{
+	uint64_t currentSegment;
+	uint64_t committedSize;
+};
+
+uint64_t headerChecksum( const RecordHeader &header )
+{
+	MurmurHash h;
+	h.append( header.magic );
+	h.append( header.key, 2 );
+	h.append( header.checksum, 2 );
+	h.append( header.size );
+	return h.h1();
+}
+
+size_t paddedSize( size_t size )
+{
+	return ( size + 7 ) & ~size_t( 7 );
+}
+
+const std::string g_segmentPrefix = "segment";
+const std::string g_segmentExtension = ".gpc";
+
+// Returns the index of a segment file, or -1 if `path` is not a segment.
+int64_t segmentIndex( const std::filesystem::path &path )
+{
+	const std::string name = path.filename().string();
+	if(
+		name.size() <= g_segmentPrefix.size() + g_segmentExtension.size() ||
+		name.compare( 0, g_segmentPrefix.size(), g_segmentPrefix ) ||
+		name.compare( name.size() - g_segmentExtension.size(), g_segmentExtension.size(), g_segmentExtension )
+	)
+	{
+		return -1;
+	}
+
+	const std::string digits = name.substr( g_segmentPrefix.size(), name.size() - g_segmentPrefix.size() - g_segmentExtension.size() );
+	if( !std::all_of( digits.begin(), digits.end(), ::isdigit ) )
+	{
+		return -1;
+	}
+	return std::stoll( digits );
+}
+
+// Segments are rotated when they reach this fraction of the size limit, so that
+// eviction can proceed in reasonably fine-grained steps.
+size_t segmentSizeLimit( size_t sizeLimit )
+{
+	return std::clamp<size_t>( sizeLimit / 8, 1024 * 1024, 1024 * 1024 * 1024 );
+}
+
+std::string segmentFileName( const std::string &directory, size_t index )
+{
+	return fmt::format( "{}/{}{:08}{}", directory, g_segmentPrefix, index, g_segmentExtension );
+}
+
+#ifndef _MSC_VER
+
+// Holds an exclusive lock on the lock file for the lifetime of the object.
+class ScopedFileLock
+{
+
+	public :
+
+		ScopedFileLock( const std::string &fileName )
+		{
+			m_fd = ::open( fileName.c_str(), O_RDWR | O_CREAT, 0666 );
+			if( m_fd < 0 )
+			{
+				throw IECore::Exception( fmt::format( "Unable to open \"{}\" : {}", fileName, strerror( errno ) ) );
+			}
+			while( ::flock( m_fd, LOCK_EX ) != 0 )
+			{
+				if( errno != EINTR )
+				{
+					::close( m_fd );
+					throw IECore::Exception( fmt::format( "Unable to lock \"{}\" : {}", fileName, strerror( errno ) ) );
+				}
+			}
+		}
+
+		~ScopedFileLock()
+		{
+			// Closing the file releases the lock.
+			::close( m_fd );
+		}
+
+		LockState readState() const
+		{
+			LockState state = { 0, 0 };
+			if( ::pread( m_fd, &state, sizeof( state ), 0 ) != sizeof( state ) )
+			{
+				state = { 0, 0 };
+			}
+			return state;
+		}
+
+		void writeState( const LockState &state )
+		{
+			if( ::pwrite( m_fd, &state, sizeof( state ), 0 ) != sizeof( state ) )
+			{
+				throw IECore::Exception( fmt::format( "Unable to write lock state : {}", strerror( errno ) ) );
+			}
+		}
+
+	private :
+
+		int m_fd;
+
+};
+
+bool writeAll( int fd, const void *data, size_t size, off_t offset )
+{
+	const char *c = static_cast<const char *>( data );
+	while( size )
+	{
+		const ssize_t written = ::pwrite( fd, c, size, offset );
+		if( written < 0 )
+		{
+			if( errno == EINTR )
+			{
+				continue;
+			}
+			return false;
+		}
+		c += written;
+		offset += written;
+		size -= written;
+	}
+	return true;
+}
+
+// Deletes the oldest segments until the total size is within `sizeLimit`.
+// Must be called with the file lock held, so no other process is modifying
+// the directory.
+void evict( const std::string &directory, size_t sizeLimit )
+{
+	std::vector<std::pair<int64_t, uintmax_t>> segments;
+	uintmax_t totalSize = 0;
+	std::error_code errorCode;
+	for( const auto &entry : std::filesystem::directory_iterator( directory, errorCode ) )
+	{
+		const int64_t i = segmentIndex( entry.path() );
+		if( i >= 0 )
+		{
+			const uintmax_t size = std::filesystem::file_size( entry.path(), errorCode );
+			segments.push_back( { i, errorCode ? 0 : size } );
+			totalSize += segments.back().second;
+		}
+	}
+
+	std::sort( segments.begin(), segments.end() );
+
+	// Never evict the newest segment, as it's the one being appended to.
+	for( size_t i = 0; i + 1 < segments.size() && totalSize > sizeLimit; ++i )
+	{
+		std::filesystem::remove( segmentFileName( directory, segments[i].first ), errorCode );
+		totalSize -= segments[i].second;
+	}
+}
+
+#endif
+
+} // namespace
+
+//////////////////////////////////////////////////////////////////////////
+// Mapping
+//////////////////////////////////////////////////////////////////////////
+
+// A read-only memory mapping of a segment file. Mappings are shared by
+// all index entries referring to them, so that they remain valid even if
+// the segment is remapped (because it has grown) or deleted (by eviction
+// in another process).
+struct PersistentCache::Mapping : private boost::noncopyable
+{
+
+	Mapping( const std::string &fileName )
+		:	data( nullptr ), size( 0 )
+	{
+#ifndef _MSC_VER
+		const int fd = ::open( fileName.c_str(), O_RDONLY );
+		if( fd < 0 )
+		{
+			return;
+		}
+
+		struct stat s;
+		if( ::fstat( fd, &s ) == 0 && s.st_size > 0 )
+		{
+			void *m = ::mmap( nullptr, s.st_size, PROT_READ, MAP_SHARED, fd, 0 );
+			if( m != MAP_FAILED )
+			{
+				data = static_cast<const char *>( m );
+				size = s.st_size;
+			}
+		}
+		// The mapping remains valid after the file is closed.
+		::close( fd );
+#endif
+	}
+
+	~Mapping()
+	{
+#ifndef _MSC_VER
+		if( data )
+		{
+			::munmap( const_cast<char *>( data ), size );
+		}
+#endif
+	}
+
+	const char *data;
+	size_t size;
+
+};
+
+//////////////////////////////////////////////////////////////////////////
+// PersistentCache
+//////////////////////////////////////////////////////////////////////////
+
+PersistentCache::PersistentCache()
+	:	m_enabled( false ), m_sizeLimit( 1024ull * 1024 * 1024 * 16 )
+{
+}
+
+PersistentCache::~PersistentCache()
+{
+}
+
+void PersistentCache::setDirectory( const std::string &directory )
+{
+	Mutex::scoped_lock lock( m_mutex, /* write = */ true );
+	if( directory == m_directory )
+	{
+		return;
+	}
+
+	closeInternal();
+
+#ifdef _MSC_VER
+	if( !directory.empty() )
+	{
+		IECore::msg( IECore::Msg::Warning, "PersistentCache", "Persistent cache is not supported on this platform" );
+	}
+#else
+	if( !directory.empty() )
+	{
+		std::filesystem::create_directories( directory );
+		m_directory = directory;
+		refreshInternal();
+		m_enabled = true;
+	}
+#endif
+}
+
+const std::string &PersistentCache::getDirectory() const
+{
+	return m_directory;
+}
+
+bool PersistentCache::enabled() const
+{
+	return m_enabled;
+}
+
+void PersistentCache::setSizeLimit( size_t bytes )
+{
+	m_sizeLimit = bytes;
+}
+
+size_t PersistentCache::getSizeLimit() const
+{
+	return m_sizeLimit;
+}
+
+size_t PersistentCache::usage() const
+{
+	Mutex::scoped_lock lock( m_mutex, /* write = */ false );
+	size_t result = 0;
+	for( const auto &segment : m_segments )
+	{
+		result += segment.knownSize;
+	}
+	return result;
+}
+
+IECore::ConstObjectPtr PersistentCache::get( const IECore::MurmurHash &key )
+{
+	if( !enabled() )
+	{
+		return nullptr;
+	}
+
+	const MurmurHash k = storageKey( key );
+
+	Location location;
+	{
+		Mutex::scoped_lock lock( m_mutex, /* write = */ false );
+		auto it = m_index.find( k );
+		if( it == m_index.end() || !it->second.mapping )
+		{
+			// Other processes may have appended since we last looked. We don't
+			// want to hit the filesystem on every miss, so we rate-limit the
+			// refresh. Records we have appended ourselves are indexed already,
+			// but need mapping before they can be read.
+			const auto now = std::chrono::steady_clock::now();
+			if( it == m_index.end() && now - m_lastRefresh < std::chrono::seconds( 1 ) )
+			{
+				return nullptr;
+			}
+			lock.upgrade_to_writer();
+			if( now - m_lastRefresh >= std::chrono::seconds( 1 ) )
+			{
+				refreshInternal();
+			}
+			it = m_index.find( k );
+			if( it != m_index.end() && !it->second.mapping )
+			{
+				if( Segment *segment = findSegment( it->second.segment ) )
+				{
+					std::error_code errorCode;
+					const uintmax_t fileSize = std::filesystem::file_size( segmentFileName( m_directory, segment->index ), errorCode );
+					indexSegment( *segment, errorCode ? 0 : fileSize );
+				}
+				it = m_index.find( k );
+				if( it != m_index.end() && !it->second.mapping )
+				{
+					// Segment evicted by another process before we could map it.
+					m_index.erase( it );
+					return nullptr;
+				}
+			}
+			if( it == m_index.end() )
+			{
+				return nullptr;
+			}
+		}
+		location = it->second;
+	}
+
+	RecordHeader header;
+	memcpy( &header, location.mapping->data + location.offset, sizeof( header ) );
+	const char *payload = location.mapping->data + location.offset + sizeof( header );
+
+	MurmurHash checksum;
+	checksum.append( payload, header.size );
+	if( checksum.h1() != header.checksum[0] || checksum.h2() != header.checksum[1] )
+	{
+		IECore::msg( IECore::Msg::Warning, "PersistentCache", fmt::format( "Ignoring corrupt record for \"{}\"", key.toString() ) );
+		Mutex::scoped_lock lock( m_mutex, /* write = */ true );
+		m_index.erase( k );
+		return nullptr;
+	}
+
+	try
+	{
+		CharVectorDataPtr buffer = new CharVectorData;
+		buffer->writable().assign( payload, payload + header.size );
+		IndexedIOPtr io = new MemoryIndexedIO( buffer, IndexedIO::rootPath, IndexedIO::Exclusive | IndexedIO::Read );
+		return Object::load( io, "value" );
+	}
+	catch( const std::exception &e )
+	{
+		IECore::msg( IECore::Msg::Warning, "PersistentCache", fmt::format( "Unable to load \"{}\" : {}", key.toString(), e.what() ) );
+		return nullptr;
+	}
+}
+
+bool PersistentCache::set( const IECore::MurmurHash &key, const IECore::Object *value )
+{
+	if( !enabled() )
+	{
+		return false;
+	}
+
+#ifdef _MSC_VER
+	return false;
+#else
+
+	// Serialise outside of any locks.
+
+	ConstCharVectorDataPtr buffer;
+	try
+	{
+		MemoryIndexedIOPtr io = new MemoryIndexedIO( nullptr, IndexedIO::rootPath, IndexedIO::Exclusive | IndexedIO::Write );
+		value->save( io, "value" );
+		buffer = io->buffer();
+	}
+	catch( ... )
+	{
+		// Not all Object types support serialisation, and that's OK -
+		// they just won't be persisted.
+		return false;
+	}
+
+	const std::vector<char> &data = buffer->readable();
+	const size_t recordSize = sizeof( RecordHeader ) + paddedSize( data.size() );
+	const size_t sizeLimit = m_sizeLimit;
+	if( recordSize > segmentSizeLimit( sizeLimit ) )
+	{
+		return false;
+	}
+
+	const MurmurHash k = storageKey( key );
+	MurmurHash checksum;
+	checksum.append( data.data(), data.size() );
+
+	RecordHeader header;
+	header.magic = g_recordMagic;
+	header.key[0] = k.h1(); header.key[1] = k.h2();
+	header.checksum[0] = checksum.h1(); header.checksum[1] = checksum.h2();
+	header.size = data.size();
+	header.headerChecksum = headerChecksum( header );
+
+	std::string directory;
+	{
+		Mutex::scoped_lock lock( m_mutex, /* write = */ false );
+		directory = m_directory;
+	}
+
+	size_t appendedSegment = 0;
+	size_t appendedOffset = 0;
+	try
+	{
+		ScopedFileLock fileLock( directory + "/lock" );
+		LockState state = fileLock.readState();
+
+		int fd = ::open( segmentFileName( directory, state.currentSegment ).c_str(), O_WRONLY | O_CREAT, 0666 );
+		struct stat s;
+		const bool valid = fd >= 0 && ::fstat( fd, &s ) == 0 && (uint64_t)s.st_size == state.committedSize;
+		bool rotated = false;
+		if( !valid || state.committedSize + recordSize > segmentSizeLimit( sizeLimit ) )
+		{
+			// Start a new segment, making sure not to clash with any segments
+			// left over from a previous lock file.
+			if( fd >= 0 )
+			{
+				::close( fd );
+			}
+			uint64_t newIndex = state.currentSegment + 1;
+			for( const auto &entry : std::filesystem::directory_iterator( directory ) )
+			{
+				const int64_t i = segmentIndex( entry.path() );
+				if( i >= 0 )
+				{
+					newIndex = std::max<uint64_t>( newIndex, i + 1 );
+				}
+			}
+			state = { newIndex, 0 };
+			fd = ::open( segmentFileName( directory, state.currentSegment ).c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0666 );
+			rotated = true;
+		}
+
+		if( fd < 0 )
+		{
+			return false;
+		}
+
+		static const char g_padding[8] = { 0, 0, 0, 0, 0, 0, 0, 0 };
+		const bool written =
+			writeAll( fd, &header, sizeof( header ), state.committedSize ) &&
+			writeAll( fd, data.data(), data.size(), state.committedSize + sizeof( header ) ) &&
+			writeAll( fd, g_padding, paddedSize( data.size() ) - data.size(), state.committedSize + sizeof( header ) + data.size() )
+		;
+		::close( fd );
+
+		if( !written )
+		{
+			// Leave `committedSize` as it is, so the next writer
+			// starts a new segment.
+			return false;
+		}
+
+		appendedSegment = state.currentSegment;
+		appendedOffset = state.committedSize;
+		state.committedSize += recordSize;
+		fileLock.writeState( state );
+
+		if( rotated )
+		{
+			evict( directory, sizeLimit );
+		}
+	}
+	catch( const std::exception &e )
+	{
+		IECore::msg( IECore::Msg::Warning, "PersistentCache", e.what() );
+		return false;
+	}
+
+	// Index our own record directly, rather than rescanning the directory
+	// to find it. It is mapped lazily the first time it is read back, which
+	// is rare because the value is already in the in-memory cache. We only
+	// take `m_mutex` now the file lock has been released, because `clear()`
+	// acquires them in the opposite order.
+
+	Mutex::scoped_lock lock( m_mutex, /* write = */ true );
+	if( m_directory == directory )
+	{
+		Segment *segment = findSegment( appendedSegment );
+		if( !segment )
+		{
+			m_segments.push_back( { appendedSegment, nullptr, 0, 0, 0 } );
+			segment = &m_segments.back();
+		}
+		segment->knownSize = std::max( segment->knownSize, appendedOffset + recordSize );
+		m_index.emplace( k, Location{ appendedSegment, nullptr, appendedOffset } );
+	}
+
+	return true;
+
+#endif
+}
+
+void PersistentCache::clear()
+{
+	Mutex::scoped_lock lock( m_mutex, /* write = */ true );
+	if( m_directory.empty() )
+	{
+		return;
+	}
+
+#ifndef _MSC_VER
+	// Continue numbering from the last segment rather than starting again
+	// from zero. Other processes may still have the old segments indexed,
+	// and if we reused their indices they would mistake the new records for
+	// appends to the old segments. With fresh indices, they see the old
+	// segments disappear on their next refresh and forget them.
+	ScopedFileLock fileLock( m_directory + "/lock" );
+	uint64_t nextIndex = fileLock.readState().currentSegment + 1;
+	for( const auto &entry : std::filesystem::directory_iterator( m_directory ) )
+	{
+		const int64_t i = segmentIndex( entry.path() );
+		if( i >= 0 )
+		{
+			nextIndex = std::max<uint64_t>( nextIndex, i + 1 );
+			std::filesystem::remove( entry.path() );
+		}
+	}
+	fileLock.writeState( { nextIndex, 0 } );
+#endif
+
+	m_segments.clear();
+	m_index.clear();
+}
+
+void PersistentCache::refreshInternal()
+{
+	m_lastRefresh = std::chrono::steady_clock::now();
+
+	// Pairs of segment index and file size.
+	std::vector<std::pair<size_t, size_t>> files;
+	std::error_code errorCode;
+	for( const auto &entry : std::filesystem::directory_iterator( m_directory, errorCode ) )
+	{
+		const int64_t i = segmentIndex( entry.path() );
+		if( i >= 0 )
+		{
+			std::error_code sizeErrorCode;
+			const uintmax_t size = entry.file_size( sizeErrorCode );
+			files.push_back( { i, sizeErrorCode ? 0 : size } );
+		}
+	}
+	std::sort( files.begin(), files.end() );
+
+	// Forget segments that have been evicted by other processes.
+
+	std::vector<Segment> segments;
+	for( auto &segment : m_segments )
+	{
+		auto fileIt = std::lower_bound( files.begin(), files.end(), std::make_pair( segment.index, size_t( 0 ) ) );
+		if( fileIt != files.end() && fileIt->first == segment.index )
+		{
+			segments.push_back( segment );
+		}
+		else
+		{
+			for( auto it = m_index.begin(); it != m_index.end(); )
+			{
+				if( it->second.segment == segment.index )
+				{
+					it = m_index.erase( it );
+				}
+				else
+				{
+					++it;
+				}
+			}
+		}
+	}
+	m_segments = segments;
+
+	// Add new segments, and index any records appended since we last
+	// looked. Segments which haven't changed size are left alone, so
+	// we don't remap them unnecessarily.
+
+	for( const auto &[index, fileSize] : files )
+	{
+		Segment *segment = findSegment( index );
+		if( !segment )
+		{
+			m_segments.push_back( { index, nullptr, 0, 0, 0 } );
+			segment = &m_segments.back();
+		}
+		indexSegment( *segment, fileSize );
+	}
+}
+
+PersistentCache::Segment *PersistentCache::findSegment( size_t index )
+{
+	auto it = std::find_if( m_segments.begin(), m_segments.end(), [index] ( const Segment &s ) { return s.index == index; } );
+	return it != m_segments.end() ? &*it : nullptr;
+}
+
+void PersistentCache::indexSegment( Segment &segment, size_t fileSize )
+{
+	if( fileSize == segment.fileSize )
+	{
+		return;
+	}
+	segment.fileSize = fileSize;
+
+	MappingPtr mapping = std::make_shared<Mapping>( segmentFileName( m_directory, segment.index ) );
+	if( !mapping->data || mapping->size <= segment.indexedSize )
+	{
+		return;
+	}
+
+	// Records already indexed keep a reference to the previous mapping, which will
+	// be unmapped when they are all gone. This means that readers never need to
+	// worry about a mapping changing underneath them.
+	segment.mapping = mapping;
+
+	size_t offset = segment.indexedSize;
+	while( offset + sizeof( RecordHeader ) <= mapping->size )
+	{
+		RecordHeader header;
+		memcpy( &header, mapping->data + offset, sizeof( header ) );
+		if( header.magic != g_recordMagic || header.headerChecksum != headerChecksum( header ) )
+		{
+			// Torn or partially-written record. No valid records can
+			// follow it, because writers move on to a new segment.
+			break;
+		}
+
+		const size_t recordSize = sizeof( RecordHeader ) + paddedSize( header.size );
+		if( offset + recordSize > mapping->size )
+		{
+			// Still being written. We'll pick it up next time.
+			break;
+		}
+
+		m_index[MurmurHash( header.key[0], header.key[1] )] = { segment.index, mapping, offset };
+		offset += recordSize;
+	}
+
+	segment.indexedSize = offset;
+	segment.knownSize = std::max( segment.knownSize, offset );
+}
+
+void PersistentCache::closeInternal()
+{
+	m_enabled = false;
+	m_directory.clear();
+	m_segments.clear();
+	m_index.clear();
+}
+
+IECore::MurmurHash PersistentCache::storageKey( const IECore::MurmurHash &key ) const
+{
+	// Hashes are not guaranteed to be stable between Gaffer versions, and
+	// neither is the data a compute produces. Salt the key with the version
+	// so that processes running different versions can share a directory
+	// without conflict.
+	static const std::string g_version = Gaffer::versionString();
+	MurmurHash result( key );
+	result.append( g_version );
+	return result;
+}
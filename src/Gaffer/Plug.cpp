@@ -56,6 +56,8 @@
 
 #include "fmt/format.h"
 
+#include <atomic>
+
 using namespace boost;
 using namespace Gaffer;
 
@@ -66,6 +68,17 @@ using namespace Gaffer;
 namespace
 {
 
+// Incremented whenever a change is made that could affect the plugs
+// returned by `DownstreamIterator::appendDownstreamPlugs()`, so that cached
+// results can be invalidated. We assume that `DependencyNode::affects()`
+// depends only on the plugs of the node and their connections.
+std::atomic<uint64_t> g_dependencyGraphEpoch( 0 );
+
+void dependencyGraphChanged()
+{
+	g_dependencyGraphEpoch.fetch_add( 1, std::memory_order_relaxed );
+}
+
 bool allDescendantInputsAreNull( const Plug *plug )
 {
 	for( Plug::RecursiveIterator it( plug ); !it.done(); ++it )
@@ -183,6 +196,7 @@ void Plug::setFlags( unsigned flags, bool enable )
 void Plug::setFlagsInternal( unsigned flags )
 {
 	m_flags = flags;
+	dependencyGraphChanged();
 }
 
 // The implementation of acceptsInputInternal() checks
@@ -427,6 +441,7 @@ void Plug::setInput( PlugPtr input, bool setChildInputs, bool updateParentInput
 
 void Plug::setInputInternal( PlugPtr input, bool emit )
 {
+	dependencyGraphChanged();
 	if( m_input )
 	{
 		m_input->m_outputs.remove( this );
@@ -553,6 +568,7 @@ PlugPtr Plug::createCounterpart( const std::string &name, Direction direction )
 void Plug::nameChanged( IECore::InternedString oldName )
 {
 	GraphComponent::nameChanged( oldName );
+	dependencyGraphChanged();
 	propagateDirtinessAtLeaves( this );
 }
 
@@ -649,6 +665,7 @@ void Plug::parentChanging( Gaffer::GraphComponent *newParent )
 void Plug::parentChanged( Gaffer::GraphComponent *oldParent )
 {
 	GraphComponent::parentChanged( oldParent );
+	dependencyGraphChanged();
 
 	if( node() )
 	{
@@ -734,7 +751,7 @@ class Plug::DirtyPlugs
 	public :
 
 		DirtyPlugs()
-			:	m_scopeCount( 0 ), m_emitting( false )
+			:	m_scopeCount( 0 ), m_emitting( false ), m_downstreamEpoch( 0 ), m_traversalDepth( 0 )
 		{
 		}
 
@@ -754,28 +771,66 @@ class Plug::DirtyPlugs
 				return;
 			}
 
-			for( DownstreamIterator it( plugToDirty ); !it.done(); ++it )
+			// We may be reentered if `affects()` triggers a garbage
+			// collection in Python, causing plugs to be destroyed. Only
+			// the outermost traversal may use the cache, because only
+			// it can safely clear it.
+			const bool useCache = m_traversalDepth == 0;
+			if( useCache )
 			{
+				const uint64_t epoch = g_dependencyGraphEpoch.load( std::memory_order_relaxed );
+				if( epoch != m_downstreamEpoch )
+				{
+					clearDownstreamCache();
+					m_downstreamEpoch = epoch;
+				}
+			}
+			Private::ScopedAssignment<size_t> scopedDepth( m_traversalDepth, m_traversalDepth + 1 );
+
+			// Depth-first traversal, visiting plugs in the same order as
+			// a DownstreamIterator would, but using `m_downstreamRanges`
+			// to avoid repeated calls to `DependencyNode::affects()`.
+			std::vector<Level> traversal;
+			traversal.push_back( downstreamLevel( plugToDirty, useCache ) );
+			while( !traversal.empty() )
+			{
+				Level &level = traversal.back();
+				if( level.index == level.end )
+				{
+					traversal.pop_back();
+					continue;
+				}
+
 				// The `const_casts()` are harmless because we're starting iteration from
-				// a non-const plug. But they are necessary because DownstreamIterator
-				// doesn't currently have a non-const form, and always yields const plugs.
-				InsertedVertex v = insertVertex( const_cast<Plug *>( &*it ) );
-				if( !it->getFlags( Plug::AcceptsDependencyCycles ) )
+				// a non-const plug. But they are necessary because `affects()` always
+				// yields const plugs.
+				Plug *upstream = const_cast<Plug *>( level.upstream );
+				Plug *plug = const_cast<Plug *>( level.cached ? m_downstreamPlugs[level.index] : m_uncachedPlugs[level.index] );
+				level.index++;
+
+				InsertedVertex v = insertVertex( plug );
+				if( !plug->getFlags( Plug::AcceptsDependencyCycles ) )
 				{
 					add_edge(
 						v.first,
-						insertVertex( const_cast<Plug *>( it.upstream() ) ).first,
+						insertVertex( upstream ).first,
 						m_graph
 					);
 				}
 
-				if( !v.second )
+				if( v.second )
 				{
-					// Already visited this plug by another path,
-					// so we can prune the iteration.
-					it.prune();
+					// First visit, so continue downstream. If we've
+					// already visited this plug by another path, we
+					// prune the traversal.
+					traversal.push_back( downstreamLevel( plug, useCache ) );
 				}
 			}
+
+			if( useCache )
+			{
+				m_uncachedPlugs.clear();
+			}
 		}
 
 		void pushScope()
@@ -824,6 +879,63 @@ class Plug::DirtyPlugs
 		// on the graph to give us an appropriate order to emit the dirty
 		// signals in, so that dirtiness is only signalled for an affected plug
 		// after it has been signalled for all upstream dirty plugs.
+		// Plugs immediately downstream of each plug, stored in compressed
+		// sparse row form. Ranges index into `m_downstreamPlugs`, and are
+		// cleared whenever `g_dependencyGraphEpoch` changes, so that the
+		// potentially expensive `DependencyNode::affects()` is only called
+		// again after the structure of the graph is edited. Results which
+		// couldn't be cached are stored in `m_uncachedPlugs` for the
+		// duration of a single traversal.
+		using DownstreamRanges = std::unordered_map<const Plug *, std::pair<size_t, size_t>>;
+
+		struct Level
+		{
+			const Plug *upstream;
+			size_t index;
+			size_t end;
+			bool cached;
+		};
+
+		Level downstreamLevel( const Plug *plug, bool useCache )
+		{
+			if( !useCache )
+			{
+				const size_t begin = m_uncachedPlugs.size();
+				DownstreamIterator::appendDownstreamPlugs( plug, m_uncachedPlugs );
+				return { plug, begin, m_uncachedPlugs.size(), false };
+			}
+
+			auto it = m_downstreamRanges.find( plug );
+			if( it != m_downstreamRanges.end() )
+			{
+				return { plug, it->second.first, it->second.second, true };
+			}
+
+			const size_t begin = m_downstreamPlugs.size();
+			if( DownstreamIterator::appendDownstreamPlugs( plug, m_downstreamPlugs ) )
+			{
+				m_downstreamRanges[plug] = { begin, m_downstreamPlugs.size() };
+				return { plug, begin, m_downstreamPlugs.size(), true };
+			}
+
+			const size_t uncachedBegin = m_uncachedPlugs.size();
+			m_uncachedPlugs.insert( m_uncachedPlugs.end(), m_downstreamPlugs.begin() + begin, m_downstreamPlugs.end() );
+			m_downstreamPlugs.resize( begin );
+			return { plug, uncachedBegin, m_uncachedPlugs.size(), false };
+		}
+
+		void clearDownstreamCache()
+		{
+			if( m_downstreamRanges.empty() )
+			{
+				return;
+			}
+			// See comments in `emit()` for why we swap rather than clear.
+			DownstreamRanges emptyRanges;
+			m_downstreamRanges.swap( emptyRanges );
+			m_downstreamPlugs.clear();
+		}
+
 		using Graph = boost::adjacency_list<vecS, vecS, directedS, PlugPtr>;
 		using VertexDescriptor = Graph::vertex_descriptor;
 		using EdgeDescriptor = Graph::edge_descriptor;
@@ -965,6 +1077,12 @@ class Plug::DirtyPlugs
 		bool m_flushPending;
 		bool m_emitting;
 
+		uint64_t m_downstreamEpoch;
+		DownstreamRanges m_downstreamRanges;
+		DependencyNode::AffectedPlugsContainer m_downstreamPlugs;
+		DependencyNode::AffectedPlugsContainer m_uncachedPlugs;
+		size_t m_traversalDepth;
+
 };
 
 void Plug::propagateDirtiness( Plug *plugToDirty )
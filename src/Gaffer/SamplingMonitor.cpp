@@ -0,0 +1,239 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2025, Cinesite VFX Ltd. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//      * Redistributions of source code must retain the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer.
+//
+//      * Redistributions in binary form must reproduce the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer in the documentation and/or other materials provided with
+//        the distribution.
+//
+//      * Neither the name of John Haddon nor the names of
+//        any other contributors to this software may be used to endorse or
+//        promote products derived from this software without specific prior
+//        written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+#include "Gaffer/SamplingMonitor.h"
+
+#include "Gaffer/Plug.h"
+#include "Gaffer/Process.h"
+#include "Gaffer/TypeIds.h"
+
+#include "IECore/Exception.h"
+
+#include "boost/unordered_set.hpp"
+
+#include "fmt/format.h"
+
+#include <fstream>
+
+using namespace Gaffer;
+
+//////////////////////////////////////////////////////////////////////////
+// Statistics
+//////////////////////////////////////////////////////////////////////////
+
+SamplingMonitor::Statistics::Statistics( size_t inclusiveSamples, size_t exclusiveSamples )
+	:	inclusiveSamples( inclusiveSamples ), exclusiveSamples( exclusiveSamples )
+{
+}
+
+SamplingMonitor::Statistics &SamplingMonitor::Statistics::operator += ( const Statistics &rhs )
+{
+	inclusiveSamples += rhs.inclusiveSamples;
+	exclusiveSamples += rhs.exclusiveSamples;
+	return *this;
+}
+
+bool SamplingMonitor::Statistics::operator == ( const Statistics &rhs ) const
+{
+	return inclusiveSamples == rhs.inclusiveSamples && exclusiveSamples == rhs.exclusiveSamples;
+}
+
+bool SamplingMonitor::Statistics::operator != ( const Statistics &rhs ) const
+{
+	return !( *this == rhs );
+}
+
+//////////////////////////////////////////////////////////////////////////
+// SamplingMonitor
+//////////////////////////////////////////////////////////////////////////
+
+SamplingMonitor::ThreadData::ThreadData()
+	:	depth( 0 )
+{
+	for( auto &plug : stack )
+	{
+		plug.store( nullptr, std::memory_order_relaxed );
+	}
+}
+
+SamplingMonitor::SamplingMonitor( std::chrono::microseconds interval )
+	:	m_interval( interval ), m_stop( false ), m_numSamples( 0 )
+{
+	m_samplingThread = std::thread(
+		[this] {
+			std::unique_lock<std::mutex> lock( m_mutex );
+			while( !m_stopCondition.wait_for( lock, m_interval, [this] { return m_stop; } ) )
+			{
+				sample();
+			}
+		}
+	);
+}
+
+SamplingMonitor::~SamplingMonitor()
+{
+	{
+		std::lock_guard<std::mutex> lock( m_mutex );
+		m_stop = true;
+	}
+	m_stopCondition.notify_one();
+	m_samplingThread.join();
+}
+
+std::chrono::microseconds SamplingMonitor::interval() const
+{
+	return m_interval;
+}
+
+SamplingMonitor::StatisticsMap SamplingMonitor::allStatistics() const
+{
+	std::lock_guard<std::mutex> lock( m_mutex );
+	StatisticsMap result;
+	for( const auto &[plug, statistics] : m_statistics )
+	{
+		result[plug] = statistics;
+	}
+	return result;
+}
+
+SamplingMonitor::Statistics SamplingMonitor::plugStatistics( const Plug *plug ) const
+{
+	std::lock_guard<std::mutex> lock( m_mutex );
+	auto it = m_statistics.find( plug );
+	return it != m_statistics.end() ? it->second : Statistics();
+}
+
+size_t SamplingMonitor::numSamples() const
+{
+	std::lock_guard<std::mutex> lock( m_mutex );
+	return m_numSamples;
+}
+
+void SamplingMonitor::writeFlameGraph( const std::string &fileName ) const
+{
+	std::ofstream file( fileName );
+	if( !file.good() )
+	{
+		throw IECore::Exception( fmt::format( "Unable to open file \"{}\"", fileName ) );
+	}
+
+	std::lock_guard<std::mutex> lock( m_mutex );
+	for( const auto &[stack, count] : m_stacks )
+	{
+		std::string line;
+		for( const Plug *plug : stack )
+		{
+			if( !line.empty() )
+			{
+				line += ";";
+			}
+			line += plug->relativeName( plug->ancestor( (IECore::TypeId)ScriptNodeTypeId ) );
+		}
+		file << line << " " << count << "\n";
+	}
+
+	if( !file.good() )
+	{
+		throw IECore::Exception( fmt::format( "Error writing file \"{}\"", fileName ) );
+	}
+}
+
+void SamplingMonitor::processStarted( const Process *process )
+{
+	bool exists;
+	ThreadData &threadData = m_threadData.local( exists );
+	if( !exists )
+	{
+		std::lock_guard<std::mutex> lock( m_mutex );
+		m_threads.push_back( &threadData );
+	}
+
+	const size_t depth = threadData.depth.load( std::memory_order_relaxed );
+	if( depth < ThreadData::maxDepth )
+	{
+		auto inserted = threadData.plugs.try_emplace( process->plug() );
+		if( inserted.second )
+		{
+			inserted.first->second = process->plug();
+		}
+		threadData.stack[depth].store( process->plug(), std::memory_order_relaxed );
+	}
+	threadData.depth.store( depth + 1, std::memory_order_release );
+}
+
+void SamplingMonitor::processFinished( const Process *process )
+{
+	ThreadData &threadData = m_threadData.local();
+	threadData.depth.store( threadData.depth.load( std::memory_order_relaxed ) - 1, std::memory_order_release );
+}
+
+void SamplingMonitor::sample()
+{
+	// Called with `m_mutex` held.
+
+	std::vector<const Plug *> stack;
+	boost::unordered_set<const Plug *> visited;
+	for( ThreadData *threadData : m_threads )
+	{
+		const size_t depth = std::min( threadData->depth.load( std::memory_order_acquire ), ThreadData::maxDepth );
+		if( !depth )
+		{
+			continue;
+		}
+
+		// The thread may push and pop while we read its stack, so
+		// the snapshot may not be exactly consistent. But all plugs
+		// are kept alive by `ThreadData::plugs`, and occasional
+		// inaccuracy is inherent to sampling anyway.
+		stack.clear();
+		for( size_t i = 0; i < depth; ++i )
+		{
+			stack.push_back( threadData->stack[i].load( std::memory_order_relaxed ) );
+		}
+
+		m_numSamples++;
+		m_statistics[stack.back()].exclusiveSamples++;
+		visited.clear();
+		for( const Plug *plug : stack )
+		{
+			// Count recursive appearances only once.
+			if( visited.insert( plug ).second )
+			{
+				m_statistics[plug].inclusiveSamples++;
+			}
+		}
+		m_stacks[stack]++;
+	}
+}
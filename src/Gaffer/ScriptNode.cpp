@@ -44,6 +44,7 @@
 #include "Gaffer/Container.inl"
 #include "Gaffer/Context.h"
 #include "Gaffer/DependencyNode.h"
+#include "Gaffer/Metadata.h"
 #include "Gaffer/MetadataAlgo.h"
 #include "Gaffer/StandardSet.h"
 #include "Gaffer/StringPlug.h"
@@ -58,7 +59,10 @@
 
 #include "fmt/format.h"
 
+#include <atomic>
 #include <fstream>
+#include <mutex>
+#include <unordered_map>
 
 // Help MSVC check if a file is writable
 #ifndef _MSC_VER
@@ -214,9 +218,13 @@ IE_CORE_DEFINERUNTIMETYPED( ScriptNode::CompoundAction );
 namespace
 {
 
+const std::filesystem::path g_binaryExtension( ".gfrb" );
+// Binary serialisations start with a null byte, which Python ones never do.
+const char g_binaryPrefix = '\0';
+
 std::string readFile( const std::filesystem::path &fileName )
 {
-	std::ifstream f( fileName.c_str() );
+	std::ifstream f( fileName.c_str(), std::ios::binary );
 	if( !f.good() )
 	{
 		throw IECore::IOException( "Unable to open file \"" + fileName.string() + "\"" );
@@ -224,6 +232,21 @@ std::string readFile( const std::filesystem::path &fileName )
 
 	const IECore::Canceller *canceller = Context::current()->canceller();
 
+	if( f.peek() == g_binaryPrefix )
+	{
+		// Binary serialisation. This must be read verbatim, and it is quick
+		// enough to do so that there's no need to check for cancellation.
+		std::string s( ( std::istreambuf_iterator<char>( f ) ), std::istreambuf_iterator<char>() );
+		if( f.bad() )
+		{
+			throw IECore::IOException( "Failed to read from \"" + fileName.string() + "\"" );
+		}
+		return s;
+	}
+
+	f.close();
+	f.open( fileName.c_str() );
+
 	std::string s;
 	while( !f.eof() )
 	{
@@ -333,6 +356,219 @@ class ScriptNode::FocusSet : public Gaffer::Set
 		Signals::ScopedConnection m_nodeParentChangedConnection;
 };
 
+//////////////////////////////////////////////////////////////////////////
+// EditTracker implementation. We use this to track edits to the child
+// nodes of the script, so that the serialisations of unchanged nodes can
+// be reused between saves.
+//////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+// Global rather than per-script, so that a count is never reused for a
+// different node, even if it is allocated at the address of a deleted one.
+std::atomic<uint64_t> g_editCount( 0 );
+
+} // namespace
+
+class ScriptNode::EditTracker : boost::noncopyable
+{
+
+	public :
+
+		EditTracker( ScriptNode *script )
+			:	m_script( script )
+		{
+			m_scriptConnections.push_back( script->childAddedSignal().connect( boost::bind( &EditTracker::scriptChildAdded, this, ::_2 ) ) );
+			m_scriptConnections.push_back( script->childRemovedSignal().connect( boost::bind( &EditTracker::scriptChildRemoved, this, ::_2 ) ) );
+			m_scriptConnections.push_back( script->actionSignal().connect( boost::bind( &EditTracker::action, this, ::_2 ) ) );
+		}
+
+		uint64_t editCount( const Node *node ) const
+		{
+			std::lock_guard<std::mutex> lock( m_mutex );
+			auto it = m_nodes.find( node );
+			return it != m_nodes.end() ? it->second.editCount : 0;
+		}
+
+	private :
+
+		using Connections = std::vector<Signals::ScopedConnection>;
+
+		void scriptChildAdded( GraphComponent *child )
+		{
+			Node *node = IECore::runTimeCast<Node>( child );
+			if( !node )
+			{
+				return;
+			}
+
+			Connections connections;
+			connect( node, connections );
+
+			std::lock_guard<std::mutex> lock( m_mutex );
+			NodeEdits &edits = m_nodes[node];
+			edits.editCount = ++g_editCount;
+			edits.connections = std::move( connections );
+		}
+
+		void scriptChildRemoved( GraphComponent *child )
+		{
+			std::lock_guard<std::mutex> lock( m_mutex );
+			m_nodes.erase( static_cast<const GraphComponent *>( child ) );
+		}
+
+		// Connects to all the signals which notify us of edits to `node`
+		// and any nodes nested inside it.
+		void connect( Node *node, Connections &connections )
+		{
+			connections.push_back( node->plugSetSignal().connect( boost::bind( &EditTracker::edited, this, ::_1 ) ) );
+			connections.push_back( node->plugInputChangedSignal().connect( boost::bind( &EditTracker::edited, this, ::_1 ) ) );
+			connections.push_back( node->plugDirtiedSignal().connect( boost::bind( &EditTracker::plugDirtied, this, ::_1 ) ) );
+			connections.push_back( node->nameChangedSignal().connect( boost::bind( &EditTracker::nameChanged, this, ::_1 ) ) );
+			connections.push_back( node->childAddedSignal().connect( boost::bind( &EditTracker::childAdded, this, ::_1, ::_2 ) ) );
+			connections.push_back( node->childRemovedSignal().connect( boost::bind( &EditTracker::edited, this, ::_1 ) ) );
+			connections.push_back( node->childrenReorderedSignal().connect( boost::bind( &EditTracker::edited, this, ::_1 ) ) );
+			connections.push_back( Metadata::nodeValueChangedSignal( node ).connect( boost::bind( &EditTracker::metadataChanged, this, ::_1, ::_3 ) ) );
+			connections.push_back( Metadata::plugValueChangedSignal( node ).connect( boost::bind( &EditTracker::metadataChanged, this, ::_1, ::_3 ) ) );
+
+			for( const auto &child : Node::Range( *node ) )
+			{
+				connect( child.get(), connections );
+			}
+		}
+
+		void edited( const GraphComponent *graphComponent )
+		{
+			if( const Node *node = topLevelNode( graphComponent ) )
+			{
+				nodeEdited( node );
+			}
+		}
+
+		void nodeEdited( const Node *node )
+		{
+			std::lock_guard<std::mutex> lock( m_mutex );
+			auto it = m_nodes.find( node );
+			if( it != m_nodes.end() )
+			{
+				it->second.editCount = ++g_editCount;
+			}
+		}
+
+		void plugDirtied( const Plug *plug )
+		{
+			// Plugs are also dirtied by edits made upstream, which don't
+			// affect our serialisation. But an unconnected input can only
+			// be dirtied by an edit to the plug itself, such as adding it
+			// to the node.
+			if( plug->direction() == Plug::In && !plug->getInput() )
+			{
+				edited( plug );
+			}
+		}
+
+		void nameChanged( const GraphComponent *graphComponent )
+		{
+			edited( graphComponent );
+			// Downstream nodes refer to us by name when serialising
+			// their connections.
+			outputsEdited( graphComponent );
+		}
+
+		void childAdded( GraphComponent *parent, GraphComponent *child )
+		{
+			const Node *node = topLevelNode( parent );
+			if( !node )
+			{
+				return;
+			}
+
+			Connections connections;
+			if( auto childNode = IECore::runTimeCast<Node>( child ) )
+			{
+				connect( childNode, connections );
+			}
+
+			std::lock_guard<std::mutex> lock( m_mutex );
+			auto it = m_nodes.find( node );
+			if( it != m_nodes.end() )
+			{
+				it->second.editCount = ++g_editCount;
+				std::move( connections.begin(), connections.end(), std::back_inserter( it->second.connections ) );
+			}
+		}
+
+		void metadataChanged( const GraphComponent *graphComponent, Metadata::ValueChangedReason reason )
+		{
+			if( reason == Metadata::ValueChangedReason::InstanceRegistration || reason == Metadata::ValueChangedReason::InstanceDeregistration )
+			{
+				edited( graphComponent );
+			}
+		}
+
+		void action( const Action *action )
+		{
+			// This catches any undoable edit we're not already notified
+			// of by the signals above, including renaming of plugs
+			// referred to by downstream nodes.
+			const GraphComponent *subject = action->subject();
+			edited( subject );
+			if( IECore::runTimeCast<const Plug>( subject ) )
+			{
+				outputsEdited( subject );
+			}
+		}
+
+		void outputsEdited( const GraphComponent *graphComponent )
+		{
+			const Node *node = topLevelNode( graphComponent );
+			auto visit = [&] ( const Plug *plug ) {
+				for( const auto &output : plug->outputs() )
+				{
+					const Node *outputNode = topLevelNode( output );
+					if( outputNode && outputNode != node )
+					{
+						nodeEdited( outputNode );
+					}
+				}
+			};
+
+			if( auto plug = IECore::runTimeCast<const Plug>( graphComponent ) )
+			{
+				visit( plug );
+			}
+			for( const auto &plug : Plug::RecursiveRange( *graphComponent ) )
+			{
+				visit( plug.get() );
+			}
+		}
+
+		const Node *topLevelNode( const GraphComponent *graphComponent ) const
+		{
+			while( graphComponent && graphComponent->parent() != m_script )
+			{
+				graphComponent = graphComponent->parent();
+			}
+			return IECore::runTimeCast<const Node>( graphComponent );
+		}
+
+		struct NodeEdits
+		{
+			uint64_t editCount = 0;
+			// Connections for the node and all its descendant nodes.
+			Connections connections;
+		};
+
+		const ScriptNode *m_script;
+		Connections m_scriptConnections;
+		// Edits are tracked on the UI thread, but `editCount()` may be
+		// called from a background save.
+		mutable std::mutex m_mutex;
+		std::unordered_map<const GraphComponent *, NodeEdits> m_nodes;
+
+};
+
 
 //////////////////////////////////////////////////////////////////////////
 // ScriptNode implementation
@@ -352,7 +588,8 @@ ScriptNode::ScriptNode( const std::string &name )
 	m_undoIterator( m_undoList.end() ),
 	m_currentActionStage( Action::Invalid ),
 	m_executing( false ),
-	m_context( new Context )
+	m_context( new Context ),
+	m_editTracker( new EditTracker( this ) )
 {
 	storeIndexOfNextChild( g_firstPlugIndex );
 
@@ -820,11 +1057,17 @@ std::string ScriptNode::serialise( const Node *parent, const Set *filter ) const
 	return serialiseInternal( parent, filter );
 }
 
+uint64_t ScriptNode::editCount( const Node *node ) const
+{
+	return m_editTracker->editCount( node );
+}
+
 void ScriptNode::serialiseToFile( const std::filesystem::path &fileName, const Node *parent, const Set *filter ) const
 {
-	std::string s = serialiseInternal( parent, filter );
+	const bool binary = fileName.extension() == g_binaryExtension;
+	std::string s = serialiseInternal( parent, filter, binary );
 
-	std::ofstream f( fileName.c_str() );
+	std::ofstream f( fileName.c_str(), binary ? std::ios::binary : std::ios::out );
 	if( !f.good() )
 	{
 		throw IECore::IOException( "Unable to open file \"" + fileName.string() + "\"" );
@@ -888,14 +1131,18 @@ bool ScriptNode::importFile( const std::filesystem::path &fileName, Node *parent
 
 	StandardSetPtr nodeSet = new StandardSet();
 	nodeSet->add( Node::Iterator( script.get() ), Node::Iterator( script->children().end(), script->children().end() ) );
-	const std::string nodeSerialisation = script->serialise( script.get(), nodeSet.get() );
+	// Binary files are reserialised in the binary format, so that the import
+	// is as quick as the load. Everything else goes through the original
+	// Python serialisation, so that text scripts are imported exactly as before.
+	const bool binary = fileName.extension() == g_binaryExtension;
+	const std::string nodeSerialisation = script->serialiseInternal( script.get(), nodeSet.get(), binary );
 
 	result |= execute( nodeSerialisation, parent, continueOnError );
 
 	return result;
 }
 
-std::string ScriptNode::serialiseInternal( const Node *parent, const Set *filter ) const
+std::string ScriptNode::serialiseInternal( const Node *parent, const Set *filter, bool binary ) const
 {
 	if( !g_serialiseFunction )
 	{
@@ -907,9 +1154,17 @@ std::string ScriptNode::serialiseInternal( const Node *parent, const Set *filter
 	{
 		static const bool includeParentMetadata = true;
 		scope.set( "serialiser:includeParentMetadata", &includeParentMetadata );
+		if( !binary )
+		{
+			// Whole script serialisations are made repeatedly by `save()`
+			// and by backups, so we cache the serialisations of unchanged
+			// nodes for reuse.
+			std::lock_guard<std::mutex> lock( m_serialisationCacheMutex );
+			return g_serialiseFunction( this, filter, binary, &m_serialisationCache );
+		}
 	}
 
-	return g_serialiseFunction( parent ? parent : this, filter );
+	return g_serialiseFunction( parent ? parent : this, filter, binary, nullptr );
 }
 
 bool ScriptNode::executeInternal( const std::string &serialisation, Node *parent, bool continueOnError, const std::string &context )
@@ -51,6 +51,7 @@
 
 #include "fmt/format.h"
 
+#include <algorithm>
 #include <unordered_map>
 #include <variant>
 
@@ -84,6 +85,233 @@ void appendLeafPlugs( const Gaffer::Plug *p, DependencyNode::AffectedPlugsContai
 	}
 }
 
+const InternedString g_ellipsis( "..." );
+
+// Returns true if `c` always matches itself and nothing else
+// when it appears in a pattern passed to `StringAlgo::match()`.
+bool isLiteral( char c )
+{
+	return c != '*' && c != '?' && c != '[' && c != '\\';
+}
+
+// As above, but for elements of a `MatchPatternPath`.
+bool isLiteral( const InternedString &element )
+{
+	return element != g_ellipsis && !StringAlgo::hasWildcards( element.c_str() );
+}
+
+// Returns true if the literal characters at the end of `pattern` must
+// match the end of a string. This is not true in the presence of
+// character classes and escapes, which we treat conservatively rather
+// than parse.
+bool hasLiteralSuffix( const std::string &pattern )
+{
+	return pattern.find_first_of( "[]\\" ) == string::npos;
+}
+
+bool hasLiteralSuffix( const StringAlgo::MatchPatternPath & )
+{
+	return true;
+}
+
+bool matches( const std::string &s, const std::string &pattern )
+{
+	return StringAlgo::match( s.c_str(), pattern.c_str() );
+}
+
+bool matches( const vector<InternedString> &path, const StringAlgo::MatchPatternPath &pattern )
+{
+	return StringAlgo::match( path, pattern );
+}
+
+// Tree mapping from sequences of keys to the patterns that begin
+// with them, allowing all the patterns whose literal prefix matches
+// a particular selector to be found in a single pass over the selector.
+template<typename Key>
+class PrefixTree
+{
+
+	public :
+
+		PrefixTree()
+			:	m_nodes( 1 )
+		{
+		}
+
+		template<typename Iterator>
+		void insert( Iterator begin, Iterator end, uint32_t pattern )
+		{
+			uint32_t node = 0;
+			for( Iterator it = begin; it != end; ++it )
+			{
+				auto &children = m_nodes[node].children;
+				auto childIt = std::lower_bound( children.begin(), children.end(), *it, childLess );
+				if( childIt != children.end() && childIt->first == *it )
+				{
+					node = childIt->second;
+				}
+				else
+				{
+					// Note : `emplace_back()` invalidates `children`, so
+					// must come last.
+					const uint32_t child = m_nodes.size();
+					children.insert( childIt, Child( *it, child ) );
+					m_nodes.emplace_back();
+					node = child;
+				}
+			}
+			m_nodes[node].patterns.push_back( pattern );
+		}
+
+		// Calls `f( pattern )` for every pattern inserted with a key
+		// sequence that is a prefix of `[begin, end)`.
+		template<typename Iterator, typename F>
+		void visit( Iterator begin, Iterator end, F &&f ) const
+		{
+			const Node *node = &m_nodes[0];
+			for( Iterator it = begin; ; ++it )
+			{
+				for( auto pattern : node->patterns )
+				{
+					f( pattern );
+				}
+				if( it == end )
+				{
+					break;
+				}
+				auto childIt = std::lower_bound( node->children.begin(), node->children.end(), *it, childLess );
+				if( childIt == node->children.end() || childIt->first != *it )
+				{
+					break;
+				}
+				node = &m_nodes[childIt->second];
+			}
+		}
+
+	private :
+
+		using Child = std::pair<Key, uint32_t>;
+
+		static bool childLess( const Child &child, const Key &key )
+		{
+			return child.first < key;
+		}
+
+		struct Node
+		{
+			// Sorted by key.
+			vector<Child> children;
+			vector<uint32_t> patterns;
+		};
+
+		vector<Node> m_nodes;
+
+};
+
+// Compiled form of an ordered list of wildcard patterns, used to find
+// the first pattern that matches a selector. Patterns are indexed by
+// their literal prefix or suffix, so that a typical lookup needs to
+// call `StringAlgo::match()` only for the handful of patterns that
+// could possibly match, rather than for every pattern in turn.
+template<typename Selector, typename Pattern>
+class WildcardRows
+{
+
+	public :
+
+		// Patterns must be added in order of increasing `rowIndex`.
+		void add( const Pattern &pattern, size_t rowIndex )
+		{
+			const uint32_t entry = m_entries.size();
+			m_entries.push_back( { pattern, rowIndex } );
+
+			auto prefixEnd = std::find_if_not( pattern.begin(), pattern.end(), isLiteralKey );
+			if( prefixEnd != pattern.begin() )
+			{
+				m_prefixes.insert( pattern.begin(), prefixEnd, entry );
+				return;
+			}
+
+			if( hasLiteralSuffix( pattern ) )
+			{
+				auto suffixEnd = std::find_if_not( pattern.rbegin(), pattern.rend(), isLiteralKey );
+				if( suffixEnd != pattern.rbegin() )
+				{
+					m_suffixes.insert( pattern.rbegin(), suffixEnd, entry );
+					return;
+				}
+			}
+
+			// Patterns such as `*` and `*a*`, which could match anything.
+			m_unindexed.push_back( entry );
+		}
+
+		// Returns the index of the first row matching `selector`,
+		// considering only rows before `limit`. Returns `limit` if
+		// there is no such row, with 0 meaning no limit.
+		size_t rowIndex( const Selector &selector, size_t limit ) const
+		{
+			boost::container::small_vector<uint32_t, 16> candidates;
+			auto addCandidate = [&candidates] ( uint32_t entry ) {
+				candidates.push_back( entry );
+			};
+			m_prefixes.visit( selector.begin(), selector.end(), addCandidate );
+			m_suffixes.visit( selector.rbegin(), selector.rend(), addCandidate );
+			std::sort( candidates.begin(), candidates.end() );
+
+			// Merge with the unindexed patterns, testing in order of
+			// entry (and therefore row) until we find a match.
+			auto candidateIt = candidates.begin();
+			auto unindexedIt = m_unindexed.begin();
+			while( candidateIt != candidates.end() || unindexedIt != m_unindexed.end() )
+			{
+				uint32_t entryIndex;
+				if( unindexedIt == m_unindexed.end() || ( candidateIt != candidates.end() && *candidateIt < *unindexedIt ) )
+				{
+					entryIndex = *candidateIt++;
+				}
+				else
+				{
+					entryIndex = *unindexedIt++;
+				}
+
+				const Entry &entry = m_entries[entryIndex];
+				if( limit && entry.rowIndex >= limit )
+				{
+					break;
+				}
+				if( matches( selector, entry.pattern ) )
+				{
+					return entry.rowIndex;
+				}
+			}
+
+			return limit;
+		}
+
+	private :
+
+		using Key = typename Pattern::value_type;
+
+		static bool isLiteralKey( const Key &key )
+		{
+			return isLiteral( key );
+		}
+
+		struct Entry
+		{
+			Pattern pattern;
+			size_t rowIndex;
+		};
+
+		vector<Entry> m_entries;
+		PrefixTree<Key> m_prefixes;
+		// Keyed by the reversed suffix.
+		PrefixTree<Key> m_suffixes;
+		vector<uint32_t> m_unindexed;
+
+};
+
 // Data type stored on `rowsMapPlug()` and used for quickly
 // finding the right row for a selector.
 class RowsMap : public IECore::Data
@@ -116,7 +344,23 @@ class RowsMap : public IECore::Data
 				const bool hasWildcards = StringAlgo::hasWildcards( name );
 				if( hasWildcards || name.find( ' ' ) != string::npos )
 				{
-					m_wildcardRows.push_back( { name, i } );
+					// Split into the individual patterns that `StringAlgo::matchMultiple()`
+					// would consider, so that those without wildcards can be looked up
+					// directly. `insert()` won't replace an existing entry, so the first
+					// row still wins.
+					vector<string> patterns;
+					StringAlgo::tokenize( name, ' ', patterns );
+					for( const auto &pattern : patterns )
+					{
+						if( StringAlgo::hasWildcards( pattern ) )
+						{
+							m_wildcardRows.add( pattern, i );
+						}
+						else
+						{
+							m_plainRows.insert( { pattern, i } );
+						}
+					}
 				}
 				else
 				{
@@ -126,7 +370,7 @@ class RowsMap : public IECore::Data
 				const StringAlgo::MatchPatternPath path = StringAlgo::matchPatternPath( name );
 				if( hasWildcards || name.find( "..." ) != string::npos )
 				{
-					m_wildcardPathRows.push_back( { path, i } );
+					m_wildcardPathRows.add( path, i );
 				}
 				else
 				{
@@ -169,19 +413,7 @@ class RowsMap : public IECore::Data
 				{
 					result = it->second;
 				}
-				for( auto &row : m_wildcardRows )
-				{
-					if( result && row.index > result )
-					{
-						break;
-					}
-
-					if( StringAlgo::matchMultiple( *s, row.name ) )
-					{
-						result = row.index;
-						break;
-					}
-				}
+				result = m_wildcardRows.rowIndex( *s, result );
 			}
 			else if( auto p = get<const vector<InternedString> *>( selector ) )
 			{
@@ -190,19 +422,7 @@ class RowsMap : public IECore::Data
 				{
 					result = it->second;
 				}
-				for( auto &row : m_wildcardPathRows )
-				{
-					if( result && row.index > result )
-					{
-						break;
-					}
-
-					if( StringAlgo::match( *p, row.path ) )
-					{
-						result = row.index;
-						break;
-					}
-				}
+				result = m_wildcardPathRows.rowIndex( *p, result );
 			}
 			return result;
 		}
@@ -219,36 +439,19 @@ class RowsMap : public IECore::Data
 		using Map = std::unordered_map<std::string, size_t>;
 		Map m_plainRows;
 
-		// Rows with wildcards. These require a linear search.
-		struct Row
-		{
-			std::string name;
-			size_t index;
-		};
-		using Vector = std::vector<Row>;
-		Vector m_wildcardRows;
+		// Patterns with wildcards.
+		WildcardRows<string, string> m_wildcardRows;
 
 		// As above, but for when the selector is an InternedStringVectorData,
-		// in which case we want to use PathMatcher-style matching. We could do
-		// better here if we generalised the PathMatcher::Node data structure to
-		// allow us to store our `index` in place of the `bool terminator`. For
-		// now we assume that Spreadsheets with extreme numbers of rows will
-		// have only plain rows (as in EditScopes), and the PathMap will be
-		// sufficient. If this assumption plays out in practice, then a simpler
-		// implementation might just be to make `StringAlgo::match()` compatible
+		// in which case we want to use PathMatcher-style matching. A simpler
+		// implementation might be to make `StringAlgo::match()` compatible
 		// with the behaviour of `*` and `...` in PathMatcher, so we can just
 		// use the original code path for everything . That would be a breaking
 		// change though.
 		using PathMap = std::map<StringAlgo::MatchPatternPath, size_t>;
 		PathMap m_plainPathRows;
 
-		struct PathRow
-		{
-			StringAlgo::MatchPatternPath path;
-			size_t index;
-		};
-		using PathVector = std::vector<PathRow>;
-		PathVector m_wildcardPathRows;
+		WildcardRows<vector<InternedString>, StringAlgo::MatchPatternPath> m_wildcardPathRows;
 
 		// List of enabled row names for `enabledRowNamesPlug()`.
 		StringVectorDataPtr m_enabledRowNames;
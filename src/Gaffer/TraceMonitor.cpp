@@ -0,0 +1,292 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2025, Cinesite VFX Ltd. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//      * Redistributions of source code must retain the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer.
+//
+//      * Redistributions in binary form must reproduce the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer in the documentation and/or other materials provided with
+//        the distribution.
+//
+//      * Neither the name of John Haddon nor the names of
+//        any other contributors to this software may be used to endorse or
+//        promote products derived from this software without specific prior
+//        written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+#include "Gaffer/TraceMonitor.h"
+
+#include "Gaffer/Plug.h"
+#include "Gaffer/Process.h"
+#include "Gaffer/ThreadMonitor.h"
+#include "Gaffer/TypeIds.h"
+
+#include "IECore/Exception.h"
+
+#include "fmt/format.h"
+
+#include <algorithm>
+#include <fstream>
+#include <optional>
+#include <tuple>
+
+using namespace Gaffer;
+
+namespace
+{
+
+// Escapes a string for inclusion in JSON. Plug names are restricted
+// to identifier characters, but process types are arbitrary.
+std::string escape( const std::string &s )
+{
+	std::string result;
+	result.reserve( s.size() );
+	for( char c : s )
+	{
+		switch( c )
+		{
+			case '"' :
+				result += "\\\"";
+				break;
+			case '\\' :
+				result += "\\\\";
+				break;
+			default :
+				if( (unsigned char)c < 0x20 )
+				{
+					result += fmt::format( "\\u{:04x}", (int)c );
+				}
+				else
+				{
+					result += c;
+				}
+		}
+	}
+	return result;
+}
+
+std::string plugName( const Plug *plug )
+{
+	return escape( plug->relativeName( plug->ancestor( (IECore::TypeId)ScriptNodeTypeId ) ) );
+}
+
+} // namespace
+
+TraceMonitor::ThreadData::ThreadData()
+	:	id( ThreadMonitor::thisThreadId() ), droppedEvents( 0 )
+{
+}
+
+TraceMonitor::TraceMonitor( const std::vector<IECore::InternedString> &processMask, size_t maxEventsPerThread )
+	:	m_processMask( processMask ), m_maxEventsPerThread( maxEventsPerThread ), m_startTime( Clock::now() )
+{
+}
+
+TraceMonitor::~TraceMonitor()
+{
+}
+
+size_t TraceMonitor::numEvents() const
+{
+	size_t result = 0;
+	for( const auto &threadData : m_threadData )
+	{
+		result += threadData.events.size();
+	}
+	return result;
+}
+
+size_t TraceMonitor::numDroppedEvents() const
+{
+	size_t result = 0;
+	for( const auto &threadData : m_threadData )
+	{
+		result += threadData.droppedEvents;
+	}
+	return result;
+}
+
+void TraceMonitor::writeChromeTrace( const std::string &fileName ) const
+{
+	std::ofstream file( fileName );
+	if( !file.good() )
+	{
+		throw IECore::Exception( fmt::format( "Unable to open file \"{}\"", fileName ) );
+	}
+
+	// Assign an id to each event, and index them by process so that we can
+	// look up the id of each event's parent. Addresses are reused by
+	// processes that don't overlap in time, so the parent is the event for
+	// the parent address which was running when the child started.
+
+	using ProcessInterval = std::tuple<Clock::time_point, Clock::time_point, size_t>;
+	std::unordered_map<const Process *, std::vector<ProcessInterval>> processIntervals;
+	size_t id = 0;
+	for( const auto &threadData : m_threadData )
+	{
+		for( const auto &event : threadData.events )
+		{
+			processIntervals[event.process].push_back( { event.startTime, event.finishTime, id++ } );
+		}
+	}
+	for( auto &[process, intervals] : processIntervals )
+	{
+		std::sort( intervals.begin(), intervals.end() );
+	}
+
+	auto parentId = [&] ( const Event &event ) -> std::optional<size_t> {
+		auto it = processIntervals.find( event.parent );
+		if( !event.parent || it == processIntervals.end() )
+		{
+			// No parent, or parent discarded due to `maxEventsPerThread`.
+			return std::nullopt;
+		}
+		const auto &intervals = it->second;
+		auto iIt = std::upper_bound(
+			intervals.begin(), intervals.end(), event.startTime,
+			[] ( const Clock::time_point &t, const ProcessInterval &i ) { return t < std::get<0>( i ); }
+		);
+		if( iIt == intervals.begin() )
+		{
+			return std::nullopt;
+		}
+		--iIt;
+		if( std::get<1>( *iIt ) < event.finishTime )
+		{
+			return std::nullopt;
+		}
+		return std::get<2>( *iIt );
+	};
+
+	// Events are written as "X" (complete) events, which Chrome nests
+	// according to their start time and duration within each thread. We
+	// name each event after the plug, and store the process type and parent
+	// as arguments so that they are visible when an event is selected.
+
+	file << "{\"traceEvents\":[\n";
+	bool first = true;
+	id = 0;
+	for( const auto &threadData : m_threadData )
+	{
+		file << ( first ? "" : ",\n" ) << fmt::format(
+			R"({{"name":"thread_name","ph":"M","pid":0,"tid":{},"args":{{"name":"Thread {}"}}}})",
+			threadData.id, threadData.id
+		);
+		first = false;
+
+		for( const auto &event : threadData.events )
+		{
+			const double timestamp = std::chrono::duration<double, std::micro>( event.startTime - m_startTime ).count();
+			const double duration = std::chrono::duration<double, std::micro>( event.finishTime - event.startTime ).count();
+			const std::optional<size_t> parent = parentId( event );
+			file << ",\n" << fmt::format(
+				R"({{"name":"{}","cat":"{}","ph":"X","pid":0,"tid":{},"ts":{:.3f},"dur":{:.3f},"args":{{"processType":"{}","id":{},"parent":"{}","parentId":{}}}}})",
+				plugName( event.plug ),
+				escape( event.processType.string() ),
+				threadData.id, timestamp, duration,
+				escape( event.processType.string() ),
+				id++,
+				event.parentPlug ? plugName( event.parentPlug ) : "",
+				parent ? std::to_string( *parent ) : "null"
+			);
+		}
+	}
+	file << "\n],\n\"displayTimeUnit\":\"ms\"}\n";
+
+	if( !file.good() )
+	{
+		throw IECore::Exception( fmt::format( "Error writing file \"{}\"", fileName ) );
+	}
+}
+
+void TraceMonitor::clear()
+{
+	m_threadData.clear();
+}
+
+void TraceMonitor::processStarted( const Process *process )
+{
+	if( !recording( process ) )
+	{
+		return;
+	}
+
+	m_threadData.local().running.push_back( { process, Clock::now() } );
+}
+
+void TraceMonitor::processFinished( const Process *process )
+{
+	if( !recording( process ) )
+	{
+		return;
+	}
+
+	ThreadData &threadData = m_threadData.local();
+	if( threadData.running.empty() || threadData.running.back().first != process )
+	{
+		// Process started before we were active.
+		return;
+	}
+
+	const Process *parent = recordedParent( process );
+	threadData.events.push_back( {
+		threadData.running.back().second,
+		Clock::now(),
+		retainPlug( threadData, process->plug() ),
+		parent ? retainPlug( threadData, parent->plug() ) : nullptr,
+		process,
+		parent,
+		process->type()
+	} );
+	threadData.running.pop_back();
+
+	if( threadData.events.size() > m_maxEventsPerThread )
+	{
+		threadData.events.pop_front();
+		threadData.droppedEvents++;
+	}
+}
+
+bool TraceMonitor::recording( const Process *process ) const
+{
+	return m_processMask.empty() || std::find( m_processMask.begin(), m_processMask.end(), process->type() ) != m_processMask.end();
+}
+
+const Process *TraceMonitor::recordedParent( const Process *process ) const
+{
+	const Process *result = process->parent();
+	while( result && !recording( result ) )
+	{
+		result = result->parent();
+	}
+	return result;
+}
+
+const Plug *TraceMonitor::retainPlug( ThreadData &threadData, const Plug *plug )
+{
+	auto inserted = threadData.plugs.try_emplace( plug );
+	if( inserted.second )
+	{
+		inserted.first->second = plug;
+	}
+	return plug;
+}
@@ -41,6 +41,7 @@
 #include "Gaffer/ComputeNode.h"
 #include "Gaffer/Context.h"
 #include "Gaffer/Private/IECorePreview/LRUCache.h"
+#include "Gaffer/Private/PersistentCache.h"
 #include "Gaffer/Process.h"
 
 #include "IECore/MessageHandler.h"
@@ -109,8 +110,8 @@ namespace
 struct HashCacheKey
 {
 	HashCacheKey() {};
-	HashCacheKey( const ValuePlug *plug, const Context *context, uint64_t dirtyCount )
-		:	plug( plug ), contextHash( context->hash() ), dirtyCount( dirtyCount )
+	HashCacheKey( const ValuePlug *plug, const IECore::MurmurHash &contextHash, uint64_t dirtyCount )
+		:	plug( plug ), contextHash( contextHash ), dirtyCount( dirtyCount )
 	{
 	}
 
@@ -174,6 +175,8 @@ ValuePlug::HashCacheMode defaultHashCacheMode()
 	return ValuePlug::HashCacheMode::Standard;
 }
 
+const IECore::InternedString g_frame( "frame" );
+
 } // namespace
 
 class ValuePlug::HashProcess : public Process
@@ -221,7 +224,13 @@ class ValuePlug::HashProcess : public Process
 
 			if( cachePolicy == CachePolicy::Uncached )
 			{
-				return HashProcess( p, plug, computeNode ).run();
+				HashProcess process( p, plug, computeNode );
+				const IECore::MurmurHash result = process.run();
+				if( process.m_frameDependent )
+				{
+					frameAccessed();
+				}
+				return result;
 			}
 
 			// Perform any pending adjustments to our thread-local cache.
@@ -242,6 +251,7 @@ class ValuePlug::HashProcess : public Process
 			// we can repeat the process for `Checked` mode.
 
 			const bool forceMonitoring = Process::forceMonitoring( threadState, p, staticType );
+			const bool frameInvariance = g_frameInvariantCacheEnabled && g_hashCacheMode == HashCacheMode::Standard;
 
 			auto acquireHash = [&]( const HashCacheKey &cacheKey ) {
 
@@ -259,16 +269,37 @@ class ValuePlug::HashProcess : public Process
 				{
 					if( auto result = threadData.cache.getIfCached( cacheKey ) )
 					{
+						if( frameInvariance && result->frameDependent )
+						{
+							frameAccessed();
+						}
+						return result->hash;
+					}
+				}
+
+				// No value in local cache. If the hash has previously been found not
+				// to depend on the frame, then we can reuse it from any other frame.
+				std::optional<HashCacheKey> frameInvariantKey;
+				if( frameInvariance && !forceMonitoring )
+				{
+					frameInvariantKey = HashCacheKey( p, frameInvariantContextHash( currentContext ), cacheKey.dirtyCount );
+					if( auto result = g_frameInvariantCache.getIfCached( *frameInvariantKey ) )
+					{
+						threadData.frameInvariantCacheHits++;
+						threadData.cache.setIfUncached( cacheKey, { *result, false }, cacheEntryCostFunction );
 						return *result;
 					}
+					threadData.frameInvariantCacheMisses++;
 				}
 
-				// No value in local cache, so either compute it directly or get it via
-				// the global cache if it's expensive enough to warrant collaboration.
-				IECore::MurmurHash result;
+				// Otherwise either compute it directly or get it via the global cache
+				// if it's expensive enough to warrant collaboration.
+				CacheEntry entry;
 				if( cachePolicy == CachePolicy::Default || cachePolicy == CachePolicy::Standard )
 				{
-					result = HashProcess( p, plug, computeNode ).run();
+					HashProcess process( p, plug, computeNode, frameInvariance );
+					entry.hash = process.run();
+					entry.frameDependent = !frameInvariance || process.m_frameDependent;
 				}
 				else
 				{
@@ -279,19 +310,28 @@ class ValuePlug::HashProcess : public Process
 					}
 					if( cachedValue )
 					{
-						result = *cachedValue;
+						entry.hash = *cachedValue;
 					}
 					else
 					{
-						result = Process::acquireCollaborativeResult<HashProcess>( cacheKey, p, plug, computeNode );
+						entry.hash = Process::acquireCollaborativeResult<HashProcess>( cacheKey, p, plug, computeNode, frameInvariance );
 					}
+					// We didn't necessarily run the process ourselves, so can only
+					// know it to be invariant if it has been cached as such.
+					entry.frameDependent = !frameInvariantKey || !g_frameInvariantCache.getIfCached( *frameInvariantKey );
+				}
+
+				if( frameInvariance && entry.frameDependent )
+				{
+					frameAccessed();
 				}
+
 				// Update local cache and return result
-				threadData.cache.setIfUncached( cacheKey, result, cacheCostFunction );
-				return result;
+				threadData.cache.setIfUncached( cacheKey, entry, cacheEntryCostFunction );
+				return entry.hash;
 			};
 
-			const HashCacheKey cacheKey( p, currentContext, p->m_dirtyCount );
+			const HashCacheKey cacheKey( p, currentContext->hashInternal(), p->m_dirtyCount );
 			if( g_hashCacheMode == HashCacheMode::Standard )
 			{
 				return acquireHash( cacheKey );
@@ -337,11 +377,13 @@ class ValuePlug::HashProcess : public Process
 		{
 			g_cacheSizeLimit = maxEntriesPerThread;
 			g_cache.setMaxCost( g_cacheSizeLimit );
+			g_frameInvariantCache.setMaxCost( g_cacheSizeLimit );
 		}
 
 		static void clearCache( bool now = false )
 		{
 			g_cache.clear();
+			g_frameInvariantCache.clear();
 			// It's not documented explicitly, but it is safe to iterate over an
 			// `enumerable_thread_specific` while `local()` is being called on
 			// other threads, because the underlying container is a
@@ -368,7 +410,7 @@ class ValuePlug::HashProcess : public Process
 
 		static size_t totalCacheUsage()
 		{
-			size_t usage = g_cache.currentCost();
+			size_t usage = g_cache.currentCost() + g_frameInvariantCache.currentCost();
 			tbb::enumerable_thread_specific<ThreadData>::iterator it, eIt;
 			for( it = g_threadData.begin(), eIt = g_threadData.end(); it != eIt; ++it )
 			{
@@ -401,12 +443,66 @@ class ValuePlug::HashProcess : public Process
 			return g_hashCacheMode;
 		}
 
+		static void setFrameInvariantCacheEnabled( bool enabled )
+		{
+			g_frameInvariantCacheEnabled = enabled;
+			Context::g_accessTracking = enabled;
+		}
+
+		static bool getFrameInvariantCacheEnabled()
+		{
+			return g_frameInvariantCacheEnabled;
+		}
+
+		static bool defaultFrameInvariantCacheEnabled()
+		{
+			const char *e = getenv( "GAFFER_FRAMEINVARIANT_HASHCACHE" );
+			const bool enabled = e && !strcmp( e, "1" );
+			// Context's flag is constant-initialised, so it is safe to assign
+			// to during our own static initialisation.
+			Context::g_accessTracking = enabled;
+			return enabled;
+		}
+
+		static FrameInvariantHashCacheStatistics frameInvariantCacheStatistics()
+		{
+			FrameInvariantHashCacheStatistics result;
+			for( const auto &threadData : g_threadData )
+			{
+				result.hits += threadData.frameInvariantCacheHits;
+				result.misses += threadData.frameInvariantCacheMisses;
+			}
+			result.entries = g_frameInvariantCache.currentCost();
+			return result;
+		}
+
+		// Records that the hash being computed by the current process depends
+		// on the frame. Called for context variable accesses, and for child
+		// hashes which depend on the frame themselves.
+		static void frameAccessed()
+		{
+			for( const Process *process = Process::current(); process; process = process->parent() )
+			{
+				if( process->type() == staticType )
+				{
+					static_cast<const HashProcess *>( process )->m_frameDependent.store( true, std::memory_order_relaxed );
+					return;
+				}
+				else if( process->type() == ValuePlug::computeProcessType() )
+				{
+					// The result of a compute depends only on its hash, which
+					// will have been accounted for separately.
+					return;
+				}
+			}
+		}
+
 		static const IECore::InternedString staticType;
 
 		// Interface required by `Process::acquireCollaborativeResult()`.
 
-		HashProcess( const ValuePlug *plug, const ValuePlug *destinationPlug, const ComputeNode *computeNode )
-			:	Process( staticType, plug, destinationPlug ), m_computeNode( computeNode )
+		HashProcess( const ValuePlug *plug, const ValuePlug *destinationPlug, const ComputeNode *computeNode, bool frameInvariance = false )
+			:	Process( staticType, plug, destinationPlug ), m_computeNode( computeNode ), m_frameInvariance( frameInvariance ), m_frameDependent( false )
 		{
 		}
 
@@ -429,6 +525,17 @@ class ValuePlug::HashProcess : public Process
 					throw IECore::Exception( "ComputeNode::hash() not implemented." );
 				}
 
+				if( m_frameInvariance && !m_frameDependent.load( std::memory_order_relaxed ) )
+				{
+					// Cache before returning, so that threads collaborating on
+					// this process can find the result.
+					const ValuePlug *valuePlug = static_cast<const ValuePlug *>( plug() );
+					g_frameInvariantCache.setIfUncached(
+						HashCacheKey( valuePlug, frameInvariantContextHash( context() ), valuePlug->m_dirtyCount ),
+						result, cacheCostFunction
+					);
+				}
+
 				return result;
 			}
 			catch( ... )
@@ -447,19 +554,57 @@ class ValuePlug::HashProcess : public Process
 
 	private :
 
+		// Returns the context hash, less the contribution from the frame.
+		static IECore::MurmurHash frameInvariantContextHash( const Context *context )
+		{
+			IECore::MurmurHash result = context->hashInternal();
+			if( const Context::Value *frame = context->internalFind( g_frame ) )
+			{
+				result = IECore::MurmurHash(
+					result.h1() - frame->hash().h1(),
+					result.h2() - frame->hash().h2()
+				);
+			}
+			return result;
+		}
+
 		const ComputeNode *m_computeNode;
+		const bool m_frameInvariance;
+		// Set if any context variable access could have read the frame.
+		// Atomic because the hash may spawn TBB tasks.
+		mutable std::atomic_bool m_frameDependent;
 
 		static std::atomic<uint64_t> g_legacyGlobalDirtyCount;
 		static HashCacheMode g_hashCacheMode;
+		static std::atomic_bool g_frameInvariantCacheEnabled;
+
+		// Hashes which have been found not to depend on the frame, keyed
+		// by the context hash without the frame.
+		static CacheType g_frameInvariantCache;
+
+		struct CacheEntry
+		{
+			IECore::MurmurHash hash;
+			// True unless known to be independent of the frame.
+			bool frameDependent = true;
+		};
+
+		static size_t cacheEntryCostFunction( const CacheEntry &value )
+		{
+			return 1;
+		}
 
 		struct ThreadData
 		{
 			// Using a null `GetterFunction` because it will never get called, because we only ever call `getIfCached()`.
-			ThreadData() : cache( CacheType::GetterFunction(), g_cacheSizeLimit, CacheType::RemovalCallback(), /* cacheErrors = */ false ), clearCache( 0 ) {}
-			using CacheType = IECorePreview::LRUCache<HashCacheKey, IECore::MurmurHash, IECorePreview::LRUCachePolicy::Serial>;
+			ThreadData() : cache( CacheType::GetterFunction(), g_cacheSizeLimit, CacheType::RemovalCallback(), /* cacheErrors = */ false ), clearCache( 0 ), frameInvariantCacheHits( 0 ), frameInvariantCacheMisses( 0 ) {}
+			using CacheType = IECorePreview::LRUCache<HashCacheKey, CacheEntry, IECorePreview::LRUCachePolicy::Serial>;
 			CacheType cache;
 			// Flag to request that hashCache be cleared.
 			std::atomic_int clearCache;
+			// Statistics for `g_frameInvariantCache`. Only written by the owning thread.
+			std::atomic_size_t frameInvariantCacheHits;
+			std::atomic_size_t frameInvariantCacheMisses;
 		};
 
 		static tbb::enumerable_thread_specific<ThreadData, tbb::cache_aligned_allocator<ThreadData>, tbb::ets_key_per_instance > g_threadData;
@@ -475,6 +620,8 @@ std::atomic_size_t ValuePlug::HashProcess::g_cacheSizeLimit( 128000 );
 ValuePlug::HashProcess::CacheType ValuePlug::HashProcess::g_cache( CacheType::GetterFunction(), g_cacheSizeLimit, CacheType::RemovalCallback(), /* cacheErrors = */ false );
 std::atomic<uint64_t> ValuePlug::HashProcess::g_legacyGlobalDirtyCount( 0 );
 ValuePlug::HashCacheMode ValuePlug::HashProcess::g_hashCacheMode( defaultHashCacheMode() );
+ValuePlug::HashProcess::CacheType ValuePlug::HashProcess::g_frameInvariantCache( CacheType::GetterFunction(), g_cacheSizeLimit, CacheType::RemovalCallback(), /* cacheErrors = */ false );
+std::atomic_bool ValuePlug::HashProcess::g_frameInvariantCacheEnabled( defaultFrameInvariantCacheEnabled() );
 
 //////////////////////////////////////////////////////////////////////////
 // The ComputeProcess manages the task of calling ComputeNode::compute()
@@ -508,6 +655,11 @@ class ValuePlug::ComputeProcess : public Process
 			g_cache.clear();
 		}
 
+		static Private::PersistentCache &persistentCache()
+		{
+			return g_persistentCache;
+		}
+
 		static const IECore::Object *value( const ValuePlug *plug, IECore::ConstObjectPtr &owner, const IECore::MurmurHash *precomputedHash )
 		{
 			const ValuePlug *p = sourcePlug( plug );
@@ -569,7 +721,8 @@ class ValuePlug::ComputeProcess : public Process
 			// > calling `getValueInternal()`.
 			const IECore::MurmurHash hash = precomputedHash ? *precomputedHash : p->ValuePlug::hash();
 
-			if( !Process::forceMonitoring( threadState, plug, staticType ) )
+			const bool forceMonitoring = Process::forceMonitoring( threadState, plug, staticType );
+			if( !forceMonitoring )
 			{
 				if( auto result = g_cache.getIfCached( hash ) )
 				{
@@ -589,6 +742,7 @@ class ValuePlug::ComputeProcess : public Process
 				// lightweight enough and unlikely enough to be shared that in
 				// the worst case it's OK to do it redundantly on a few threads
 				// before it gets cached.
+				const CacheType::ComputeTimer timer;
 				owner = ComputeProcess( p, plug, computeNode ).run();
 				// Store the value in the cache, but only if it isn't there already.
 				// The check is useful because it's common for an upstream compute
@@ -600,13 +754,17 @@ class ValuePlug::ComputeProcess : public Process
 				// upstream node will already have computed the same result) and the
 				// attribute data itself consists of many small objects for which
 				// computing memory usage is slow.
-				g_cache.setIfUncached( hash, owner, cacheCostFunction );
+				g_cache.setIfUncached( hash, owner, cacheCostFunction, timer.elapsed() );
 				return owner.get();
 			}
 			else
 			{
+				// The persistent cache sits beneath the in-memory one, and is
+				// accessed from within the collaborative process so that only
+				// one thread does the loading.
+				const bool persistent = cachePolicy == CachePolicy::Persistent && !forceMonitoring && g_persistentCache.enabled();
 				owner = acquireCollaborativeResult<ComputeProcess>(
-					hash, p, plug, computeNode
+					hash, p, plug, computeNode, persistent ? &hash : nullptr
 				);
 				return owner.get();
 			}
@@ -633,8 +791,8 @@ class ValuePlug::ComputeProcess : public Process
 
 		// Interface required by `Process::acquireCollaborativeResult()`.
 
-		ComputeProcess( const ValuePlug *plug, const ValuePlug *destinationPlug, const ComputeNode *computeNode )
-			:	Process( staticType, plug, destinationPlug ), m_computeNode( computeNode )
+		ComputeProcess( const ValuePlug *plug, const ValuePlug *destinationPlug, const ComputeNode *computeNode, const IECore::MurmurHash *persistentHash = nullptr )
+			:	Process( staticType, plug, destinationPlug ), m_computeNode( computeNode ), m_persistentHash( persistentHash )
 		{
 		}
 
@@ -642,6 +800,14 @@ class ValuePlug::ComputeProcess : public Process
 		{
 			try
 			{
+				if( m_persistentHash )
+				{
+					if( IECore::ConstObjectPtr result = g_persistentCache.get( *m_persistentHash ) )
+					{
+						return result;
+					}
+				}
+
 				// Cast is safe because our constructor takes ValuePlugs.
 				const ValuePlug *valuePlug = static_cast<const ValuePlug *>( plug() );
 				if( const ValuePlug *input = valuePlug->getInput<ValuePlug>() )
@@ -667,6 +833,10 @@ class ValuePlug::ComputeProcess : public Process
 				{
 					throw IECore::Exception( "Compute did not set plug value." );
 				}
+				if( m_persistentHash )
+				{
+					g_persistentCache.set( *m_persistentHash, m_result.get() );
+				}
 				// Move to avoid unnecessary reference count increment/decrement - we don't
 				// need `m_result` any more.
 				return std::move( m_result );
@@ -689,14 +859,19 @@ class ValuePlug::ComputeProcess : public Process
 	private :
 
 		const ComputeNode *m_computeNode;
+		const IECore::MurmurHash *m_persistentHash;
 		IECore::ConstObjectPtr m_result;
 
+		static Private::PersistentCache g_persistentCache;
+
 };
 
 const IECore::InternedString ValuePlug::ComputeProcess::staticType( ValuePlug::computeProcessType() );
 // Using a null `GetterFunction` because it will never get called, because we only ever call `getIfCached()`.
 // Note : The default size here is overridden by `startup/Gaffer/cache.py`.
 ValuePlug::ComputeProcess::CacheType ValuePlug::ComputeProcess::g_cache( CacheType::GetterFunction(), 1024 * 1024 * 1024 * 1, CacheType::RemovalCallback(), /* cacheErrors = */ false ); // 1 gig
+// Note : Disabled by default, but may be enabled by `startup/Gaffer/cache.py`.
+Private::PersistentCache ValuePlug::ComputeProcess::g_persistentCache;
 
 //////////////////////////////////////////////////////////////////////////
 // SetValueAction implementation
@@ -1156,6 +1331,36 @@ void ValuePlug::clearCache()
 	ComputeProcess::clearCache();
 }
 
+void ValuePlug::setPersistentCacheDirectory( const std::string &directory )
+{
+	ComputeProcess::persistentCache().setDirectory( directory );
+}
+
+const std::string &ValuePlug::getPersistentCacheDirectory()
+{
+	return ComputeProcess::persistentCache().getDirectory();
+}
+
+void ValuePlug::setPersistentCacheSizeLimit( size_t bytes )
+{
+	ComputeProcess::persistentCache().setSizeLimit( bytes );
+}
+
+size_t ValuePlug::getPersistentCacheSizeLimit()
+{
+	return ComputeProcess::persistentCache().getSizeLimit();
+}
+
+size_t ValuePlug::persistentCacheUsage()
+{
+	return ComputeProcess::persistentCache().usage();
+}
+
+void ValuePlug::clearPersistentCache()
+{
+	ComputeProcess::persistentCache().clear();
+}
+
 size_t ValuePlug::getHashCacheSizeLimit()
 {
 	return HashProcess::getCacheSizeLimit();
@@ -1186,6 +1391,29 @@ ValuePlug::HashCacheMode ValuePlug::getHashCacheMode()
 	return HashProcess::getHashCacheMode();
 }
 
+void ValuePlug::setFrameInvariantHashCacheEnabled( bool enabled )
+{
+	HashProcess::setFrameInvariantCacheEnabled( enabled );
+}
+
+bool ValuePlug::getFrameInvariantHashCacheEnabled()
+{
+	return HashProcess::getFrameInvariantCacheEnabled();
+}
+
+ValuePlug::FrameInvariantHashCacheStatistics ValuePlug::frameInvariantHashCacheStatistics()
+{
+	return HashProcess::frameInvariantCacheStatistics();
+}
+
+void ValuePlug::contextVariableAccessed( const IECore::InternedString *name )
+{
+	if( !name || *name == g_frame )
+	{
+		HashProcess::frameAccessed();
+	}
+}
+
 const IECore::InternedString &ValuePlug::hashProcessType()
 {
 	static IECore::InternedString g_hashProcessType( "computeNode:hash" );
@@ -72,6 +72,11 @@ void loadColorManagerWrapper( ArnoldColorManager &c, const std::string &name, bo
 class ArnoldColorManagerSerialiser : public GafferBindings::NodeSerialiser
 {
 
+	const std::type_info &binaryPostHierarchyType() const override
+	{
+		return typeid( ArnoldColorManagerSerialiser );
+	}
+
 	std::string postConstructor( const Gaffer::GraphComponent *graphComponent, const std::string &identifier, GafferBindings::Serialisation &serialisation ) const override
 	{
 		std::string result = GafferBindings::NodeSerialiser::postConstructor( graphComponent, identifier, serialisation );
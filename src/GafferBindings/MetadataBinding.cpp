@@ -56,33 +56,51 @@
 
 #include "fmt/format.h"
 
+#include <algorithm>
+
 using namespace boost::python;
 using namespace IECore;
 using namespace Gaffer;
 using namespace GafferBindings;
 
-namespace GafferBindings
+namespace
 {
 
-std::string metadataSerialisation( const Gaffer::GraphComponent *graphComponent, const std::string &identifier, Serialisation &serialisation )
+std::vector<InternedString> keysToSerialise( const Gaffer::GraphComponent *graphComponent )
 {
-	const std::vector<InternedString> keys = Metadata::registeredValues( graphComponent, Metadata::RegistrationTypes::InstancePersistent );
+	std::vector<InternedString> keys = Metadata::registeredValues( graphComponent, Metadata::RegistrationTypes::InstancePersistent );
 
+	// Metadata on Plugs that live on References only need to be
+	// serialised if they have been edited after loading the reference.
+	// Metadata on user plugs will always be serialised.
 	const Plug *plug = runTimeCast<const Plug>( graphComponent );
 	const Reference *reference = plug ? runTimeCast<const Reference>( plug->node() ) : nullptr;
-	bool requireEdits = reference && plug && plug != reference->userPlug() && !reference->userPlug()->isAncestorOf( plug );
+	if( reference && plug != reference->userPlug() && !reference->userPlug()->isAncestorOf( plug ) )
+	{
+		keys.erase(
+			std::remove_if(
+				keys.begin(), keys.end(),
+				[reference, plug] ( const InternedString &key ) { return !reference->hasMetadataEdit( plug, key ); }
+			),
+			keys.end()
+		);
+	}
+
+	return keys;
+}
+
+} // namespace
+
+namespace GafferBindings
+{
+
+std::string metadataSerialisation( const Gaffer::GraphComponent *graphComponent, const std::string &identifier, Serialisation &serialisation )
+{
+	const std::vector<InternedString> keys = keysToSerialise( graphComponent );
 
 	std::string result;
 	for( std::vector<InternedString>::const_iterator it = keys.begin(), eIt = keys.end(); it != eIt; ++it )
 	{
-		// Metadata on Plugs that live on References only need to be
-		// serialised if they have been edited after loading the reference.
-		// Metadata on user plugs will always be serialised.
-		if( requireEdits && !reference->hasMetadataEdit( plug, *it ) )
-		{
-			continue;
-		}
-
 		object pythonKey( it->c_str() );
 		std::string key = extract<std::string>( pythonKey.attr( "__repr__" )() );
 
@@ -119,4 +137,27 @@ std::string metadataSerialisation( const Gaffer::GraphComponent *graphComponent,
 	return result;
 }
 
+bool canSerialiseMetadataBinary( const Gaffer::GraphComponent *graphComponent )
+{
+	for( const auto &key : Metadata::registeredValues( graphComponent, Metadata::RegistrationTypes::InstancePersistent ) )
+	{
+		// Numeric bookmarks are serialised via `MetadataAlgo::setNumericBookmark()`,
+		// which we leave to Python.
+		if( MetadataAlgo::numericBookmarkAffectedByChange( key ) )
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+void binaryMetadataSerialisation( const Gaffer::GraphComponent *graphComponent, const std::string &identifier, Serialisation &serialisation )
+{
+	for( const auto &key : keysToSerialise( graphComponent ) )
+	{
+		ConstDataPtr value = Metadata::value( graphComponent, key );
+		serialisation.addMetadata( identifier, key, value.get() );
+	}
+}
+
 } // namespace GafferBindings
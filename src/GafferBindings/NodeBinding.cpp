@@ -59,6 +59,22 @@ std::string NodeSerialiser::postHierarchy( const Gaffer::GraphComponent *graphCo
 		metadataSerialisation( static_cast<const Gaffer::Node *>( graphComponent ), identifier, serialisation );
 }
 
+bool NodeSerialiser::binaryPostHierarchy( const Gaffer::GraphComponent *graphComponent, const std::string &identifier, Serialisation &serialisation ) const
+{
+	if( !canSerialiseMetadataBinary( graphComponent ) )
+	{
+		return false;
+	}
+
+	binaryMetadataSerialisation( graphComponent, identifier, serialisation );
+	return true;
+}
+
+const std::type_info &NodeSerialiser::binaryPostHierarchyType() const
+{
+	return typeid( NodeSerialiser );
+}
+
 bool NodeSerialiser::childNeedsSerialisation( const Gaffer::GraphComponent *child, const Serialisation &serialisation ) const
 {
 	if( const Plug *childPlug = IECore::runTimeCast<const Plug>( child ) )
@@ -203,6 +203,42 @@ std::string PlugSerialiser::postHierarchy( const Gaffer::GraphComponent *graphCo
 	return result;
 }
 
+bool PlugSerialiser::binaryPostHierarchy( const Gaffer::GraphComponent *graphComponent, const std::string &identifier, Serialisation &serialisation ) const
+{
+	const Plug *plug = static_cast<const Plug *>( graphComponent );
+
+	bool shouldSerialiseMetadata = true;
+	if( plug->node() == serialisation.parent() )
+	{
+		shouldSerialiseMetadata = Context::current()->get<bool>( g_includeParentPlugMetadata, true );
+	}
+	if( shouldSerialiseMetadata && !canSerialiseMetadataBinary( plug ) )
+	{
+		return false;
+	}
+
+	if( shouldSerialiseInput( plug, serialisation ) )
+	{
+		const std::string inputIdentifier = serialisation.identifier( plug->getInput() );
+		if( inputIdentifier.size() )
+		{
+			serialisation.addInput( identifier, inputIdentifier );
+		}
+	}
+
+	if( shouldSerialiseMetadata )
+	{
+		binaryMetadataSerialisation( plug, identifier, serialisation );
+	}
+
+	return true;
+}
+
+const std::type_info &PlugSerialiser::binaryPostHierarchyType() const
+{
+	return typeid( PlugSerialiser );
+}
+
 bool PlugSerialiser::childNeedsSerialisation( const Gaffer::GraphComponent *child, const Serialisation &serialisation ) const
 {
 	// cast is safe because of constraints maintained by Plug::acceptsChild().
@@ -44,14 +44,20 @@
 
 #include "Gaffer/ArrayPlug.h"
 #include "Gaffer/Context.h"
+#include "Gaffer/Metadata.h"
+#include "Gaffer/Node.h"
 #include "Gaffer/Plug.h"
+#include "Gaffer/PlugAlgo.h"
 #include "Gaffer/Spreadsheet.h"
 #include "Gaffer/Version.h"
 
+#include "IECorePython/ExceptionAlgo.h"
 #include "IECorePython/ScopedGILLock.h"
 
 #include "IECore/MemoryIndexedIO.h"
 #include "IECore/MessageHandler.h"
+#include "IECore/ObjectVector.h"
+#include "IECore/SimpleTypedData.h"
 
 #include "boost/algorithm/string.hpp"
 #include "boost/archive/iterators/base64_from_binary.hpp"
@@ -137,39 +143,429 @@ std::string modulePathInternal( const boost::python::object &o )
 	return sanitisedModulePath;
 }
 
+// Binary format
+// =============
+//
+// The binary format consists of a header followed by a flat list of operations,
+// which are performed in order by `executeBinary()`. All values are stored in a
+// single ObjectVector, saved using MemoryIndexedIO, which the operations refer
+// to by index. The leading null byte guarantees that a binary serialisation can
+// never be mistaken for a Python one.
+
+const std::string g_binaryMagic = std::string( 1, '\0' ) + "GafferBinarySerialisation";
+const uint32_t g_binaryVersion = 1;
+
+enum class OperationType : uint8_t
+{
+	// Executes `argument` as Python.
+	Python,
+	// Constructs a node of class `argument` named `name`, and parents it
+	// to `identifier`. If `flag` is set, the node is also stored in the
+	// `__children` dictionary of the execution namespace.
+	ConstructNode,
+	// Sets the value of plug `identifier` to `value`.
+	SetValue,
+	// Connects plug `identifier` to the plug `argument`.
+	SetInput,
+	// Registers `value` as the metadata `argument` for `identifier`. `flag`
+	// specifies whether or not the metadata is persistent.
+	RegisterMetadata
+};
+
+class BinaryWriter
+{
+
+	public :
+
+		void writeUInt8( uint8_t v )
+		{
+			m_data.push_back( static_cast<char>( v ) );
+		}
+
+		void writeUInt32( uint32_t v )
+		{
+			for( int i = 0; i < 4; ++i )
+			{
+				m_data.push_back( static_cast<char>( ( v >> ( i * 8 ) ) & 0xff ) );
+			}
+		}
+
+		void writeString( const std::string &s )
+		{
+			writeUInt32( s.size() );
+			m_data += s;
+		}
+
+		void writeBytes( const char *bytes, size_t size )
+		{
+			m_data.append( bytes, size );
+		}
+
+		std::string &data()
+		{
+			return m_data;
+		}
+
+	private :
+
+		std::string m_data;
+
+};
+
+class BinaryReader
+{
+
+	public :
+
+		BinaryReader( const std::string &data )
+			:	m_data( data ), m_position( 0 )
+		{
+		}
+
+		uint8_t readUInt8()
+		{
+			check( 1 );
+			return static_cast<uint8_t>( m_data[m_position++] );
+		}
+
+		uint32_t readUInt32()
+		{
+			check( 4 );
+			uint32_t result = 0;
+			for( int i = 0; i < 4; ++i )
+			{
+				result |= static_cast<uint32_t>( static_cast<uint8_t>( m_data[m_position++] ) ) << ( i * 8 );
+			}
+			return result;
+		}
+
+		const char *readBytes( size_t size )
+		{
+			check( size );
+			const char *result = m_data.data() + m_position;
+			m_position += size;
+			return result;
+		}
+
+		std::string readString()
+		{
+			const uint32_t size = readUInt32();
+			return std::string( readBytes( size ), size );
+		}
+
+	private :
+
+		void check( size_t size ) const
+		{
+			if( m_position + size > m_data.size() )
+			{
+				throw IECore::IOException( "Unexpected end of binary serialisation" );
+			}
+		}
+
+		const std::string &m_data;
+		size_t m_position;
+
+};
+
+// Resolves an identifier generated by `Serialisation::identifier()`, without
+// the overhead of evaluating it in Python. `root` is the component referred to
+// by the first element of the identifier, and `__children` entries are looked
+// up in `children`.
+GraphComponent *resolveIdentifier( const std::string &identifier, const std::string &parentName, GraphComponent *parent, PyObject *children )
+{
+	size_t pos = identifier.find( '[' );
+	const std::string root = identifier.substr( 0, pos );
+
+	GraphComponent *result = nullptr;
+	if( root == parentName )
+	{
+		result = parent;
+	}
+	else if( root == "__children" && children )
+	{
+		pos = identifier.find( "\"]", pos );
+		if( pos == std::string::npos )
+		{
+			throw IECore::Exception( fmt::format( "Invalid identifier \"{}\"", identifier ) );
+		}
+		const size_t start = root.size() + 2;
+		const std::string name = identifier.substr( start, pos - start );
+		PyObject *child = PyDict_GetItemString( children, name.c_str() );
+		if( !child )
+		{
+			throw IECore::Exception( fmt::format( "\"{}\" not found", identifier ) );
+		}
+		result = extract<GraphComponent *>( child );
+		pos += 2;
+	}
+	else
+	{
+		throw IECore::Exception( fmt::format( "Invalid identifier \"{}\"", identifier ) );
+	}
+
+	while( pos < identifier.size() )
+	{
+		if( identifier[pos] != '[' || pos + 1 >= identifier.size() )
+		{
+			throw IECore::Exception( fmt::format( "Invalid identifier \"{}\"", identifier ) );
+		}
+
+		GraphComponent *child = nullptr;
+		if( identifier[pos+1] == '"' )
+		{
+			const size_t end = identifier.find( "\"]", pos + 2 );
+			if( end == std::string::npos )
+			{
+				throw IECore::Exception( fmt::format( "Invalid identifier \"{}\"", identifier ) );
+			}
+			child = result->getChild( InternedString( identifier.substr( pos + 2, end - pos - 2 ) ) );
+			pos = end + 2;
+		}
+		else
+		{
+			const size_t end = identifier.find( ']', pos );
+			if( end == std::string::npos )
+			{
+				throw IECore::Exception( fmt::format( "Invalid identifier \"{}\"", identifier ) );
+			}
+			const size_t index = boost::lexical_cast<size_t>( identifier.substr( pos + 1, end - pos - 1 ) );
+			if( index < result->children().size() )
+			{
+				child = result->children()[index].get();
+			}
+			pos = end + 1;
+		}
+
+		if( !child )
+		{
+			throw IECore::Exception( fmt::format( "\"{}\" not found", identifier ) );
+		}
+		result = child;
+	}
+
+	return result;
+}
+
+template<typename T>
+T *resolveIdentifier( const std::string &identifier, const std::string &parentName, GraphComponent *parent, PyObject *children )
+{
+	GraphComponent *g = resolveIdentifier( identifier, parentName, parent, children );
+	if( T *t = runTimeCast<T>( g ) )
+	{
+		return t;
+	}
+	throw IECore::Exception( fmt::format( "\"{}\" is not a {}", identifier, T::staticTypeName() ) );
+}
+
+const std::string &nodeTypeName( const GraphComponent *graphComponent )
+{
+	static const std::string g_none( "None" );
+	const GraphComponent *node = runTimeCast<const Node>( graphComponent );
+	if( !node )
+	{
+		node = graphComponent->ancestor<Node>();
+	}
+	return node ? node->typeName() : g_none;
+}
+
+thread_local Serialisation::LoadStatistics *g_currentLoadStatistics = nullptr;
+
 } // namespace
 
+//////////////////////////////////////////////////////////////////////////
+// BinaryData
+//////////////////////////////////////////////////////////////////////////
+
+struct Serialisation::BinaryData
+{
+
+	struct Operation
+	{
+		OperationType type;
+		uint32_t nodeType;
+		std::string identifier;
+		std::string argument;
+		std::string name;
+		ConstDataPtr value;
+		bool flag;
+	};
+
+	using Operations = std::vector<Operation>;
+
+	Operations hierarchy;
+	Operations connections;
+	Operations post;
+
+	// Destination for `Serialisation::add*()` calls.
+	Operations *current = nullptr;
+	uint32_t currentNodeType = 0;
+
+	std::vector<std::string> nodeTypes;
+	std::unordered_map<std::string, uint32_t> nodeTypeIndices;
+
+	uint32_t nodeTypeIndex( const GraphComponent *graphComponent )
+	{
+		const std::string &typeName = nodeTypeName( graphComponent );
+		auto inserted = nodeTypeIndices.insert( { typeName, nodeTypes.size() } );
+		if( inserted.second )
+		{
+			nodeTypes.push_back( typeName );
+		}
+		return inserted.first->second;
+	}
+
+	void addPython( Operations &operations, uint32_t nodeType, const std::string &python )
+	{
+		if( python.empty() )
+		{
+			return;
+		}
+		// Merge with the previous fragment where possible, to minimise
+		// the number of separate calls into Python.
+		if( operations.size() && operations.back().type == OperationType::Python && operations.back().nodeType == nodeType )
+		{
+			operations.back().argument += python;
+		}
+		else
+		{
+			operations.push_back( { OperationType::Python, nodeType, "", python, "", nullptr, false } );
+		}
+	}
+
+	void writeOperations( const Operations &operations, BinaryWriter &writer, std::vector<ConstDataPtr> &values ) const
+	{
+		for( const auto &o : operations )
+		{
+			writer.writeUInt8( static_cast<uint8_t>( o.type ) );
+			writer.writeUInt32( o.nodeType );
+			switch( o.type )
+			{
+				case OperationType::Python :
+					writer.writeString( o.argument );
+					break;
+				case OperationType::ConstructNode :
+					writer.writeString( o.identifier );
+					writer.writeString( o.argument );
+					writer.writeString( o.name );
+					writer.writeUInt8( o.flag );
+					break;
+				case OperationType::SetValue :
+					writer.writeString( o.identifier );
+					writer.writeUInt32( values.size() );
+					values.push_back( o.value );
+					break;
+				case OperationType::SetInput :
+					writer.writeString( o.identifier );
+					writer.writeString( o.argument );
+					break;
+				case OperationType::RegisterMetadata :
+					writer.writeString( o.identifier );
+					writer.writeString( o.argument );
+					writer.writeUInt32( values.size() );
+					values.push_back( o.value );
+					writer.writeUInt8( o.flag );
+					break;
+			}
+		}
+	}
+
+};
+
 //////////////////////////////////////////////////////////////////////////
 // Serialisation
 //////////////////////////////////////////////////////////////////////////
 
-Serialisation::Serialisation( const Gaffer::GraphComponent *parent, const std::string &parentName, const Gaffer::Set *filter )
+Serialisation::Serialisation( const Gaffer::GraphComponent *parent, const std::string &parentName, const Gaffer::Set *filter, Format format, FragmentCache *fragmentCache )
 	:	m_parent( parent ), m_parentName( parentName ), m_filter( filter ),
-		m_protectParentNamespace( Context::current()->get<bool>( "serialiser:protectParentNamespace", true ) )
+		m_protectParentNamespace( Context::current()->get<bool>( "serialiser:protectParentNamespace", true ) ),
+		m_format( format ), m_fragmentCache( nullptr )
 {
+	if( m_format == Format::Binary )
+	{
+		m_binaryData = std::make_unique<BinaryData>();
+	}
+	else if( fragmentCache && !filter )
+	{
+		m_fragmentCache = fragmentCache;
+		if( m_fragmentCache->m_parentName != m_parentName || m_fragmentCache->m_protectParentNamespace != m_protectParentNamespace )
+		{
+			// Identifiers embedded in the fragments would be wrong.
+			m_fragmentCache->clear();
+			m_fragmentCache->m_parentName = m_parentName;
+			m_fragmentCache->m_protectParentNamespace = m_protectParentNamespace;
+		}
+		m_fragmentCache->m_generation++;
+		m_fragmentCache->m_hits = m_fragmentCache->m_misses = 0;
+	}
+
 	IECorePython::ScopedGILLock gilLock;
 	walk( parent, parentName, acquireSerialiser( parent ), Context::current()->canceller() );
 
-	if( Context::current()->get<bool>( "serialiser:includeParentMetadata", false ) )
+	if( m_fragmentCache )
 	{
-		if( const Node *node = runTimeCast<const Node>( parent ) )
+		// Discard fragments for children which no longer exist.
+		const uint64_t generation = m_fragmentCache->m_generation;
+		for( auto it = m_fragmentCache->m_fragments.begin(); it != m_fragmentCache->m_fragments.end(); )
 		{
-			m_postScript += metadataSerialisation( node, parentName, *this );
+			if( it->second.generation != generation )
+			{
+				it = m_fragmentCache->m_fragments.erase( it );
+			}
+			else
+			{
+				++it;
+			}
 		}
-		else if( const Plug *plug = runTimeCast<const Plug>( parent ) )
+	}
+
+	if( Context::current()->get<bool>( "serialiser:includeParentMetadata", false ) )
+	{
+		if( runTimeCast<const Node>( parent ) || runTimeCast<const Plug>( parent ) )
 		{
-			m_postScript += metadataSerialisation( plug, parentName, *this );
+			if( m_binaryData )
+			{
+				m_binaryData->current = &m_binaryData->post;
+				m_binaryData->currentNodeType = m_binaryData->nodeTypeIndex( parent );
+				if( canSerialiseMetadataBinary( parent ) )
+				{
+					binaryMetadataSerialisation( parent, parentName, *this );
+				}
+				else
+				{
+					m_binaryData->addPython( m_binaryData->post, m_binaryData->currentNodeType, metadataSerialisation( parent, parentName, *this ) );
+				}
+				m_binaryData->current = nullptr;
+			}
+			else
+			{
+				m_postScript += metadataSerialisation( parent, parentName, *this );
+			}
 		}
 	}
 }
 
+Serialisation::~Serialisation()
+{
+}
+
 const Gaffer::GraphComponent *Serialisation::parent() const
 {
 	return m_parent;
 }
 
+Serialisation::Format Serialisation::format() const
+{
+	return m_format;
+}
+
 std::string Serialisation::result() const
 {
+	if( m_binaryData )
+	{
+		return binaryResult();
+	}
+
 	std::string result;
 	for( std::set<std::string>::const_iterator it=m_modules.begin(); it!=m_modules.end(); it++ )
 	{
@@ -209,6 +605,315 @@ std::string Serialisation::result() const
 	return result;
 }
 
+std::string Serialisation::binaryResult() const
+{
+	BinaryWriter writer;
+	writer.writeBytes( g_binaryMagic.data(), g_binaryMagic.size() );
+	writer.writeUInt32( g_binaryVersion );
+	writer.writeString( m_parentName );
+	writer.writeUInt8( m_protectParentNamespace );
+
+	writer.writeUInt32( m_modules.size() );
+	for( const auto &m : m_modules )
+	{
+		writer.writeString( m );
+	}
+
+	BinaryData::Operations versionOperations;
+	if(
+		runTimeCast<const Node>( m_parent ) &&
+		Context::current()->get<bool>( "serialiser:includeVersionMetadata", true )
+	)
+	{
+		const uint32_t nodeType = m_binaryData->nodeTypes.size();
+		for( const auto &[key, value] : std::initializer_list<std::pair<const char *, int>> {
+			{ "serialiser:milestoneVersion", GAFFER_MILESTONE_VERSION },
+			{ "serialiser:majorVersion", GAFFER_MAJOR_VERSION },
+			{ "serialiser:minorVersion", GAFFER_MINOR_VERSION },
+			{ "serialiser:patchVersion", GAFFER_PATCH_VERSION }
+		} )
+		{
+			versionOperations.push_back( { OperationType::RegisterMetadata, nodeType, m_parentName, key, "", new IntData( value ), /* persistent = */ false } );
+		}
+	}
+
+	writer.writeUInt32( m_binaryData->nodeTypes.size() + ( versionOperations.size() ? 1 : 0 ) );
+	for( const auto &t : m_binaryData->nodeTypes )
+	{
+		writer.writeString( t );
+	}
+	if( versionOperations.size() )
+	{
+		writer.writeString( m_parent->typeName() );
+	}
+
+	// Operations are written into a separate buffer, so that the values
+	// they reference can be written first.
+
+	BinaryWriter operationsWriter;
+	std::vector<ConstDataPtr> values;
+	for( const auto operations : { &versionOperations, &m_binaryData->hierarchy, &m_binaryData->connections, &m_binaryData->post } )
+	{
+		m_binaryData->writeOperations( *operations, operationsWriter, values );
+	}
+
+	ObjectVectorPtr valuesVector = new ObjectVector;
+	valuesVector->members().reserve( values.size() );
+	for( const auto &v : values )
+	{
+		valuesVector->members().push_back( boost::const_pointer_cast<Data>( v ) );
+	}
+
+	IECore::MemoryIndexedIOPtr io = new IECore::MemoryIndexedIO( nullptr, {}, IECore::IndexedIO::Write );
+	valuesVector->save( io, "v" );
+	IECore::ConstCharVectorDataPtr buffer = io->buffer();
+	writer.writeUInt32( buffer->readable().size() );
+	writer.writeBytes( buffer->readable().data(), buffer->readable().size() );
+
+	writer.writeUInt32( versionOperations.size() + m_binaryData->hierarchy.size() + m_binaryData->connections.size() + m_binaryData->post.size() );
+	writer.data() += operationsWriter.data();
+
+	return std::move( writer.data() );
+}
+
+void Serialisation::addValue( const std::string &identifier, const IECore::Data *value )
+{
+	if( !m_binaryData || !m_binaryData->current )
+	{
+		throw IECore::Exception( "Serialisation::addValue may only be called from Serialiser::binaryPostHierarchy" );
+	}
+	m_binaryData->current->push_back( { OperationType::SetValue, m_binaryData->currentNodeType, identifier, "", "", value, false } );
+}
+
+void Serialisation::addInput( const std::string &identifier, const std::string &inputIdentifier )
+{
+	if( !m_binaryData || !m_binaryData->current )
+	{
+		throw IECore::Exception( "Serialisation::addInput may only be called from Serialiser::binaryPostHierarchy" );
+	}
+	m_binaryData->current->push_back( { OperationType::SetInput, m_binaryData->currentNodeType, identifier, inputIdentifier, "", nullptr, false } );
+}
+
+void Serialisation::addMetadata( const std::string &identifier, IECore::InternedString key, const IECore::Data *value, bool persistent )
+{
+	if( !m_binaryData || !m_binaryData->current )
+	{
+		throw IECore::Exception( "Serialisation::addMetadata may only be called from Serialiser::binaryPostHierarchy" );
+	}
+	m_binaryData->current->push_back( { OperationType::RegisterMetadata, m_binaryData->currentNodeType, identifier, key.string(), "", value, persistent } );
+}
+
+bool Serialisation::isBinary( const std::string &serialisation )
+{
+	return serialisation.compare( 0, g_binaryMagic.size(), g_binaryMagic ) == 0;
+}
+
+bool Serialisation::executeBinary( const std::string &serialisation, Gaffer::GraphComponent *parent, const boost::python::object &executionDict, const PythonFunction &executePython, bool continueOnError, const std::string &context )
+{
+	BinaryReader reader( serialisation );
+	reader.readBytes( g_binaryMagic.size() );
+	const uint32_t version = reader.readUInt32();
+	if( version > g_binaryVersion )
+	{
+		throw IECore::IOException( fmt::format( "Unsupported binary serialisation version {}", version ) );
+	}
+
+	const std::string parentName = reader.readString();
+	const bool protectParentNamespace = reader.readUInt8();
+
+	boost::python::object globals( executionDict );
+
+	// Import modules, as `import` statements in the Python format would.
+
+	const uint32_t numModules = reader.readUInt32();
+	for( uint32_t i = 0; i < numModules; ++i )
+	{
+		const std::string module = reader.readString();
+		try
+		{
+			boost::python::object m = boost::python::import( module.c_str() );
+			const std::string topLevel = module.substr( 0, module.find( '.' ) );
+			globals[topLevel] = topLevel == module ? m : boost::python::import( topLevel.c_str() );
+		}
+		catch( const boost::python::error_already_set & )
+		{
+			const std::string message = IECorePython::ExceptionAlgo::formatPythonException( /* withTraceback = */ false );
+			if( !continueOnError )
+			{
+				throw IECore::Exception( message );
+			}
+			IECore::msg( IECore::Msg::Error, context.size() ? context : "Serialisation::executeBinary", message );
+		}
+	}
+
+	std::vector<std::string> nodeTypes( reader.readUInt32() );
+	for( auto &t : nodeTypes )
+	{
+		t = reader.readString();
+	}
+
+	ConstObjectVectorPtr values;
+	{
+		const uint32_t size = reader.readUInt32();
+		CharVectorDataPtr buffer = new CharVectorData;
+		const char *bytes = reader.readBytes( size );
+		buffer->writable().assign( bytes, bytes + size );
+		MemoryIndexedIOPtr io = new MemoryIndexedIO( buffer, {}, IECore::IndexedIO::Read );
+		values = runTimeCast<const ObjectVector>( Object::load( io, "v" ) );
+		if( !values )
+		{
+			throw IECore::IOException( "Invalid values in binary serialisation" );
+		}
+	}
+
+	auto value = [&values] ( uint32_t index ) -> const Data * {
+		if( index >= values->members().size() )
+		{
+			throw IECore::IOException( "Invalid value index in binary serialisation" );
+		}
+		return runTimeCast<const Data>( values->members()[index].get() );
+	};
+
+	boost::python::dict children;
+	if( protectParentNamespace )
+	{
+		globals["__children"] = children;
+	}
+
+	std::vector<LoadStatistics::Entry> statistics( nodeTypes.size() );
+	std::unordered_map<std::string, boost::python::object> classes;
+
+	const IECore::Canceller *canceller = Context::current()->canceller();
+	bool result = false;
+
+	const uint32_t numOperations = reader.readUInt32();
+	for( uint32_t i = 0; i < numOperations; ++i )
+	{
+		IECore::Canceller::check( canceller );
+
+		const OperationType type = static_cast<OperationType>( reader.readUInt8() );
+		const uint32_t nodeType = reader.readUInt32();
+		if( nodeType >= statistics.size() )
+		{
+			throw IECore::IOException( "Invalid node type in binary serialisation" );
+		}
+		LoadStatistics::Entry &entry = statistics[nodeType];
+
+		const auto startTime = std::chrono::steady_clock::now();
+
+		if( type == OperationType::Python )
+		{
+			const std::string python = reader.readString();
+			result |= executePython( python );
+			entry.pythonFragments++;
+			entry.pythonTime += std::chrono::steady_clock::now() - startTime;
+			continue;
+		}
+
+		const std::string identifier = reader.readString();
+		try
+		{
+			switch( type )
+			{
+				case OperationType::ConstructNode : {
+					const std::string classPath = reader.readString();
+					const std::string name = reader.readString();
+					const bool storeInChildren = reader.readUInt8();
+					GraphComponent *nodeParent = resolveIdentifier( identifier, parentName, parent, children.ptr() );
+					auto inserted = classes.insert( { classPath, boost::python::object() } );
+					if( inserted.second )
+					{
+						inserted.first->second = boost::python::eval( classPath.c_str(), globals, globals );
+					}
+					boost::python::object node = inserted.first->second( name );
+					nodeParent->addChild( extract<GraphComponentPtr>( node )() );
+					if( storeInChildren )
+					{
+						children[name] = node;
+					}
+					break;
+				}
+				case OperationType::SetValue : {
+					const Data *data = value( reader.readUInt32() );
+					ValuePlug *plug = resolveIdentifier<ValuePlug>( identifier, parentName, parent, children.ptr() );
+					if( !data || !PlugAlgo::setValueFromData( plug, data ) )
+					{
+						throw IECore::Exception( fmt::format( "Unable to set value for \"{}\"", identifier ) );
+					}
+					break;
+				}
+				case OperationType::SetInput : {
+					const std::string inputIdentifier = reader.readString();
+					Plug *plug = resolveIdentifier<Plug>( identifier, parentName, parent, children.ptr() );
+					plug->setInput( resolveIdentifier<Plug>( inputIdentifier, parentName, parent, children.ptr() ) );
+					break;
+				}
+				case OperationType::RegisterMetadata : {
+					const std::string key = reader.readString();
+					const Data *data = value( reader.readUInt32() );
+					const bool persistent = reader.readUInt8();
+					GraphComponent *target = resolveIdentifier( identifier, parentName, parent, children.ptr() );
+					Metadata::registerValue( target, key, data, persistent );
+					break;
+				}
+				default :
+					throw IECore::IOException( "Invalid operation in binary serialisation" );
+			}
+		}
+		catch( const IECore::IOException & )
+		{
+			// The serialisation itself is corrupt, so we
+			// can't continue, even if `continueOnError` is true.
+			throw;
+		}
+		catch( const IECore::Cancelled & )
+		{
+			throw;
+		}
+		catch( const boost::python::error_already_set & )
+		{
+			const std::string message = IECorePython::ExceptionAlgo::formatPythonException( /* withTraceback = */ false );
+			if( !continueOnError )
+			{
+				throw IECore::Exception( fmt::format( "{}{}{}", context, context.size() ? " : " : "", message ) );
+			}
+			IECore::msg( IECore::Msg::Error, context.size() ? context : "Serialisation::executeBinary", message );
+			result = true;
+		}
+		catch( const std::exception &e )
+		{
+			if( !continueOnError )
+			{
+				throw IECore::Exception( fmt::format( "{}{}{}", context, context.size() ? " : " : "", e.what() ) );
+			}
+			IECore::msg( IECore::Msg::Error, context.size() ? context : "Serialisation::executeBinary", e.what() );
+			result = true;
+		}
+
+		entry.nativeOperations++;
+		entry.nativeTime += std::chrono::steady_clock::now() - startTime;
+	}
+
+	if( protectParentNamespace && PyDict_DelItemString( globals.ptr(), "__children" ) != 0 )
+	{
+		PyErr_Clear();
+	}
+
+	if( LoadStatistics *loadStatistics = LoadStatistics::current() )
+	{
+		for( size_t i = 0; i < nodeTypes.size(); ++i )
+		{
+			LoadStatistics::Entry &entry = loadStatistics->entries[nodeTypes[i]];
+			entry.nativeOperations += statistics[i].nativeOperations;
+			entry.pythonFragments += statistics[i].pythonFragments;
+			entry.nativeTime += statistics[i].nativeTime;
+			entry.pythonTime += statistics[i].pythonTime;
+		}
+	}
+
+	return result;
+}
+
 std::string Serialisation::modulePath( const IECore::RefCounted *object )
 {
 	boost::python::object o( RefCountedPtr( const_cast<RefCounted *>( object ) ) ); // we can only push non-const objects to python so we need the cast
@@ -287,51 +992,184 @@ void Serialisation::walk( const Gaffer::GraphComponent *parent, const std::strin
 			continue;
 		}
 
-		const Serialiser *childSerialiser = acquireSerialiser( child );
-		childSerialiser->moduleDependencies( child, m_modules, *this );
-
-		std::string childConstructor;
-		if( parentSerialiser->childNeedsConstruction( child, *this ) )
+		if( parent == m_parent && m_fragmentCache )
 		{
-			childConstructor = childSerialiser->constructor( child, *this );
-		}
-
-		std::string childIdentifier;
-		if( parent == m_parent && childConstructor.size() && m_protectParentNamespace )
-		{
-			childIdentifier = this->childIdentifier( "__children", it );
+			walkCachedChild( it, parentIdentifier, parentSerialiser, canceller );
 		}
 		else
 		{
-			childIdentifier = this->childIdentifier( parentIdentifier, it );
+			walkChild( it, parentIdentifier, parentSerialiser, canceller );
 		}
+	}
+}
 
-		if( childConstructor.size() )
+void Serialisation::walkChild( Gaffer::GraphComponent::ChildIterator it, const std::string &parentIdentifier, const Serialiser *parentSerialiser, const IECore::Canceller *canceller )
+{
+	const GraphComponent *child = it->get();
+	const GraphComponent *parent = child->parent();
+
+	const Serialiser *childSerialiser = acquireSerialiser( child );
+	childSerialiser->moduleDependencies( child, m_modules, *this );
+
+	std::string childConstructor;
+	if( parentSerialiser->childNeedsConstruction( child, *this ) )
+	{
+		childConstructor = childSerialiser->constructor( child, *this );
+	}
+
+	std::string childIdentifier;
+	if( parent == m_parent && childConstructor.size() && m_protectParentNamespace )
+	{
+		childIdentifier = this->childIdentifier( "__children", it );
+	}
+	else
+	{
+		childIdentifier = this->childIdentifier( parentIdentifier, it );
+	}
+
+	if( m_binaryData )
+	{
+		walkBinary( child, childIdentifier, childConstructor, parentIdentifier, childSerialiser );
+		walk( child, childIdentifier, childSerialiser, canceller );
+		return;
+	}
+
+	if( childConstructor.size() )
+	{
+		if( parent == m_parent )
 		{
-			if( parent == m_parent )
+			if( m_protectParentNamespace )
 			{
-				if( m_protectParentNamespace )
-				{
-					m_hierarchyScript += childIdentifier + " = " + childConstructor + "\n";
-					m_hierarchyScript += parentIdentifier + ".addChild( " + childIdentifier + " )\n";
-				}
-				else
-				{
-					m_hierarchyScript += childIdentifier + " = " + childConstructor + "\n";
-				}
+				m_hierarchyScript += childIdentifier + " = " + childConstructor + "\n";
+				m_hierarchyScript += parentIdentifier + ".addChild( " + childIdentifier + " )\n";
 			}
 			else
 			{
-				m_hierarchyScript += parentIdentifier + ".addChild( " + childConstructor + " )\n";
+				m_hierarchyScript += childIdentifier + " = " + childConstructor + "\n";
 			}
 		}
+		else
+		{
+			m_hierarchyScript += parentIdentifier + ".addChild( " + childConstructor + " )\n";
+		}
+	}
 
-		m_hierarchyScript += childSerialiser->postConstructor( child, childIdentifier, *this );
-		m_connectionScript += childSerialiser->postHierarchy( child, childIdentifier, *this );
-		m_postScript += childSerialiser->postScript( child, childIdentifier, *this );
+	m_hierarchyScript += childSerialiser->postConstructor( child, childIdentifier, *this );
+	m_connectionScript += childSerialiser->postHierarchy( child, childIdentifier, *this );
+	m_postScript += childSerialiser->postScript( child, childIdentifier, *this );
 
-		walk( child, childIdentifier, childSerialiser, canceller );
+	walk( child, childIdentifier, childSerialiser, canceller );
+}
+
+void Serialisation::walkCachedChild( Gaffer::GraphComponent::ChildIterator it, const std::string &parentIdentifier, const Serialiser *parentSerialiser, const IECore::Canceller *canceller )
+{
+	const GraphComponent *child = it->get();
+	const uint64_t key = m_fragmentCache->m_keyFunction( child );
+	if( !key )
+	{
+		walkChild( it, parentIdentifier, parentSerialiser, canceller );
+		return;
 	}
+
+	auto [fragmentIt, inserted] = m_fragmentCache->m_fragments.try_emplace( child );
+	FragmentCache::Fragment &fragment = fragmentIt->second;
+	fragment.generation = m_fragmentCache->m_generation;
+	if( !inserted && fragment.key == key )
+	{
+		m_hierarchyScript += fragment.hierarchy;
+		m_connectionScript += fragment.connections;
+		m_postScript += fragment.postScript;
+		m_modules.insert( fragment.modules.begin(), fragment.modules.end() );
+		m_fragmentCache->m_hits++;
+		return;
+	}
+
+	// Serialise as usual, but capture everything generated for
+	// the child so we can reuse it next time.
+
+	fragment.key = 0; // Invalid until we've completed successfully.
+	const size_t hierarchySize = m_hierarchyScript.size();
+	const size_t connectionSize = m_connectionScript.size();
+	const size_t postScriptSize = m_postScript.size();
+
+	std::set<std::string> modules;
+	m_modules.swap( modules );
+	try
+	{
+		walkChild( it, parentIdentifier, parentSerialiser, canceller );
+	}
+	catch( ... )
+	{
+		m_modules.insert( modules.begin(), modules.end() );
+		throw;
+	}
+	m_modules.swap( modules );
+	m_modules.insert( modules.begin(), modules.end() );
+
+	fragment.hierarchy = m_hierarchyScript.substr( hierarchySize );
+	fragment.connections = m_connectionScript.substr( connectionSize );
+	fragment.postScript = m_postScript.substr( postScriptSize );
+	fragment.modules = std::move( modules );
+	fragment.key = key;
+	m_fragmentCache->m_misses++;
+}
+
+void Serialisation::walkBinary( const Gaffer::GraphComponent *child, const std::string &childIdentifier, const std::string &childConstructor, const std::string &parentIdentifier, const Serialiser *childSerialiser )
+{
+	BinaryData &binaryData = *m_binaryData;
+	const uint32_t nodeType = binaryData.nodeTypeIndex( child );
+	const bool topLevel = child->parent() == m_parent;
+
+	if( childConstructor.size() )
+	{
+		// Nodes using the standard `repr()` constructor can be constructed
+		// without evaluating any Python. This doesn't apply when we're not
+		// protecting the parent namespace, because then the `parent[name] = node`
+		// form is used, which replaces any existing child with the same name.
+		if(
+			( !topLevel || m_protectParentNamespace ) &&
+			runTimeCast<const Node>( child ) &&
+			childConstructor == classPath( child ) + "( \"" + child->getName().string() + "\" )"
+		)
+		{
+			binaryData.hierarchy.push_back( {
+				OperationType::ConstructNode, nodeType, parentIdentifier,
+				classPath( child ), child->getName().string(), nullptr, topLevel
+			} );
+		}
+		else if( topLevel && m_protectParentNamespace )
+		{
+			binaryData.addPython(
+				binaryData.hierarchy, nodeType,
+				childIdentifier + " = " + childConstructor + "\n" +
+				parentIdentifier + ".addChild( " + childIdentifier + " )\n"
+			);
+		}
+		else if( topLevel )
+		{
+			binaryData.addPython( binaryData.hierarchy, nodeType, childIdentifier + " = " + childConstructor + "\n" );
+		}
+		else
+		{
+			binaryData.addPython( binaryData.hierarchy, nodeType, parentIdentifier + ".addChild( " + childConstructor + " )\n" );
+		}
+	}
+
+	binaryData.addPython( binaryData.hierarchy, nodeType, childSerialiser->postConstructor( child, childIdentifier, *this ) );
+
+	binaryData.current = &binaryData.connections;
+	binaryData.currentNodeType = nodeType;
+	const bool binaryPostHierarchy =
+		typeid( *childSerialiser ) == childSerialiser->binaryPostHierarchyType() &&
+		childSerialiser->binaryPostHierarchy( child, childIdentifier, *this )
+	;
+	binaryData.current = nullptr;
+	if( !binaryPostHierarchy )
+	{
+		binaryData.addPython( binaryData.connections, nodeType, childSerialiser->postHierarchy( child, childIdentifier, *this ) );
+	}
+
+	binaryData.addPython( binaryData.post, nodeType, childSerialiser->postScript( child, childIdentifier, *this ) );
 }
 
 std::string Serialisation::identifier( const Gaffer::GraphComponent *graphComponent ) const
@@ -445,6 +1283,46 @@ const Serialisation::Serialiser *Serialisation::acquireSerialiser( const GraphCo
 	return nullptr;
 }
 
+Serialisation::LoadStatistics::Scope::Scope( LoadStatistics *statistics )
+	:	m_previous( g_currentLoadStatistics )
+{
+	g_currentLoadStatistics = statistics;
+}
+
+Serialisation::LoadStatistics::Scope::~Scope()
+{
+	g_currentLoadStatistics = m_previous;
+}
+
+Serialisation::LoadStatistics *Serialisation::LoadStatistics::current()
+{
+	return g_currentLoadStatistics;
+}
+
+Serialisation::FragmentCache::FragmentCache( const KeyFunction &keyFunction )
+	:	m_keyFunction( keyFunction ), m_generation( 0 ), m_protectParentNamespace( false ), m_hits( 0 ), m_misses( 0 )
+{
+}
+
+Serialisation::FragmentCache::~FragmentCache()
+{
+}
+
+size_t Serialisation::FragmentCache::hits() const
+{
+	return m_hits;
+}
+
+size_t Serialisation::FragmentCache::misses() const
+{
+	return m_misses;
+}
+
+void Serialisation::FragmentCache::clear()
+{
+	m_fragments.clear();
+}
+
 Serialisation::SerialiserMap &Serialisation::serialiserMap()
 {
 	static SerialiserMap m;
@@ -541,6 +1419,16 @@ std::string Serialisation::Serialiser::postHierarchy( const Gaffer::GraphCompone
 	return "";
 }
 
+bool Serialisation::Serialiser::binaryPostHierarchy( const Gaffer::GraphComponent *graphComponent, const std::string &identifier, Serialisation &serialisation ) const
+{
+	return false;
+}
+
+const std::type_info &Serialisation::Serialiser::binaryPostHierarchyType() const
+{
+	return typeid( Serialiser );
+}
+
 std::string Serialisation::Serialiser::postScript( const Gaffer::GraphComponent *graphComponent, const std::string &identifier, Serialisation &serialisation ) const
 {
 	return "";
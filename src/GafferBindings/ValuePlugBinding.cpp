@@ -39,14 +39,17 @@
 
 #include "GafferBindings/ValuePlugBinding.h"
 
+#include "GafferBindings/MetadataBinding.h"
 #include "GafferBindings/PlugBinding.h"
 #include "GafferBindings/Serialisation.h"
 
 #include "Gaffer/Context.h"
 #include "Gaffer/Metadata.h"
 #include "Gaffer/Node.h"
+#include "Gaffer/PlugAlgo.h"
 #include "Gaffer/Reference.h"
 #include "Gaffer/Spreadsheet.h"
+#include "Gaffer/TypeIds.h"
 #include "Gaffer/ValuePlug.h"
 
 #include "boost/algorithm/string/predicate.hpp"
@@ -130,6 +133,76 @@ std::string valueSerialisationWalk( const Gaffer::ValuePlug *plug, const std::st
 	return identifier + ".setValue( " + ValuePlugSerialiser::valueRepr( pythonValue, &serialisation ) + " )\n";
 }
 
+// Binary equivalent of `valueSerialisationWalk()`. Values are always stored
+// for leaf plugs, since there is no readability benefit to condensing them.
+// Returns false if any value can't be represented natively, in which case
+// `values` should be ignored.
+bool binaryValueSerialisationWalk( const Gaffer::ValuePlug *plug, const std::string &identifier, Serialisation &serialisation, std::vector<std::pair<std::string, IECore::ConstDataPtr>> &values )
+{
+	if( !plug->getFlags( Plug::Serialisable ) )
+	{
+		return true;
+	}
+
+	if( plug->children().size() )
+	{
+		for( ValuePlug::Iterator childIt( plug ); !childIt.done(); ++childIt )
+		{
+			const std::string childIdentifier = serialisation.childIdentifier( identifier, childIt.base() );
+			if( !binaryValueSerialisationWalk( childIt->get(), childIdentifier, serialisation, values ) )
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	if( plug->getInput() || plug->direction() == Plug::Out || plug->isSetToDefault() )
+	{
+		return true;
+	}
+
+	switch( (Gaffer::TypeId)plug->typeId() )
+	{
+		case ValuePlugTypeId :
+			// No value to serialise.
+			return true;
+		case BoolPlugTypeId :
+		case IntPlugTypeId :
+		case FloatPlugTypeId :
+		case StringPlugTypeId :
+		case M33fPlugTypeId :
+		case M44fPlugTypeId :
+		case AtomicBox2fPlugTypeId :
+		case AtomicBox3fPlugTypeId :
+		case AtomicBox2iPlugTypeId :
+		case AtomicCompoundDataPlugTypeId :
+		case PathMatcherDataPlugTypeId :
+		case IntVectorDataPlugTypeId :
+		case FloatVectorDataPlugTypeId :
+		case StringVectorDataPlugTypeId :
+		case InternedStringVectorDataPlugTypeId :
+		case BoolVectorDataPlugTypeId :
+		case V2iVectorDataPlugTypeId :
+		case V3iVectorDataPlugTypeId :
+		case V2fVectorDataPlugTypeId :
+		case V3fVectorDataPlugTypeId :
+		case Color3fVectorDataPlugTypeId :
+		case Color4fVectorDataPlugTypeId :
+		case M44fVectorDataPlugTypeId :
+		case M33fVectorDataPlugTypeId :
+		case Box2fVectorDataPlugTypeId :
+		case Int64VectorDataPlugTypeId :
+			values.push_back( { identifier, PlugAlgo::getValueAsData( plug ) } );
+			return true;
+		default :
+			// Types we don't know about, including those
+			// implemented in Python. Fall back to Python
+			// serialisation.
+			return false;
+	}
+}
+
 std::string compoundObjectRepr( const IECore::CompoundObject &o, Serialisation *serialisation )
 {
 	std::string items;
@@ -246,6 +319,42 @@ std::string ValuePlugSerialiser::postHierarchy( const Gaffer::GraphComponent *gr
 	return result;
 }
 
+bool ValuePlugSerialiser::binaryPostHierarchy( const Gaffer::GraphComponent *graphComponent, const std::string &identifier, Serialisation &serialisation ) const
+{
+	const ValuePlug *plug = static_cast<const ValuePlug *>( graphComponent );
+
+	// Metadata is the only reason `PlugSerialiser::binaryPostHierarchy()` may fail,
+	// so we check it up front, before adding any values.
+	if( !canSerialiseMetadataBinary( plug ) )
+	{
+		return false;
+	}
+
+	std::vector<std::pair<std::string, IECore::ConstDataPtr>> values;
+	if( plug == serialisation.parent() || !plug->parent<ValuePlug>() )
+	{
+		if( plug->node() != serialisation.parent() || !Context::current()->get<bool>( g_omitParentNodePlugValues, false ) )
+		{
+			if( !binaryValueSerialisationWalk( plug, identifier, serialisation, values ) )
+			{
+				return false;
+			}
+		}
+	}
+
+	for( const auto &[valueIdentifier, value] : values )
+	{
+		serialisation.addValue( valueIdentifier, value.get() );
+	}
+
+	return PlugSerialiser::binaryPostHierarchy( graphComponent, identifier, serialisation );
+}
+
+const std::type_info &ValuePlugSerialiser::binaryPostHierarchyType() const
+{
+	return typeid( ValuePlugSerialiser );
+}
+
 std::string ValuePlugSerialiser::valueRepr( const boost::python::object &value, Serialisation *serialisation )
 {
 	// CompoundObject may contain objects which can only be serialised
@@ -68,6 +68,11 @@ template<typename T>
 class ParameterisedHolderSerialiser : public NodeSerialiser
 {
 
+	const std::type_info &binaryPostHierarchyType() const override
+	{
+		return typeid( ParameterisedHolderSerialiser );
+	}
+
 	std::string postScript( const Gaffer::GraphComponent *graphComponent, const std::string &identifier, Serialisation &serialisation ) const override
 	{
 		const T *parameterisedHolder = static_cast<const T *>( graphComponent );
@@ -44,14 +44,24 @@
 #include "Gaffer/StringPlug.h"
 #include "Gaffer/SubGraph.h"
 #include "Gaffer/Switch.h"
+#include "Gaffer/ThreadState.h"
 
 #include "IECore/FrameRange.h"
 #include "IECore/MessageHandler.h"
 
 #include "boost/algorithm/string/predicate.hpp"
+#include "boost/noncopyable.hpp"
 
 #include "fmt/format.h"
 
+#include "tbb/concurrent_hash_map.h"
+#include "tbb/task_arena.h"
+#include "tbb/task_group.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
 #include <unordered_map>
 
 using namespace std;
@@ -125,8 +135,10 @@ namespace
 
 const InternedString g_batchSize( "batchSize" );
 const InternedString g_immediatePlugName( "immediate" );
+const InternedString g_concurrentFramesPlugName( "concurrentFrames" );
 const InternedString g_jobDirectoryContextEntry( "dispatcher:jobDirectory" );
 const InternedString g_scriptFileNameContextEntry( "dispatcher:scriptFileName" );
+const InternedString g_taskHashesDirectoryContextEntry( "dispatcher:taskHashesDirectory" );
 const InternedString g_frameRangeStart( "frameRange:start" );
 const InternedString g_frameRangeEnd( "frameRange:end" );
 
@@ -147,6 +159,7 @@ Dispatcher::Dispatcher( const std::string &name )
 	addChild( new StringPlug( "frameRange", Plug::In, "1-100x10" ) );
 	addChild( new StringPlug( "jobName", Plug::In, "" ) );
 	addChild( new StringPlug( "jobsDirectory", Plug::In, "" ) );
+	addChild( new BoolPlug( "skipUpToDateTasks", Plug::In, false ) );
 }
 
 Dispatcher::~Dispatcher()
@@ -203,6 +216,16 @@ const StringPlug *Dispatcher::jobsDirectoryPlug() const
 	return getChild<StringPlug>( g_firstPlugIndex + 4 );
 }
 
+BoolPlug *Dispatcher::skipUpToDateTasksPlug()
+{
+	return getChild<BoolPlug>( g_firstPlugIndex + 5 );
+}
+
+const BoolPlug *Dispatcher::skipUpToDateTasksPlug() const
+{
+	return getChild<BoolPlug>( g_firstPlugIndex + 5 );
+}
+
 const std::filesystem::path Dispatcher::jobDirectory() const
 {
 	return m_jobDirectory;
@@ -308,6 +331,7 @@ void Dispatcher::setupPlugs( Plug *parentPlug )
 {
 	parentPlug->addChild( new IntPlug( g_batchSize, Plug::In, 1 ) );
 	parentPlug->addChild( new BoolPlug( g_immediatePlugName, Plug::In, false ) );
+	parentPlug->addChild( new IntPlug( g_concurrentFramesPlugName, Plug::In, 1, 1 ) );
 
 	const CreatorMap &m = creators();
 	for( const auto &[name, creator] : m )
@@ -415,21 +439,143 @@ const CompoundData *Dispatcher::TaskBatch::blindData() const
 // that it can track the necessary temporary state as member data.
 //////////////////////////////////////////////////////////////////////////
 
+namespace
+{
+
+// Information about a task, evaluated up front by `Batcher::evaluateTasks()`
+// so that it doesn't need to be evaluated again each time the task is visited.
+struct TaskInfo
+{
+
+	TaskInfo( const TaskNode::Task &task )
+		:	task( task ), source( nullptr ), requiresSequenceExecution( false ), batchSize( 1 ), immediate( false )
+	{
+	}
+
+	TaskNode::Task task;
+	// The task that is actually executed, after accounting for Switches
+	// and ContextProcessors. This is `this` if `task` is already the source,
+	// and `nullptr` if there is no source TaskNode. The remaining members are
+	// only valid when `source == this`.
+	const TaskInfo *source;
+
+	IECore::MurmurHash hash;
+	bool requiresSequenceExecution;
+	int batchSize;
+	bool immediate;
+	std::vector<const TaskInfo *> preTasks;
+	std::vector<const TaskInfo *> postTasks;
+
+};
+
+// Reports progress for dispatches large enough that users might otherwise
+// wonder what is going on.
+class ProgressReporter
+{
+
+	public :
+
+		// The message handler is captured up front, because messages may be
+		// output from TBB worker threads, where the caller's handler isn't
+		// current.
+		ProgressReporter()
+			:	m_messageHandler( IECore::MessageHandler::currentHandler() ),
+				m_startTime( std::chrono::steady_clock::now() ), m_lastReportTime( 0 ), m_count( 0 )
+		{
+		}
+
+		// May be called concurrently.
+		void increment( const char *description )
+		{
+			const size_t count = ++m_count;
+			if( count % 10000 )
+			{
+				return;
+			}
+
+			const int64_t elapsed = elapsedMilliseconds();
+			int64_t lastReportTime = m_lastReportTime;
+			if(
+				elapsed - lastReportTime < 2000 ||
+				!m_lastReportTime.compare_exchange_strong( lastReportTime, elapsed )
+			)
+			{
+				return;
+			}
+
+			m_messageHandler->handle(
+				IECore::Msg::Info, "Dispatcher",
+				fmt::format( "{} {} tasks ({:.1f}s)", description, count, elapsed / 1000.0 )
+			);
+		}
+
+		void reset()
+		{
+			m_count = 0;
+		}
+
+		bool reported() const
+		{
+			return m_lastReportTime > 0;
+		}
+
+		int64_t elapsedMilliseconds() const
+		{
+			return std::chrono::duration_cast<std::chrono::milliseconds>( std::chrono::steady_clock::now() - m_startTime ).count();
+		}
+
+		IECore::MessageHandler *messageHandler() const
+		{
+			return m_messageHandler;
+		}
+
+	private :
+
+		IECore::MessageHandler *m_messageHandler;
+		const std::chrono::steady_clock::time_point m_startTime;
+		std::atomic_int64_t m_lastReportTime;
+		std::atomic_size_t m_count;
+
+};
+
+} // namespace
+
 class Dispatcher::Batcher
 {
 
 	public :
 
 		Batcher()
-			:	m_rootBatch( new TaskBatch() )
+			:	m_rootBatch( new TaskBatch() ), m_threadState( ThreadState::current() )
 		{
 		}
 
-		void addTask( const TaskNode::Task &task )
+		void addTasks( const TaskNode::Tasks &tasks )
 		{
-			if( auto batch = batchTasksWalk( task ) )
+			// Evaluate all the tasks in parallel first, so that the serial
+			// walk that builds the batches only needs to look up the results.
+
+			std::vector<const TaskInfo *> taskInfos = evaluateTasks( tasks );
+
+			m_progress.reset();
+			for( const auto &taskInfo : taskInfos )
 			{
-				addPreTask( m_rootBatch.get(), batch );
+				Ancestors ancestors;
+				if( auto batch = batchTasksWalk( taskInfo, ancestors ) )
+				{
+					addPreTask( m_rootBatch.get(), batch );
+				}
+			}
+
+			if( m_progress.reported() )
+			{
+				m_progress.messageHandler()->handle(
+					IECore::Msg::Info, "Dispatcher",
+					fmt::format(
+						"Batched {} tasks into {} batches ({:.1f}s)",
+						m_tasksToBatches.size(), m_currentBatchesCreated, m_progress.elapsedMilliseconds() / 1000.0
+					)
+				);
 			}
 		}
 
@@ -455,24 +601,187 @@ class Dispatcher::Batcher
 
 	private :
 
-		TaskBatchPtr batchTasksWalk( TaskNode::Task task, const std::set<const TaskBatch *> &ancestors = std::set<const TaskBatch *>() )
+		// Task evaluation
+		// ===============
+		//
+		// Evaluating hashes and preTasks is by far the most expensive part of
+		// building the batches, so we do it in parallel, visiting each unique
+		// combination of TaskPlug and Context only once.
+
+		std::vector<const TaskInfo *> evaluateTasks( const TaskNode::Tasks &tasks )
+		{
+			std::vector<const TaskInfo *> result;
+			result.reserve( tasks.size() );
+
+			tbb::this_task_arena::isolate(
+				[&] {
+					for( const auto &task : tasks )
+					{
+						result.push_back( acquireTaskInfo( task ) );
+					}
+					m_taskGroup.wait();
+				}
+			);
+
+			return result;
+		}
+
+		const TaskInfo *acquireTaskInfo( const TaskNode::Task &task )
+		{
+			IECore::MurmurHash key = task.context()->hash();
+			key.append( (uint64_t)task.plug() );
+
+			TaskInfoMap::accessor accessor;
+			if( !m_taskInfos.insert( accessor, key ) )
+			{
+				return accessor->second.get();
+			}
+
+			accessor->second = std::make_unique<TaskInfo>( task );
+			TaskInfo *taskInfo = accessor->second.get();
+			accessor.release();
+
+			m_taskGroup.run(
+				[this, taskInfo] {
+					ThreadState::Scope threadStateScope( m_threadState );
+					evaluateTaskInfo( taskInfo );
+					m_progress.increment( "Evaluated" );
+				}
+			);
+
+			return taskInfo;
+		}
+
+		void evaluateTaskInfo( TaskInfo *taskInfo )
 		{
+			Context::Scope scopedTaskContext( taskInfo->task.context() );
+
 			// Find source task, taking into account
 			// Switches and ContextProcessors.
+
+			auto [sourcePlug, sourceContext] = PlugAlgo::contextSensitiveSource( taskInfo->task.plug() );
+			auto sourceTaskPlug = runTimeCast<const TaskNode::TaskPlug>( sourcePlug );
+			if( !sourceTaskPlug )
+			{
+				return;
+			}
+
+			if( sourceTaskPlug != taskInfo->task.plug() || ( sourceContext && *sourceContext != *taskInfo->task.context() ) )
+			{
+				taskInfo->source = acquireTaskInfo(
+					TaskNode::Task( sourceTaskPlug, sourceContext ? sourceContext.get() : taskInfo->task.context() )
+				);
+				return;
+			}
+
+			if( sourceTaskPlug->direction() != Plug::Out )
+			{
+				return;
+			}
+
+			// We are the source. Evaluate everything needed by `acquireBatch()`
+			// and `batchTasksWalk()`.
+
+			taskInfo->source = taskInfo;
+
+			const TaskNode::TaskPlug *plug = taskInfo->task.plug();
+			taskInfo->hash = plug->hash();
+			taskInfo->requiresSequenceExecution = plug->requiresSequenceExecution();
+
+			const Plug *dispatcherPlug = static_cast<const TaskNode *>( plug->node() )->dispatcherPlug();
+			if( const IntPlug *batchSizePlug = dispatcherPlug->getChild<const IntPlug>( g_batchSize ) )
+			{
+				taskInfo->batchSize = batchSizePlug->getValue();
+			}
+			if( const BoolPlug *immediatePlug = dispatcherPlug->getChild<const BoolPlug>( g_immediatePlugName ) )
+			{
+				taskInfo->immediate = immediatePlug->getValue();
+			}
+
+			TaskNode::Tasks preTasks;
+			TaskNode::Tasks postTasks;
+			plug->preTasks( preTasks );
+			plug->postTasks( postTasks );
+
+			taskInfo->preTasks.reserve( preTasks.size() );
+			for( const auto &preTask : preTasks )
 			{
-				Context::Scope scopedTaskContext( task.context() );
-				auto [sourcePlug, sourceContext] = PlugAlgo::contextSensitiveSource( task.plug() );
-				if( auto sourceTaskPlug = runTimeCast<const TaskNode::TaskPlug>( sourcePlug ) )
+				taskInfo->preTasks.push_back( acquireTaskInfo( preTask ) );
+			}
+
+			taskInfo->postTasks.reserve( postTasks.size() );
+			for( const auto &postTask : postTasks )
+			{
+				taskInfo->postTasks.push_back( acquireTaskInfo( postTask ) );
+			}
+		}
+
+		// Batch construction
+		// ==================
+		//
+		// This is done serially, so that the batches are identical from
+		// one dispatch to the next.
+
+		// Batches on the current path through the graph, used to detect
+		// cycles. We use a count per batch so that batches can be removed
+		// again by `AncestorScope`.
+		using Ancestors = std::unordered_map<const TaskBatch *, size_t>;
+
+		class AncestorsScope : boost::noncopyable
+		{
+
+			public :
+
+				AncestorsScope( Ancestors &ancestors, const TaskBatch *batch, const TaskBatches &postBatches )
+					:	m_ancestors( ancestors ), m_batch( batch ), m_postBatches( postBatches )
 				{
-					task = TaskNode::Task( sourceTaskPlug, sourceContext ? sourceContext.get() : task.context() );
+					add( m_batch );
+					for( const auto &postBatch : m_postBatches )
+					{
+						add( postBatch.get() );
+					}
 				}
-				else
+
+				~AncestorsScope()
 				{
-					return nullptr;
+					remove( m_batch );
+					for( const auto &postBatch : m_postBatches )
+					{
+						remove( postBatch.get() );
+					}
 				}
+
+			private :
+
+				void add( const TaskBatch *batch )
+				{
+					m_ancestors[batch]++;
+				}
+
+				void remove( const TaskBatch *batch )
+				{
+					auto it = m_ancestors.find( batch );
+					if( !--it->second )
+					{
+						m_ancestors.erase( it );
+					}
+				}
+
+				Ancestors &m_ancestors;
+				const TaskBatch *m_batch;
+				const TaskBatches &m_postBatches;
+
+		};
+
+		TaskBatchPtr batchTasksWalk( const TaskInfo *taskInfo, Ancestors &ancestors )
+		{
+			// Find source task, as determined by `evaluateTaskInfo()`.
+			while( taskInfo && taskInfo->source != taskInfo )
+			{
+				taskInfo = taskInfo->source;
 			}
 
-			if( task.plug()->direction() != Plug::Out )
+			if( !taskInfo )
 			{
 				return nullptr;
 			}
@@ -480,7 +789,7 @@ class Dispatcher::Batcher
 			// Acquire a batch with this task placed in it,
 			// and check that we haven't discovered a cyclic
 			// dependency.
-			TaskBatchPtr batch = acquireBatch( task );
+			TaskBatchPtr batch = acquireBatch( *taskInfo );
 			if( ancestors.find( batch.get() ) != ancestors.end() )
 			{
 				throw IECore::Exception( fmt::format(
@@ -489,23 +798,15 @@ class Dispatcher::Batcher
 				) );
 			}
 
-			// Ask the task what preTasks and postTasks it would like.
-			TaskNode::Tasks preTasks;
-			TaskNode::Tasks postTasks;
-			{
-				Context::Scope scopedTaskContext( task.context() );
-				task.plug()->preTasks( preTasks );
-				task.plug()->postTasks( postTasks );
-			}
-
 			// Collect all the batches the postTasks belong in.
 			// We grab these first because they need to be included
 			// in the ancestors for cycle detection when getting
 			// the preTask batches.
 			TaskBatches postBatches;
-			for( const auto &postTask : postTasks )
+			for( const auto &postTask : taskInfo->postTasks )
 			{
-				if( auto postBatch = batchTasksWalk( postTask ) )
+				Ancestors postTaskAncestors;
+				if( auto postBatch = batchTasksWalk( postTask, postTaskAncestors ) )
 				{
 					postBatches.push_back( postBatch );
 				}
@@ -514,18 +815,14 @@ class Dispatcher::Batcher
 			// Collect all the batches the preTasks belong in,
 			// and add them as preTasks for our batch.
 
-			std::set<const TaskBatch *> preTaskAncestors( ancestors );
-			preTaskAncestors.insert( batch.get() );
-			for( const auto &postBatch : postBatches )
-			{
-				preTaskAncestors.insert( postBatch.get() );
-			}
-
-			for( const auto &preTask : preTasks )
 			{
-				if( auto preBatch = batchTasksWalk( preTask, preTaskAncestors ) )
+				AncestorsScope ancestorsScope( ancestors, batch.get(), postBatches );
+				for( const auto &preTask : taskInfo->preTasks )
 				{
-					addPreTask( batch.get(), preBatch );
+					if( auto preBatch = batchTasksWalk( preTask, ancestors ) )
+					{
+						addPreTask( batch.get(), preBatch );
+					}
 				}
 			}
 
@@ -543,18 +840,15 @@ class Dispatcher::Batcher
 			return batch;
 		}
 
-		TaskBatchPtr acquireBatch( const TaskNode::Task &task )
+		TaskBatchPtr acquireBatch( const TaskInfo &taskInfo )
 		{
-			// Several plugs will be evaluated that may vary by context,
-			// so we need to be in the correct context for this task
-			// \todo should we be removing `frame` from the context?
-			Context::Scope scopedTaskContext( task.context() );
+			const TaskNode::Task &task = taskInfo.task;
 
 			// See if we've previously visited this task, and therefore
 			// have placed it in a batch already, which we can return
 			// unchanged. The `taskHash` is used as the unique identity of
 			// the task.
-			MurmurHash taskHash = task.plug()->hash();
+			MurmurHash taskHash = taskInfo.hash;
 			const bool taskIsNoOp = taskHash == IECore::MurmurHash();
 			if( taskIsNoOp )
 			{
@@ -572,12 +866,14 @@ class Dispatcher::Batcher
 				return batchForTask;
 			}
 
+			m_progress.increment( "Batched" );
+
 			// We haven't seen this task before, so we need to find
 			// an appropriate batch to put it in. This may be one of
 			// our current batches, or we may need to make a new one
 			// entirely if the current batch is full.
 
-			const bool requiresSequenceExecution = task.plug()->requiresSequenceExecution();
+			const bool requiresSequenceExecution = taskInfo.requiresSequenceExecution;
 
 			ConstContextPtr batchContext = m_batchContextPool.acquireUnique( task.context() );
 			MurmurHash batchMapHash = batchContext->hash();
@@ -586,9 +882,7 @@ class Dispatcher::Batcher
 			TaskBatchPtr &batch = m_currentBatches[batchMapHash];
 			if( batch && !requiresSequenceExecution )
 			{
-				const IntPlug *batchSizePlug = dispatcherPlug( task )->getChild<const IntPlug>( g_batchSize );
-				const int batchSizeLimit = ( batchSizePlug ) ? batchSizePlug->getValue() : 1;
-				if( batch->m_size >= (size_t)batchSizeLimit )
+				if( batch->m_size >= (size_t)taskInfo.batchSize )
 				{
 					// The current batch is full, so we'll need to make a new one.
 					batch = nullptr;
@@ -598,6 +892,7 @@ class Dispatcher::Batcher
 			if( !batch )
 			{
 				batch = new TaskBatch( task.plug(), batchContext );
+				m_currentBatchesCreated++;
 			}
 
 			// Now we have an appropriate batch, update it to include
@@ -619,8 +914,7 @@ class Dispatcher::Batcher
 
 			batch->m_size++;
 
-			const BoolPlug *immediatePlug = dispatcherPlug( task )->getChild<const BoolPlug>( g_immediatePlugName );
-			if( immediatePlug && immediatePlug->getValue() )
+			if( taskInfo.immediate )
 			{
 				batch->m_immediate = true;
 			}
@@ -688,19 +982,21 @@ class Dispatcher::Batcher
 			}
 		}
 
-		const Gaffer::Plug *dispatcherPlug( const TaskNode::Task &task )
-		{
-			return static_cast<const TaskNode *>( task.plug()->node() )->dispatcherPlug();
-		}
-
 		using BatchMap = std::unordered_map<IECore::MurmurHash, TaskBatchPtr>;
 		using TaskToBatchMap = std::unordered_map<IECore::MurmurHash, TaskBatchPtr>;
+		using TaskInfoMap = tbb::concurrent_hash_map<IECore::MurmurHash, std::unique_ptr<TaskInfo>>;
 
 		TaskBatchPtr m_rootBatch;
 		BatchMap m_currentBatches;
+		size_t m_currentBatchesCreated = 0;
 		TaskToBatchMap m_tasksToBatches;
 		BatchContextPool m_batchContextPool;
 
+		const ThreadState &m_threadState;
+		TaskInfoMap m_taskInfos;
+		tbb::task_group m_taskGroup;
+		ProgressReporter m_progress;
+
 };
 
 //////////////////////////////////////////////////////////////////////////
@@ -808,18 +1104,21 @@ IECore::MurmurHash Dispatcher::hash( const Gaffer::Context *context ) const
 	std::vector<int64_t> frames;
 	frameRange()->asList( frames );
 
-	Context::EditableScope jobContext( context );
-
-	Batcher batcher;
+	TaskNode::Tasks tasks;
+	tasks.reserve( frames.size() * tasksPlug()->children().size() );
 	for( auto frame : frames )
 	{
-		jobContext.setFrame( frame );
+		ContextPtr frameContext = new Context( *context );
+		frameContext->setFrame( frame );
 		for( auto &task : TaskNode::TaskPlug::Range( *tasksPlug() ) )
 		{
-			batcher.addTask( TaskNode::Task( task, Context::current() ) );
+			tasks.emplace_back( task, frameContext.get() );
 		}
 	}
 
+	Batcher batcher;
+	batcher.addTasks( tasks );
+
 	h.append( batcher.hash() );
 
 	return h;
@@ -875,19 +1174,48 @@ void Dispatcher::execute() const
 	Context::Scope jobScope( jobContext.get() );
 	createJobDirectory( script, jobContext.get() );
 
+	if( skipUpToDateTasksPlug()->getValue() && !jobContext->getIfExists<string>( g_taskHashesDirectoryContextEntry ) )
+	{
+		// Hashes are stored alongside the numbered job directories, so that
+		// they are shared by all jobs with the same name. If we're nested
+		// inside another dispatch, we just use the outer dispatcher's hashes.
+		jobContext->set(
+			g_taskHashesDirectoryContextEntry,
+			( m_jobDirectory.parent_path() / "taskHashes" ).generic_string()
+		);
+	}
+
 	signalGuard.emitDispatchSignal();
 
 	std::vector<FrameList::Frame> frames;
 	FrameListPtr frameList = frameRange();
 	frameList->asList( frames );
 
-	Batcher batcher;
+	// Tasks keep a reference to their context, so each frame needs
+	// a context of its own.
+	TaskNode::Tasks tasks;
+	tasks.reserve( frames.size() * tasksPlug()->children().size() );
 	for( const auto &frame : frames )
 	{
+		ContextPtr frameContext = new Context( *jobContext );
+		frameContext->setFrame( frame );
 		for( const auto &taskPlug : TaskPlug::Range( *tasksPlug() ) )
 		{
-			jobContext->setFrame( frame );
-			batcher.addTask( TaskNode::Task( taskPlug, Context::current() ) );
+			tasks.emplace_back( taskPlug, frameContext.get() );
+		}
+	}
+
+	Batcher batcher;
+	batcher.addTasks( tasks );
+
+	if( jobContext->getIfExists<string>( g_taskHashesDirectoryContextEntry ) )
+	{
+		std::unordered_map<const TaskBatch *, bool> visited;
+		size_t numSkipped = 0;
+		pruneUpToDateBatches( batcher.rootBatch(), visited, numSkipped );
+		if( numSkipped )
+		{
+			IECore::msg( IECore::Msg::Info, "Dispatcher", fmt::format( "Skipped {} up-to-date tasks", numSkipped ) );
 		}
 	}
 
@@ -957,6 +1285,68 @@ void Dispatcher::executeAndPruneImmediateBatches( TaskBatch *batch, bool immedia
 	batch->m_visited = true;
 }
 
+bool Dispatcher::pruneUpToDateBatches( TaskBatch *batch, std::unordered_map<const TaskBatch *, bool> &visited, size_t &numSkipped ) const
+{
+	auto [visitedIt, inserted] = visited.insert( { batch, true } );
+	if( !inserted )
+	{
+		return visitedIt->second;
+	}
+
+	// A batch must be executed if any of its preTasks are executed, because
+	// the task hashes don't account for the contents of files written by
+	// the preTasks.
+
+	bool executePreTasks = false;
+	TaskBatches &preTasks = batch->m_preTasks;
+	for( TaskBatches::iterator it = preTasks.begin(); it != preTasks.end(); )
+	{
+		if( pruneUpToDateBatches( it->get(), visited, numSkipped ) )
+		{
+			executePreTasks = true;
+			++it;
+		}
+		else
+		{
+			batch->m_preTasksSet.erase( it->get() );
+			it = preTasks.erase( it );
+		}
+	}
+
+	std::vector<float> &frames = batch->m_frames;
+	if( !executePreTasks && !frames.empty() )
+	{
+		Context::EditableScope frameScope( batch->m_context.get() );
+		auto upToDate = [&] ( float frame ) {
+			frameScope.setFrame( frame );
+			return batch->m_plug->upToDate();
+		};
+
+		if( batch->m_plug->requiresSequenceExecution() )
+		{
+			// Frames must be executed together, so we can
+			// only skip them if they are all up to date.
+			if( std::all_of( frames.begin(), frames.end(), upToDate ) )
+			{
+				numSkipped += frames.size();
+				frames.clear();
+			}
+		}
+		else
+		{
+			const size_t size = frames.size();
+			frames.erase( std::remove_if( frames.begin(), frames.end(), upToDate ), frames.end() );
+			numSkipped += size - frames.size();
+		}
+	}
+
+	// Note that `visitedIt` may have been invalidated by insertions
+	// made by the recursion above.
+	const bool result = executePreTasks || !frames.empty();
+	visited[batch] = result;
+	return result;
+}
+
 //////////////////////////////////////////////////////////////////////////
 // Registration
 //////////////////////////////////////////////////////////////////////////
@@ -41,12 +41,23 @@
 #include "Gaffer/ArrayPlug.h"
 #include "Gaffer/Context.h"
 #include "Gaffer/Dot.h"
+#include "Gaffer/NumericPlug.h"
 #include "Gaffer/Process.h"
 #include "Gaffer/ScriptNode.h"
 #include "Gaffer/SubGraph.h"
+#include "Gaffer/ThreadState.h"
+
+#include "IECore/MessageHandler.h"
 
 #include "fmt/format.h"
 
+#include "tbb/pipeline.h"
+
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <unordered_set>
+
 using namespace IECore;
 using namespace Gaffer;
 using namespace GafferDispatch;
@@ -113,6 +124,8 @@ class TaskNodeProcess : public Gaffer::Process
 		static InternedString requiresSequenceExecutionProcessType;
 		static InternedString preTasksProcessType;
 		static InternedString postTasksProcessType;
+		static InternedString outputFileNamesProcessType;
+		static InternedString outputHashProcessType;
 
 };
 
@@ -122,6 +135,170 @@ InternedString TaskNodeProcess::executeSequenceProcessType( "taskNode:executeSeq
 InternedString TaskNodeProcess::requiresSequenceExecutionProcessType( "taskNode:requiresSequenceExecution" );
 InternedString TaskNodeProcess::preTasksProcessType( "taskNode:preTasks" );
 InternedString TaskNodeProcess::postTasksProcessType( "taskNode:postTasks" );
+InternedString TaskNodeProcess::outputFileNamesProcessType( "taskNode:outputFileNames" );
+InternedString TaskNodeProcess::outputHashProcessType( "taskNode:outputHash" );
+
+const InternedString g_taskHashesDirectoryContextName( "dispatcher:taskHashesDirectory" );
+const InternedString g_concurrentFramesContextName( "taskNode:concurrentFrames" );
+const InternedString g_concurrentFramesPlugName( "concurrentFrames" );
+
+// Each output file of each frame has its own record, named by hashing the
+// file name and frame. We use separate files rather than a single manifest
+// so that records may be written concurrently by many processes.
+std::filesystem::path taskHashFileName( const std::string &directory, const std::string &outputFileName, float frame )
+{
+	IECore::MurmurHash h;
+	h.append( std::filesystem::absolute( outputFileName ).generic_string() );
+	h.append( frame );
+	return std::filesystem::path( directory ) / h.toString();
+}
+
+// Records the hash of the task in the current context, so that it can be
+// skipped by future dispatches if it is unchanged.
+void recordTaskHash( const TaskNode::TaskPlug *plug )
+{
+	const std::string *directory = Context::current()->getIfExists<std::string>( g_taskHashesDirectoryContextName );
+	if( !directory )
+	{
+		return;
+	}
+
+	std::vector<std::string> fileNames;
+	plug->outputFileNames( fileNames );
+	if( fileNames.empty() )
+	{
+		return;
+	}
+
+	const IECore::MurmurHash hash = plug->outputHash();
+	if( hash == IECore::MurmurHash() )
+	{
+		return;
+	}
+
+	try
+	{
+		std::filesystem::create_directories( *directory );
+		for( const auto &fileName : fileNames )
+		{
+			// Write to a temporary file and rename it, so that a concurrent
+			// reader never sees a partially written record.
+			const std::filesystem::path recordFileName = taskHashFileName( *directory, fileName, Context::current()->getFrame() );
+			std::filesystem::path tempFileName = recordFileName;
+			tempFileName += fmt::format( ".{}.tmp", std::random_device()() );
+			{
+				std::ofstream f( tempFileName );
+				f << hash.toString() << "\n" << fileName << "\n";
+				if( !f )
+				{
+					throw IECore::Exception( fmt::format( "Failed to write \"{}\"", tempFileName.generic_string() ) );
+				}
+			}
+			std::filesystem::rename( tempFileName, recordFileName );
+		}
+	}
+	catch( const std::exception &e )
+	{
+		// Failing to record the hash doesn't invalidate the task itself,
+		// it just means it will be executed again next time.
+		IECore::msg(
+			IECore::Msg::Warning, plug->relativeName( plug->ancestor<ScriptNode>() ),
+			fmt::format( "Unable to record task hash : {}", e.what() )
+		);
+	}
+}
+
+// Implementation of `TaskNode::executeFrames()`, with the concurrency
+// passed explicitly.
+void executeFramesInternal( const std::vector<float> &frames, const std::function<std::function<void ()> ()> &functor, size_t concurrency )
+{
+	concurrency = std::min( concurrency, frames.size() );
+	if( concurrency <= 1 )
+	{
+		Context::EditableScope frameScope( Context::current() );
+		for( auto frame : frames )
+		{
+			frameScope.setFrame( frame );
+			if( auto orderedFunctor = functor() )
+			{
+				orderedFunctor();
+			}
+		}
+		return;
+	}
+
+	// We use a pipeline so that we can limit the number of frames in flight
+	// without limiting the threads available to each frame. The final stage
+	// calls the ordered functors.
+
+	using FrameResult = std::pair<float, std::function<void ()>>;
+
+	const ThreadState &threadState = ThreadState::current();
+	size_t nextFrameIndex = 0;
+
+	tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
+	tbb::parallel_pipeline( concurrency,
+
+		tbb::make_filter<void, float>(
+			tbb::filter::serial_in_order,
+			[&] ( tbb::flow_control &flowControl ) {
+				if( nextFrameIndex >= frames.size() )
+				{
+					flowControl.stop();
+					return 0.0f;
+				}
+				return frames[nextFrameIndex++];
+			}
+		) &
+
+		tbb::make_filter<float, FrameResult>(
+			tbb::filter::parallel,
+			[&] ( float frame ) {
+				Context::EditableScope frameScope( threadState );
+				frameScope.setFrame( frame );
+				return FrameResult( frame, functor() );
+			}
+		) &
+
+		tbb::make_filter<FrameResult, void>(
+			tbb::filter::serial_in_order,
+			[&] ( const FrameResult &result ) {
+				if( result.second )
+				{
+					Context::EditableScope frameScope( threadState );
+					frameScope.setFrame( result.first );
+					result.second();
+				}
+			}
+		),
+
+		// Prevents outer tasks silently cancelling our tasks
+		taskGroupContext
+
+	);
+}
+
+// Returns true if no two frames share an output file.
+bool outputFileNamesUnique( const TaskNode::TaskPlug *plug, const std::vector<float> &frames )
+{
+	std::unordered_set<std::string> allFileNames;
+	std::vector<std::string> fileNames;
+	Context::EditableScope frameScope( Context::current() );
+	for( auto frame : frames )
+	{
+		frameScope.setFrame( frame );
+		fileNames.clear();
+		plug->outputFileNames( fileNames );
+		for( const auto &fileName : fileNames )
+		{
+			if( !allFileNames.insert( fileName ).second )
+			{
+				return false;
+			}
+		}
+	}
+	return true;
+}
 
 } // namespace
 
@@ -200,29 +377,45 @@ IECore::MurmurHash TaskNode::TaskPlug::hash() const
 
 void TaskNode::TaskPlug::execute() const
 {
-	TaskNodeProcess p( TaskNodeProcess::executeProcessType, this );
-	try
 	{
-		p.taskNode()->execute();
-	}
-	catch( ... )
-	{
-		p.handleException();
-		return;
+		TaskNodeProcess p( TaskNodeProcess::executeProcessType, this );
+		try
+		{
+			p.taskNode()->execute();
+		}
+		catch( ... )
+		{
+			p.handleException();
+			return;
+		}
 	}
+
+	recordTaskHash( this );
 }
 
 void TaskNode::TaskPlug::executeSequence( const std::vector<float> &frames ) const
 {
-	TaskNodeProcess p( TaskNodeProcess::executeSequenceProcessType, this );
-	try
 	{
-		p.taskNode()->executeSequence( frames );
+		TaskNodeProcess p( TaskNodeProcess::executeSequenceProcessType, this );
+		try
+		{
+			p.taskNode()->executeSequence( frames );
+		}
+		catch( ... )
+		{
+			p.handleException();
+			return;
+		}
 	}
-	catch( ... )
+
+	if( Context::current()->getIfExists<std::string>( g_taskHashesDirectoryContextName ) )
 	{
-		p.handleException();
-		return;
+		Context::EditableScope frameScope( Context::current() );
+		for( auto frame : frames )
+		{
+			frameScope.setFrame( frame );
+			recordTaskHash( this );
+		}
 	}
 }
 
@@ -268,6 +461,75 @@ void TaskNode::TaskPlug::postTasks( Tasks &tasks ) const
 	}
 }
 
+void TaskNode::TaskPlug::outputFileNames( std::vector<std::string> &fileNames ) const
+{
+	TaskNodeProcess p( TaskNodeProcess::outputFileNamesProcessType, this );
+	try
+	{
+		p.taskNode()->outputFileNames( p.context(), fileNames );
+	}
+	catch( ... )
+	{
+		p.handleException();
+		return;
+	}
+}
+
+IECore::MurmurHash TaskNode::TaskPlug::outputHash() const
+{
+	TaskNodeProcess p( TaskNodeProcess::outputHashProcessType, this );
+	try
+	{
+		return p.taskNode()->outputHash( p.context() );
+	}
+	catch( ... )
+	{
+		p.handleException();
+		return MurmurHash();
+	}
+}
+
+bool TaskNode::TaskPlug::upToDate() const
+{
+	const std::string *directory = Context::current()->getIfExists<std::string>( g_taskHashesDirectoryContextName );
+	if( !directory )
+	{
+		return false;
+	}
+
+	std::vector<std::string> fileNames;
+	outputFileNames( fileNames );
+	if( fileNames.empty() )
+	{
+		return false;
+	}
+
+	const IECore::MurmurHash h = outputHash();
+	if( h == IECore::MurmurHash() )
+	{
+		return false;
+	}
+
+	const std::string hashString = h.toString();
+	const float frame = Context::current()->getFrame();
+	for( const auto &fileName : fileNames )
+	{
+		if( !std::filesystem::exists( fileName ) )
+		{
+			return false;
+		}
+
+		std::ifstream f( taskHashFileName( *directory, fileName, frame ) );
+		std::string recordedHash;
+		if( !std::getline( f, recordedHash ) || recordedHash != hashString )
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
 //////////////////////////////////////////////////////////////////////////
 // TaskNode implementation
 //////////////////////////////////////////////////////////////////////////
@@ -372,6 +634,15 @@ void TaskNode::postTasks( const Context *context, Tasks &tasks ) const
 	}
 }
 
+void TaskNode::outputFileNames( const Context *context, std::vector<std::string> &fileNames ) const
+{
+}
+
+IECore::MurmurHash TaskNode::outputHash( const Context *context ) const
+{
+	return hash( context );
+}
+
 IECore::MurmurHash TaskNode::hash( const Context *context ) const
 {
 	IECore::MurmurHash h;
@@ -385,13 +656,22 @@ void TaskNode::execute() const
 
 void TaskNode::executeSequence( const std::vector<float> &frames ) const
 {
-	Context::EditableScope timeScope( Context::current() );
-
-	for ( std::vector<float>::const_iterator it = frames.begin(); it != frames.end(); ++it )
+	size_t concurrency = concurrentFrames();
+	if( concurrency > 1 && !outputFileNamesUnique( taskPlug(), frames ) )
 	{
-		timeScope.setFrame( *it );
-		execute();
+		// Frames writing to the same file must be executed serially,
+		// so that the last frame wins, as it would without concurrency.
+		concurrency = 1;
 	}
+
+	executeFramesInternal(
+		frames,
+		[this] {
+			execute();
+			return std::function<void ()>();
+		},
+		concurrency
+	);
 }
 
 bool TaskNode::requiresSequenceExecution() const
@@ -399,6 +679,32 @@ bool TaskNode::requiresSequenceExecution() const
 	return false;
 }
 
+bool TaskNode::supportsConcurrentFrames() const
+{
+	return false;
+}
+
+size_t TaskNode::concurrentFrames() const
+{
+	if( !supportsConcurrentFrames() )
+	{
+		return 1;
+	}
+
+	if( const int *concurrentFrames = Context::current()->getIfExists<int>( g_concurrentFramesContextName ) )
+	{
+		return std::max( *concurrentFrames, 1 );
+	}
+
+	const IntPlug *concurrentFramesPlug = dispatcherPlug()->getChild<IntPlug>( g_concurrentFramesPlugName );
+	return concurrentFramesPlug ? std::max( concurrentFramesPlug->getValue(), 1 ) : 1;
+}
+
+void TaskNode::executeFrames( const std::vector<float> &frames, const FrameFunctor &functor ) const
+{
+	executeFramesInternal( frames, functor, concurrentFrames() );
+}
+
 void GafferDispatch::intrusive_ptr_add_ref( TaskNode *node )
 {
 	bool firstRef = node->refCount() == 0;
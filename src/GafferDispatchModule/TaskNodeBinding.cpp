@@ -87,6 +87,33 @@ IECore::MurmurHash taskPlugHash( const TaskNode::TaskPlug &t )
 	return t.hash();
 }
 
+boost::python::list taskPlugOutputFileNames( const TaskNode::TaskPlug &t )
+{
+	std::vector<std::string> fileNames;
+	{
+		IECorePython::ScopedGILRelease gilRelease;
+		t.outputFileNames( fileNames );
+	}
+	boost::python::list result;
+	for( const auto &fileName : fileNames )
+	{
+		result.append( fileName );
+	}
+	return result;
+}
+
+IECore::MurmurHash taskPlugOutputHash( const TaskNode::TaskPlug &t )
+{
+	IECorePython::ScopedGILRelease gilRelease;
+	return t.outputHash();
+}
+
+bool taskPlugUpToDate( const TaskNode::TaskPlug &t )
+{
+	IECorePython::ScopedGILRelease gilRelease;
+	return t.upToDate();
+}
+
 void taskPlugExecute( const TaskNode::TaskPlug &t )
 {
 	IECorePython::ScopedGILRelease gilRelease;
@@ -163,6 +190,9 @@ void GafferDispatchModule::bindTaskNode()
 			.def( "requiresSequenceExecution", &TaskNode::TaskPlug::requiresSequenceExecution )
 			.def( "preTasks", &taskPlugPreTasks )
 			.def( "postTasks", &taskPlugPostTasks )
+			.def( "outputFileNames", &taskPlugOutputFileNames )
+			.def( "outputHash", &taskPlugOutputHash )
+			.def( "upToDate", &taskPlugUpToDate )
 			// Adjusting the name so that it correctly reflects
 			// the nesting, and can be used by the PlugSerialiser.
 			.attr( "__qualname__" ) = "TaskNode.TaskPlug"
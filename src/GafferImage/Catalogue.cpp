@@ -572,6 +572,30 @@ class Catalogue::InternalImage : public ImageNode
 				}
 
 				void save( WeakPtr forWrapUp )
+				{
+					// Run in the Background class, so that saving doesn't
+					// compete with the Viewer for threads.
+					ParallelAlgo::execute(
+						ParallelAlgo::Priority::Background,
+						[&] { saveInternal(); }
+					);
+
+					// Schedule execution of wrapUp() on the UI thread,
+					// to make our results visible to the user. Note that
+					// we absolutely _must not_ create a Ptr here on the
+					// background thread - ownership must be managed on
+					// the UI thread only (see ~AsynchronousSaver).
+					ParallelAlgo::callOnUIThread(
+						[forWrapUp] {
+							if( Ptr that = forWrapUp.lock() )
+							{
+								that->wrapUp();
+							}
+						}
+					);
+				}
+
+				void saveInternal()
 				{
 					ImageAlgo::parallelGatherTiles(
 						m_imageCopy->copyChannels()->outPlug(),
@@ -596,20 +620,6 @@ class Catalogue::InternalImage : public ImageNode
 					{
 						IECore::msg( IECore::Msg::Error, "Saving Catalogue image", e.what() );
 					}
-
-					// Schedule execution of wrapUp() on the UI thread,
-					// to make our results visible to the user. Note that
-					// we absolutely _must not_ create a Ptr here on the
-					// background thread - ownership must be managed on
-					// the UI thread only (see ~AsynchronousSaver).
-					ParallelAlgo::callOnUIThread(
-						[forWrapUp] {
-							if( Ptr that = forWrapUp.lock() )
-							{
-								that->wrapUp();
-							}
-						}
-					);
 				}
 
 				void wrapUp()
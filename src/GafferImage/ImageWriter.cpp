@@ -1866,6 +1866,44 @@ IECore::MurmurHash ImageWriter::hash( const Context *context ) const
 	return h;
 }
 
+void ImageWriter::outputFileNames( const Context *context, std::vector<std::string> &fileNames ) const
+{
+	Context::Scope scope( context );
+	const std::string fileName = fileNamePlug()->getValue();
+	if( !fileName.empty() )
+	{
+		fileNames.push_back( fileName );
+	}
+}
+
+IECore::MurmurHash ImageWriter::outputHash( const Context *context ) const
+{
+	IECore::MurmurHash h = hash( context );
+	if( h == IECore::MurmurHash() )
+	{
+		return h;
+	}
+
+	// `hash()` doesn't account for the image itself, so we must.
+	Context::Scope scope( context );
+	ConstStringVectorDataPtr viewNamesData = inPlug()->viewNames();
+	for( const auto &viewName : viewNamesData->readable() )
+	{
+		h.append( viewName );
+		h.append( ImageAlgo::imageHash( inPlug(), &viewName ) );
+	}
+
+	return h;
+}
+
+bool ImageWriter::supportsConcurrentFrames() const
+{
+	// Each frame is written to its own ImageOutput, so frames are
+	// independent. `TaskNode::executeSequence()` takes care of executing
+	// serially if several frames write to the same file.
+	return true;
+}
+
 void ImageWriter::execute() const
 {
 	// Create an OIIO::ImageOutput
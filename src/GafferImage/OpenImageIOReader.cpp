@@ -45,6 +45,7 @@
 #include "GafferImage/ImageReader.h"
 
 #include "Gaffer/Context.h"
+#include "Gaffer/MemoryPressureGovernor.h"
 #include "Gaffer/StringPlug.h"
 
 #include "IECoreImage/OpenImageIOAlgo.h"
@@ -64,7 +65,9 @@
 #include "tbb/parallel_for.h"
 #include "tbb/enumerable_thread_specific.h"
 
+#include <filesystem>
 #include <memory>
+#include <optional>
 
 OIIO_NAMESPACE_USING
 
@@ -1619,6 +1622,13 @@ FileHandleCache *fileCache()
 	return c;
 }
 
+// Each open file holds buffers and headers, so we allow the number of
+// open files to be reduced under memory pressure.
+MemoryPressureGovernor::CacheRegistration g_fileCacheRegistration(
+	"OpenImageIOReader:openFiles",
+	{ &OpenImageIOReader::getOpenFilesLimit, &OpenImageIOReader::setOpenFilesLimit, nullptr }
+);
+
 boost::container::flat_set<ustring> g_metadataBlacklist = {
 	// These two attributes are used by OIIO/EXR to specify the names of
 	// subimages. We don't want to load them because :
@@ -1644,6 +1654,45 @@ boost::container::flat_set<ustring> g_metadataBlacklist = {
 	ustring( "multiView" )
 };
 
+// Returns the frame which `MissingFrameMode::Hold` substitutes for
+// a missing `frame`, or nothing if there are no frames available.
+std::optional<int> heldFrame( const std::vector<int> &frames, float frame )
+{
+	if( frames.empty() )
+	{
+		return std::nullopt;
+	}
+
+	std::vector<int>::const_iterator fIt = std::lower_bound( frames.begin(), frames.end(), (int)frame );
+
+	// decrement to get the previous frame, unless
+	// this is the first frame, in which case we
+	// hold to the beginning of the sequence
+	if( fIt != frames.begin() )
+	{
+		fIt--;
+	}
+
+	return *fIt;
+}
+
+// Appends the size and modification time of a file, without opening it.
+// Returns false if the file doesn't exist.
+bool hashFileIdentity( const std::string &fileName, IECore::MurmurHash &h )
+{
+	std::error_code errorCode;
+	const std::filesystem::file_time_type time = std::filesystem::last_write_time( fileName, errorCode );
+	if( errorCode )
+	{
+		return false;
+	}
+
+	h.append( (int64_t)time.time_since_epoch().count() );
+	const uintmax_t size = std::filesystem::file_size( fileName, errorCode );
+	h.append( errorCode ? (uint64_t)0 : (uint64_t)size );
+	return true;
+}
+
 } // namespace
 
 //////////////////////////////////////////////////////////////////////////
@@ -1759,6 +1808,11 @@ size_t OpenImageIOReader::getOpenFilesLimit()
 	return fileCache()->getMaxCost();
 }
 
+void OpenImageIOReader::clearFileCache()
+{
+	fileCache()->clear();
+}
+
 size_t OpenImageIOReader::supportedExtensions( std::vector<std::string> &extensions )
 {
 	std::string attr;
@@ -1839,6 +1893,29 @@ void OpenImageIOReader::hash( const ValuePlug *output, const Context *context, I
 		refreshCountPlug()->hash( h );
 		missingFrameModePlug()->hash( h );
 		channelInterpretationPlug()->hash( h );
+
+		// Tile batches are stored in the persistent cache, where they may be
+		// reused by other processes. The file name and refresh count only
+		// identify the file within this process, so we also hash the size and
+		// modification time of the file we will read from. We get these from
+		// the filesystem rather than by opening the file, so that hashing
+		// neither pays for the open nor throws for missing files, leaving
+		// errors to be reported by the compute as usual.
+		const std::string fileName = fileNamePlug()->getValue();
+		if( !fileName.empty() && !hashFileIdentity( c.context()->substitute( fileName ), h ) )
+		{
+			if( (MissingFrameMode)missingFrameModePlug()->getValue() == Hold )
+			{
+				// Mirror `retrieveFile()`, which will read from the held frame.
+				ConstIntVectorDataPtr frames = availableFramesPlug()->getValue();
+				if( std::optional<int> frame = heldFrame( frames->readable(), c.context()->getFrame() ) )
+				{
+					Context::EditableScope holdScope( c.context() );
+					holdScope.setFrame( *frame );
+					hashFileIdentity( holdScope.context()->substitute( fileName ), h );
+				}
+			}
+		}
 	}
 }
 
@@ -1922,8 +1999,9 @@ Gaffer::ValuePlug::CachePolicy OpenImageIOReader::computeCachePolicy( const Gaff
 	{
 		// For our most common case, reading Exrs using ExrCore, we are able to have multiple threads join
 		// and help with reading ( the actual file reads probably don't benefit too much from multithreading,
-		// but decompression benefits a lot )
-		return ValuePlug::CachePolicy::TaskCollaboration;
+		// but decompression benefits a lot ). Tile batches are also expensive enough to be worth storing
+		// in the persistent cache, if it is enabled.
+		return ValuePlug::CachePolicy::Persistent;
 	}
 	else if( output == outPlug()->channelDataPlug() )
 	{
@@ -2282,22 +2360,11 @@ std::shared_ptr<void> OpenImageIOReader::retrieveFile( const Context *context, b
 		else if( mode == OpenImageIOReader::Hold )
 		{
 			ConstIntVectorDataPtr frameData = availableFramesPlug()->getValue();
-			const std::vector<int> &frames = frameData->readable();
-			if( frames.size() )
+			if( std::optional<int> frame = heldFrame( frameData->readable(), context->getFrame() ) )
 			{
-				std::vector<int>::const_iterator fIt = std::lower_bound( frames.begin(), frames.end(), (int)context->getFrame() );
-
-				// decrement to get the previous frame, unless
-				// this is the first frame, in which case we
-				// hold to the beginning of the sequence
-				if( fIt != frames.begin() )
-				{
-					fIt--;
-				}
-
 				// setup a context with the new frame
 				Context::EditableScope holdScope( context );
-				holdScope.setFrame( *fIt );
+				holdScope.setFrame( *frame );
 
 				const std::string resolvedFileNameHeld = holdScope.context()->substitute( fileName );
 				cacheEntry = cache->get( std::make_pair( resolvedFileNameHeld, channelNaming ) );
@@ -73,6 +73,11 @@ struct DriverCreatedSlotCaller
 class CatalogueSerialiser : public NodeSerialiser
 {
 
+	const std::type_info &binaryPostHierarchyType() const override
+	{
+		return typeid( CatalogueSerialiser );
+	}
+
 	bool childNeedsSerialisation( const Gaffer::GraphComponent *child, const Serialisation &serialisation ) const override
 	{
 		if( child == child->parent<Catalogue>()->outPlug() )
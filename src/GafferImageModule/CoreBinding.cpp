@@ -262,6 +262,11 @@ class AtomicFormatPlugSerialiser : public GafferBindings::ValuePlugSerialiser
 
 	public :
 
+		const std::type_info &binaryPostHierarchyType() const override
+		{
+			return typeid( AtomicFormatPlugSerialiser );
+		}
+
 		void moduleDependencies( const Gaffer::GraphComponent *graphComponent, std::set<std::string> &modules, const Serialisation &serialisation ) const override
 		{
 			// Imath is needed when reloading Format values which reference Box2i.
@@ -298,6 +303,11 @@ class FormatPlugSerialiser : public GafferBindings::ValuePlugSerialiser
 
 	public :
 
+		const std::type_info &binaryPostHierarchyType() const override
+		{
+			return typeid( FormatPlugSerialiser );
+		}
+
 		void moduleDependencies( const Gaffer::GraphComponent *graphComponent, std::set<std::string> &modules, const Serialisation &serialisation ) const override
 		{
 			// Imath is needed when reloading Format values which reference Box2i.
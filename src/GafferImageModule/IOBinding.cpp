@@ -134,6 +134,8 @@ void GafferImageModule::bindIO()
 			.staticmethod( "setOpenFilesLimit" )
 			.def( "getOpenFilesLimit", &OpenImageIOReader::getOpenFilesLimit )
 			.staticmethod( "getOpenFilesLimit" )
+			.def( "clearFileCache", &OpenImageIOReader::clearFileCache )
+			.staticmethod( "clearFileCache" )
 			.def( "supportedExtensions", &supportedExtensions<OpenImageIOReader> )
 			.staticmethod( "supportedExtensions" )
 		;
@@ -65,6 +65,11 @@ class ImageProcessorSerialiser : public GafferBindings::NodeSerialiser
 
 	public :
 
+		const std::type_info &binaryPostHierarchyType() const override
+		{
+			return typeid( ImageProcessorSerialiser );
+		}
+
 		bool childNeedsSerialisation( const Gaffer::GraphComponent *child, const Serialisation &serialisation ) const override
 		{
 			auto imageProcessor = static_cast<const ImageProcessor *>( child->parent() );
@@ -922,7 +922,8 @@ void ImageGadget::updateTiles()
 				);
 			}
 
-		}
+		},
+		ParallelAlgo::Priority::Interactive
 	);
 
 }
@@ -163,6 +163,11 @@ void dataToTensorSetupWrapper( DataToTensor &dataToTensor, ValuePlug &prototypeD
 class DataToTensorSerialiser : public NodeSerialiser
 {
 
+	const std::type_info &binaryPostHierarchyType() const override
+	{
+		return typeid( DataToTensorSerialiser );
+	}
+
 	bool childNeedsConstruction( const Gaffer::GraphComponent *child, const Serialisation &serialisation ) const override
 	{
 		auto dataToTensor = child->parent<DataToTensor>();
@@ -44,6 +44,10 @@
 
 #include "Gaffer/Animation.h"
 
+#include "IECorePython/RefCountedBinding.h"
+
+#include "IECore/VectorTypedData.h"
+
 #include "fmt/format.h"
 
 #include "boost/lexical_cast.hpp"
@@ -139,6 +143,27 @@ void setTieMode( Animation::Key &k, const Animation::TieMode mode )
 	k.setTieMode( mode );
 }
 
+template<typename T>
+IECore::FloatVectorDataPtr evaluateTimes( const T &t, const IECore::FloatVectorData &times )
+{
+	IECore::FloatVectorDataPtr result = new IECore::FloatVectorData;
+	result->writable().resize( times.readable().size() );
+	ScopedGILRelease gilRelease;
+	t.evaluate( times.readable(), result->writable() );
+	return result;
+}
+
+Animation::CurvePlug::ConstBakedPtr baked( const Animation::CurvePlug &curve, const float startTime, const float endTime, const size_t numSamples )
+{
+	ScopedGILRelease gilRelease;
+	return curve.baked( startTime, endTime, numSamples );
+}
+
+IECore::FloatVectorDataPtr bakedSamples( const Animation::CurvePlug::Baked &baked )
+{
+	return new IECore::FloatVectorData( baked.samples() );
+}
+
 std::string keyRepr( const Animation::Key &k )
 {
 	return fmt::format(
@@ -225,6 +250,11 @@ class CurvePlugSerialiser : public ValuePlugSerialiser
 
 	public :
 
+		const std::type_info &binaryPostHierarchyType() const override
+		{
+			return typeid( CurvePlugSerialiser );
+		}
+
 		std::string postConstructor( const Gaffer::GraphComponent *graphComponent, const std::string &identifier, Serialisation &serialisation ) const override
 		{
 			std::string result = ValuePlugSerialiser::postConstructor( graphComponent, identifier, serialisation );
@@ -360,62 +390,75 @@ void GafferModule::bindAnimation()
 		)
 	;
 
-	PlugClass< Animation::CurvePlug >()
-		.def( init< const char *, Plug::Direction, unsigned >(
-				(
-					boost::python::arg_( "name" )=GraphComponent::defaultName<Animation::CurvePlug>(),
-					boost::python::arg_( "direction" )=Plug::In,
-					boost::python::arg_( "flags" )=Plug::Default
+	{
+		scope curvePlugScope = PlugClass< Animation::CurvePlug >()
+			.def( init< const char *, Plug::Direction, unsigned >(
+					(
+						boost::python::arg_( "name" )=GraphComponent::defaultName<Animation::CurvePlug>(),
+						boost::python::arg_( "direction" )=Plug::In,
+						boost::python::arg_( "flags" )=Plug::Default
+					)
 				)
 			)
-		)
-		.def( "keyAddedSignal", &Animation::CurvePlug::keyAddedSignal, return_internal_reference< 1 >() )
-		.def( "keyRemovedSignal", &Animation::CurvePlug::keyRemovedSignal, return_internal_reference< 1 >() )
-		.def( "keyTimeChangedSignal", &Animation::CurvePlug::keyTimeChangedSignal, return_internal_reference< 1 >() )
-		.def( "keyValueChangedSignal", &Animation::CurvePlug::keyValueChangedSignal, return_internal_reference< 1 >() )
-		.def( "keyInterpolationChangedSignal", &Animation::CurvePlug::keyInterpolationChangedSignal, return_internal_reference< 1 >() )
-		.def( "keyTieModeChangedSignal", &Animation::CurvePlug::keyTieModeChangedSignal, return_internal_reference< 1 >() )
-		.def( "extrapolationChangedSignal", &Animation::CurvePlug::extrapolationChangedSignal, return_internal_reference< 1 >() )
-		.def( "addKey", &addKey, arg( "removeActiveClashing" ) = true )
-		.def( "insertKey", &insertKey )
-		.def( "insertKey", &insertKeyValue )
-		.def( "hasKey", &Animation::CurvePlug::hasKey )
-		.def(
-			"getKey",
-			(Animation::Key *(Animation::CurvePlug::*)( float ))&Animation::CurvePlug::getKey,
-			return_value_policy<IECorePython::CastToIntrusivePtr>()
-		)
-		.def( "removeKey", &removeKey )
-		.def( "removeInactiveKeys", &removeInactiveKeys )
-		.def(
-			"closestKey",
-			(Animation::Key *(Animation::CurvePlug::*)( float ))&Animation::CurvePlug::closestKey,
-			return_value_policy<IECorePython::CastToIntrusivePtr>()
-		)
-		.def(
-			"closestKey",
-			(Animation::Key *(Animation::CurvePlug::*)( float, float ))&Animation::CurvePlug::closestKey,
-			return_value_policy<IECorePython::CastToIntrusivePtr>()
-		)
-		.def(
-			"previousKey",
-			(Animation::Key *(Animation::CurvePlug::*)( float ))&Animation::CurvePlug::previousKey,
-			return_value_policy<IECorePython::CastToIntrusivePtr>()
-		)
-		.def(
-			"nextKey",
-			(Animation::Key *(Animation::CurvePlug::*)( float ))&Animation::CurvePlug::nextKey,
-			return_value_policy<IECorePython::CastToIntrusivePtr>()
-		)
-		.def( "setExtrapolation", &setExtrapolation )
-		.def( "getExtrapolation", &Animation::CurvePlug::getExtrapolation )
-		.def(
-			"getExtrapolationKey",
-			(Animation::Key *(Animation::CurvePlug::*)( Animation::Direction ))&Animation::CurvePlug::getExtrapolationKey,
-			return_value_policy<IECorePython::CastToIntrusivePtr>() )
-		.def( "evaluate", &Animation::CurvePlug::evaluate )
-		.attr( "__qualname__" ) = "Animation.CurvePlug"
-	;
+			.def( "keyAddedSignal", &Animation::CurvePlug::keyAddedSignal, return_internal_reference< 1 >() )
+			.def( "keyRemovedSignal", &Animation::CurvePlug::keyRemovedSignal, return_internal_reference< 1 >() )
+			.def( "keyTimeChangedSignal", &Animation::CurvePlug::keyTimeChangedSignal, return_internal_reference< 1 >() )
+			.def( "keyValueChangedSignal", &Animation::CurvePlug::keyValueChangedSignal, return_internal_reference< 1 >() )
+			.def( "keyInterpolationChangedSignal", &Animation::CurvePlug::keyInterpolationChangedSignal, return_internal_reference< 1 >() )
+			.def( "keyTieModeChangedSignal", &Animation::CurvePlug::keyTieModeChangedSignal, return_internal_reference< 1 >() )
+			.def( "extrapolationChangedSignal", &Animation::CurvePlug::extrapolationChangedSignal, return_internal_reference< 1 >() )
+			.def( "addKey", &addKey, arg( "removeActiveClashing" ) = true )
+			.def( "insertKey", &insertKey )
+			.def( "insertKey", &insertKeyValue )
+			.def( "hasKey", &Animation::CurvePlug::hasKey )
+			.def(
+				"getKey",
+				(Animation::Key *(Animation::CurvePlug::*)( float ))&Animation::CurvePlug::getKey,
+				return_value_policy<IECorePython::CastToIntrusivePtr>()
+			)
+			.def( "removeKey", &removeKey )
+			.def( "removeInactiveKeys", &removeInactiveKeys )
+			.def(
+				"closestKey",
+				(Animation::Key *(Animation::CurvePlug::*)( float ))&Animation::CurvePlug::closestKey,
+				return_value_policy<IECorePython::CastToIntrusivePtr>()
+			)
+			.def(
+				"closestKey",
+				(Animation::Key *(Animation::CurvePlug::*)( float, float ))&Animation::CurvePlug::closestKey,
+				return_value_policy<IECorePython::CastToIntrusivePtr>()
+			)
+			.def(
+				"previousKey",
+				(Animation::Key *(Animation::CurvePlug::*)( float ))&Animation::CurvePlug::previousKey,
+				return_value_policy<IECorePython::CastToIntrusivePtr>()
+			)
+			.def(
+				"nextKey",
+				(Animation::Key *(Animation::CurvePlug::*)( float ))&Animation::CurvePlug::nextKey,
+				return_value_policy<IECorePython::CastToIntrusivePtr>()
+			)
+			.def( "setExtrapolation", &setExtrapolation )
+			.def( "getExtrapolation", &Animation::CurvePlug::getExtrapolation )
+			.def(
+				"getExtrapolationKey",
+				(Animation::Key *(Animation::CurvePlug::*)( Animation::Direction ))&Animation::CurvePlug::getExtrapolationKey,
+				return_value_policy<IECorePython::CastToIntrusivePtr>() )
+			.def( "evaluate", (float (Animation::CurvePlug::*)( float ) const)&Animation::CurvePlug::evaluate )
+			.def( "evaluate", &evaluateTimes<Animation::CurvePlug> )
+			.def( "baked", &baked )
+		;
+		curvePlugScope.attr( "__qualname__" ) = "Animation.CurvePlug";
+
+		IECorePython::RefCountedClass<Animation::CurvePlug::Baked, IECore::RefCounted>( "Baked" )
+			.def( "startTime", &Animation::CurvePlug::Baked::startTime )
+			.def( "endTime", &Animation::CurvePlug::Baked::endTime )
+			.def( "samples", &bakedSamples )
+			.def( "evaluate", (float (Animation::CurvePlug::Baked::*)( float ) const)&Animation::CurvePlug::Baked::evaluate )
+			.def( "evaluate", &evaluateTimes<Animation::CurvePlug::Baked> )
+			.attr( "__qualname__" ) = "Animation.CurvePlug.Baked"
+		;
+	}
 
 	SignalClass< Animation::CurvePlug::CurvePlugKeySignal,
 		DefaultSignalCaller< Animation::CurvePlug::CurvePlugKeySignal >, CurvePlugKeySlotCaller >( "CurvePlugKeySignal" );
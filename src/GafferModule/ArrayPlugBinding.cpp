@@ -106,6 +106,11 @@ class ArrayPlugSerialiser : public PlugSerialiser
 
 	public :
 
+		const std::type_info &binaryPostHierarchyType() const override
+		{
+			return typeid( ArrayPlugSerialiser );
+		}
+
 		bool childNeedsConstruction( const Gaffer::GraphComponent *child, const Serialisation &serialisation ) const override
 		{
 			// We'll call `resize()` in our `postConstructor()` to create all
@@ -64,6 +64,11 @@ void removeInputWrapper( Collect &c, Gaffer::ValuePlug &p )
 class CollectSerialiser : public NodeSerialiser
 {
 
+	const std::type_info &binaryPostHierarchyType() const override
+	{
+		return typeid( CollectSerialiser );
+	}
+
 	std::string postConstructor( const Gaffer::GraphComponent *graphComponent, const std::string &identifier, Serialisation &serialisation ) const override
 	{
 		std::string result = NodeSerialiser::postConstructor( graphComponent, identifier, serialisation );
@@ -92,6 +92,11 @@ class CompoundNumericPlugSerialiser : public ValuePlugSerialiser
 
 	public :
 
+		const std::type_info &binaryPostHierarchyType() const override
+		{
+			return typeid( CompoundNumericPlugSerialiser );
+		}
+
 		std::string constructor( const Gaffer::GraphComponent *graphComponent, Serialisation &serialisation ) const override
 		{
 			return serialisationRepr( static_cast<const T *>( graphComponent ), &serialisation );
@@ -90,6 +90,11 @@ ContextPtr inPlugContext( const ContextProcessor &n )
 class SetupBasedNodeSerialiser : public NodeSerialiser
 {
 
+	const std::type_info &binaryPostHierarchyType() const override
+	{
+		return typeid( SetupBasedNodeSerialiser );
+	}
+
 	bool childNeedsConstruction( const Gaffer::GraphComponent *child, const Serialisation &serialisation ) const override
 	{
 		const Node *node = child->parent<Node>();
@@ -173,6 +178,11 @@ const ValuePlugPtr valuePlugFromQueryPlug( Gaffer::ContextQuery &q, const NameVa
 
 class ContextQuerySerialiser : public NodeSerialiser
 {
+	const std::type_info &binaryPostHierarchyType() const override
+	{
+		return typeid( ContextQuerySerialiser );
+	}
+
 	std::string postConstructor( const GraphComponent* component, const std::string& identifier, Serialisation& serialisation ) const override
 	{
 		std::string result = NodeSerialiser::postConstructor( component, identifier, serialisation );
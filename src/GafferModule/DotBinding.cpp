@@ -61,6 +61,11 @@ void setup( Dot &dot, const Plug &plug )
 class DotSerialiser : public NodeSerialiser
 {
 
+	const std::type_info &binaryPostHierarchyType() const override
+	{
+		return typeid( DotSerialiser );
+	}
+
 	bool childNeedsConstruction( const Gaffer::GraphComponent *child, const Serialisation &serialisation ) const override
 	{
 		const Dot *dot = child->parent<Dot>();
@@ -355,12 +355,17 @@ tuple languages()
 class ExpressionSerialiser : public NodeSerialiser
 {
 
+	const std::type_info &binaryPostHierarchyType() const override
+	{
+		return typeid( ExpressionSerialiser );
+	}
+
 	void moduleDependencies( const Gaffer::GraphComponent *graphComponent, std::set<std::string> &modules, const Serialisation &serialisation ) const override
 	{
 		const Expression *e = static_cast<const Expression *>( graphComponent );
 		std::string language;
 		e->getExpression( language );
-		if( !language.empty() && language != "python" )
+		if( !language.empty() && language != "python" && language != "native" )
 		{
 			/// \todo Consider a virtual method on the Engine
 			/// to provide this information.
@@ -49,6 +49,7 @@
 #include "DotBinding.h"
 #include "ExpressionBinding.h"
 #include "GraphComponentBinding.h"
+#include "MemoryPressureGovernorBinding.h"
 #include "ProcessMessageHandlerBinding.h"
 #include "MetadataAlgoBinding.h"
 #include "MetadataBinding.h"
@@ -275,6 +276,7 @@ BOOST_PYTHON_MODULE( _Gaffer )
 	bindTweakPlugs();
 	bindOptionalValuePlug();
 	bindCollect();
+	bindMemoryPressureGovernor();
 
 	NodeClass<Backdrop>();
 	DependencyNodeClass<PatternMatch>();
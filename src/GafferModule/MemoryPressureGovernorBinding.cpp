@@ -0,0 +1,213 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2025, Cinesite VFX Ltd. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//      * Redistributions of source code must retain the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer.
+//
+//      * Redistributions in binary form must reproduce the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer in the documentation and/or other materials provided with
+//        the distribution.
+//
+//      * Neither the name of John Haddon nor the names of
+//        any other contributors to this software may be used to endorse or
+//        promote products derived from this software without specific prior
+//        written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//////////////////////////////////////////////////////////////////////////
+
+#include "boost/python.hpp"
+
+#include "MemoryPressureGovernorBinding.h"
+
+#include "Gaffer/MemoryPressureGovernor.h"
+
+#include "IECorePython/RefCountedBinding.h"
+#include "IECorePython/ScopedGILRelease.h"
+
+#include "fmt/format.h"
+
+using namespace boost::python;
+using namespace Gaffer;
+
+namespace
+{
+
+std::string statusRepr( const MemoryPressureGovernor::Status &status )
+{
+	return fmt::format(
+		"Gaffer.MemoryPressureGovernor.Status( used = {}, limit = {} )",
+		status.used, status.limit
+	);
+}
+
+MemoryPressureGovernor::Status *statusConstructor( size_t used, size_t limit )
+{
+	auto result = new MemoryPressureGovernor::Status;
+	result->used = used;
+	result->limit = limit;
+	return result;
+}
+
+object read( const MemoryPressureGovernor::Source &source )
+{
+	MemoryPressureGovernor::Status status;
+	if( !source.read( status ) )
+	{
+		return object();
+	}
+	return object( status );
+}
+
+MemoryPressureGovernor::SourcePtr cgroupSource( const std::string &directory )
+{
+	return MemoryPressureGovernor::cgroupSource( directory );
+}
+
+MemoryPressureGovernor::SourcePtr memInfoSource( const std::string &file )
+{
+	return MemoryPressureGovernor::memInfoSource( file );
+}
+
+class MemoryPressureGovernorWrapper : public MemoryPressureGovernor
+{
+
+	public :
+
+		MemoryPressureGovernorWrapper( const SourcePtr &source, float targetUsage, float minimumScale, std::chrono::milliseconds interval )
+			:	MemoryPressureGovernor( source, targetUsage, minimumScale, interval )
+		{
+		}
+
+		~MemoryPressureGovernorWrapper() override
+		{
+			// We are typically destroyed when Python releases the last
+			// reference, in which case we hold the GIL. The update thread
+			// may need the GIL to output messages, so we must release it
+			// before waiting for the thread to finish.
+			if( Py_IsInitialized() && PyGILState_Check() )
+			{
+				IECorePython::ScopedGILRelease gilRelease;
+				stopUpdates();
+			}
+			else
+			{
+				stopUpdates();
+			}
+		}
+
+};
+
+MemoryPressureGovernorPtr constructor( object source, float targetUsage, float minimumScale, int interval )
+{
+	MemoryPressureGovernor::SourcePtr s = source.is_none() ? MemoryPressureGovernor::defaultSource() : extract<MemoryPressureGovernor::SourcePtr>( source )();
+	return new MemoryPressureGovernorWrapper( s, targetUsage, minimumScale, std::chrono::milliseconds( interval ) );
+}
+
+MemoryPressureGovernor::SourcePtr source( const MemoryPressureGovernor &governor )
+{
+	return const_cast<MemoryPressureGovernor::Source *>( governor.source() );
+}
+
+int interval( const MemoryPressureGovernor &governor )
+{
+	return governor.interval().count();
+}
+
+float update( MemoryPressureGovernor &governor )
+{
+	IECorePython::ScopedGILRelease gilRelease;
+	return governor.update();
+}
+
+void setInstance( object governor )
+{
+	MemoryPressureGovernorPtr g = governor.is_none() ? nullptr : extract<MemoryPressureGovernorPtr>( governor )();
+	// Replacing the instance waits for its update thread.
+	IECorePython::ScopedGILRelease gilRelease;
+	MemoryPressureGovernor::setInstance( g );
+}
+
+MemoryPressureGovernorPtr getInstance()
+{
+	return MemoryPressureGovernor::getInstance();
+}
+
+list registeredCaches()
+{
+	list result;
+	for( const auto &name : MemoryPressureGovernor::registeredCaches() )
+	{
+		result.append( name );
+	}
+	return result;
+}
+
+} // namespace
+
+void GafferModule::bindMemoryPressureGovernor()
+{
+	scope s = IECorePython::RefCountedClass<MemoryPressureGovernor, IECore::RefCounted>( "MemoryPressureGovernor" )
+		.def(
+			"__init__",
+			make_constructor(
+				constructor, default_call_policies(),
+				(
+					arg( "source" ) = object(),
+					arg( "targetUsage" ) = 0.9f,
+					arg( "minimumScale" ) = 0.1f,
+					arg( "interval" ) = 1000
+				)
+			)
+		)
+		.def( "source", &source )
+		.def( "targetUsage", &MemoryPressureGovernor::targetUsage )
+		.def( "minimumScale", &MemoryPressureGovernor::minimumScale )
+		.def( "interval", &interval )
+		.def( "update", &update )
+		.def( "scale", &MemoryPressureGovernor::scale )
+		.def( "cgroupSource", &cgroupSource, ( arg( "directory" ) = "/sys/fs/cgroup" ) )
+		.staticmethod( "cgroupSource" )
+		.def( "memInfoSource", &memInfoSource, ( arg( "file" ) = "/proc/meminfo" ) )
+		.staticmethod( "memInfoSource" )
+		.def( "defaultSource", &MemoryPressureGovernor::defaultSource )
+		.staticmethod( "defaultSource" )
+		.def( "setInstance", &setInstance )
+		.staticmethod( "setInstance" )
+		.def( "getInstance", &getInstance )
+		.staticmethod( "getInstance" )
+		.def( "registeredCaches", &registeredCaches )
+		.staticmethod( "registeredCaches" )
+	;
+
+	class_<MemoryPressureGovernor::Status>( "Status", no_init )
+		.def( "__init__", make_constructor( &statusConstructor, default_call_policies(), ( arg( "used" ) = 0, arg( "limit" ) = 0 ) ) )
+		.def_readwrite( "used", &MemoryPressureGovernor::Status::used )
+		.def_readwrite( "limit", &MemoryPressureGovernor::Status::limit )
+		.def( "__repr__", &statusRepr )
+	;
+
+	IECorePython::RefCountedClass<MemoryPressureGovernor::Source, IECore::RefCounted>( "Source" )
+		.def( "read", &read )
+		.def( "description", &MemoryPressureGovernor::Source::description )
+		.attr( "__qualname__" ) = "MemoryPressureGovernor.Source"
+	;
+}
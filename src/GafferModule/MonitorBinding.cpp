@@ -44,7 +44,9 @@
 #include "Gaffer/Node.h"
 #include "Gaffer/PerformanceMonitor.h"
 #include "Gaffer/Plug.h"
+#include "Gaffer/SamplingMonitor.h"
 #include "Gaffer/ThreadMonitor.h"
+#include "Gaffer/TraceMonitor.h"
 #include "Gaffer/VTuneMonitor.h"
 
 #include "IECorePython/RefCountedBinding.h"
@@ -99,6 +101,52 @@ void setComputeDuration( PerformanceMonitor::Statistics &s, boost::chrono::nanos
 	s.computeDuration = boost::chrono::nanoseconds( v );
 }
 
+void histogramAddSample( PerformanceMonitor::Histogram &h, boost::chrono::nanoseconds::rep duration )
+{
+	h.addSample( boost::chrono::nanoseconds( duration ) );
+}
+
+boost::chrono::nanoseconds::rep histogramMax( const PerformanceMonitor::Histogram &h )
+{
+	return h.max().count();
+}
+
+boost::chrono::nanoseconds::rep histogramPercentile( const PerformanceMonitor::Histogram &h, float p )
+{
+	return h.percentile( p ).count();
+}
+
+PlugPtr slowProcessPlug( const PerformanceMonitor::SlowProcess &p )
+{
+	return boost::const_pointer_cast<Plug>( p.plug );
+}
+
+std::string slowProcessType( const PerformanceMonitor::SlowProcess &p )
+{
+	return p.type.string();
+}
+
+ContextPtr slowProcessContext( const PerformanceMonitor::SlowProcess &p )
+{
+	// Return a copy, so that the recorded context can't be modified.
+	return new Context( *p.context );
+}
+
+boost::chrono::nanoseconds::rep slowProcessDuration( const PerformanceMonitor::SlowProcess &p )
+{
+	return p.duration.count();
+}
+
+list slowestProcesses( const PerformanceMonitor &m )
+{
+	list result;
+	for( const auto &p : m.slowestProcesses() )
+	{
+		result.append( p );
+	}
+	return result;
+}
+
 template<typename T>
 dict allStatistics( T &m )
 {
@@ -150,6 +198,12 @@ void annotateWrapper3( Node &root, const ContextMonitor &monitor, bool persisten
 	MonitorAlgo::annotate( root, monitor, persistent );
 }
 
+void annotateWrapper4( Node &root, const SamplingMonitor &monitor, bool persistent )
+{
+	IECorePython::ScopedGILRelease gilRelease;
+	MonitorAlgo::annotate( root, monitor, persistent );
+}
+
 void removePerformanceAnnotationsWrapper( Node &root )
 {
 	IECorePython::ScopedGILRelease gilRelease;
@@ -199,6 +253,43 @@ dict threadMonitorCombinedStatisticsWrapper( const ThreadMonitor &monitor )
 	return processesPerThreadToPython( monitor.combinedStatistics() );
 }
 
+std::string samplingStatisticsRepr( const SamplingMonitor::Statistics &s )
+{
+	return fmt::format(
+		"Gaffer.SamplingMonitor.Statistics( inclusiveSamples = {}, exclusiveSamples = {} )",
+		s.inclusiveSamples, s.exclusiveSamples
+	);
+}
+
+SamplingMonitor::Ptr samplingMonitorConstructor( int interval )
+{
+	return new SamplingMonitor( std::chrono::microseconds( interval ) );
+}
+
+int samplingMonitorInterval( const SamplingMonitor &monitor )
+{
+	return monitor.interval().count();
+}
+
+void writeFlameGraphWrapper( const SamplingMonitor &monitor, const std::string &fileName )
+{
+	IECorePython::ScopedGILRelease gilRelease;
+	monitor.writeFlameGraph( fileName );
+}
+
+TraceMonitor::Ptr traceMonitorConstructor( boost::python::object pythonProcessMask, size_t maxEventsPerThread )
+{
+	std::vector<IECore::InternedString> processMask;
+	container_utils::extend_container( processMask, pythonProcessMask );
+	return new TraceMonitor( processMask, maxEventsPerThread );
+}
+
+void writeChromeTraceWrapper( const TraceMonitor &monitor, const std::string &fileName )
+{
+	IECorePython::ScopedGILRelease gilRelease;
+	monitor.writeChromeTrace( fileName );
+}
+
 } // namespace
 
 void GafferModule::bindMonitor()
@@ -240,6 +331,17 @@ void GafferModule::bindMonitor()
 			)
 		);
 
+		def(
+			"formatDistributions",
+			&formatDistributions,
+			(
+				arg( "monitor" ),
+				arg( "maxLines" ) = 50
+			)
+		);
+
+		def( "formatSlowestProcesses", &formatSlowestProcesses, arg( "monitor" ) );
+
 		def(
 			"annotate",
 			&annotateWrapper1,
@@ -258,6 +360,12 @@ void GafferModule::bindMonitor()
 			( arg( "node" ), arg( "monitor" ), arg( "persistent" ) = true )
 		);
 
+		def(
+			"annotate",
+			&annotateWrapper4,
+			( arg( "node" ), arg( "monitor" ), arg( "persistent" ) = true )
+		);
+
 		def( "removePerformanceAnnotations", &removePerformanceAnnotationsWrapper, arg( "root" ) );
 		def( "removeContextAnnotations", &removeContextAnnotationsWrapper, arg( "root" ) );
 	}
@@ -271,10 +379,28 @@ void GafferModule::bindMonitor()
 
 	{
 		scope s = IECorePython::RefCountedClass<PerformanceMonitor, Monitor>( "PerformanceMonitor" )
-			.def( init<>() )
+			.def( init<size_t>( ( arg( "maxSlowProcesses" ) = 0 ) ) )
 			.def( "allStatistics", &allStatistics<PerformanceMonitor> )
 			.def( "plugStatistics", &PerformanceMonitor::plugStatistics, return_value_policy<copy_const_reference>() )
 			.def( "combinedStatistics", &PerformanceMonitor::combinedStatistics, return_value_policy<copy_const_reference>() )
+			.def( "maxSlowProcesses", &PerformanceMonitor::maxSlowProcesses )
+			.def( "slowestProcesses", &slowestProcesses )
+		;
+
+		class_<PerformanceMonitor::Histogram>( "Histogram" )
+			.def( "addSample", &histogramAddSample )
+			.def( "count", &PerformanceMonitor::Histogram::count )
+			.def( "max", &histogramMax )
+			.def( "percentile", &histogramPercentile )
+			.def( self == self )
+			.def( self != self )
+		;
+
+		class_<PerformanceMonitor::SlowProcess>( "SlowProcess", no_init )
+			.add_property( "plug", &slowProcessPlug )
+			.add_property( "type", &slowProcessType )
+			.add_property( "context", &slowProcessContext )
+			.add_property( "duration", &slowProcessDuration )
 		;
 
 		class_<PerformanceMonitor::Statistics>( "Statistics" )
@@ -291,6 +417,8 @@ void GafferModule::bindMonitor()
 			.def_readwrite( "computeCount", &PerformanceMonitor::Statistics::computeCount )
 			.add_property( "hashDuration", &getHashDuration, &setHashDuration )
 			.add_property( "computeDuration", &getComputeDuration, &setComputeDuration )
+			.def_readwrite( "hashHistogram", &PerformanceMonitor::Statistics::hashHistogram )
+			.def_readwrite( "computeHistogram", &PerformanceMonitor::Statistics::computeHistogram )
 			.def( self == self )
 			.def( self != self )
 			.def( "__repr__", &repr )
@@ -332,6 +460,50 @@ void GafferModule::bindMonitor()
 		;
 	}
 
+	{
+		scope s = IECorePython::RefCountedClass<SamplingMonitor, Monitor>( "SamplingMonitor" )
+			.def(
+				"__init__",
+				make_constructor(
+					samplingMonitorConstructor, default_call_policies(),
+					arg( "interval" ) = 1000
+				)
+			)
+			.def( "interval", &samplingMonitorInterval )
+			.def( "allStatistics", &allStatistics<SamplingMonitor> )
+			.def( "plugStatistics", &SamplingMonitor::plugStatistics )
+			.def( "numSamples", &SamplingMonitor::numSamples )
+			.def( "writeFlameGraph", &writeFlameGraphWrapper )
+		;
+
+		class_<SamplingMonitor::Statistics>( "Statistics", init<size_t, size_t>( ( arg( "inclusiveSamples" ) = 0, arg( "exclusiveSamples" ) = 0 ) ) )
+			.def_readwrite( "inclusiveSamples", &SamplingMonitor::Statistics::inclusiveSamples )
+			.def_readwrite( "exclusiveSamples", &SamplingMonitor::Statistics::exclusiveSamples )
+			.def( self == self )
+			.def( self != self )
+			.def( "__repr__", &samplingStatisticsRepr )
+		;
+	}
+
+	{
+		IECorePython::RefCountedClass<TraceMonitor, Monitor>( "TraceMonitor" )
+			.def(
+				"__init__",
+				make_constructor(
+					traceMonitorConstructor, default_call_policies(),
+					(
+						arg( "processMask" ) = boost::python::tuple(),
+						arg( "maxEventsPerThread" ) = 250000
+					)
+				)
+			)
+			.def( "numEvents", &TraceMonitor::numEvents )
+			.def( "numDroppedEvents", &TraceMonitor::numDroppedEvents )
+			.def( "writeChromeTrace", &writeChromeTraceWrapper )
+			.def( "clear", &TraceMonitor::clear )
+		;
+	}
+
 #ifdef GAFFER_VTUNE
 	{
 		scope s = IECorePython::RefCountedClass<VTuneMonitor, Monitor>( "VTuneMonitor" )
@@ -57,6 +57,11 @@ class NameValuePlugSerialiser : public ValuePlugSerialiser
 
 	public :
 
+		const std::type_info &binaryPostHierarchyType() const override
+		{
+			return typeid( NameValuePlugSerialiser );
+		}
+
 		bool childNeedsConstruction( const Gaffer::GraphComponent *child, const Serialisation &serialisation ) const override
 		{
 			// The children will be created by the constructor output by repr
@@ -58,6 +58,11 @@ class OptionalValuePlugSerialiser : public ValuePlugSerialiser
 
 	public :
 
+		const std::type_info &binaryPostHierarchyType() const override
+		{
+			return typeid( OptionalValuePlugSerialiser );
+		}
+
 		bool childNeedsConstruction( const Gaffer::GraphComponent *child, const Serialisation &serialisation ) const override
 		{
 			// The children will be created by the constructor
@@ -83,7 +83,7 @@ std::shared_ptr<boost::python::object> withGILAcquireDeleter( const boost::pytho
 	);
 }
 
-std::shared_ptr<BackgroundTask> backgroundTaskConstructor( const Plug *subject, object f )
+std::shared_ptr<BackgroundTask> backgroundTaskConstructor( const Plug *subject, object f, ParallelAlgo::Priority priority )
 {
 	auto fPtr = withGILAcquireDeleter( f );
 	auto backgroundTask = std::make_unique<BackgroundTask>(
@@ -98,7 +98,8 @@ std::shared_ptr<BackgroundTask> backgroundTaskConstructor( const Plug *subject,
 			{
 				IECorePython::ExceptionAlgo::translatePythonException();
 			}
-		}
+		},
+		priority
 	);
 
 	return withGILReleaseDeleter( backgroundTask );
@@ -222,7 +223,7 @@ void popUIThreadCallHandler()
 	ParallelAlgo::popUIThreadCallHandler();
 }
 
-std::shared_ptr<BackgroundTask> callOnBackgroundThread( const Plug *subject, boost::python::object f )
+std::shared_ptr<BackgroundTask> callOnBackgroundThread( const Plug *subject, boost::python::object f, ParallelAlgo::Priority priority )
 {
 	// The BackgroundTask we return will own the python function we
 	// pass to it. Wrap the function so that the GIL is acquired
@@ -241,20 +242,42 @@ std::shared_ptr<BackgroundTask> callOnBackgroundThread( const Plug *subject, boo
 			{
 				IECorePython::ExceptionAlgo::translatePythonException();
 			}
-		}
+		},
+		priority
 	);
 
 	return withGILReleaseDeleter( backgroundTask );
 }
 
+void setNUMANodes( size_t numNodes )
+{
+	// Replacing the arenas may wait for their workers.
+	IECorePython::ScopedGILRelease gilRelease;
+	ParallelAlgo::setNUMANodes( numNodes );
+}
+
 } // namespace
 
 void GafferModule::bindParallelAlgo()
 {
 
+	object module( borrowed( PyImport_AddModule( "Gaffer.ParallelAlgo" ) ) );
+	scope().attr( "ParallelAlgo" ) = module;
+
+	{
+		// Bound first, so that it is available as a default
+		// argument for the BackgroundTask constructor.
+		scope moduleScope( module );
+		enum_<ParallelAlgo::Priority>( "Priority" )
+			.value( "Interactive", ParallelAlgo::Priority::Interactive )
+			.value( "Normal", ParallelAlgo::Priority::Normal )
+			.value( "Background", ParallelAlgo::Priority::Background )
+		;
+	}
+
 	{
 		scope s = class_<BackgroundTask, boost::noncopyable>( "BackgroundTask", no_init )
-			.def( "__init__", make_constructor( &backgroundTaskConstructor, default_call_policies() ) )
+			.def( "__init__", make_constructor( &backgroundTaskConstructor, default_call_policies(), ( arg( "subject" ), arg( "function" ), arg( "priority" ) = ParallelAlgo::Priority::Normal ) ) )
 			.def( "cancel", &backgroundTaskCancel )
 			.def( "wait", &backgroundTaskWait )
 			.def( "waitFor", &backgroundTaskWaitFor )
@@ -273,14 +296,29 @@ void GafferModule::bindParallelAlgo()
 
 	register_ptr_to_python<std::shared_ptr<BackgroundTask>>();
 
-	object module( borrowed( PyImport_AddModule( "Gaffer.ParallelAlgo" ) ) );
-	scope().attr( "ParallelAlgo" ) = module;
 	scope moduleScope( module );
 
 	def( "callOnUIThread", &callOnUIThread );
 	def( "pushUIThreadCallHandler", &pushUIThreadCallHandler );
 	def( "popUIThreadCallHandler", &popUIThreadCallHandler );
 	def( "canCallOnUIThread", &ParallelAlgo::canCallOnUIThread );
-	def( "callOnBackgroundThread", &callOnBackgroundThread );
+	def( "callOnBackgroundThread", &callOnBackgroundThread, ( arg( "subject" ), arg( "function" ), arg( "priority" ) = ParallelAlgo::Priority::Normal ) );
+
+	def( "setThreadBudget", &ParallelAlgo::setThreadBudget );
+	def( "getThreadBudget", &ParallelAlgo::getThreadBudget );
+
+	class_<ParallelAlgo::QueueStatistics>( "QueueStatistics" )
+		.def_readonly( "numTasks", &ParallelAlgo::QueueStatistics::numTasks )
+		.def_readonly( "numPending", &ParallelAlgo::QueueStatistics::numPending )
+		.def_readonly( "totalLatency", &ParallelAlgo::QueueStatistics::totalLatency )
+		.def_readonly( "maxLatency", &ParallelAlgo::QueueStatistics::maxLatency )
+	;
+
+	def( "queueStatistics", &ParallelAlgo::queueStatistics );
+	def( "resetQueueStatistics", &ParallelAlgo::resetQueueStatistics );
+
+	def( "setNUMANodes", &setNUMANodes );
+	def( "getNUMANodes", &ParallelAlgo::getNUMANodes );
+	def( "currentNUMANode", &ParallelAlgo::currentNUMANode );
 
 }
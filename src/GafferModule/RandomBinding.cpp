@@ -66,6 +66,11 @@ void setupWrapper( RandomChoice &r, const Gaffer::ValuePlug &p )
 class RandomChoiceSerialiser : public NodeSerialiser
 {
 
+	const std::type_info &binaryPostHierarchyType() const override
+	{
+		return typeid( RandomChoiceSerialiser );
+	}
+
 	bool childNeedsConstruction( const Gaffer::GraphComponent *child, const Serialisation &serialisation ) const override
 	{
 		const RandomChoice *node = child->parent<RandomChoice>();
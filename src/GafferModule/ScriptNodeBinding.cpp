@@ -182,7 +182,7 @@ boost::python::object executionDict( ScriptNodePtr script, NodePtr parent )
 	return std::move( result );
 }
 
-std::string serialise( const Node *parent, const Set *filter )
+std::string serialise( const Node *parent, const Set *filter, bool binary, IECore::RefCountedPtr *cache )
 {
 	if( !Py_IsInitialized() )
 	{
@@ -207,7 +207,24 @@ std::string serialise( const Node *parent, const Set *filter )
 	std::string result;
 	try
 	{
-		Serialisation serialisation( parent, "parent", filter );
+		Serialisation::FragmentCache *fragmentCache = nullptr;
+		if( cache )
+		{
+			if( !*cache )
+			{
+				const ScriptNode *script = IECore::runTimeCast<const ScriptNode>( parent );
+				*cache = new Serialisation::FragmentCache(
+					[script] ( const GraphComponent *child ) {
+						const Node *node = IECore::runTimeCast<const Node>( child );
+						return node ? script->editCount( node ) : 0;
+					}
+				);
+			}
+			// Safe because we are the only code that creates the cache.
+			fragmentCache = static_cast<Serialisation::FragmentCache *>( cache->get() );
+		}
+
+		Serialisation serialisation( parent, "parent", filter, binary ? Serialisation::Format::Binary : Serialisation::Format::Python, fragmentCache );
 		result = serialisation.result();
 	}
 	catch( boost::python::error_already_set & )
@@ -277,30 +294,40 @@ bool execute( ScriptNode *script, const std::string &serialisation, Node *parent
 		Py_Initialize();
 	}
 
-	const std::string toExecute = replaceImath( serialisation );
-
 	IECorePython::ScopedGILLock gilLock;
 	bool result = false;
 	try
 	{
 		boost::python::object e = executionDict( script, parent );
 
-		if( !continueOnError )
-		{
-			try
+		auto executePython = [&e, continueOnError, &context] ( const std::string &toExecute ) {
+			if( !continueOnError )
 			{
-				exec( toExecute.c_str(), e, e );
+				try
+				{
+					exec( toExecute.c_str(), e, e );
+				}
+				catch( boost::python::error_already_set & )
+				{
+					int lineNumber = 0;
+					std::string message = IECorePython::ExceptionAlgo::formatPythonException( /* withTraceback = */ false, &lineNumber );
+					throw IECore::Exception( formattedErrorContext( lineNumber, context ) + " : " + message );
+				}
+				return false;
 			}
-			catch( boost::python::error_already_set & )
+			else
 			{
-				int lineNumber = 0;
-				std::string message = IECorePython::ExceptionAlgo::formatPythonException( /* withTraceback = */ false, &lineNumber );
-				throw IECore::Exception( formattedErrorContext( lineNumber, context ) + " : " + message );
+				return tolerantExec( toExecute, e, e, context );
 			}
+		};
+
+		if( Serialisation::isBinary( serialisation ) )
+		{
+			result = Serialisation::executeBinary( serialisation, parent, e, executePython, continueOnError, context );
 		}
 		else
 		{
-			result = tolerantExec( toExecute, e, e, context );
+			result = executePython( replaceImath( serialisation ) );
 		}
 	}
 	catch( boost::python::error_already_set & )
@@ -525,6 +552,7 @@ void GafferModule::bindScriptNode()
 		.def( "isExecuting", &ScriptNode::isExecuting )
 		.def( "serialise", &ScriptNode::serialise, ( boost::python::arg( "parent" ) = boost::python::object(), boost::python::arg( "filter" ) = boost::python::object() ) )
 		.def( "serialiseToFile", &ScriptNode::serialiseToFile, ( boost::python::arg( "fileName" ), boost::python::arg( "parent" ) = boost::python::object(), boost::python::arg( "filter" ) = boost::python::object() ) )
+		.def( "editCount", &ScriptNode::editCount )
 		.def( "save", &save )
 		.def( "load", &load, ( boost::python::arg( "continueOnError" ) = false ) )
 		.def( "importFile", &importFile, ( boost::python::arg( "fileName" ), boost::python::arg( "parent" ) = boost::python::object(), boost::python::arg( "continueOnError" ) = false ) )
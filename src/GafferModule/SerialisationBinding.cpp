@@ -84,27 +84,112 @@ IECore::ObjectPtr objectFromBase64Wrapper( const std::string &base64String )
 	return Serialisation::objectFromBase64( base64String );
 }
 
+object result( const Serialisation &serialisation )
+{
+	const std::string r = serialisation.result();
+	if( serialisation.format() == Serialisation::Format::Binary )
+	{
+		return object( handle<>( PyBytes_FromStringAndSize( r.data(), r.size() ) ) );
+	}
+	return object( r );
+}
+
+bool isBinary( object serialisation )
+{
+	extract<std::string> stringExtractor( serialisation );
+	if( stringExtractor.check() )
+	{
+		return Serialisation::isBinary( stringExtractor() );
+	}
+	char *bytes; Py_ssize_t size;
+	if( PyBytes_AsStringAndSize( serialisation.ptr(), &bytes, &size ) == -1 )
+	{
+		throw_error_already_set();
+	}
+	return Serialisation::isBinary( std::string( bytes, size ) );
+}
+
+// Provides access to `Serialisation::LoadStatistics` as a Python context
+// manager, so that statistics can be collected from `ScriptNode.load()`.
+class LoadStatisticsWrapper
+{
+
+	public :
+
+		void enter()
+		{
+			m_scope = std::make_unique<Serialisation::LoadStatistics::Scope>( &m_statistics );
+		}
+
+		void exit( object type, object value, object traceBack )
+		{
+			m_scope.reset();
+		}
+
+		dict entries() const
+		{
+			dict result;
+			for( const auto &[typeName, entry] : m_statistics.entries )
+			{
+				dict e;
+				e["nativeOperations"] = entry.nativeOperations;
+				e["pythonFragments"] = entry.pythonFragments;
+				e["nativeTime"] = std::chrono::duration<double>( entry.nativeTime ).count();
+				e["pythonTime"] = std::chrono::duration<double>( entry.pythonTime ).count();
+				result[typeName] = e;
+			}
+			return result;
+		}
+
+	private :
+
+		Serialisation::LoadStatistics m_statistics;
+		std::unique_ptr<Serialisation::LoadStatistics::Scope> m_scope;
+
+};
+
+object loadStatisticsEnter( object self )
+{
+	LoadStatisticsWrapper &w = extract<LoadStatisticsWrapper &>( self );
+	w.enter();
+	return self;
+}
+
 } // namespace
 
 void GafferModule::bindSerialisation()
 {
 
-	scope s = boost::python::class_<Serialisation, boost::noncopyable>( "Serialisation", no_init )
+	boost::python::class_<Serialisation, boost::noncopyable> serialisationClass( "Serialisation", no_init );
+	scope s = serialisationClass;
+
+	// Must be bound before the constructor, as it provides the default
+	// value for the `format` argument.
+	enum_<Serialisation::Format>( "Format" )
+		.value( "Python", Serialisation::Format::Python )
+		.value( "Binary", Serialisation::Format::Binary )
+	;
+
+	serialisationClass
 		.def(
-			init<const Gaffer::GraphComponent *, const std::string &, const Gaffer::Set *>
+			init<const Gaffer::GraphComponent *, const std::string &, const Gaffer::Set *, Serialisation::Format>
 			(
 				(
 					arg( "parent" ),
 					arg( "parentName" ) = "parent",
-					arg( "filter" ) = object()
+					arg( "filter" ) = object(),
+					arg( "format" ) = Serialisation::Format::Python
 				)
 			)
 		)
 		.def( "parent", &parent )
+		.def( "format", &Serialisation::format )
 		.def( "identifier", &Serialisation::identifier )
 		.def( "childIdentifier", &childIdentifier )
 		.def( "addModule", &Serialisation::addModule )
-		.def( "result", &Serialisation::result )
+		.def( "result", &result )
+		.def( "isBinary", &isBinary )
+		.staticmethod( "isBinary" )
 		.def( "modulePath", (std::string (*)( const object & ))&Serialisation::modulePath )
 		.staticmethod( "modulePath" )
 		.def( "classPath", (std::string (*)( const object & ))&Serialisation::classPath )
@@ -119,6 +204,12 @@ void GafferModule::bindSerialisation()
 		.staticmethod( "acquireSerialiser" )
 	;
 
+	class_<LoadStatisticsWrapper, boost::noncopyable>( "LoadStatistics" )
+		.def( "__enter__", &loadStatisticsEnter )
+		.def( "__exit__", &LoadStatisticsWrapper::exit )
+		.def( "entries", &LoadStatisticsWrapper::entries )
+	;
+
 	SerialiserClass<Serialisation::Serialiser, IECore::RefCounted, SerialiserWrapper<Serialisation::Serialiser>>( "Serialiser" );
 
 }
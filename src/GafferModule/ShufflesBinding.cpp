@@ -84,6 +84,11 @@ class ShufflePlugSerialiser : public ValuePlugSerialiser
 {
 	public :
 
+		const std::type_info &binaryPostHierarchyType() const override
+		{
+			return typeid( ShufflePlugSerialiser );
+		}
+
 		bool childNeedsConstruction( const Gaffer::GraphComponent *child, const Serialisation &serialisation ) const override
 		{
 			return false;
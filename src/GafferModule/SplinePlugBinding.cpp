@@ -140,6 +140,11 @@ class SplinePlugSerialiser : public ValuePlugSerialiser
 
 	public :
 
+		const std::type_info &binaryPostHierarchyType() const override
+		{
+			return typeid( SplinePlugSerialiser );
+		}
+
 		std::string postConstructor( const Gaffer::GraphComponent *plug, const std::string &identifier, Serialisation &serialisation ) const override
 		{
 			std::string result = ValuePlugSerialiser::postConstructor( plug, identifier, serialisation );
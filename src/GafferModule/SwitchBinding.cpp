@@ -71,6 +71,11 @@ PlugPtr activeInPlug( Switch &s, const Plug *plug )
 class SwitchSerialiser : public NodeSerialiser
 {
 
+	const std::type_info &binaryPostHierarchyType() const override
+	{
+		return typeid( SwitchSerialiser );
+	}
+
 	bool childNeedsConstruction( const Gaffer::GraphComponent *child, const Serialisation &serialisation ) const override
 	{
 		const Switch *sw = child->parent<Switch>();
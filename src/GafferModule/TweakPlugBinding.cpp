@@ -72,6 +72,11 @@ bool applyTweaksToParameters( const TweaksPlug &tweaksPlug, IECore::CompoundData
 
 class TweakPlugSerialiser : public ValuePlugSerialiser
 {
+	const std::type_info &binaryPostHierarchyType() const override
+	{
+		return typeid( TweakPlugSerialiser );
+	}
+
 	bool childNeedsConstruction( const Gaffer::GraphComponent *child, const Serialisation &serialisation ) const override
 	{
 		return false;
@@ -133,6 +133,18 @@ void GafferModule::bindValuePlug()
 		.staticmethod( "cacheMemoryUsage" )
 		.def( "clearCache", &ValuePlug::clearCache )
 		.staticmethod( "clearCache" )
+		.def( "setPersistentCacheDirectory", &ValuePlug::setPersistentCacheDirectory )
+		.staticmethod( "setPersistentCacheDirectory" )
+		.def( "getPersistentCacheDirectory", &ValuePlug::getPersistentCacheDirectory, return_value_policy<copy_const_reference>() )
+		.staticmethod( "getPersistentCacheDirectory" )
+		.def( "setPersistentCacheSizeLimit", &ValuePlug::setPersistentCacheSizeLimit )
+		.staticmethod( "setPersistentCacheSizeLimit" )
+		.def( "getPersistentCacheSizeLimit", &ValuePlug::getPersistentCacheSizeLimit )
+		.staticmethod( "getPersistentCacheSizeLimit" )
+		.def( "persistentCacheUsage", &ValuePlug::persistentCacheUsage )
+		.staticmethod( "persistentCacheUsage" )
+		.def( "clearPersistentCache", &ValuePlug::clearPersistentCache )
+		.staticmethod( "clearPersistentCache" )
 		.def( "getHashCacheSizeLimit", &ValuePlug::getHashCacheSizeLimit )
 		.staticmethod( "getHashCacheSizeLimit" )
 		.def( "setHashCacheSizeLimit", &ValuePlug::setHashCacheSizeLimit )
@@ -145,10 +157,22 @@ void GafferModule::bindValuePlug()
 		.staticmethod( "getHashCacheMode" )
 		.def( "setHashCacheMode", &ValuePlug::setHashCacheMode )
 		.staticmethod( "setHashCacheMode" )
+		.def( "setFrameInvariantHashCacheEnabled", &ValuePlug::setFrameInvariantHashCacheEnabled )
+		.staticmethod( "setFrameInvariantHashCacheEnabled" )
+		.def( "getFrameInvariantHashCacheEnabled", &ValuePlug::getFrameInvariantHashCacheEnabled )
+		.staticmethod( "getFrameInvariantHashCacheEnabled" )
+		.def( "frameInvariantHashCacheStatistics", &ValuePlug::frameInvariantHashCacheStatistics )
+		.staticmethod( "frameInvariantHashCacheStatistics" )
 		.def( "dirtyCount", &ValuePlug::dirtyCount )
 		.def( "__repr__", &repr )
 	;
 
+	class_<ValuePlug::FrameInvariantHashCacheStatistics>( "FrameInvariantHashCacheStatistics" )
+		.def_readonly( "hits", &ValuePlug::FrameInvariantHashCacheStatistics::hits )
+		.def_readonly( "misses", &ValuePlug::FrameInvariantHashCacheStatistics::misses )
+		.def_readonly( "entries", &ValuePlug::FrameInvariantHashCacheStatistics::entries )
+	;
+
 	enum_<ValuePlug::HashCacheMode>( "HashCacheMode" )
 		.value( "Standard", ValuePlug::HashCacheMode::Standard )
 		.value( "Checked", ValuePlug::HashCacheMode::Checked )
@@ -162,6 +186,7 @@ void GafferModule::bindValuePlug()
 		.value( "TaskIsolation", ValuePlug::CachePolicy::TaskIsolation )
 		.value( "Default", ValuePlug::CachePolicy::Default )
 		.value( "Legacy", ValuePlug::CachePolicy::Legacy )
+		.value( "Persistent", ValuePlug::CachePolicy::Persistent )
 	;
 
 	Serialisation::registerSerialiser( Gaffer::ValuePlug::staticTypeId(), new ValuePlugSerialiser );
@@ -39,6 +39,7 @@
 #include "GafferOSL/OSLShader.h"
 
 #include "Gaffer/Context.h"
+#include "Gaffer/MemoryPressureGovernor.h"
 
 #include "IECoreScene/ShaderNetworkAlgo.h"
 
@@ -874,6 +875,26 @@ OSL::ShadingSystem *shadingSystem( int *batchSize = nullptr )
 	// Compensate.
 	g_textureSystem->attribute( "flip_t", 1 );
 
+	// Allow the texture cache to be reduced under memory pressure.
+	Gaffer::MemoryPressureGovernor::registerCache(
+		"GafferOSL:textureCache",
+		{
+			[] {
+				float megabytes = 0;
+				g_textureSystem->getattribute( "max_memory_MB", megabytes );
+				return (size_t)( megabytes * 1024.0 * 1024.0 );
+			},
+			[] ( size_t bytes ) {
+				g_textureSystem->attribute( "max_memory_MB", (float)( bytes / ( 1024.0 * 1024.0 ) ) );
+			},
+			[] {
+				long long bytes = 0;
+				g_textureSystem->getattribute( "stat:cache_memory_used", OIIO::TypeDesc::INT64, &bytes );
+				return (size_t)bytes;
+			}
+		}
+	);
+
 	g_shadingSystem = new ShadingSystem(
 		new RendererServices( g_textureSystem ),
 		g_textureSystem
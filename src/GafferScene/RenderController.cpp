@@ -1597,7 +1597,9 @@ std::shared_ptr<Gaffer::BackgroundTask> RenderController::updateInBackground( co
 				updateInternal( callback, &priorityPaths, /* signalCompletion = */ false );
 			}
 			updateInternal( callback );
-		}
+		},
+		// The user is waiting to see the results.
+		ParallelAlgo::Priority::Interactive
 	);
 
 	return m_backgroundTask;
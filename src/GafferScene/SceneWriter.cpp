@@ -44,7 +44,10 @@
 
 #include "IECoreScene/SceneInterface.h"
 
+#include "tbb/parallel_for.h"
+
 #include <filesystem>
+#include <memory>
 #include <unordered_map>
 
 using namespace std;
@@ -68,16 +71,21 @@ struct LocationData
 	{
 		if( setsForTags )
 		{
-			const CompoundDataMap &setsMap = setsForTags->readable();
-			m_tags.reserve( setsMap.size() );
+			addTags( setsForTags );
+		}
+	}
+
+	void addTags( const CompoundData *setsForTags )
+	{
+		const CompoundDataMap &setsMap = setsForTags->readable();
+		m_tags.reserve( setsMap.size() );
 
-			for( const auto &[name, data] : setsMap )
+		for( const auto &[name, data] : setsMap )
+		{
+			auto pathMatcher = static_cast<const PathMatcherData *>( data.get() );
+			if( pathMatcher->readable().match( m_path ) & IECore::PathMatcher::ExactMatch )
 			{
-				auto pathMatcher = static_cast<const PathMatcherData *>( data.get() );
-				if( pathMatcher->readable().match( path ) & IECore::PathMatcher::ExactMatch )
-				{
-					m_tags.push_back( name );
-				}
+				m_tags.push_back( name );
 			}
 		}
 	}
@@ -206,6 +214,41 @@ IECore::MurmurHash SceneWriter::hash( const Gaffer::Context *context ) const
 	return h;
 }
 
+void SceneWriter::outputFileNames( const Gaffer::Context *context, std::vector<std::string> &fileNames ) const
+{
+	Context::Scope scope( context );
+	const std::string fileName = fileNamePlug()->getValue();
+	if( !fileName.empty() )
+	{
+		fileNames.push_back( fileName );
+	}
+}
+
+IECore::MurmurHash SceneWriter::outputHash( const Gaffer::Context *context ) const
+{
+	// We can't use `hash()` because it includes the address of the
+	// input scene, which is different in every process.
+	Context::Scope scope( context );
+	const ScenePlug *scenePlug = inPlug()->source<ScenePlug>();
+	if ( ( fileNamePlug()->getValue() == "" ) || ( scenePlug == inPlug() ) )
+	{
+		return IECore::MurmurHash();
+	}
+
+	IECore::MurmurHash h = TaskNode::hash( context );
+	h.append( fileNamePlug()->hash() );
+	h.append( SceneAlgo::hierarchyHash( inPlug(), ScenePlug::ScenePath() ) );
+
+	ConstInternedStringVectorDataPtr setNamesData = inPlug()->setNames();
+	for( const auto &setName : setNamesData->readable() )
+	{
+		h.append( setName );
+		h.append( inPlug()->setHash( setName ) );
+	}
+
+	return h;
+}
+
 void SceneWriter::execute() const
 {
 	std::vector<float> frame( 1, Context::current()->getFrame() );
@@ -220,6 +263,12 @@ void SceneWriter::executeSequence( const std::vector<float> &frames ) const
 		throw IECore::Exception( "No input scene" );
 	}
 
+	if( frames.size() > 1 && concurrentFrames() > 1 )
+	{
+		executeConcurrentFrames( frames );
+		return;
+	}
+
 	SceneInterfacePtr output;
 	Context::EditableScope scope( Context::current() );
 
@@ -274,11 +323,100 @@ void SceneWriter::executeSequence( const std::vector<float> &frames ) const
 	}
 }
 
+void SceneWriter::executeConcurrentFrames( const std::vector<float> &frames ) const
+{
+	const ScenePlug *scene = inPlug()->getInput<ScenePlug>();
+
+	// The state of the file being written. This is only accessed from the
+	// ordered functors, which are called serially.
+	SceneInterfacePtr output;
+
+	executeFrames(
+		frames,
+		[&] () -> std::function<void ()> {
+
+			// Gather the scene for this frame. This may be done for several
+			// frames concurrently, and uses memory proportional to the size
+			// of the scene.
+
+			const std::string fileName = fileNamePlug()->getValue();
+
+			auto locations = std::make_shared<std::vector<LocationData>>();
+			SceneAlgo::parallelGatherLocations(
+				scene,
+				[&] ( const ScenePlug *scene, const ScenePlug::ScenePath &path ) {
+					return LocationData( scene, path, nullptr );
+				},
+				[&] ( LocationData &locationData ) {
+					locations->push_back( std::move( locationData ) );
+				}
+			);
+
+			ConstCompoundObjectPtr globals = scene->globals();
+
+			// Write the frame. This is done serially and in frame order,
+			// because SceneInterfaces are neither thread-safe for writing
+			// nor able to write samples out of order.
+
+			return [this, &output, scene, fileName, locations, globals] {
+
+				ConstCompoundDataPtr sets;
+				bool useSetsAPI = true;
+				if( !output || output->fileName() != fileName )
+				{
+					createDirectories( fileName );
+					output = SceneInterface::create( fileName, IndexedIO::Write );
+					sets = SceneAlgo::sets( scene );
+					useSetsAPI = SceneReader::useSetsAPI( output.get() );
+				}
+
+				if( !useSetsAPI && sets )
+				{
+					tbb::parallel_for(
+						tbb::blocked_range<size_t>( 0, locations->size() ),
+						[&] ( const tbb::blocked_range<size_t> &range ) {
+							for( size_t i = range.begin(); i != range.end(); ++i )
+							{
+								(*locations)[i].addTags( sets.get() );
+							}
+						}
+					);
+				}
+
+				const float time = Context::current()->getTime();
+				for( const auto &locationData : *locations )
+				{
+					locationData.write( output.get(), time );
+				}
+
+				if( useSetsAPI && sets )
+				{
+					for( const auto &[name, data] : sets->readable() )
+					{
+						output->writeSet( name, static_cast<const PathMatcherData *>( data.get() )->readable() );
+					}
+				}
+
+				if( !globals->members().empty() )
+				{
+					output->writeAttribute( "gaffer:globals", globals.get(), time );
+				}
+
+			};
+		}
+	);
+}
+
 bool SceneWriter::requiresSequenceExecution() const
 {
 	return true;
 }
 
+bool SceneWriter::supportsConcurrentFrames() const
+{
+	return true;
+}
+
 void SceneWriter::createDirectories( const std::string &fileName ) const
 {
 	const std::filesystem::path filePath( fileName );
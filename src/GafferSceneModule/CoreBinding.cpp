@@ -340,6 +340,11 @@ std::string pathToStringWrapper( const ScenePlug::ScenePath &scenePath )
 class SceneProcessorSerialiser : public NodeSerialiser
 {
 
+	const std::type_info &binaryPostHierarchyType() const override
+	{
+		return typeid( SceneProcessorSerialiser );
+	}
+
 	bool childNeedsSerialisation( const Gaffer::GraphComponent *child, const Serialisation &serialisation ) const override
 	{
 		const auto sceneProcessor = static_cast<const SceneProcessor *>( child->parent() );
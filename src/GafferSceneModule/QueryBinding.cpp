@@ -82,6 +82,11 @@ void setup( GafferScene::AttributeQuery& query, const Gaffer::ValuePlug& plug )
 
 class AttributeQuerySerialiser : public GafferBindings::NodeSerialiser
 {
+	const std::type_info &binaryPostHierarchyType() const override
+	{
+		return typeid( AttributeQuerySerialiser );
+	}
+
 	std::string postConstructor( const Gaffer::GraphComponent* component, const std::string& identifier, GafferBindings::Serialisation& serialisation ) const override
 	{
 		std::string result = GafferBindings::NodeSerialiser::postConstructor( component, identifier, serialisation );
@@ -147,6 +152,11 @@ const NameValuePlugPtr queryPlug( const T &q, const ValuePlug &p )
 template<typename T>
 class MultiQuerySerialiser : public NodeSerialiser
 {
+	const std::type_info &binaryPostHierarchyType() const override
+	{
+		return typeid( MultiQuerySerialiser );
+	}
+
 	std::string postConstructor( const GraphComponent* component, const std::string& identifier, Serialisation& serialisation ) const override
 	{
 		std::string result = NodeSerialiser::postConstructor( component, identifier, serialisation );
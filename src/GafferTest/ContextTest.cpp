@@ -301,6 +301,49 @@ void GafferTest::testContextHashPerformance( int numEntries, int entrySize, bool
 
 }
 
+double GafferTest::testContextScopePerformance( int numLocations )
+{
+	// Emulate the context manipulation performed during a typical
+	// scene traversal, where a base context holding a handful of
+	// variables is edited to set the location, and then again to
+	// evaluate a neighbouring frame for motion blur.
+
+	ContextPtr baseContext = new Context();
+	for( int i = 0; i < 10; i++ )
+	{
+		baseContext->set( InternedString( i ), std::string( 10, 'x') );
+	}
+
+	const InternedString scenePathName( "scene:path" );
+	Context::Scope baseScope( baseContext.get() );
+	const ThreadState &threadState = ThreadState::current();
+
+	Timer t;
+	tbb::parallel_for(
+		tbb::blocked_range<int>( 0, numLocations ),
+		[&threadState, &scenePathName]( const tbb::blocked_range<int> &r )
+		{
+			vector<InternedString> path = { "world", "group", "" };
+			for( int i = r.begin(); i != r.end(); ++i )
+			{
+				path.back() = InternedString( i % 1000 );
+
+				Context::EditableScope locationScope( threadState );
+				locationScope.set( scenePathName, &path );
+				const MurmurHash locationHash = locationScope.context()->hash();
+
+				Context::EditableScope frameScope( locationScope.context() );
+				frameScope.setFrame( locationScope.context()->getFrame() + 0.5f );
+				GAFFERTEST_ASSERT( frameScope.context()->hash() != locationHash );
+			}
+		}
+	);
+
+	// Report nanoseconds per scope, so that results are comparable
+	// regardless of `numLocations`.
+	return t.stop() * 1e9 / ( numLocations * 2.0 );
+}
+
 void GafferTest::testContextCopyPerformance( int numEntries, int entrySize )
 {
 	// We usually deal with contexts that already have some stuff in them, so adding some entries
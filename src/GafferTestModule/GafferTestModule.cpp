@@ -41,6 +41,7 @@
 #include "GafferTest/ContextTest.h"
 #include "GafferTest/DownstreamIteratorTest.h"
 #include "GafferTest/FilteredRecursiveChildIteratorTest.h"
+#include "GafferTest/GraphComponentTest.h"
 #include "GafferTest/MultiplyNode.h"
 #include "GafferTest/RandomTest.h"
 #include "GafferTest/RecursiveChildIteratorTest.h"
@@ -50,7 +51,9 @@
 #include "ValuePlugTest.h"
 #include "MessagesTest.h"
 #include "MetadataTest.h"
+#include "PersistentCacheTest.h"
 #include "ProcessTest.h"
+#include "SerialisationTest.h"
 #include "SignalsTest.h"
 
 #include "IECorePython/ScopedGILRelease.h"
@@ -78,6 +81,18 @@ static boost::python::tuple countContextHash32CollisionsWrapper( int entries, in
 	return boost::python::make_tuple( std::get<0>(result), std::get<1>(result), std::get<2>(result), std::get<3>(result) );
 }
 
+static double testContextScopePerformanceWrapper( int numLocations )
+{
+	IECorePython::ScopedGILRelease gilRelease;
+	return testContextScopePerformance( numLocations );
+}
+
+static void testDescendantPerformanceWrapper( const Gaffer::GraphComponent *root, int numLookups )
+{
+	IECorePython::ScopedGILRelease gilRelease;
+	testDescendantPerformance( root, numLookups );
+}
+
 static float asFloat32( const float value )
 {
 	return value;
@@ -106,11 +121,13 @@ BOOST_PYTHON_MODULE( _GafferTest )
 	def( "countContextHash32Collisions", &countContextHash32CollisionsWrapper );
 	def( "testContextHashPerformance", &testContextHashPerformance );
 	def( "testContextCopyPerformance", &testContextCopyPerformance );
+	def( "testContextScopePerformance", &testContextScopePerformanceWrapper );
 	def( "testCopyEditableScope", &testCopyEditableScope );
 	def( "testContextHashValidation", &testContextHashValidation );
 	def( "testComputeNodeThreading", &testComputeNodeThreading );
 	def( "testDownstreamIterator", &testDownstreamIterator );
 	def( "testRandomPerf", &testRandomPerf );
+	def( "testDescendantPerformance", &testDescendantPerformanceWrapper );
 
 	bindTaskMutexTest();
 	bindLRUCacheTest();
@@ -118,6 +135,8 @@ BOOST_PYTHON_MODULE( _GafferTest )
 	bindMessagesTest();
 	bindSignalsTest();
 	bindProcessTest();
+	bindPersistentCacheTest();
+	bindSerialisationTest();
 
 	object module( borrowed( PyImport_AddModule( "GafferTest._MetadataTest" ) ) );
 	scope().attr( "_MetadataTest" ) = module;
@@ -46,12 +46,30 @@
 
 #include "tbb/parallel_for.h"
 
+#include <type_traits>
+
 using namespace IECorePreview;
 using namespace boost::python;
 
 namespace
 {
 
+// Returns the number of bins per hardware thread used by `Policy`, so that
+// tests can choose keys which are guaranteed to share a bin.
+template<template<typename> class Policy>
+size_t binsPerThread()
+{
+	using Cache = LRUCache<int, int, Policy>;
+	if constexpr( std::is_same_v<Policy<Cache>, LRUCachePolicy::Sharded<Cache>> )
+	{
+		return Policy<Cache>::binsPerThread;
+	}
+	else
+	{
+		return 1;
+	}
+}
+
 // Nasty template jiggery-pokery that allows us to dispatch the same
 // test code for difference LRUCache policies.
 template<template<template<typename> class> class F>
@@ -79,6 +97,14 @@ struct DispatchTest
 		{
 			F<LRUCachePolicy::TaskParallel> f( std::forward<Args>( args )... ); f();
 		}
+		else if( policy == "sharded" )
+		{
+			F<LRUCachePolicy::Sharded> f( std::forward<Args>( args )... ); f();
+		}
+		else if( policy == "greedyDual" )
+		{
+			F<LRUCachePolicy::GreedyDual> f( std::forward<Args>( args )... ); f();
+		}
 		else
 		{
 			GAFFERTEST_ASSERT( false );
@@ -680,7 +706,7 @@ struct TestLRUCacheUncacheableItem
 						cost = std::numeric_limits<size_t>::max();
 						// Recursive call to cache, with new key chosen to require
 						// the same bin as this key.
-						return cache->get( key + std::thread::hardware_concurrency() );
+						return cache->get( key + std::thread::hardware_concurrency() * binsPerThread<Policy>() );
 					}
 					else
 					{
@@ -800,6 +826,151 @@ void testLRUCacheSetIfUncached( const std::string &policy )
 	DispatchTest<TestLRUCacheSetIfUncached>()( policy );
 }
 
+// Benchmark for comparing the scalability of the different policies.
+// Performs a fixed mix of gets and sets from `numThreads` threads,
+// where a `numThreads` of 0 uses all available threads.
+template<template<typename> class Policy>
+struct TestLRUCacheGetSetMix
+{
+
+	TestLRUCacheGetSetMix( int numThreads, int numIterations, int numValues, int maxCost )
+		:	m_numThreads( numThreads ), m_numIterations( numIterations ), m_numValues( numValues ), m_maxCost( maxCost )
+	{
+	}
+
+	void operator()()
+	{
+		using Cache = LRUCache<int, int, Policy>;
+		Cache cache(
+			[]( int key, size_t &cost, const IECore::Canceller *canceller ) { cost = 1; return key; },
+			m_maxCost
+		);
+
+		tbb::task_arena arena( m_numThreads ? m_numThreads : tbb::task_arena::automatic );
+		arena.execute(
+			[&] {
+				tbb::parallel_for(
+					tbb::blocked_range<size_t>( 0, m_numIterations ),
+					[&]( const tbb::blocked_range<size_t> &r ) {
+						for( size_t i = r.begin(); i != r.end(); ++i )
+						{
+							// Scramble the index so that consecutive iterations
+							// don't visit consecutive keys.
+							const int k = ( i * 2654435761u ) % m_numValues;
+							if( i % 10 == 0 )
+							{
+								cache.set( k, k, 1 );
+							}
+							else
+							{
+								GAFFERTEST_ASSERTEQUAL( cache.get( k ), k );
+							}
+						}
+					}
+				);
+			}
+		);
+	}
+
+	private :
+
+		const int m_numThreads;
+		const int m_numIterations;
+		const int m_numValues;
+		const int m_maxCost;
+
+};
+
+void testLRUCacheGetSetMix( const std::string &policy, int numThreads, int numIterations, int numValues, int maxCost )
+{
+	GAFFERTEST_ASSERT( policy != "serial" || numThreads == 1 ); // Serial policy is not threadsafe.
+	DispatchTest<TestLRUCacheGetSetMix>()( policy, numThreads, numIterations, numValues, maxCost );
+}
+
+struct TraceAccess
+{
+	int key;
+	size_t cost;
+	float computeTime;
+};
+
+struct TraceReplayResult
+{
+	size_t hits = 0;
+	size_t misses = 0;
+	double recomputeTime = 0;
+};
+
+template<template<typename> class Policy>
+struct TestLRUCacheTraceReplay
+{
+
+	TestLRUCacheTraceReplay( const std::vector<TraceAccess> &trace, size_t maxCost, TraceReplayResult &result )
+		:	m_trace( trace ), m_maxCost( maxCost ), m_result( result )
+	{
+	}
+
+	void operator()()
+	{
+		using Cache = IECorePreview::LRUCache<int, int, Policy>;
+
+		// We never expect the getter to be called, because we
+		// simulate the compute ourselves using `set()`.
+		Cache cache(
+			[]( int key, size_t &cost, const IECore::Canceller *canceller ) {
+				GAFFERTEST_ASSERT( false );
+				cost = 1;
+				return key;
+			},
+			m_maxCost
+		);
+
+		// Replay serially so that the results are deterministic,
+		// and are a measure of eviction decisions alone.
+		for( const auto &access : m_trace )
+		{
+			if( auto v = cache.getIfCached( access.key ) )
+			{
+				GAFFERTEST_ASSERTEQUAL( *v, access.key );
+				m_result.hits++;
+			}
+			else
+			{
+				cache.set( access.key, access.key, access.cost, access.computeTime );
+				m_result.misses++;
+				m_result.recomputeTime += access.computeTime;
+			}
+		}
+	}
+
+	private :
+
+		const std::vector<TraceAccess> &m_trace;
+		const size_t m_maxCost;
+		TraceReplayResult &m_result;
+
+};
+
+// Replays a trace of `( key, cost, computeTime )` tuples against a cache,
+// returning `( hits, misses, recomputeTime )`. This is used to compare the
+// effectiveness of the different eviction policies for a given workload.
+boost::python::tuple testLRUCacheTraceReplay( const std::string &policy, const boost::python::list &pythonTrace, size_t maxCost )
+{
+	std::vector<TraceAccess> trace;
+	const size_t traceLength = boost::python::len( pythonTrace );
+	trace.reserve( traceLength );
+	for( size_t i = 0; i < traceLength; ++i )
+	{
+		boost::python::tuple t = extract<boost::python::tuple>( pythonTrace[i] );
+		trace.push_back( { extract<int>( t[0] ), extract<size_t>( t[1] ), extract<float>( t[2] ) } );
+	}
+
+	TraceReplayResult result;
+	DispatchTest<TestLRUCacheTraceReplay>()( policy, trace, maxCost, result );
+
+	return boost::python::make_tuple( result.hits, result.misses, result.recomputeTime );
+}
+
 } // namespace
 
 void GafferTestModule::bindLRUCacheTest()
@@ -815,4 +986,6 @@ void GafferTestModule::bindLRUCacheTest()
 	def( "testLRUCacheUncacheableItem", &testLRUCacheUncacheableItem );
 	def( "testLRUCacheGetIfCached", &testLRUCacheGetIfCached );
 	def( "testLRUCacheSetIfUncached", &testLRUCacheSetIfUncached );
+	def( "testLRUCacheGetSetMix", &testLRUCacheGetSetMix, ( arg( "policy" ), arg( "numThreads" ), arg( "numIterations" ), arg( "numValues" ), arg( "maxCost" ) ) );
+	def( "testLRUCacheTraceReplay", &testLRUCacheTraceReplay, ( arg( "policy" ), arg( "trace" ), arg( "maxCost" ) ) );
 }
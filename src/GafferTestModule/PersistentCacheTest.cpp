@@ -0,0 +1,110 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2025, Cinesite VFX Ltd. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//      * Redistributions of source code must retain the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer.
+//
+//      * Redistributions in binary form must reproduce the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer in the documentation and/or other materials provided with
+//        the distribution.
+//
+//      * Neither the name of John Haddon nor the names of
+//        any other contributors to this software may be used to endorse or
+//        promote products derived from this software without specific prior
+//        written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//////////////////////////////////////////////////////////////////////////
+#include "boost/python.hpp"
+
+#include "PersistentCacheTest.h"
+
+#include "GafferTest/Assert.h"
+
+#include "Gaffer/Private/PersistentCache.h"
+
+#include "IECore/SimpleTypedData.h"
+
+#include <thread>
+
+using namespace boost::python;
+using namespace IECore;
+using namespace Gaffer::Private;
+
+namespace
+{
+
+MurmurHash testKey( int i )
+{
+	MurmurHash h;
+	h.append( "testPersistentCacheClear" );
+	h.append( i );
+	return h;
+}
+
+// Simulates two processes sharing a directory, one of which clears it while
+// the other still has the old segments indexed.
+void testPersistentCacheClear( const std::string &directory )
+{
+	PersistentCache cache1;
+	cache1.setDirectory( directory );
+	for( int i = 0; i < 10; ++i )
+	{
+		IntDataPtr value = new IntData( i );
+		GAFFERTEST_ASSERT( cache1.set( testKey( i ), value.get() ) );
+	}
+
+	PersistentCache cache2;
+	cache2.setDirectory( directory );
+	for( int i = 0; i < 10; ++i )
+	{
+		ConstIntDataPtr value = runTimeCast<const IntData>( cache2.get( testKey( i ) ) );
+		GAFFERTEST_ASSERT( value );
+		GAFFERTEST_ASSERTEQUAL( value->readable(), i );
+	}
+
+	// Clear and append a record large enough to overlap all the old ones,
+	// so that `cache2` would misread it if it were appended to a segment
+	// with a reused index.
+
+	cache1.clear();
+	StringDataPtr newValue = new StringData( std::string( 10000, 'x' ) );
+	GAFFERTEST_ASSERT( cache1.set( testKey( 10 ), newValue.get() ) );
+
+	// Wait for `cache2` to be due a refresh, which is rate-limited.
+	std::this_thread::sleep_for( std::chrono::milliseconds( 1100 ) );
+
+	ConstStringDataPtr value = runTimeCast<const StringData>( cache2.get( testKey( 10 ) ) );
+	GAFFERTEST_ASSERT( value );
+	GAFFERTEST_ASSERT( value->readable() == newValue->readable() );
+
+	for( int i = 0; i < 10; ++i )
+	{
+		GAFFERTEST_ASSERT( !cache2.get( testKey( i ) ) );
+	}
+}
+
+} // namespace
+
+void GafferTestModule::bindPersistentCacheTest()
+{
+	def( "testPersistentCacheClear", &testPersistentCacheClear );
+}
@@ -105,16 +105,26 @@ void evaluateCurve( const Animation::CurvePlug* const curvePlug,
 	const double fract = std::modf( std::abs( tEnd - tStart ) / unitPerPx, & count );
 	const int steps = static_cast< int >( count ) + ( ( fract == 0.0 ) ? 0 : 1 );
 
+	// NOTE : evaluate all times in a single batch, which is much quicker than evaluating them individually.
+	std::vector< float > times;
+	times.reserve( steps + 1 );
 	if( vertices.empty() )
-		vertices.push_back( viewportGadget->worldToRasterSpace( V3f( tStart, curvePlug->evaluate( tStart ), 0 ) ) );
+		times.push_back( tStart );
 
 	for( int i = 1; i < steps; ++i )
 	{
-		const double time = tStart + static_cast< double >( i ) * unitPerPx * sign;
-		vertices.push_back( viewportGadget->worldToRasterSpace( V3f( time, curvePlug->evaluate( time ), 0 ) ) );
+		times.push_back( tStart + static_cast< double >( i ) * unitPerPx * sign );
 	}
 
-	vertices.push_back( viewportGadget->worldToRasterSpace( V3f( tEnd, curvePlug->evaluate( tEnd ), 0 ) ) );
+	times.push_back( tEnd );
+
+	std::vector< float > values( times.size() );
+	curvePlug->evaluate( times, values );
+
+	for( size_t i = 0; i < times.size(); ++i )
+	{
+		vertices.push_back( viewportGadget->worldToRasterSpace( V3f( times[ i ], values[ i ], 0 ) ) );
+	}
 }
 
 /// Aliases that define the intended use of each
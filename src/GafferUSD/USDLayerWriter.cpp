@@ -45,6 +45,7 @@
 #include "Gaffer/ContextQuery.h"
 #include "Gaffer/NameSwitch.h"
 #include "Gaffer/NameValuePlug.h"
+#include "Gaffer/ThreadState.h"
 
 #include "IECoreScene/SceneInterface.h"
 
@@ -56,8 +57,10 @@ IECORE_POP_DEFAULT_VISIBILITY
 
 #include "boost/filesystem.hpp"
 
+#include "tbb/parallel_for.h"
 #include "tbb/parallel_reduce.h"
 
+#include <array>
 #include <filesystem>
 
 using namespace std;
@@ -492,6 +495,11 @@ bool USDLayerWriter::requiresSequenceExecution() const
 	return true;
 }
 
+bool USDLayerWriter::supportsConcurrentFrames() const
+{
+	return true;
+}
+
 void USDLayerWriter::execute() const
 {
 	std::vector<float> frame( 1, Context::current()->getFrame() );
@@ -542,10 +550,35 @@ void USDLayerWriter::executeSequence( const std::vector<float> &frames ) const
 
 	const string baseFileName = ( tempDirectory / "base.usdc" ).generic_string();
 	const string layerFileName = ( tempDirectory / "layer.usdc" ).generic_string();
-	for( const auto &fileName : { baseFileName, layerFileName } )
+	const int concurrency = static_cast<int>( concurrentFrames() );
+	if( concurrency > 1 )
+	{
+		// Pass our concurrency on to the internal SceneWriter, and write
+		// the base and layer concurrently too, since they are independent.
+		context.set( "taskNode:concurrentFrames", &concurrency );
+		const ThreadState &threadState = ThreadState::current();
+		const std::array<const string *, 2> fileNames = { &baseFileName, &layerFileName };
+		tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
+		tbb::parallel_for(
+			tbb::blocked_range<size_t>( 0, fileNames.size(), 1 ),
+			[&] ( const tbb::blocked_range<size_t> &range ) {
+				for( size_t i = range.begin(); i != range.end(); ++i )
+				{
+					Context::EditableScope fileNameScope( threadState );
+					fileNameScope.set( "usdLayerWriter:fileName", fileNames[i] );
+					sceneWriter()->taskPlug()->executeSequence( frames );
+				}
+			},
+			taskGroupContext
+		);
+	}
+	else
 	{
-		context.set( "usdLayerWriter:fileName", &fileName );
-		sceneWriter()->taskPlug()->executeSequence( frames );
+		for( const auto &fileName : { baseFileName, layerFileName } )
+		{
+			context.set( "usdLayerWriter:fileName", &fileName );
+			sceneWriter()->taskPlug()->executeSequence( frames );
+		}
 	}
 
 	// Load the temporary USD files, and process `layer` in place so that it
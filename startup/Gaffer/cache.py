@@ -34,6 +34,7 @@
 #
 ##########################################################################
 
+import os
 import psutil
 
 import Gaffer
@@ -44,3 +45,19 @@ import Gaffer
 Gaffer.ValuePlug.setCacheMemoryLimit(
 	min( 1024**3 * 8, psutil.virtual_memory().total * 3 // 4 )
 )
+
+# Enable the persistent cache if requested. This allows expensive
+# results to be shared between processes, and is particularly useful
+# when many short-lived processes are run on the same farm node.
+
+if os.environ.get( "GAFFER_PERSISTENT_CACHE_DIRECTORY" ) :
+	Gaffer.ValuePlug.setPersistentCacheDirectory( os.environ["GAFFER_PERSISTENT_CACHE_DIRECTORY"] )
+	if os.environ.get( "GAFFER_PERSISTENT_CACHE_SIZE" ) :
+		Gaffer.ValuePlug.setPersistentCacheSizeLimit( int( os.environ["GAFFER_PERSISTENT_CACHE_SIZE"] ) * 1024**3 )
+
+# Enable dynamic adjustment of cache limits in response to memory pressure
+# if requested. This is particularly useful on shared farm nodes, where the
+# memory available to a process changes as other jobs start and finish.
+
+if os.environ.get( "GAFFER_MEMORY_PRESSURE_GOVERNOR", "0" ) != "0" :
+	Gaffer.MemoryPressureGovernor.setInstance( Gaffer.MemoryPressureGovernor() )
@@ -130,6 +130,25 @@ def __clearCaches( menu ) :
 	Gaffer.ValuePlug.clearCache()
 	Gaffer.ValuePlug.clearHashCache()
 
+def __printQueueLatency( menu ) :
+
+	lines = []
+	for name, priority in Gaffer.ParallelAlgo.Priority.names.items() :
+		statistics = Gaffer.ParallelAlgo.queueStatistics( priority )
+		lines.append(
+			"{} : {} tasks, {} pending, {:.3f}s average latency, {:.3f}s max latency".format(
+				name, statistics.numTasks, statistics.numPending,
+				statistics.totalLatency / statistics.numTasks if statistics.numTasks else 0,
+				statistics.maxLatency
+			)
+		)
+
+	IECore.msg( IECore.Msg.Level.Info, "Background Task Queue Latency", "\n".join( lines ) )
+
+def __resetQueueLatency( menu ) :
+
+	Gaffer.ParallelAlgo.resetQueueStatistics()
+
 def __profilingSubMenu( menu ) :
 
 	result = IECore.MenuDefinition()
@@ -217,6 +236,21 @@ def __profilingSubMenu( menu ) :
 		}
 	)
 
+	# Background task queues
+
+	result.append(
+		"/Background Task Latency/Print",
+		{
+			"command" : __printQueueLatency,
+		}
+	)
+	result.append(
+		"/Background Task Latency/Reset",
+		{
+			"command" : __resetQueueLatency,
+		}
+	)
+
 	result.append(
 		"/CacheDivider", { "divider" : True },
 	)
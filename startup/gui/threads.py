@@ -0,0 +1,95 @@
+##########################################################################
+#
+#  Copyright (c) 2025, Cinesite VFX Ltd. All rights reserved.
+#
+#  Redistribution and use in source and binary forms, with or without
+#  modification, are permitted provided that the following conditions are
+#  met:
+#
+#      * Redistributions of source code must retain the above
+#        copyright notice, this list of conditions and the following
+#        disclaimer.
+#
+#      * Redistributions in binary form must reproduce the above
+#        copyright notice, this list of conditions and the following
+#        disclaimer in the documentation and/or other materials provided with
+#        the distribution.
+#
+#      * Neither the name of John Haddon nor the names of
+#        any other contributors to this software may be used to endorse or
+#        promote products derived from this software without specific prior
+#        written permission.
+#
+#  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+#  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+#  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+#  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+#  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+#  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+#  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+#  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+#  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+#  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+#  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+##########################################################################
+
+
+import Gaffer
+
+# Add plugs to the preferences node, to allow the thread budgets for each
+# class of background task to be configured.
+
+preferences = application.root()["preferences"]
+preferences["threads"] = Gaffer.Plug()
+preferences["threads"]["interactive"] = Gaffer.IntPlug( defaultValue = 0, minValue = 0 )
+preferences["threads"]["normal"] = Gaffer.IntPlug( defaultValue = 0, minValue = 0 )
+preferences["threads"]["background"] = Gaffer.IntPlug( defaultValue = 0, minValue = 0 )
+
+Gaffer.Metadata.registerValue( preferences["threads"], "plugValueWidget:type", "GafferUI.LayoutPlugValueWidget", persistent = False )
+Gaffer.Metadata.registerValue( preferences["threads"], "layout:section", "Threads", persistent = False )
+
+Gaffer.Metadata.registerValue(
+	preferences["threads"]["interactive"], "description",
+	"""
+	The maximum number of threads used for updates the user is waiting
+	to see, such as interactive renders and Viewer image tiles. A value
+	of 0 places no limit on the number of threads.
+	""",
+	persistent = False
+)
+
+Gaffer.Metadata.registerValue(
+	preferences["threads"]["normal"], "description",
+	"""
+	The maximum number of threads used for general background updates,
+	such as the HierarchyView. A value of 0 places no limit on the number
+	of threads.
+	""",
+	persistent = False
+)
+
+Gaffer.Metadata.registerValue(
+	preferences["threads"]["background"], "description",
+	"""
+	The maximum number of threads used for low priority work, such as
+	saving Catalogue images. A value of 0 places no limit on the number
+	of threads.
+	""",
+	persistent = False
+)
+
+__priorities = {
+	"interactive" : Gaffer.ParallelAlgo.Priority.Interactive,
+	"normal" : Gaffer.ParallelAlgo.Priority.Normal,
+	"background" : Gaffer.ParallelAlgo.Priority.Background,
+}
+
+def __plugSet( plug ) :
+
+	if not preferences["threads"].isSame( plug.parent() ) :
+		return
+
+	Gaffer.ParallelAlgo.setThreadBudget( __priorities[plug.getName()], plug.getValue() )
+
+preferences.plugSetSignal().connect( __plugSet )